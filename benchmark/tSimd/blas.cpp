@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <tSimd/aligned_allocate.hpp>
+#include <tSimd/blas.hpp>
+
+// tsimd::blas 与朴素的标量循环的比较，输出 GFLOP/s (axpy / dot 每个元素2次浮点运算，gemv 每个矩阵元素2次)
+// 库函数使用运行时选择的指令集，label 为选中的指令集
+// 比较不同的指令集时，用环境变量限制最高的指令集分别运行，例如:
+// TSIMD_MAX_ISA=sse2 ./benchmark_tsimd_blas
+// TSIMD_MAX_ISA=avx2_fma3 ./benchmark_tsimd_blas
+// 向量在 L1 / L2 中时受计算限制，远大于 LLC 时受内存带宽限制
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::blas::Layout;
+
+    using aligned_vector = std::vector<float32, tsimd::AlignedAllocator<float32>>;
+
+    void set_counters(benchmark::State& state, const double flops_per_iteration)
+    {
+        state.counters["GFLOPS"] = benchmark::Counter(flops_per_iteration * 1e-9 * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+        state.SetLabel(tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    }
+
+    void naive_axpy(const float32 alpha, const float32* x, float32* y, const size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            y[i] = alpha * x[i] + y[i];
+        }
+    }
+
+    float32 naive_dot(const float32* x, const float32* y, const size_t count)
+    {
+        float32 s = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            s += x[i] * y[i];
+        }
+        return s;
+    }
+
+    void naive_gemv(const size_t rows, const size_t cols, const float32 alpha, const float32* A, const float32* x, const float32 beta, float32* y)
+    {
+        for (size_t r = 0; r < rows; ++r)
+        {
+            float32 s = 0.0f;
+            for (size_t c = 0; c < cols; ++c)
+            {
+                s += A[r * cols + c] * x[c];
+            }
+            y[r] = alpha * s + beta * y[r];
+        }
+    }
+
+    template<typename Fn>
+    void run_axpy(benchmark::State& state, const Fn fn)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        const aligned_vector x(N, 1.0f);
+        aligned_vector y(N, 0.0f);
+
+        for (auto _ : state)
+        {
+            // alpha 很小，y 不会增长到 inf
+            fn(1e-7f, x.data(), y.data(), N);
+            benchmark::ClobberMemory();
+        }
+        set_counters(state, 2.0 * static_cast<double>(N));
+    }
+
+    template<typename Fn>
+    void run_dot(benchmark::State& state, const Fn fn)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        const aligned_vector x(N, 1.0f);
+        const aligned_vector y(N, 0.5f);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(fn(x.data(), y.data(), N));
+        }
+        set_counters(state, 2.0 * static_cast<double>(N));
+    }
+
+    // 方阵，行主序，lda = cols
+    template<typename Fn>
+    void run_gemv(benchmark::State& state, const Fn fn)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        const aligned_vector A(N * N, 0.25f);
+        const aligned_vector x(N, 1.0f);
+        aligned_vector y(N, 0.0f);
+
+        for (auto _ : state)
+        {
+            fn(N, A.data(), x.data(), y.data());
+            benchmark::ClobberMemory();
+        }
+        set_counters(state, 2.0 * static_cast<double>(N) * static_cast<double>(N));
+    }
+}
+
+static void BM_axpy_naive(benchmark::State& state)
+{
+    run_axpy(state, naive_axpy);
+}
+
+static void BM_axpy(benchmark::State& state)
+{
+    run_axpy(state, tsimd::blas::axpy);
+}
+
+static void BM_dot_naive(benchmark::State& state)
+{
+    run_dot(state, naive_dot);
+}
+
+static void BM_dot(benchmark::State& state)
+{
+    run_dot(state, tsimd::blas::dot);
+}
+
+static void BM_gemv_naive(benchmark::State& state)
+{
+    run_gemv(state, [](const size_t N, const float32* A, const float32* x, float32* y)
+    {
+        naive_gemv(N, N, 1.0f, A, x, 0.0f, y);
+    });
+}
+
+static void BM_gemv(benchmark::State& state, const Layout layout)
+{
+    run_gemv(state, [layout](const size_t N, const float32* A, const float32* x, float32* y)
+    {
+        tsimd::blas::gemv(layout, N, N, 1.0f, A, N, x, 0.0f, y);
+    });
+}
+
+// 16KB (L1) / 256KB (L2) / 64MB (内存)
+BENCHMARK(BM_axpy_naive)->Arg(1 << 11)->Arg(1 << 15)->Arg(1 << 23);
+BENCHMARK(BM_axpy)->Arg(1 << 11)->Arg(1 << 15)->Arg(1 << 23);
+BENCHMARK(BM_dot_naive)->Arg(1 << 11)->Arg(1 << 15)->Arg(1 << 23);
+BENCHMARK(BM_dot)->Arg(1 << 11)->Arg(1 << 15)->Arg(1 << 23);
+// 矩阵 64KB (L2) / 1MB / 64MB (内存)
+BENCHMARK(BM_gemv_naive)->Arg(128)->Arg(512)->Arg(4096);
+BENCHMARK_CAPTURE(BM_gemv, row_major, Layout::RowMajor)->Arg(128)->Arg(512)->Arg(4096);
+BENCHMARK_CAPTURE(BM_gemv, column_major, Layout::ColumnMajor)->Arg(128)->Arg(512)->Arg(4096);
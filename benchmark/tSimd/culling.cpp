@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <tSimd/culling.hpp>
+
+// tsimd::cull_spheres / cull_aabbs 与逐个实例提前退出的标量循环的比较，输出每秒处理的实例数
+// label 为选中的指令集，比较不同的指令集时用 TSIMD_MAX_ISA 限制，例如 TSIMD_MAX_ISA=sse2 ./benchmark_tsimd_culling
+// 参数为实例个数
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::uint32;
+
+    struct Plane
+    {
+        float32 a, b, c, d;
+    };
+
+    /**
+     * 合成场景: 相机在原点看向 -z，水平 / 垂直 fov 90°，near 0.1，far 500
+     * 实例均匀分布在边长 1000 的立方体中 (约 1/6 的实例在视锥体内)，半径 / 半边长 [0.5, 4]
+     */
+    struct Scene
+    {
+        Plane planes[6];
+        tsimd::Vec3Stream<float32> centers;
+        tsimd::Vec3Stream<float32> extents;
+        std::vector<float32> radii;
+        std::vector<uint32> visible;
+
+        explicit Scene(const size_t n)
+            : centers(n), extents(n), radii(n), visible(n)
+        {
+            const float32 k = 1.0f / std::sqrt(2.0f);
+            planes[0] = { k, 0, -k, 0 };        // left
+            planes[1] = { -k, 0, -k, 0 };       // right
+            planes[2] = { 0, k, -k, 0 };        // bottom
+            planes[3] = { 0, -k, -k, 0 };       // top
+            planes[4] = { 0, 0, -1, -0.1f };    // near
+            planes[5] = { 0, 0, 1, 500.0f };    // far
+
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float32> pos(-500.0f, 500.0f);
+            std::uniform_real_distribution<float32> size(0.5f, 4.0f);
+            for (size_t i = 0; i < n; ++i)
+            {
+                centers.set(i, { pos(rng), pos(rng), pos(rng) });
+                extents.set(i, { size(rng), size(rng), size(rng) });
+                radii[i] = size(rng);
+            }
+        }
+    };
+
+    size_t cull_spheres_scalar(const Scene& s, uint32* visible)
+    {
+        const float32* x = s.centers.component(0);
+        const float32* y = s.centers.component(1);
+        const float32* z = s.centers.component(2);
+        size_t n = 0;
+        for (size_t i = 0; i < s.centers.size(); ++i)
+        {
+            bool inside = true;
+            for (const Plane& p : s.planes)
+            {
+                if (p.a * x[i] + p.b * y[i] + p.c * z[i] + p.d + s.radii[i] < 0)
+                {
+                    inside = false;
+                    break;
+                }
+            }
+            if (inside)
+            {
+                visible[n++] = static_cast<uint32>(i);
+            }
+        }
+        return n;
+    }
+
+    size_t cull_aabbs_scalar(const Scene& s, uint32* visible)
+    {
+        const float32* x = s.centers.component(0);
+        const float32* y = s.centers.component(1);
+        const float32* z = s.centers.component(2);
+        const float32* ex = s.extents.component(0);
+        const float32* ey = s.extents.component(1);
+        const float32* ez = s.extents.component(2);
+        size_t n = 0;
+        for (size_t i = 0; i < s.centers.size(); ++i)
+        {
+            bool inside = true;
+            for (const Plane& p : s.planes)
+            {
+                const float32 r = std::abs(p.a) * ex[i] + std::abs(p.b) * ey[i] + std::abs(p.c) * ez[i];
+                if (p.a * x[i] + p.b * y[i] + p.c * z[i] + p.d + r < 0)
+                {
+                    inside = false;
+                    break;
+                }
+            }
+            if (inside)
+            {
+                visible[n++] = static_cast<uint32>(i);
+            }
+        }
+        return n;
+    }
+
+    template<typename Fn>
+    void run_cull(benchmark::State& state, const Fn fn)
+    {
+        Scene scene(static_cast<size_t>(state.range(0)));
+
+        size_t visible = 0;
+        for (auto _ : state)
+        {
+            visible = fn(scene, scene.visible.data());
+            benchmark::DoNotOptimize(visible);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["visible"] = static_cast<double>(visible);
+        state.SetLabel(tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    }
+}
+
+static void BM_cull_spheres_scalar(benchmark::State& state)
+{
+    run_cull(state, cull_spheres_scalar);
+}
+
+static void BM_cull_spheres(benchmark::State& state)
+{
+    run_cull(state, [](const Scene& s, uint32* visible)
+    {
+        return tsimd::cull_spheres(s.planes, s.centers, s.radii.data(), visible);
+    });
+}
+
+static void BM_cull_aabbs_scalar(benchmark::State& state)
+{
+    run_cull(state, cull_aabbs_scalar);
+}
+
+static void BM_cull_aabbs(benchmark::State& state)
+{
+    run_cull(state, [](const Scene& s, uint32* visible)
+    {
+        return tsimd::cull_aabbs(s.planes, s.centers, s.extents, visible);
+    });
+}
+
+// 4k 在 L1/L2 中，500k 为每帧的实例数 (约 12 MB 的输入)
+BENCHMARK(BM_cull_spheres_scalar)->Arg(4096)->Arg(500000);
+BENCHMARK(BM_cull_spheres)->Arg(4096)->Arg(500000);
+BENCHMARK(BM_cull_aabbs_scalar)->Arg(4096)->Arg(500000);
+BENCHMARK(BM_cull_aabbs)->Arg(4096)->Arg(500000);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <tSimd/algorithm.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "tSimd/dispatch.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 比较每次调用的分发开销: 每次查表 / 缓存查表结果 / 调用方自己保存函数指针
+// N 较小时，分发开销占比大
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void bm_add_impl(const float* TMATH_RESTRICT lhs, const float* TMATH_RESTRICT rhs, float* TMATH_RESTRICT out, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(out + i, op::add(op::load_partial(lhs + i, lanes), op::load_partial(rhs + i, lanes)), lanes);
+            });
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+TSIMD_DYN_DISPATCH_FUNC(bm_add_impl);
+
+namespace
+{
+    struct Buffers
+    {
+        explicit Buffers(const size_t N) : lhs(N, 1.0f), rhs(N, 2.0f), out(N) {}
+
+        std::vector<float> lhs;
+        std::vector<float> rhs;
+        std::vector<float> out;
+    };
+}
+
+// 旧的行为: 每次调用都经过 detail::dyn_func_index()
+static void BM_dispatch_table_lookup(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        TSIMD_DYN_TABLE_LOOKUP(bm_add_impl)(buf.lhs.data(), buf.rhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+// TSIMD_DYN_CALL 的默认行为
+static void BM_dispatch_resolved(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        TSIMD_DYN_RESOLVED(bm_add_impl)(buf.lhs.data(), buf.rhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+// 下限: 在循环外取得函数指针，循环内只有间接调用
+static void BM_dispatch_hoisted(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    auto fn = TSIMD_DYN_TABLE_LOOKUP(bm_add_impl);
+    benchmark::DoNotOptimize(fn);
+
+    for (auto _ : state)
+    {
+        fn(buf.lhs.data(), buf.rhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+BENCHMARK(BM_dispatch_table_lookup)->Arg(4)->Arg(16)->Arg(64)->Arg(1024);
+BENCHMARK(BM_dispatch_resolved)->Arg(4)->Arg(16)->Arg(64)->Arg(1024);
+BENCHMARK(BM_dispatch_hoisted)->Arg(4)->Arg(16)->Arg(64)->Arg(1024);
+
+#endif
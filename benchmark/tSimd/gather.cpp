@@ -0,0 +1,212 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <tSimd/algorithm.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "tSimd/gather.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 每个指令集分别比较 op::gather / op::scatter 与逐个元素读写 (模拟)
+// SSE2 / AVX 的 op::gather 本身就是模拟的，AVX2 为 vgatherdps，AVX-512 的 gather / scatter 都是原生指令
+// 表较小时 (L1) 主要是指令本身的开销，表很大时受缓存缺失限制，两者的差距变小
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void bm_gather_impl(const float* TMATH_RESTRICT table, const int32* TMATH_RESTRICT idx, const size_t N, float* TMATH_RESTRICT out) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            for (size_t i = 0; i < N; i += op::Lanes)
+            {
+                op::storeu(out + i, op::gather(table, op::load_index(idx + i)));
+            }
+        }
+
+        TSIMD_DYN_FUNC_ATTR void bm_gather_emulated_impl(const float* TMATH_RESTRICT table, const int32* TMATH_RESTRICT idx, const size_t N, float* TMATH_RESTRICT out) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            alignas(64) float tmp[op::Lanes];
+            for (size_t i = 0; i < N; i += op::Lanes)
+            {
+                for (size_t k = 0; k < op::Lanes; ++k)
+                {
+                    tmp[k] = table[idx[i + k]];
+                }
+                op::storeu(out + i, op::load(tmp));
+            }
+        }
+
+        TSIMD_DYN_FUNC_ATTR void bm_scatter_impl(float* TMATH_RESTRICT table, const int32* TMATH_RESTRICT idx, const size_t N, const float* TMATH_RESTRICT in) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            for (size_t i = 0; i < N; i += op::Lanes)
+            {
+                op::scatter(table, op::load_index(idx + i), op::loadu(in + i));
+            }
+        }
+
+        TSIMD_DYN_FUNC_ATTR void bm_scatter_emulated_impl(float* TMATH_RESTRICT table, const int32* TMATH_RESTRICT idx, const size_t N, const float* TMATH_RESTRICT in) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            alignas(64) float tmp[op::Lanes];
+            for (size_t i = 0; i < N; i += op::Lanes)
+            {
+                op::store(tmp, op::loadu(in + i));
+                for (size_t k = 0; k < op::Lanes; ++k)
+                {
+                    table[idx[i + k]] = tmp[k];
+                }
+            }
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+TSIMD_DYN_DISPATCH_FUNC(bm_gather_impl);
+TSIMD_DYN_DISPATCH_FUNC(bm_gather_emulated_impl);
+TSIMD_DYN_DISPATCH_FUNC(bm_scatter_impl);
+TSIMD_DYN_DISPATCH_FUNC(bm_scatter_emulated_impl);
+
+namespace
+{
+    constexpr size_t IndexCount = 1 << 16;
+
+    // 编译了这个指令集的版本，并且CPU支持
+    bool is_available(const tsimd::SimdInstruction instruction)
+    {
+        using tsimd::SimdInstruction;
+        const auto& supports = tsimd::InstructionSelector::get_support_info();
+        switch (instruction)
+        {
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SSE2)
+        case SimdInstruction::SSE2:     return supports.SSE2;
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX)
+        case SimdInstruction::AVX:      return supports.AVX;
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2)
+        case SimdInstruction::AVX2:     return supports.AVX2;
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+        case SimdInstruction::AVX512_F: return supports.AVX512_F;
+    #endif
+        default:                        return false;
+        }
+    }
+
+    // 函数指针表中指定指令集的一项，不可用时返回 nullptr
+    template<typename Fn, size_t N>
+    Fn select_tier(Fn (&table)[N], const tsimd::SimdInstruction instruction)
+    {
+        return is_available(instruction) ? table[tsimd::detail::instruction_index(instruction)] : nullptr;
+    }
+
+    struct Buffers
+    {
+        explicit Buffers(const size_t table_size) : table(table_size, 1.0f), idx(IndexCount), values(IndexCount, 2.0f)
+        {
+            // 随机下标，避免硬件预取
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<tsimd::int32> dist(0, static_cast<tsimd::int32>(table_size - 1));
+            for (auto& i : idx)
+            {
+                i = dist(rng);
+            }
+        }
+
+        std::vector<float> table;
+        std::vector<tsimd::int32> idx;
+        std::vector<float> values;
+    };
+
+    template<typename Fn>
+    void run_gather(benchmark::State& state, const Fn fn)
+    {
+        if (!fn)
+        {
+            state.SkipWithError("instruction not available");
+            return;
+        }
+
+        Buffers buf(static_cast<size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            fn(buf.table.data(), buf.idx.data(), IndexCount, buf.values.data());
+            benchmark::DoNotOptimize(buf.values.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(IndexCount));
+    }
+
+    template<typename Fn>
+    void run_scatter(benchmark::State& state, const Fn fn)
+    {
+        if (!fn)
+        {
+            state.SkipWithError("instruction not available");
+            return;
+        }
+
+        Buffers buf(static_cast<size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            fn(buf.table.data(), buf.idx.data(), IndexCount, buf.values.data());
+            benchmark::DoNotOptimize(buf.table.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(IndexCount));
+    }
+}
+
+static void BM_gather(benchmark::State& state, const tsimd::SimdInstruction instruction)
+{
+    run_gather(state, select_tier(tsimd::PFN_table::bm_gather_impl, instruction));
+}
+
+static void BM_gather_emulated(benchmark::State& state, const tsimd::SimdInstruction instruction)
+{
+    run_gather(state, select_tier(tsimd::PFN_table::bm_gather_emulated_impl, instruction));
+}
+
+static void BM_scatter(benchmark::State& state, const tsimd::SimdInstruction instruction)
+{
+    run_scatter(state, select_tier(tsimd::PFN_table::bm_scatter_impl, instruction));
+}
+
+static void BM_scatter_emulated(benchmark::State& state, const tsimd::SimdInstruction instruction)
+{
+    run_scatter(state, select_tier(tsimd::PFN_table::bm_scatter_emulated_impl, instruction));
+}
+
+// 表的大小: 4KB (L1) / 1MB (L2 ~ L3) / 64MB (内存)
+#define TSIMD_BM_GATHER_TIER(func, tier) \
+    BENCHMARK_CAPTURE(func, tier, tsimd::SimdInstruction::tier)->Arg(1 << 10)->Arg(1 << 18)->Arg(1 << 24)
+
+TSIMD_BM_GATHER_TIER(BM_gather, SSE2);
+TSIMD_BM_GATHER_TIER(BM_gather_emulated, SSE2);
+TSIMD_BM_GATHER_TIER(BM_gather, AVX);
+TSIMD_BM_GATHER_TIER(BM_gather_emulated, AVX);
+TSIMD_BM_GATHER_TIER(BM_gather, AVX2);
+TSIMD_BM_GATHER_TIER(BM_gather_emulated, AVX2);
+TSIMD_BM_GATHER_TIER(BM_gather, AVX512_F);
+TSIMD_BM_GATHER_TIER(BM_gather_emulated, AVX512_F);
+
+TSIMD_BM_GATHER_TIER(BM_scatter, AVX2);
+TSIMD_BM_GATHER_TIER(BM_scatter_emulated, AVX2);
+TSIMD_BM_GATHER_TIER(BM_scatter, AVX512_F);
+TSIMD_BM_GATHER_TIER(BM_scatter_emulated, AVX512_F);
+
+#endif
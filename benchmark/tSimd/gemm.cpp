@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <tSimd/aligned_allocate.hpp>
+#include <tSimd/blas.hpp>
+#include <tSimd/parallel.hpp>
+
+// tsimd::blas::gemm (单线程 / default_thread_pool) 与朴素三重循环的比较，输出 GFLOP/s (2 * M * N * K)
+// label 为选中的指令集，比较不同的指令集时用 TSIMD_MAX_ISA 限制，例如 TSIMD_MAX_ISA=sse2 ./benchmark_tsimd_gemm
+// 参数为 M / N / K，行主序
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::blas::Layout;
+
+    using aligned_vector = std::vector<float32, tsimd::AlignedAllocator<float32>>;
+
+    // C[i][j] = sum(A[i][p] * B[p][j])，内层循环按列访问 B
+    void naive_gemm(const size_t M, const size_t N, const size_t K, const float32* A, const float32* B, float32* C)
+    {
+        for (size_t i = 0; i < M; ++i)
+        {
+            for (size_t j = 0; j < N; ++j)
+            {
+                float32 s = 0.0f;
+                for (size_t p = 0; p < K; ++p)
+                {
+                    s += A[i * K + p] * B[p * N + j];
+                }
+                C[i * N + j] = s;
+            }
+        }
+    }
+
+    template<typename Fn>
+    void run_gemm(benchmark::State& state, const Fn fn)
+    {
+        const auto M = static_cast<size_t>(state.range(0));
+        const auto N = static_cast<size_t>(state.range(1));
+        const auto K = static_cast<size_t>(state.range(2));
+        const aligned_vector A(M * K, 0.5f);
+        const aligned_vector B(K * N, 0.25f);
+        aligned_vector C(M * N, 0.0f);
+
+        for (auto _ : state)
+        {
+            fn(M, N, K, A.data(), B.data(), C.data());
+            benchmark::ClobberMemory();
+        }
+
+        const double flops = 2.0 * static_cast<double>(M) * static_cast<double>(N) * static_cast<double>(K);
+        state.counters["GFLOPS"] = benchmark::Counter(flops * 1e-9 * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+        state.SetLabel(tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    }
+}
+
+static void BM_gemm_naive(benchmark::State& state)
+{
+    run_gemm(state, naive_gemm);
+}
+
+static void BM_gemm(benchmark::State& state)
+{
+    run_gemm(state, [](const size_t M, const size_t N, const size_t K, const float32* A, const float32* B, float32* C)
+    {
+        tsimd::blas::gemm(Layout::RowMajor, M, N, K, 1.0f, A, K, B, N, 0.0f, C, N);
+    });
+}
+
+static void BM_gemm_parallel(benchmark::State& state)
+{
+    run_gemm(state, [](const size_t M, const size_t N, const size_t K, const float32* A, const float32* B, float32* C)
+    {
+        tsimd::blas::gemm(Layout::RowMajor, M, N, K, 1.0f, A, K, B, N, 0.0f, C, N, &tsimd::default_thread_pool());
+    });
+}
+
+// 方阵，以及全连接层的形状 (batch 64, 256 -> 1024)，naive 跳过 1024^3
+BENCHMARK(BM_gemm_naive)->Args({ 64, 64, 64 })->Args({ 256, 256, 256 })->Args({ 64, 1024, 256 });
+BENCHMARK(BM_gemm)->Args({ 64, 64, 64 })->Args({ 256, 256, 256 })->Args({ 1024, 1024, 1024 })->Args({ 64, 1024, 256 });
+BENCHMARK(BM_gemm_parallel)->Args({ 64, 64, 64 })->Args({ 256, 256, 256 })->Args({ 1024, 1024, 1024 })->Args({ 64, 1024, 256 })->UseRealTime();
@@ -0,0 +1,262 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <tSimd/mat_stream.hpp>
+#include <tSimd/matrix.hpp>
+
+// 4x4 float 矩阵乘法: 标量循环 / 逐个调用 tSimd / 批量调用 tSimd (AVX 每个寄存器2个矩阵，AVX-512 4个)
+// 行主序，out[i] = lhs[i] * rhs[i]
+// 逆矩阵: 逐个调用 / 批量调用 (每个寄存器放 Lanes 个矩阵的同一个元素，逐个调用时大部分 lane 是空的)
+// soa: 同样的数据导入 Mat4Stream 后的批量调用，不包含导入的时间，每条指令处理 Lanes 个矩阵
+
+namespace
+{
+    struct Buffers
+    {
+        explicit Buffers(const size_t N) : lhs(N * 16), rhs(N * 16), vec(N * 4), out(N * 16)
+        {
+            for (size_t i = 0; i < lhs.size(); ++i)
+            {
+                lhs[i] = static_cast<float>(i % 7) * 0.5f;
+                rhs[i] = static_cast<float>(i % 5) * 0.25f;
+            }
+            // 对角线占优，保证可逆
+            for (size_t i = 0; i < lhs.size(); i += 5)
+            {
+                lhs[i] += 8.0f;
+            }
+            for (size_t i = 0; i < vec.size(); ++i)
+            {
+                vec[i] = static_cast<float>(i % 3) + 1.0f;
+            }
+        }
+
+        std::vector<float> lhs;
+        std::vector<float> rhs;
+        std::vector<float> vec;
+        std::vector<float> out;
+    };
+
+    // Buffers 的 lhs / rhs / vec 导入为 SoA
+    struct StreamBuffers
+    {
+        explicit StreamBuffers(const size_t N)
+        {
+            const Buffers buf(N);
+            lhs.import_row_major(buf.lhs.data(), N);
+            rhs.import_row_major(buf.rhs.data(), N);
+            points.resize(N);
+            for (size_t i = 0; i < N; ++i)
+            {
+                points.set(i, { buf.vec[i * 4 + 0], buf.vec[i * 4 + 1], buf.vec[i * 4 + 2] });
+            }
+        }
+
+        tsimd::Mat4Stream<float> lhs;
+        tsimd::Mat4Stream<float> rhs;
+        tsimd::Mat4Stream<float> out;
+        tsimd::Vec3Stream<float> points;
+        tsimd::Vec3Stream<float> out_points;
+    };
+
+    void mat4_mul_scalar(const float* a, const float* b, float* out) noexcept
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            for (size_t col = 0; col < 4; ++col)
+            {
+                out[row * 4 + col] = a[row * 4 + 0] * b[0 + col] + (a[row * 4 + 1] * b[4 + col] +
+                                    (a[row * 4 + 2] * b[8 + col] + a[row * 4 + 3] * b[12 + col]));
+            }
+        }
+    }
+
+    void mat4_mul_vec4_scalar(const float* m, const float* v, float* out) noexcept
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            const float* r = m + row * 4;
+            out[row] = r[0] * v[0] + (r[1] * v[1] + (r[2] * v[2] + r[3] * v[3]));
+        }
+    }
+}
+
+static void BM_mat4_mul_scalar(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            mat4_mul_scalar(buf.lhs.data() + i * 16, buf.rhs.data() + i * 16, buf.out.data() + i * 16);
+        }
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+// 每个矩阵调用一次，包含分发开销
+static void BM_mat4_mul_single(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            tsimd::mat4_mul_row_major(buf.lhs.data() + i * 16, buf.rhs.data() + i * 16, buf.out.data() + i * 16);
+        }
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_mul_batch(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::mat4_mul_row_major(buf.lhs.data(), buf.rhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_mul_vec4_scalar(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            mat4_mul_vec4_scalar(buf.lhs.data() + i * 16, buf.vec.data() + i * 4, buf.out.data() + i * 4);
+        }
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_mul_vec4_batch(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::mat4_mul_vec4_row_major(buf.lhs.data(), buf.vec.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_inverse_single(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            tsimd::mat4_inverse(buf.lhs.data() + i * 16, buf.out.data() + i * 16);
+        }
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_inverse_batch(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::mat4_inverse(buf.lhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_inverse_affine_batch(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::mat4_inverse_affine_row_major(buf.lhs.data(), buf.out.data(), N);
+        benchmark::DoNotOptimize(buf.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_mul_soa(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    StreamBuffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::mul(buf.lhs, buf.rhs, buf.out);
+        benchmark::DoNotOptimize(buf.out.element(0, 0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_inverse_soa(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    StreamBuffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::inverse(buf.lhs, buf.out);
+        benchmark::DoNotOptimize(buf.out.element(0, 0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_mat4_transform_points_soa(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    StreamBuffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::transform_points(buf.lhs, buf.points, buf.out_points);
+        benchmark::DoNotOptimize(buf.out_points.component(0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+BENCHMARK(BM_mat4_mul_scalar)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_mul_single)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_mul_batch)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_mul_vec4_scalar)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_mul_vec4_batch)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_inverse_single)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_inverse_batch)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_inverse_affine_batch)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_mul_soa)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_inverse_soa)->Arg(16)->Arg(1024)->Arg(32768);
+BENCHMARK(BM_mat4_transform_points_soa)->Arg(16)->Arg(1024)->Arg(32768);
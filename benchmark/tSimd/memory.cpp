@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <tSimd/algorithm.hpp>
+#include <tSimd/page_allocate.hpp>
+#include <tSimd/parallel.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "tSimd/memory.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 不同分配策略下的 STREAM triad (a = b + s * c)，使用 default_thread_pool() 的 parallel_for
+// 数组远大于 LLC 时受内存带宽和 TLB miss 限制: 大页减少 TLB miss，first touch 在多路 (NUMA) 机器上减少远端内存访问
+// BM_triad_thp_streaming 用 stream 写 a，省去 RFO，内存流量从 4N 降到 3N
+// 透明大页是否生效取决于 /sys/kernel/mm/transparent_hugepage/enabled，Explicit 需要预留大页 (/proc/sys/vm/nr_hugepages)
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void bm_triad_impl(float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, const float* TMATH_RESTRICT c, const float s, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            const auto vs = op::set(s);
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(a + i, op::mul_add(vs, op::load_partial(c + i, lanes), op::load_partial(b + i, lanes)), lanes);
+            });
+        }
+
+        // 输出超过 streaming_store_threshold() 时使用 stream，避免写 a 时的 RFO
+        TSIMD_DYN_FUNC_ATTR void bm_triad_store_select_impl(float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, const float* TMATH_RESTRICT c, const float s, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            const auto vs = op::set(s);
+            if (for_each_batch_store<op>(N, a, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                TSIMD_STORE_BATCH(op, a + i, op::mul_add(vs, op::load_partial(c + i, lanes), op::load_partial(b + i, lanes)), lanes);
+            }))
+            {
+                op::fence();
+            }
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+TSIMD_DYN_DISPATCH_FUNC(bm_triad_impl);
+TSIMD_DYN_DISPATCH_FUNC(bm_triad_store_select_impl);
+
+namespace
+{
+    constexpr size_t Grain = 64 * 1024;
+
+    // 三个数组用同一个策略分配，在当前线程初始化 (常见的用法)
+    // 没有 first_touch 时，物理页都分配在当前线程所在的节点
+    template<typename Policy>
+    struct Buffers
+    {
+        Buffers(const Policy& policy, const size_t N) : policy(policy), N(N)
+        {
+            a = static_cast<float*>(policy.allocate(N * sizeof(float)));
+            b = static_cast<float*>(policy.allocate(N * sizeof(float)));
+            c = static_cast<float*>(policy.allocate(N * sizeof(float)));
+            for (size_t i = 0; i < N; ++i)
+            {
+                a[i] = 0.0f;
+                b[i] = 1.0f;
+                c[i] = 2.0f;
+            }
+        }
+
+        ~Buffers()
+        {
+            policy.deallocate(a, N * sizeof(float));
+            policy.deallocate(b, N * sizeof(float));
+            policy.deallocate(c, N * sizeof(float));
+        }
+
+        Policy policy;
+        size_t N;
+        float* a;
+        float* b;
+        float* c;
+    };
+
+    template<bool StoreSelect = false, typename Policy>
+    void run_triad(benchmark::State& state, const Policy& policy)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        Buffers<Policy> buf(policy, N);
+
+        for (auto _ : state)
+        {
+            tsimd::parallel_for(0, N, Grain, [&](const size_t begin, const size_t end) noexcept
+            {
+                if constexpr (StoreSelect)
+                {
+                    TSIMD_DYN_CALL(bm_triad_store_select_impl)(buf.a + begin, buf.b + begin, buf.c + begin, 3.0f, end - begin);
+                }
+                else
+                {
+                    TSIMD_DYN_CALL(bm_triad_impl)(buf.a + begin, buf.b + begin, buf.c + begin, 3.0f, end - begin);
+                }
+            });
+            benchmark::DoNotOptimize(buf.a);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N * 3 * sizeof(float)));
+    }
+
+    using HugePage = tsimd::PageAllocPolicy::HugePage;
+}
+
+// posix_memalign
+static void BM_triad_default(benchmark::State& state)
+{
+    run_triad(state, tsimd::DefaultAllocPolicy{});
+}
+
+static void BM_triad_mmap(benchmark::State& state)
+{
+    run_triad(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::None });
+}
+
+static void BM_triad_thp(benchmark::State& state)
+{
+    run_triad(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::Transparent });
+}
+
+static void BM_triad_hugetlb(benchmark::State& state)
+{
+    run_triad(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::Explicit });
+}
+
+static void BM_triad_thp_first_touch(benchmark::State& state)
+{
+    run_triad(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::Transparent, .first_touch = true });
+}
+
+static void BM_triad_thp_node0(benchmark::State& state)
+{
+    run_triad(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::Transparent, .numa_node = 0 });
+}
+
+// 每个分块都使用 stream (阈值为 0)，与 BM_triad_thp 比较
+static void BM_triad_thp_streaming(benchmark::State& state)
+{
+    const size_t old_threshold = tsimd::streaming_store_threshold();
+    tsimd::set_streaming_store_threshold(0);
+    run_triad<true>(state, tsimd::PageAllocPolicy{ .huge_page = HugePage::Transparent });
+    tsimd::set_streaming_store_threshold(old_threshold);
+}
+
+BENCHMARK(BM_triad_default)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_mmap)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_thp)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_hugetlb)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_thp_first_touch)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_thp_node0)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+BENCHMARK(BM_triad_thp_streaming)->Arg(1 << 22)->Arg(1 << 25)->UseRealTime();
+
+#endif
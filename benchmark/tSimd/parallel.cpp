@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+#include <tSimd/aligned_allocate.hpp>
+#include <tSimd/algorithm.hpp>
+#include <tSimd/parallel.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "tSimd/parallel.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// parallel_for 的多线程扩展: saxpy (y = a * x + y)，线程数从 1 到 hardware_concurrency
+// 每个分块调用一次分发后的 kernel，分块起点对齐，相邻分块不共享缓存行
+// 数据超过 LLC 之后受内存带宽限制，不会随线程数线性增长
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void bm_saxpy_impl(const float a, const float* TMATH_RESTRICT x, float* TMATH_RESTRICT y, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            const auto va = op::set(a);
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(y + i, op::mul_add(va, op::load_partial(x + i, lanes), op::load_partial(y + i, lanes)), lanes);
+            });
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+TSIMD_DYN_DISPATCH_FUNC(bm_saxpy_impl);
+
+namespace
+{
+    using AlignedVector = std::vector<float, tsimd::AlignedAllocator<float>>;
+
+    constexpr size_t Grain = 16 * 1024;
+
+    static void BM_saxpy_parallel(benchmark::State& state)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        const auto threads = static_cast<size_t>(state.range(1));
+        AlignedVector x(N, 1.0f);
+        AlignedVector y(N, 2.0f);
+        tsimd::ThreadPool pool(threads);
+
+        for (auto _ : state)
+        {
+            pool.parallel_for(0, N, Grain, [&](const size_t begin, const size_t end) noexcept
+            {
+                TSIMD_DYN_CALL(bm_saxpy_impl)(0.5f, x.data() + begin, y.data() + begin, end - begin);
+            });
+            benchmark::DoNotOptimize(y.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N * 3 * sizeof(float)));
+    }
+
+    // 单线程直接调用 kernel，作为 parallel_for 开销的基准
+    static void BM_saxpy_single(benchmark::State& state)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        AlignedVector x(N, 1.0f);
+        AlignedVector y(N, 2.0f);
+
+        for (auto _ : state)
+        {
+            TSIMD_DYN_CALL(bm_saxpy_impl)(0.5f, x.data(), y.data(), N);
+            benchmark::DoNotOptimize(y.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N * 3 * sizeof(float)));
+    }
+
+    void thread_counts(benchmark::internal::Benchmark* b)
+    {
+        const auto max_threads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+        for (const int64_t n : { 1 << 16, 1 << 20, 1 << 24 })
+        {
+            for (int64_t t = 1; t < max_threads; t *= 2)
+            {
+                b->Args({ n, t });
+            }
+            b->Args({ n, max_threads });
+        }
+    }
+}
+
+BENCHMARK(BM_saxpy_single)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK(BM_saxpy_parallel)->Apply(thread_counts)->ArgNames({ "N", "threads" })->UseRealTime();
+
+#endif
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <tSimd/quat.hpp>
+
+// 四元数混合: 标量 AoS 循环 (std::acos / std::sin) / SoA 批量 (Exact / Fast / nlerp)
+// 动画系统每帧大约混合 200k 个骨骼旋转
+
+namespace
+{
+    using Quat = std::array<float, 4>;
+
+    Quat make_quat(const size_t i, const float offset)
+    {
+        Quat q;
+        float len2 = 0.0f;
+        for (size_t d = 0; d < 4; ++d)
+        {
+            q[d] = std::sin(static_cast<float>(i * 4 + d) * 0.37f + offset);
+            len2 += q[d] * q[d];
+        }
+        const float inv = 1.0f / std::sqrt(len2);
+        for (auto& c : q)
+        {
+            c *= inv;
+        }
+        return q;
+    }
+
+    struct Buffers
+    {
+        explicit Buffers(const size_t N) : a_aos(N), b_aos(N), out_aos(N), a(N), b(N), out(N), v(N), v_out(N)
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                a_aos[i] = make_quat(i, 0.0f);
+                b_aos[i] = make_quat(i, 2.0f);
+                a.set(i, a_aos[i]);
+                b.set(i, b_aos[i]);
+                v.set(i, { 1.0f, static_cast<float>(i % 5), -2.0f });
+            }
+        }
+
+        std::vector<Quat> a_aos;
+        std::vector<Quat> b_aos;
+        std::vector<Quat> out_aos;
+        tsimd::QuatStream<float> a;
+        tsimd::QuatStream<float> b;
+        tsimd::QuatStream<float> out;
+        tsimd::Vec3Stream<float> v;
+        tsimd::Vec3Stream<float> v_out;
+    };
+
+    Quat slerp_scalar(const Quat& a, const Quat& b, const float t) noexcept
+    {
+        const float d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        const float sign = d < 0 ? -1.0f : 1.0f;
+        const float cos_theta = std::abs(d);
+
+        float k0 = 1.0f - t, k1 = t;
+        if (cos_theta <= 0.9995f)
+        {
+            const float theta = std::acos(cos_theta);
+            const float inv_sin_theta = 1.0f / std::sqrt(1.0f - cos_theta * cos_theta);
+            k0 = std::sin((1.0f - t) * theta) * inv_sin_theta;
+            k1 = std::sin(t * theta) * inv_sin_theta;
+        }
+        k1 *= sign;
+        return { a[0] * k0 + b[0] * k1, a[1] * k0 + b[1] * k1, a[2] * k0 + b[2] * k1, a[3] * k0 + b[3] * k1 };
+    }
+}
+
+static void BM_quat_slerp_scalar(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            buf.out_aos[i] = slerp_scalar(buf.a_aos[i], buf.b_aos[i], 0.3f);
+        }
+        benchmark::DoNotOptimize(buf.out_aos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_quat_slerp_exact(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::quat_slerp(buf.a, buf.b, 0.3f, buf.out, tsimd::QuatAccuracy::Exact);
+        benchmark::DoNotOptimize(buf.out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_quat_slerp_fast(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::quat_slerp(buf.a, buf.b, 0.3f, buf.out, tsimd::QuatAccuracy::Fast);
+        benchmark::DoNotOptimize(buf.out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_quat_nlerp(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::quat_nlerp(buf.a, buf.b, 0.3f, buf.out);
+        benchmark::DoNotOptimize(buf.out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_quat_mul(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::quat_mul(buf.a, buf.b, buf.out);
+        benchmark::DoNotOptimize(buf.out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+static void BM_quat_rotate(benchmark::State& state)
+{
+    const auto N = static_cast<size_t>(state.range(0));
+    Buffers buf(N);
+
+    for (auto _ : state)
+    {
+        tsimd::quat_rotate(buf.a, buf.v, buf.v_out);
+        benchmark::DoNotOptimize(buf.v_out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+BENCHMARK(BM_quat_slerp_scalar)->Arg(1024)->Arg(200000);
+BENCHMARK(BM_quat_slerp_exact)->Arg(1024)->Arg(200000);
+BENCHMARK(BM_quat_slerp_fast)->Arg(1024)->Arg(200000);
+BENCHMARK(BM_quat_nlerp)->Arg(1024)->Arg(200000);
+BENCHMARK(BM_quat_mul)->Arg(1024)->Arg(200000);
+BENCHMARK(BM_quat_rotate)->Arg(1024)->Arg(200000);
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <tSimd/ray.hpp>
+
+// tsimd::intersect_triangles / intersect_aabbs 与逐条光线的标量循环的比较，输出 Mrays/s
+// 每条光线与所有图元求交 (没有 BVH)，所以 Mrays/s 与图元个数成反比
+// label 为选中的指令集，比较不同的指令集时用 TSIMD_MAX_ISA 限制，例如 TSIMD_MAX_ISA=sse2 ./benchmark_tsimd_ray
+// 参数为网格的边长 G (2 * G * G 个三角形，G * G 个 AABB)
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::uint32;
+
+    using Vec3 = std::array<float32, 3>;
+    using Triangle = std::array<Vec3, 3>;
+
+    struct Box
+    {
+        Vec3 min, max;
+    };
+
+    constexpr size_t RayCount = 64 * 64;
+
+    /**
+     * 生成的网格: [-1, 1] x [-1, 1] 上的高度场，每个格子两个三角形，AABB 为每个格子的包围盒
+     * 光线: 从 (0, 0, 3) 射向 z = 0 平面上 64 x 64 的均匀网格点 (与拾取 / 烘焙时的一批光线类似)
+     */
+    struct Scene
+    {
+        std::vector<Triangle> triangles;
+        std::vector<Box> boxes;
+        tsimd::Vec3Stream<float32> origins;
+        tsimd::Vec3Stream<float32> directions;
+        tsimd::RayHits hits;
+
+        explicit Scene(const size_t g)
+            : origins(RayCount), directions(RayCount), hits(RayCount)
+        {
+            const auto height = [](const float32 x, const float32 y)
+            {
+                return 0.2f * std::sin(3.0f * x) * std::cos(2.0f * y);
+            };
+            const auto vertex = [&](const size_t ix, const size_t iy) -> Vec3
+            {
+                const float32 x = -1.0f + 2.0f * static_cast<float32>(ix) / static_cast<float32>(g);
+                const float32 y = -1.0f + 2.0f * static_cast<float32>(iy) / static_cast<float32>(g);
+                return { x, y, height(x, y) };
+            };
+
+            for (size_t iy = 0; iy < g; ++iy)
+            {
+                for (size_t ix = 0; ix < g; ++ix)
+                {
+                    const Vec3 a = vertex(ix, iy), b = vertex(ix + 1, iy), c = vertex(ix, iy + 1), d = vertex(ix + 1, iy + 1);
+                    triangles.push_back({ a, b, d });
+                    triangles.push_back({ a, d, c });
+
+                    Box box = { a, a };
+                    for (const Vec3& p : { b, c, d })
+                    {
+                        for (size_t k = 0; k < 3; ++k)
+                        {
+                            box.min[k] = std::min(box.min[k], p[k]);
+                            box.max[k] = std::max(box.max[k], p[k]);
+                        }
+                    }
+                    boxes.push_back(box);
+                }
+            }
+
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float32> jitter(-0.01f, 0.01f);
+            for (size_t i = 0; i < RayCount; ++i)
+            {
+                const float32 x = -1.2f + 2.4f * static_cast<float32>(i % 64) / 63.0f + jitter(rng);
+                const float32 y = -1.2f + 2.4f * static_cast<float32>(i / 64) / 63.0f + jitter(rng);
+                origins.set(i, { 0.0f, 0.0f, 3.0f });
+                directions.set(i, { x, y, -3.0f });
+            }
+        }
+    };
+
+    // 与 tMath 的 intersect_triangle 相同，逐条光线逐个三角形
+    void intersect_triangles_scalar(Scene& s)
+    {
+        for (size_t i = 0; i < RayCount; ++i)
+        {
+            const Vec3 o = s.origins.get(i);
+            const Vec3 d = s.directions.get(i);
+            for (size_t j = 0; j < s.triangles.size(); ++j)
+            {
+                const Vec3& v0 = s.triangles[j][0];
+                const Vec3 e1 = { s.triangles[j][1][0] - v0[0], s.triangles[j][1][1] - v0[1], s.triangles[j][1][2] - v0[2] };
+                const Vec3 e2 = { s.triangles[j][2][0] - v0[0], s.triangles[j][2][1] - v0[1], s.triangles[j][2][2] - v0[2] };
+
+                const Vec3 p = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+                const float32 inv_det = 1.0f / (e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2]);
+                const Vec3 sv = { o[0] - v0[0], o[1] - v0[1], o[2] - v0[2] };
+                const float32 u = (sv[0] * p[0] + sv[1] * p[1] + sv[2] * p[2]) * inv_det;
+                const Vec3 q = { sv[1] * e1[2] - sv[2] * e1[1], sv[2] * e1[0] - sv[0] * e1[2], sv[0] * e1[1] - sv[1] * e1[0] };
+                const float32 v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inv_det;
+                const float32 t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv_det;
+
+                if (u >= 0 && v >= 0 && u + v <= 1 && t > 0 && t < s.hits.t[i])
+                {
+                    s.hits.t[i] = t;
+                    s.hits.u[i] = u;
+                    s.hits.v[i] = v;
+                    s.hits.prim[i] = static_cast<uint32>(j);
+                }
+            }
+        }
+    }
+
+    template<typename Fn>
+    void run_rays(benchmark::State& state, const Fn fn)
+    {
+        Scene scene(static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            scene.hits.reset(RayCount);
+            fn(scene);
+            benchmark::ClobberMemory();
+        }
+
+        size_t hit = 0;
+        for (size_t i = 0; i < RayCount; ++i)
+        {
+            hit += scene.hits.hit(i) ? 1 : 0;
+        }
+        state.counters["Mrays/s"] = benchmark::Counter(static_cast<double>(RayCount) * 1e-6 * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+        state.counters["hit"] = static_cast<double>(hit);
+        state.SetLabel(tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    }
+}
+
+static void BM_ray_triangles_scalar(benchmark::State& state)
+{
+    run_rays(state, intersect_triangles_scalar);
+}
+
+static void BM_ray_triangles(benchmark::State& state)
+{
+    run_rays(state, [](Scene& s)
+    {
+        tsimd::intersect_triangles(s.origins, s.directions, std::span<const Triangle>(s.triangles), s.hits);
+    });
+}
+
+static void BM_ray_aabbs(benchmark::State& state)
+{
+    run_rays(state, [](Scene& s)
+    {
+        tsimd::intersect_aabbs(s.origins, s.directions, std::span<const Box>(s.boxes), s.hits);
+    });
+}
+
+// 128 / 512 / 2048 个三角形
+BENCHMARK(BM_ray_triangles_scalar)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_ray_triangles)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_ray_aabbs)->Arg(8)->Arg(16)->Arg(32);
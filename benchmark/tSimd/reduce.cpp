@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <tSimd/algorithm.hpp>
+#include <tSimd/reduce.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "tSimd/reduce.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 数组求和 / 点积: 一个累加器 (每次 add 都要等上一次的结果，受延迟限制) 与 reduce 中 8 个累加器的比较
+// 数组在 L1 / L2 中时差距最大，数组远大于 LLC 时都受内存带宽限制
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR float bm_sum_one_acc_impl(const float* in, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            auto acc = op::zero();
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                acc = op::add(acc, op::load_partial(in + i, lanes));
+            });
+            return op::reduce_sum(acc);
+        }
+
+        TSIMD_DYN_FUNC_ATTR float bm_dot_one_acc_impl(const float* a, const float* b, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            auto acc = op::zero();
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                acc = op::mul_add(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes), acc);
+            });
+            return op::reduce_sum(acc);
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+TSIMD_DYN_DISPATCH_FUNC(bm_sum_one_acc_impl);
+TSIMD_DYN_DISPATCH_FUNC(bm_dot_one_acc_impl);
+
+namespace
+{
+    using tsimd::reduce::Mode;
+
+    template<typename Fn>
+    void run_reduce(benchmark::State& state, const Fn fn)
+    {
+        const auto N = static_cast<size_t>(state.range(0));
+        const std::vector<float> a(N, 1.0f);
+        const std::vector<float> b(N, 0.5f);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(fn(a.data(), b.data(), N));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    }
+}
+
+static void BM_sum_one_acc(benchmark::State& state)
+{
+    run_reduce(state, [](const float* a, const float*, const size_t N) { return TSIMD_DYN_CALL(bm_sum_one_acc_impl)(a, N); });
+}
+
+static void BM_sum(benchmark::State& state, const Mode mode)
+{
+    run_reduce(state, [mode](const float* a, const float*, const size_t N) { return tsimd::reduce::sum(a, N, mode); });
+}
+
+static void BM_dot_one_acc(benchmark::State& state)
+{
+    run_reduce(state, [](const float* a, const float* b, const size_t N) { return TSIMD_DYN_CALL(bm_dot_one_acc_impl)(a, b, N); });
+}
+
+static void BM_dot(benchmark::State& state, const Mode mode)
+{
+    run_reduce(state, [mode](const float* a, const float* b, const size_t N) { return tsimd::reduce::dot(a, b, N, mode); });
+}
+
+static void BM_minmax(benchmark::State& state)
+{
+    run_reduce(state, [](const float* a, const float*, const size_t N) { return tsimd::reduce::minmax(a, N).max; });
+}
+
+// 16KB (L1) / 256KB (L2) / 64MB (内存)
+BENCHMARK(BM_sum_one_acc)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_CAPTURE(BM_sum, fast, Mode::Fast)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_CAPTURE(BM_sum, kahan, Mode::Kahan)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_CAPTURE(BM_sum, pairwise, Mode::Pairwise)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(BM_dot_one_acc)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_CAPTURE(BM_dot, fast, Mode::Fast)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_CAPTURE(BM_dot, kahan, Mode::Kahan)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(BM_minmax)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 24);
+
+#endif
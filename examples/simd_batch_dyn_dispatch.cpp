@@ -5,6 +5,7 @@
 #include <string>
 
 #include <tSimd/batch.hpp>
+#include <tSimd/algorithm.hpp>
 #undef TSIMD_DISPATCH_THIS_FILE
 #define TSIMD_DISPATCH_THIS_FILE "simd_batch_dyn_dispatch.cpp" // this file
 #include <tSimd/dispatch_this_file.hpp> // auto dispatch
@@ -20,7 +21,6 @@ namespace tsimd
         {
             using op = TSIMD_DYN_SIMD_OP(float);
             using batch_t = op::batch_t;
-            constexpr size_t Step = op::Lanes;
 
             // 测试
             std::string cur_intrinsic = TMATH_STR("" TSIMD_DYN_FUNC_ATTR);
@@ -32,20 +32,16 @@ namespace tsimd
     #error "Unknown compiler."
 #endif
 
-            size_t i = 0;
-            for (; i + Step <= N; i += Step)
+            // 末尾不足一个batch的部分由 load_partial / store_partial 处理，不再需要标量循环
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
             {
-                batch_t a = op::loadu(arr + i);
-                batch_t b = op::loadu(arr2 + i);
-                batch_t c = op::loadu(arr3 + i);
+                batch_t a = op::load_partial(arr + i, lanes);
+                batch_t b = op::load_partial(arr2 + i, lanes);
+                batch_t c = op::load_partial(arr3 + i, lanes);
 
                 batch_t tmp = op::mul_add(a, b, c);
-                op::storeu(out_result + i, tmp);
-            }
-            for (; i < N; ++i)
-            {
-                out_result[i] = arr[i] * arr2[i] + arr3[i];
-            }
+                op::store_partial(out_result + i, tmp, lanes);
+            });
         }
     }
 }
@@ -67,10 +63,10 @@ int main()
     float numbers2[] = { -1, -2, -3, -4, -5, -6, -7, -8, -9 };
     float numbers3[] = { 11, 12, 13, 14, 15, 16, 17, 18, 19 };
 
-    float result[8] = {};
-    kernel(numbers, numbers2, numbers3, 8, result);
+    float result[9] = {};
+    kernel(numbers, numbers2, numbers3, 9, result);
 
-    for (int i = 0; i < 8; ++i)
+    for (int i = 0; i < 9; ++i)
     {
         float expected = numbers[i] * numbers2[i] + numbers3[i];
         assert(std::abs(expected - result[i]) <= 1e-5f);
@@ -27,6 +27,7 @@
     #define TMATH_NOINLINE __declspec(noinline)
     #define TMATH_FORCE_INLINE __forceinline
     #define TMATH_FLATTEN
+    #define TMATH_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]] // MSVC 忽略 [[no_unique_address]]
     #define TMATH_LIKELY(expr) (expr)
     #define TMATH_UNLIKELY(expr) (expr)
     #define TMATH_PRAGMA(tokens) __pragma(tokens)
@@ -41,6 +42,7 @@
     #define TMATH_NOINLINE __attribute__((noinline))
     #define TMATH_FORCE_INLINE inline __attribute__((always_inline))
     #define TMATH_FLATTEN __attribute__((flatten))
+    #define TMATH_NO_UNIQUE_ADDRESS [[no_unique_address]]
     #define TMATH_LIKELY(expr) __builtin_expect(!!(expr), 1)
     #define TMATH_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
     #define TMATH_PRAGMA(tokens) _Pragma(#tokens)
@@ -0,0 +1,261 @@
+#pragma once
+
+#include "impl/fwd_vector.hpp"
+#include "impl/math_defs.hpp"
+#include "number.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+TMATH_NAMESPACE_BEGIN
+
+// 包围体 (AABB / 包围球) 与视锥体，向量类型可以是任意满足 is_vector3 / is_vector4 的类型
+// 平面存放为 (a, b, c, d)，法线 (a, b, c) 指向内侧: a*x + b*y + c*z + d >= 0 的点在平面内侧
+// 视锥体与包围体的测试 (intersects) 的计算顺序与 tSimd 的批量剔除 (tsimd::cull_*) 相同，结果完全一致
+
+// ============================================= types =============================================
+
+template<is_vector3_floating_point Vec3>
+struct AABB
+{
+    Vec3 min;
+    Vec3 max;
+};
+
+template<is_vector3_floating_point Vec3>
+struct BoundingSphere
+{
+    Vec3 center;
+    vector_component_t<Vec3> radius;
+};
+
+/**
+ * 6 个平面的顺序: left, right, bottom, top, near, far
+ * 剔除时要求平面已经归一化 (|(a, b, c)| = 1)，否则 d + 半径 的比较没有意义
+ */
+template<is_vector4_floating_point Vec4>
+struct Frustum
+{
+    Vec4 planes[6];
+};
+
+enum class DepthRange
+{
+    NegativeOneToOne, // OpenGL: 裁剪空间 z 属于 [-w, w]
+    ZeroToOne,        // Direct3D / Vulkan: 裁剪空间 z 属于 [0, w]
+};
+
+
+
+// ============================================= AABB =============================================
+
+template<is_vector3_floating_point Vec3>
+constexpr AABB<Vec3> aabb_from_center_extents(const Vec3& center, const Vec3& extents) noexcept
+{
+    return {
+        { center.data[0] - extents.data[0], center.data[1] - extents.data[1], center.data[2] - extents.data[2] },
+        { center.data[0] + extents.data[0], center.data[1] + extents.data[1], center.data[2] + extents.data[2] }
+    };
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr Vec3 center(const AABB<Vec3>& box) noexcept
+{
+    using Field = vector_component_t<Vec3>;
+    constexpr Field half = static_cast<Field>(0.5);
+    return { (box.min.data[0] + box.max.data[0]) * half, (box.min.data[1] + box.max.data[1]) * half, (box.min.data[2] + box.max.data[2]) * half };
+}
+
+// 半边长
+template<is_vector3_floating_point Vec3>
+constexpr Vec3 extents(const AABB<Vec3>& box) noexcept
+{
+    using Field = vector_component_t<Vec3>;
+    constexpr Field half = static_cast<Field>(0.5);
+    return { (box.max.data[0] - box.min.data[0]) * half, (box.max.data[1] - box.min.data[1]) * half, (box.max.data[2] - box.min.data[2]) * half };
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr AABB<Vec3> merge(const AABB<Vec3>& a, const AABB<Vec3>& b) noexcept
+{
+    AABB<Vec3> r;
+    for (int i = 0; i < 3; ++i)
+    {
+        r.min.data[i] = a.min.data[i] < b.min.data[i] ? a.min.data[i] : b.min.data[i];
+        r.max.data[i] = a.max.data[i] > b.max.data[i] ? a.max.data[i] : b.max.data[i];
+    }
+    return r;
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr AABB<Vec3> merge(const AABB<Vec3>& box, const Vec3& point) noexcept
+{
+    return merge(box, AABB<Vec3>{ point, point });
+}
+
+// 边界上的点也算在内
+template<is_vector3_floating_point Vec3>
+constexpr bool contains(const AABB<Vec3>& box, const Vec3& point) noexcept
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (point.data[i] < box.min.data[i] || point.data[i] > box.max.data[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr bool intersects(const AABB<Vec3>& a, const AABB<Vec3>& b) noexcept
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (a.max.data[i] < b.min.data[i] || b.max.data[i] < a.min.data[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+// ============================================= BoundingSphere =============================================
+
+// AABB 的外接球
+template<is_vector3_floating_point Vec3>
+BoundingSphere<Vec3> bounding_sphere(const AABB<Vec3>& box) noexcept
+{
+    const Vec3 e = extents(box);
+    return { center(box), TMATH_NAMESPACE_NAME::sqrt(e.data[0] * e.data[0] + e.data[1] * e.data[1] + e.data[2] * e.data[2]) };
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr bool contains(const BoundingSphere<Vec3>& sphere, const Vec3& point) noexcept
+{
+    const auto dx = point.data[0] - sphere.center.data[0];
+    const auto dy = point.data[1] - sphere.center.data[1];
+    const auto dz = point.data[2] - sphere.center.data[2];
+    return dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius;
+}
+
+template<is_vector3_floating_point Vec3>
+constexpr bool intersects(const BoundingSphere<Vec3>& a, const BoundingSphere<Vec3>& b) noexcept
+{
+    const auto dx = a.center.data[0] - b.center.data[0];
+    const auto dy = a.center.data[1] - b.center.data[1];
+    const auto dz = a.center.data[2] - b.center.data[2];
+    const auto r = a.radius + b.radius;
+    return dx * dx + dy * dy + dz * dz <= r * r;
+}
+
+
+
+// ============================================= Plane / Frustum =============================================
+
+// 点到平面的有符号距离 (平面已归一化时)，((a*x + b*y) + c*z) + d
+template<is_vector4_floating_point Vec4, is_vector3 Vec3>
+constexpr vector_component_t<Vec4> signed_distance(const Vec4& plane, const Vec3& point) noexcept
+{
+    using Field = vector_component_t<Vec4>;
+    return plane.data[0] * static_cast<Field>(point.data[0]) + plane.data[1] * static_cast<Field>(point.data[1])
+         + plane.data[2] * static_cast<Field>(point.data[2]) + plane.data[3];
+}
+
+// 法线为0的平面返回原值
+template<is_vector4_floating_point Vec4>
+Vec4 normalized_plane(const Vec4& plane) noexcept
+{
+    using Field = vector_component_t<Vec4>;
+    const Field len = TMATH_NAMESPACE_NAME::sqrt(plane.data[0] * plane.data[0] + plane.data[1] * plane.data[1] + plane.data[2] * plane.data[2]);
+    const Field inv = len > 0 ? static_cast<Field>(1) / len : static_cast<Field>(1);
+    return { plane.data[0] * inv, plane.data[1] * inv, plane.data[2] * inv, plane.data[3] * inv };
+}
+
+/**
+ * 从 投影矩阵 * 视图矩阵 (作用在列向量上: clip = m * v) 提取视锥体的6个平面，已归一化
+ * 传入投影矩阵时得到视图空间的视锥体，传入 投影 * 视图 * 模型 时得到模型空间的视锥体
+ * 参考: Gribb, Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix"
+ */
+template<is_vector4_floating_point Vec4, is_square_matrix_any_major Mat>
+    requires (matrix_traits<Mat>::row_count == 4)
+Frustum<Vec4> frustum_from_matrix(const Mat& m, const DepthRange depth = DepthRange::NegativeOneToOne) noexcept
+{
+    using Field = vector_component_t<Vec4>;
+
+    // 逻辑上的 (row, col) 元素
+    const auto at = [&](const int row, const int col) -> Field
+    {
+        if constexpr (matrix_traits<Mat>::is_column_major)
+        {
+            return static_cast<Field>(m.data[col].data[row]);
+        }
+        else
+        {
+            return static_cast<Field>(m.data[row].data[col]);
+        }
+    };
+
+    // row3 + sign * row
+    const auto combine = [&](const int row, const Field sign) -> Vec4
+    {
+        return { at(3, 0) + sign * at(row, 0), at(3, 1) + sign * at(row, 1), at(3, 2) + sign * at(row, 2), at(3, 3) + sign * at(row, 3) };
+    };
+
+    constexpr Field one = static_cast<Field>(1);
+    const Vec4 near_plane = depth == DepthRange::ZeroToOne ? Vec4{ at(2, 0), at(2, 1), at(2, 2), at(2, 3) } : combine(2, one);
+    return { {
+        normalized_plane(combine(0, one)),
+        normalized_plane(combine(0, -one)),
+        normalized_plane(combine(1, one)),
+        normalized_plane(combine(1, -one)),
+        normalized_plane(near_plane),
+        normalized_plane(combine(2, -one))
+    } };
+}
+
+/**
+ * 包围球是否与视锥体相交 (保守测试: 球心到每个平面的距离都 >= -radius)
+ * 视锥体角落外的一些球也会返回 true，剔除只需要保证不漏掉可见的物体
+ */
+template<is_vector4_floating_point Vec4, is_vector3_floating_point Vec3>
+constexpr bool intersects(const Frustum<Vec4>& frustum, const BoundingSphere<Vec3>& sphere) noexcept
+{
+    using Field = vector_component_t<Vec4>;
+    for (const Vec4& plane : frustum.planes)
+    {
+        if (signed_distance(plane, sphere.center) + static_cast<Field>(sphere.radius) < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * AABB 是否与视锥体相交 (保守测试)
+ * 中心到平面的距离 + AABB 在法线上的投影半径 ((|a|*ex + |b|*ey) + |c|*ez) < 0 时在平面外侧
+ */
+template<is_vector4_floating_point Vec4, is_vector3_floating_point Vec3>
+constexpr bool intersects(const Frustum<Vec4>& frustum, const AABB<Vec3>& box) noexcept
+{
+    using Field = vector_component_t<Vec4>;
+    const Vec3 c = center(box);
+    const Vec3 e = extents(box);
+    for (const Vec4& plane : frustum.planes)
+    {
+        const Field r = TMATH_NAMESPACE_NAME::abs(plane.data[0]) * static_cast<Field>(e.data[0])
+                      + TMATH_NAMESPACE_NAME::abs(plane.data[1]) * static_cast<Field>(e.data[1])
+                      + TMATH_NAMESPACE_NAME::abs(plane.data[2]) * static_cast<Field>(e.data[2]);
+        if (signed_distance(plane, c) + r < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TMATH_NAMESPACE_END
+
+TMATH_DIAGNOSTICS_POP
@@ -297,7 +297,7 @@ template<typename Q>
 using quat_component_t = quat_traits<Q>::component_type;
 
 template<typename T>
-concept is_quat = detail::is_generic_vector<T> && (quat_traits<T>::component_count == 4) && detail::mark_as_quat<T>;
+concept is_quat = detail::mark_as_quat<T> && detail::is_generic_vector<T> && (quat_traits<T>::component_count == 4); // 先检查标签，避免其他向量类型触发 quat_traits 的 static_assert
 
 
 // =============================================== Matrix ===============================================
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <concepts>
+
+#include "math_defs.hpp"
+#include "matrix_simd.hpp"
+#include "matrix_row_major.hpp"
+#include "matrix_column_major.hpp"
+#include "matrix_functions.inl"
+
+TMATH_NAMESPACE_BEGIN
+
+/**
+ * 批量相乘: out[i] = lhs[i] * rhs[i]，rhs / out 可以是同类型的矩阵，也可以是向量
+ * float 4x4 矩阵在运行时使用 tSimd (TMATH_USE_TSIMD)，一个寄存器可以放多个矩阵的同一行 (列)
+ * 允许原地计算 (out == lhs 或 out == rhs)
+ */
+template<is_square_matrix_any_major Mat, typename T>
+    requires std::same_as<T, Mat> || is_vector_n<T>
+constexpr void mul_batch(const Mat* lhs, const T* rhs, T* out, const size_t count) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat> && (std::same_as<T, Mat> || detail::is_simd_vec4f<T>))
+    {
+        if !consteval
+        {
+            const float* l = reinterpret_cast<const float*>(lhs);
+            const float* r = reinterpret_cast<const float*>(rhs);
+            float* o = reinterpret_cast<float*>(out);
+
+            if constexpr (std::same_as<T, Mat>)
+            {
+                if constexpr (matrix_traits<Mat>::is_column_major)
+                {
+                    tsimd::mat4_mul_column_major(l, r, o, count);
+                }
+                else
+                {
+                    tsimd::mat4_mul_row_major(l, r, o, count);
+                }
+            }
+            else
+            {
+                if constexpr (matrix_traits<Mat>::is_column_major)
+                {
+                    tsimd::mat4_mul_vec4_column_major(l, r, o, count);
+                }
+                else
+                {
+                    tsimd::mat4_mul_vec4_row_major(l, r, o, count);
+                }
+            }
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TMATH_NAMESPACE_NAME::operator*(lhs[i], rhs[i]);
+    }
+}
+
+/**
+ * 批量计算 4x4 矩阵的行列式 / 逆矩阵: out[i] = f(m[i])
+ * float 4x4 矩阵在运行时使用 tSimd (TMATH_USE_TSIMD)，一次处理 Lanes 个矩阵，结果与逐个计算相同
+ * 允许原地计算 (out == m)
+ */
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr void determinant_batch(const Mat* m, matrix_component_t<Mat>* out, const size_t count) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            tsimd::mat4_determinant(reinterpret_cast<const float*>(m), out, count);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TMATH_NAMESPACE_NAME::determinant(m[i]);
+    }
+}
+
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr void inverse_batch(const Mat* m, Mat* out, const size_t count) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            tsimd::mat4_inverse(reinterpret_cast<const float*>(m), reinterpret_cast<float*>(out), count);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TMATH_NAMESPACE_NAME::inverse(m[i]);
+    }
+}
+
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr void inverse_affine_batch(const Mat* m, Mat* out, const size_t count) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            if constexpr (matrix_traits<Mat>::is_column_major)
+            {
+                tsimd::mat4_inverse_affine_column_major(reinterpret_cast<const float*>(m), reinterpret_cast<float*>(out), count);
+            }
+            else
+            {
+                tsimd::mat4_inverse_affine_row_major(reinterpret_cast<const float*>(m), reinterpret_cast<float*>(out), count);
+            }
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TMATH_NAMESPACE_NAME::inverse_affine(m[i]);
+    }
+}
+
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr void inverse_transpose_3x3_batch(const Mat* m, Mat* out, const size_t count) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            tsimd::mat4_inverse_transpose_3x3(reinterpret_cast<const float*>(m), reinterpret_cast<float*>(out), count);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TMATH_NAMESPACE_NAME::inverse_transpose_3x3(m[i]);
+    }
+}
+
+TMATH_NAMESPACE_END
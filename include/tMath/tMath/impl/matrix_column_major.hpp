@@ -1,6 +1,10 @@
 #pragma once
 
+#include <utility>
+
 #include "math_defs.hpp"
+#include "matrix_simd.hpp"
+#include "../vector.hpp"
 
 TMATH_DIAGNOSTICS_PUSH
 
@@ -11,7 +15,82 @@ TMATH_IGNORE_WARNING("-Wmissing-braces")
 TMATH_NAMESPACE_BEGIN
 
 
+// ============================================= operators =============================================
+// 列主序: data[Col].data[Row]，求和顺序与行主序的版本相同
+
+namespace detail
+{
+    template<is_matrix_column_major Mat, is_vector_n Vec, size_t Row, size_t... K>
+    constexpr auto mat_vec_dot_column_major_impl(const Mat& lhs, const Vec& rhs, std::index_sequence<K...>) noexcept
+    {
+        return ( (lhs.data[K].data[Row] * rhs.data[K]) + ... );
+    }
+
+    template<is_matrix_column_major Mat, is_vector_n Vec, size_t... Row>
+    constexpr Vec operator_mul_column_major_impl(const Mat& lhs, const Vec& rhs, std::index_sequence<Row...>) noexcept
+    {
+        return { mat_vec_dot_column_major_impl<Mat, Vec, Row>(lhs, rhs, std::make_index_sequence<matrix_traits<Mat>::column_count>{})... };
+    }
+}
+template<is_matrix_column_major Mat, is_vector_n Vec>
+constexpr Vec operator*(const Mat& lhs, const Vec& rhs) noexcept
+{
+    static_assert(matrix_traits<Mat>::column_count == vector_traits<Vec>::component_count);
+
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat> && detail::is_simd_vec4f<Vec>)
+    {
+        if !consteval
+        {
+            Vec out;
+            tsimd::mat4_mul_vec4_column_major(reinterpret_cast<const float*>(&lhs), reinterpret_cast<const float*>(&rhs), reinterpret_cast<float*>(&out));
+            return out;
+        }
+    }
+#endif
+
+    return detail::operator_mul_column_major_impl(lhs, rhs, std::make_index_sequence<matrix_traits<Mat>::row_count>{});
+}
+
+
+namespace detail
+{
+    template<is_square_matrix_column_major Mat, size_t Row, size_t Col, size_t... K>
+    constexpr auto mat_dot_column_major_impl(const Mat& lhs, const Mat& rhs, std::index_sequence<K...>) noexcept
+    {
+        return ( (lhs.data[K].data[Row] * rhs.data[Col].data[K]) + ... );
+    }
+
+    template<is_square_matrix_column_major Mat, size_t Col, size_t... Row>
+    constexpr matrix_traits<Mat>::vector_type mul_column_impl(const Mat& lhs, const Mat& rhs, std::index_sequence<Row...>) noexcept
+    {
+        return { mat_dot_column_major_impl<Mat, Row, Col>(lhs, rhs, std::make_index_sequence<matrix_traits<Mat>::row_count>{})... };
+    }
+
+    template<is_square_matrix_column_major Mat, size_t... Col>
+    constexpr Mat operator_mul_column_major_impl(const Mat& lhs, const Mat& rhs, std::index_sequence<Col...>) noexcept
+    {
+        return { mul_column_impl<Mat, Col>(lhs, rhs, std::make_index_sequence<matrix_traits<Mat>::row_count>{})... };
+    }
+}
+template<is_square_matrix_column_major Mat>
+constexpr Mat operator*(const Mat& lhs, const Mat& rhs) noexcept
+{
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            Mat out;
+            tsimd::mat4_mul_column_major(reinterpret_cast<const float*>(&lhs), reinterpret_cast<const float*>(&rhs), reinterpret_cast<float*>(&out));
+            return out;
+        }
+    }
+#endif
 
+    constexpr int N = matrix_traits<Mat>::column_count;
+    return detail::operator_mul_column_major_impl(lhs, rhs, std::make_index_sequence<N>{});
+}
 
 
 TMATH_NAMESPACE_END
@@ -64,4 +64,200 @@ constexpr Mat transpose(const Mat& m) noexcept
 }
 
 
+// ============================================= 4x4 行列式 / 逆矩阵 =============================================
+// A 的逆矩阵的转置 = A 转置的逆矩阵，所以 determinant / inverse / inverse_transpose_3x3 直接按存储顺序计算，行主序和列主序相同
+// 只有 inverse_affine 需要区分平移分量的位置
+// 单个矩阵用标量计算 (一次只有一个矩阵，SoA 的 SIMD 版本反而更慢)，大量矩阵请使用 matrix_batch.inl 的批量版本
+
+namespace detail
+{
+    template<is_square_matrix_any_major Mat>
+    constexpr Mat make_matrix4(const matrix_component_t<Mat> (&b)[16]) noexcept
+    {
+        using V = matrix_traits<Mat>::vector_type;
+        return {
+            V{ b[0], b[1], b[2], b[3] },
+            V{ b[4], b[5], b[6], b[7] },
+            V{ b[8], b[9], b[10], b[11] },
+            V{ b[12], b[13], b[14], b[15] }
+        };
+    }
+
+    /**
+     * 按存储顺序取出16个元素: a[i * 4 + j] = m.data[i].data[j]
+     */
+    template<is_square_matrix_any_major Mat>
+    constexpr void load_matrix4(const Mat& m, matrix_component_t<Mat> (&a)[16]) noexcept
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                a[i * 4 + j] = m.data[i].data[j];
+            }
+        }
+    }
+
+    template<is_square_matrix_any_major Mat>
+    constexpr bool is_matrix4 = (matrix_traits<Mat>::row_count == 4);
+}
+
+/**
+ * 4x4 矩阵的行列式
+ */
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr matrix_component_t<Mat> determinant(const Mat& m) noexcept
+{
+    using C = matrix_component_t<Mat>;
+    C a[16]{};
+    detail::load_matrix4(m, a);
+
+    const C s0 = a[0] * a[5] - a[4] * a[1];
+    const C s1 = a[0] * a[6] - a[4] * a[2];
+    const C s2 = a[0] * a[7] - a[4] * a[3];
+    const C s3 = a[1] * a[6] - a[5] * a[2];
+    const C s4 = a[1] * a[7] - a[5] * a[3];
+    const C s5 = a[2] * a[7] - a[6] * a[3];
+
+    const C c5 = a[10] * a[15] - a[14] * a[11];
+    const C c4 = a[9] * a[15] - a[13] * a[11];
+    const C c3 = a[9] * a[14] - a[13] * a[10];
+    const C c2 = a[8] * a[15] - a[12] * a[11];
+    const C c1 = a[8] * a[14] - a[12] * a[10];
+    const C c0 = a[8] * a[13] - a[12] * a[9];
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+/**
+ * 4x4 矩阵的逆矩阵 (伴随矩阵 / 行列式)
+ * 不检查是否可逆，奇异矩阵的结果为 inf / NaN，需要时先用 determinant 判断
+ */
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr Mat inverse(const Mat& m) noexcept
+{
+    using C = matrix_component_t<Mat>;
+    C a[16]{};
+    detail::load_matrix4(m, a);
+
+    // 上面两行和下面两行的 2x2 子式
+    const C s0 = a[0] * a[5] - a[4] * a[1];
+    const C s1 = a[0] * a[6] - a[4] * a[2];
+    const C s2 = a[0] * a[7] - a[4] * a[3];
+    const C s3 = a[1] * a[6] - a[5] * a[2];
+    const C s4 = a[1] * a[7] - a[5] * a[3];
+    const C s5 = a[2] * a[7] - a[6] * a[3];
+
+    const C c5 = a[10] * a[15] - a[14] * a[11];
+    const C c4 = a[9] * a[15] - a[13] * a[11];
+    const C c3 = a[9] * a[14] - a[13] * a[10];
+    const C c2 = a[8] * a[15] - a[12] * a[11];
+    const C c1 = a[8] * a[14] - a[12] * a[10];
+    const C c0 = a[8] * a[13] - a[12] * a[9];
+
+    const C det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    const C inv_det = C(1) / det;
+    const C neg_inv_det = -inv_det;
+
+    const C b[16] = {
+        (a[5] * c5 - a[6] * c4 + a[7] * c3) * inv_det,
+        (a[1] * c5 - a[2] * c4 + a[3] * c3) * neg_inv_det,
+        (a[13] * s5 - a[14] * s4 + a[15] * s3) * inv_det,
+        (a[9] * s5 - a[10] * s4 + a[11] * s3) * neg_inv_det,
+
+        (a[4] * c5 - a[6] * c2 + a[7] * c1) * neg_inv_det,
+        (a[0] * c5 - a[2] * c2 + a[3] * c1) * inv_det,
+        (a[12] * s5 - a[14] * s2 + a[15] * s1) * neg_inv_det,
+        (a[8] * s5 - a[10] * s2 + a[11] * s1) * inv_det,
+
+        (a[4] * c4 - a[5] * c2 + a[7] * c0) * inv_det,
+        (a[0] * c4 - a[1] * c2 + a[3] * c0) * neg_inv_det,
+        (a[12] * s4 - a[13] * s2 + a[15] * s0) * inv_det,
+        (a[8] * s4 - a[9] * s2 + a[11] * s0) * neg_inv_det,
+
+        (a[4] * c3 - a[5] * c1 + a[6] * c0) * neg_inv_det,
+        (a[0] * c3 - a[1] * c1 + a[2] * c0) * inv_det,
+        (a[12] * s3 - a[13] * s1 + a[14] * s0) * neg_inv_det,
+        (a[8] * s3 - a[9] * s1 + a[10] * s0) * inv_det,
+    };
+    return detail::make_matrix4<Mat>(b);
+}
+
+/**
+ * 只包含旋转和平移的仿射矩阵的逆矩阵: [R t; 0 1] -> [R^T  -R^T * t; 0 1]
+ * 要求 R 是正交矩阵 (没有缩放和错切)，否则请使用 inverse
+ * 行主序的平移在每一行的最后一个分量，列主序的平移在 data[3]
+ */
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr Mat inverse_affine(const Mat& m) noexcept
+{
+    using C = matrix_component_t<Mat>;
+    C a[16]{};
+    detail::load_matrix4(m, a);
+
+    // R 的转置在两种存储顺序下都是存储上的转置
+    C b[16]{};
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            b[i * 4 + j] = a[j * 4 + i];
+        }
+    }
+
+    // t' = -(R^T * t)
+    for (int i = 0; i < 3; ++i)
+    {
+        if constexpr (matrix_traits<Mat>::is_column_major)
+        {
+            b[12 + i] = -(a[i * 4 + 0] * a[12] + a[i * 4 + 1] * a[13] + a[i * 4 + 2] * a[14]);
+        }
+        else
+        {
+            b[i * 4 + 3] = -(a[0 * 4 + i] * a[3] + a[1 * 4 + i] * a[7] + a[2 * 4 + i] * a[11]);
+        }
+    }
+    b[15] = C(1);
+    return detail::make_matrix4<Mat>(b);
+}
+
+/**
+ * 左上角 3x3 矩阵的逆矩阵的转置 (法线矩阵)，其余部分为单位矩阵 (没有平移)
+ * 不检查是否可逆，奇异矩阵的结果为 inf / NaN
+ */
+template<is_square_matrix_any_major Mat>
+    requires detail::is_matrix4<Mat>
+constexpr Mat inverse_transpose_3x3(const Mat& m) noexcept
+{
+    using C = matrix_component_t<Mat>;
+    C a[16]{};
+    detail::load_matrix4(m, a);
+
+    // 代数余子式矩阵 / 行列式
+    const C c00 = a[5] * a[10] - a[6] * a[9];
+    const C c01 = a[6] * a[8] - a[4] * a[10];
+    const C c02 = a[4] * a[9] - a[5] * a[8];
+    const C c10 = a[2] * a[9] - a[1] * a[10];
+    const C c11 = a[0] * a[10] - a[2] * a[8];
+    const C c12 = a[1] * a[8] - a[0] * a[9];
+    const C c20 = a[1] * a[6] - a[2] * a[5];
+    const C c21 = a[2] * a[4] - a[0] * a[6];
+    const C c22 = a[0] * a[5] - a[1] * a[4];
+
+    const C det = a[0] * c00 + a[1] * c01 + a[2] * c02;
+    const C inv_det = C(1) / det;
+
+    const C b[16] = {
+        c00 * inv_det, c01 * inv_det, c02 * inv_det, C(0),
+        c10 * inv_det, c11 * inv_det, c12 * inv_det, C(0),
+        c20 * inv_det, c21 * inv_det, c22 * inv_det, C(0),
+        C(0), C(0), C(0), C(1),
+    };
+    return detail::make_matrix4<Mat>(b);
+}
+
+
 TMATH_NAMESPACE_END
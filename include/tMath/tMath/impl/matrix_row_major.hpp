@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "math_defs.hpp"
+#include "matrix_simd.hpp"
 #include "../vector.hpp"
 
 TMATH_DIAGNOSTICS_PUSH
@@ -28,6 +29,18 @@ constexpr Vec operator*(const Mat& lhs, const Vec& rhs) noexcept
 {
     static_assert(matrix_traits<Mat>::column_count == vector_traits<Vec>::component_count);
 
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat> && detail::is_simd_vec4f<Vec>)
+    {
+        if !consteval
+        {
+            Vec out;
+            tsimd::mat4_mul_vec4_row_major(reinterpret_cast<const float*>(&lhs), reinterpret_cast<const float*>(&rhs), reinterpret_cast<float*>(&out));
+            return out;
+        }
+    }
+#endif
+
     return detail::operator_mul_impl(lhs, rhs, std::make_index_sequence<matrix_traits<Mat>::vector_count>{});
 }
 
@@ -55,6 +68,18 @@ namespace detail
 template<is_square_matrix_row_major Mat>
 constexpr Mat operator*(const Mat& lhs, const Mat& rhs) noexcept
 {
+#if defined(TMATH_USE_TSIMD)
+    if constexpr (detail::is_simd_mat4f<Mat>)
+    {
+        if !consteval
+        {
+            Mat out;
+            tsimd::mat4_mul_row_major(reinterpret_cast<const float*>(&lhs), reinterpret_cast<const float*>(&rhs), reinterpret_cast<float*>(&out));
+            return out;
+        }
+    }
+#endif
+
     constexpr int N = matrix_traits<Mat>::row_count;
     return detail::operator_mul_impl(lhs, rhs, std::make_index_sequence<N>{});
 }
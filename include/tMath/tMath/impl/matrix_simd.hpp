@@ -0,0 +1,34 @@
+#pragma once
+
+#include <type_traits>
+
+#include "math_defs.hpp"
+
+/**
+ * 定义了 TMATH_USE_TSIMD 时 (CMake 选项 TMATH_USE_TSIMD，默认关闭，需要链接 tSimd)
+ * float 4x4 矩阵的乘法在运行时使用 tSimd 的分发函数，编译期求值仍然使用标量的 constexpr 版本
+ *
+ * 注意:
+ * 1. 每次乘法都是一次对非内联函数的间接调用，单个矩阵的乘法不一定更快，大量矩阵请直接使用 tSimd 的批量函数
+ * 2. tSimd 在 FMA 指令集上使用 mul_add，同一个表达式在运行时和编译期 (consteval) 的结果可能在最后一位上不同
+ */
+#if defined(TMATH_USE_TSIMD)
+    #include <tSimd/matrix.hpp>
+#endif
+
+TMATH_NAMESPACE_BEGIN
+
+namespace detail
+{
+    template<typename Mat>
+    concept is_simd_mat4f = is_square_matrix_any_major<Mat> &&
+                            std::is_same_v<matrix_component_t<Mat>, float> &&
+                            (matrix_traits<Mat>::row_count == 4);
+
+    template<typename Vec>
+    concept is_simd_vec4f = is_vector_n<Vec> &&
+                            std::is_same_v<vector_component_t<Vec>, float> &&
+                            (vector_traits<Vec>::component_count == 4);
+}
+
+TMATH_NAMESPACE_END
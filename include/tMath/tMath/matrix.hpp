@@ -2,6 +2,7 @@
 
 #include "impl/matrix_row_major.hpp"
 #include "impl/matrix_column_major.hpp"
+#include "impl/matrix_batch.inl"
 
 
 #define TMATH_MATRIX_OPERATORS(matrix_type_name) \
@@ -2,6 +2,7 @@
 
 #include "impl/fwd_vector.hpp"
 #include "impl/math_defs.hpp"
+#include "number.hpp"
 
 TMATH_DIAGNOSTICS_PUSH
 
@@ -11,18 +12,56 @@ TMATH_IGNORE_WARNING("-Wmissing-braces")
 
 TMATH_NAMESPACE_BEGIN
 
-template<is_quat Q, is_vector4 Vec4>
-constexpr Q& operator*=(Q& lhs, const Vec4& rhs) noexcept
+// 四元数的存储顺序为 (x, y, z, w)，w 为实部
+// 旋转相关的函数都假定四元数是单位四元数，作用在列向量上: v' = q * v * q^-1
+// 乘法 / nlerp / rotate 的计算顺序与 tSimd 的批量版本 (tsimd::quat_*) 相同，不支持 FMA 的指令集结果完全一致
+
+// ============================================= operators =============================================
+
+template<is_quat Q>
+constexpr bool operator==(const Q& lhs, const Q& rhs) noexcept
 {
-    // TODO
-    return lhs;
+    return lhs.data[0] == rhs.data[0] && lhs.data[1] == rhs.data[1] && lhs.data[2] == rhs.data[2] && lhs.data[3] == rhs.data[3];
 }
 
+template<is_quat Q>
+constexpr bool operator!=(const Q& lhs, const Q& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * Hamilton 乘积: 先旋转 rhs，再旋转 lhs
+ */
+template<is_quat Q>
+constexpr Q operator*(const Q& lhs, const Q& rhs) noexcept
+{
+    const auto ax = lhs.data[0], ay = lhs.data[1], az = lhs.data[2], aw = lhs.data[3];
+    const auto bx = rhs.data[0], by = rhs.data[1], bz = rhs.data[2], bw = rhs.data[3];
+
+    return {
+        aw * bx + ax * bw + ay * bz - az * by,
+        aw * by - ax * bz + ay * bw + az * bx,
+        aw * bz + ax * by - ay * bx + az * bw,
+        aw * bw - ax * bx - ay * by - az * bz
+    };
+}
 
 template<is_quat Q>
 constexpr Q& operator*=(Q& lhs, const Q& rhs) noexcept
 {
-    // TODO
+    lhs = lhs * rhs;
+    return lhs;
+}
+
+/**
+ * rhs 的 (x, y, z, w) 当作四元数，与 lhs 做 Hamilton 乘积
+ */
+template<is_quat Q, is_vector4 Vec4>
+constexpr Q& operator*=(Q& lhs, const Vec4& rhs) noexcept
+{
+    using Field = quat_component_t<Q>;
+    lhs = lhs * Q{ static_cast<Field>(rhs.data[0]), static_cast<Field>(rhs.data[1]), static_cast<Field>(rhs.data[2]), static_cast<Field>(rhs.data[3]) };
     return lhs;
 }
 
@@ -37,18 +76,328 @@ constexpr Q identity() noexcept
     return { static_cast<Field>(0), static_cast<Field>(0), static_cast<Field>(0), static_cast<Field>(1) };
 }
 
+/**
+ * 绕 axis 旋转 angle 弧度
+ * @param axis 单位向量
+ */
 template<is_quat Q, is_vector3 Vec3, is_floating_point F>
-constexpr Q axis_angle(const Vec3& axis, const F angle)
+Q axis_angle(const Vec3& axis, const F angle)
+{
+    using Field = quat_component_t<Q>;
+    const Field half = static_cast<Field>(angle) * static_cast<Field>(0.5);
+    const Field s = TMATH_NAMESPACE_NAME::sin(half);
+
+    return {
+        static_cast<Field>(axis.data[0]) * s,
+        static_cast<Field>(axis.data[1]) * s,
+        static_cast<Field>(axis.data[2]) * s,
+        TMATH_NAMESPACE_NAME::cos(half)
+    };
+}
+
+/**
+ * 欧拉角 (弧度): 先绕 x 轴旋转 euler.x，再绕 y 轴旋转 euler.y，最后绕 z 轴旋转 euler.z (q = qz * qy * qx)
+ */
+template<is_quat Q, is_vector3 Vec3>
+Q from_euler(const Vec3& euler)
+{
+    using Field = quat_component_t<Q>;
+    constexpr Field half = static_cast<Field>(0.5);
+
+    const Field cx = TMATH_NAMESPACE_NAME::cos(static_cast<Field>(euler.data[0]) * half);
+    const Field sx = TMATH_NAMESPACE_NAME::sin(static_cast<Field>(euler.data[0]) * half);
+    const Field cy = TMATH_NAMESPACE_NAME::cos(static_cast<Field>(euler.data[1]) * half);
+    const Field sy = TMATH_NAMESPACE_NAME::sin(static_cast<Field>(euler.data[1]) * half);
+    const Field cz = TMATH_NAMESPACE_NAME::cos(static_cast<Field>(euler.data[2]) * half);
+    const Field sz = TMATH_NAMESPACE_NAME::sin(static_cast<Field>(euler.data[2]) * half);
+
+    return {
+        sx * cy * cz - cx * sy * sz,
+        cx * sy * cz + sx * cy * sz,
+        cx * cy * sz - sx * sy * cz,
+        cx * cy * cz + sx * sy * sz
+    };
+}
+
+/**
+ * 旋转矩阵 (3x3 或 4x4 的左上角，行主序 / 列主序都可以) 转换为四元数
+ * 矩阵需要是正交矩阵 (没有缩放)
+ */
+template<is_quat Q, is_square_matrix_any_major Mat>
+    requires (matrix_traits<Mat>::row_count == 3 || matrix_traits<Mat>::row_count == 4)
+Q from_matrix(const Mat& m)
+{
+    using Field = quat_component_t<Q>;
+
+    // 逻辑上的 (row, col) 元素
+    const auto at = [&](const int row, const int col) -> Field
+    {
+        if constexpr (matrix_traits<Mat>::is_column_major)
+        {
+            return static_cast<Field>(m.data[col].data[row]);
+        }
+        else
+        {
+            return static_cast<Field>(m.data[row].data[col]);
+        }
+    };
+
+    constexpr Field one = static_cast<Field>(1);
+    constexpr Field quarter = static_cast<Field>(0.25);
+    const Field m00 = at(0, 0), m11 = at(1, 1), m22 = at(2, 2);
+    const Field trace = m00 + m11 + m22;
+
+    // 选最大的分量做除数，避免除以接近0的数
+    if (trace > 0)
+    {
+        const Field s = TMATH_NAMESPACE_NAME::sqrt(trace + one) * 2;
+        return { (at(2, 1) - at(1, 2)) / s, (at(0, 2) - at(2, 0)) / s, (at(1, 0) - at(0, 1)) / s, quarter * s };
+    }
+    if (m00 > m11 && m00 > m22)
+    {
+        const Field s = TMATH_NAMESPACE_NAME::sqrt(one + m00 - m11 - m22) * 2;
+        return { quarter * s, (at(0, 1) + at(1, 0)) / s, (at(0, 2) + at(2, 0)) / s, (at(2, 1) - at(1, 2)) / s };
+    }
+    if (m11 > m22)
+    {
+        const Field s = TMATH_NAMESPACE_NAME::sqrt(one + m11 - m00 - m22) * 2;
+        return { (at(0, 1) + at(1, 0)) / s, quarter * s, (at(1, 2) + at(2, 1)) / s, (at(0, 2) - at(2, 0)) / s };
+    }
+    const Field s = TMATH_NAMESPACE_NAME::sqrt(one + m22 - m00 - m11) * 2;
+    return { (at(0, 2) + at(2, 0)) / s, (at(1, 2) + at(2, 1)) / s, quarter * s, (at(1, 0) - at(0, 1)) / s };
+}
+
+
+
+// ============================================= functions =============================================
+
+template<is_quat Q>
+constexpr quat_component_t<Q> dot(const Q& lhs, const Q& rhs) noexcept
+{
+    return lhs.data[0] * rhs.data[0] + lhs.data[1] * rhs.data[1] + lhs.data[2] * rhs.data[2] + lhs.data[3] * rhs.data[3];
+}
+
+template<is_quat Q>
+quat_component_t<Q> magnitude(const Q& q) noexcept
+{
+    return TMATH_NAMESPACE_NAME::sqrt(dot(q, q));
+}
+
+/**
+ * 0四元数返回0四元数
+ */
+template<is_quat Q>
+Q normalized(const Q& q) noexcept
+{
+    using Field = quat_component_t<Q>;
+    const Field mag = magnitude(q);
+    const Field inv_mag = (mag > 0) ? (static_cast<Field>(1) / mag) : mag;
+    return { q.data[0] * inv_mag, q.data[1] * inv_mag, q.data[2] * inv_mag, q.data[3] * inv_mag };
+}
+
+template<is_quat Q>
+constexpr Q conjugate(const Q& q) noexcept
+{
+    return { -q.data[0], -q.data[1], -q.data[2], q.data[3] };
+}
+
+/**
+ * q^-1 = conjugate(q) / |q|^2，单位四元数可以直接使用 conjugate
+ */
+template<is_quat Q>
+constexpr Q inverse(const Q& q) noexcept
+{
+    using Field = quat_component_t<Q>;
+    const Field inv_len2 = static_cast<Field>(1) / dot(q, q);
+    return { -q.data[0] * inv_len2, -q.data[1] * inv_len2, -q.data[2] * inv_len2, q.data[3] * inv_len2 };
+}
+
+/**
+ * 用单位四元数旋转向量: t = 2 * cross(q.xyz, v), v' = v + w * t + cross(q.xyz, t)
+ */
+template<is_quat Q, is_vector3 Vec3>
+constexpr Vec3 rotate(const Q& q, const Vec3& v) noexcept
+{
+    using Field = quat_component_t<Q>;
+    const Field qx = q.data[0], qy = q.data[1], qz = q.data[2], qw = q.data[3];
+    const Field vx = static_cast<Field>(v.data[0]), vy = static_cast<Field>(v.data[1]), vz = static_cast<Field>(v.data[2]);
+
+    const Field tx = (qy * vz - qz * vy) * 2;
+    const Field ty = (qz * vx - qx * vz) * 2;
+    const Field tz = (qx * vy - qy * vx) * 2;
+
+    using C = vector_component_t<Vec3>;
+    return {
+        static_cast<C>(vx + qw * tx + (qy * tz - qz * ty)),
+        static_cast<C>(vy + qw * ty + (qz * tx - qx * tz)),
+        static_cast<C>(vz + qw * tz + (qx * ty - qy * tx))
+    };
+}
+
+/**
+ * 单位四元数转换为旋转矩阵，3x3 或 4x4 (其余部分为单位矩阵)，行主序 / 列主序都可以
+ */
+template<is_square_matrix_any_major Mat, is_quat Q>
+    requires (matrix_traits<Mat>::row_count == 3 || matrix_traits<Mat>::row_count == 4)
+constexpr Mat to_matrix(const Q& q) noexcept
+{
+    using C = matrix_component_t<Mat>;
+    constexpr int N = matrix_traits<Mat>::row_count;
+
+    const C x = static_cast<C>(q.data[0]), y = static_cast<C>(q.data[1]), z = static_cast<C>(q.data[2]), w = static_cast<C>(q.data[3]);
+    const C one = static_cast<C>(1);
+    const C two = static_cast<C>(2);
+
+    const C r[3][3] = {
+        { one - two * (y * y + z * z), two * (x * y - w * z), two * (x * z + w * y) },
+        { two * (x * y + w * z), one - two * (x * x + z * z), two * (y * z - w * x) },
+        { two * (x * z - w * y), two * (y * z + w * x), one - two * (x * x + y * y) },
+    };
+
+    Mat m{};
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < N; ++col)
+        {
+            const C value = (row < 3 && col < 3) ? r[row][col] : static_cast<C>(row == col);
+            if constexpr (matrix_traits<Mat>::is_column_major)
+            {
+                m.data[col].data[row] = value;
+            }
+            else
+            {
+                m.data[row].data[col] = value;
+            }
+        }
+    }
+    return m;
+}
+
+/**
+ * 单位四元数转换为旋转轴和角度 (弧度，[0, 2pi])
+ * 接近单位四元数时旋转轴不确定，返回 (1, 0, 0)
+ */
+template<is_vector3 Vec3, is_quat Q>
+quat_component_t<Q> to_axis_angle(const Q& q, Vec3& axis) noexcept
+{
+    using Field = quat_component_t<Q>;
+    using C = vector_component_t<Vec3>;
+
+    const Field w = clamp(q.data[3], static_cast<Field>(-1), static_cast<Field>(1));
+    const Field s = TMATH_NAMESPACE_NAME::sqrt(static_cast<Field>(1) - w * w);
+    if (s < Epsilon<Field>)
+    {
+        axis = { static_cast<C>(1), static_cast<C>(0), static_cast<C>(0) };
+    }
+    else
+    {
+        axis = { static_cast<C>(q.data[0] / s), static_cast<C>(q.data[1] / s), static_cast<C>(q.data[2] / s) };
+    }
+    return TMATH_NAMESPACE_NAME::acos(w) * 2;
+}
+
+/**
+ * 单位四元数转换为欧拉角 (弧度)，与 from_euler 的顺序相同 (q = qz * qy * qx)
+ * euler.y 在 [-pi/2, pi/2]，到达 +-pi/2 时 (万向节锁) x 和 z 的分配不唯一
+ */
+template<is_vector3 Vec3, is_quat Q>
+Vec3 to_euler(const Q& q) noexcept
+{
+    using Field = quat_component_t<Q>;
+    using C = vector_component_t<Vec3>;
+    const Field x = q.data[0], y = q.data[1], z = q.data[2], w = q.data[3];
+    constexpr Field one = static_cast<Field>(1);
+
+    const Field sin_y = clamp((w * y - z * x) * 2, -one, one);
+    return {
+        static_cast<C>(TMATH_NAMESPACE_NAME::atan2((w * x + y * z) * 2, one - (x * x + y * y) * 2)),
+        static_cast<C>(TMATH_NAMESPACE_NAME::asin(sin_y)),
+        static_cast<C>(TMATH_NAMESPACE_NAME::atan2((w * z + x * y) * 2, one - (y * y + z * z) * 2))
+    };
+}
+
+namespace detail
+{
+    // a * k0 + b * k1 再归一化
+    template<is_quat Q>
+    Q quat_blend_normalized(const Q& a, const Q& b, const quat_component_t<Q> k0, const quat_component_t<Q> k1) noexcept
+    {
+        using Field = quat_component_t<Q>;
+        const Q r = {
+            a.data[0] * k0 + b.data[0] * k1,
+            a.data[1] * k0 + b.data[1] * k1,
+            a.data[2] * k0 + b.data[2] * k1,
+            a.data[3] * k0 + b.data[3] * k1
+        };
+        const Field inv = static_cast<Field>(1) / TMATH_NAMESPACE_NAME::sqrt(dot(r, r));
+        return { r.data[0] * inv, r.data[1] * inv, r.data[2] * inv, r.data[3] * inv };
+    }
+}
+
+/**
+ * 线性插值后归一化，沿最短路径 (dot < 0 时取 -b)
+ * 角速度不均匀，t = 0.5 以外的位置与 slerp 有偏差
+ */
+template<is_quat Q, is_floating_point F>
+Q nlerp(const Q& a, const Q& b, const F t) noexcept
+{
+    using Field = quat_component_t<Q>;
+    const Field ft = static_cast<Field>(t);
+    const Field sign = dot(a, b) < 0 ? static_cast<Field>(-1) : static_cast<Field>(1);
+    return detail::quat_blend_normalized(a, b, static_cast<Field>(1) - ft, ft * sign);
+}
+
+/**
+ * 球面线性插值，沿最短路径 (dot < 0 时取 -b)
+ * 两个四元数几乎相同时 (|dot| > 0.9995) 退化为 nlerp，避免除以接近0的 sin(theta)
+ */
+template<is_quat Q, is_floating_point F>
+Q slerp(const Q& a, const Q& b, const F t) noexcept
 {
-    // TODO
-    return {};
+    using Field = quat_component_t<Q>;
+    constexpr Field one = static_cast<Field>(1);
+    const Field ft = static_cast<Field>(t);
+
+    const Field d = dot(a, b);
+    const Field sign = d < 0 ? -one : one;
+    const Field cos_theta = TMATH_NAMESPACE_NAME::abs(d);
+    if (cos_theta > static_cast<Field>(0.9995))
+    {
+        return detail::quat_blend_normalized(a, b, one - ft, ft * sign);
+    }
+
+    const Field theta = TMATH_NAMESPACE_NAME::acos(cos_theta);
+    const Field inv_sin_theta = one / TMATH_NAMESPACE_NAME::sqrt(one - cos_theta * cos_theta);
+    const Field k0 = TMATH_NAMESPACE_NAME::sin((one - ft) * theta) * inv_sin_theta;
+    const Field k1 = TMATH_NAMESPACE_NAME::sin(ft * theta) * inv_sin_theta * sign;
+    return {
+        a.data[0] * k0 + b.data[0] * k1,
+        a.data[1] * k0 + b.data[1] * k1,
+        a.data[2] * k0 + b.data[2] * k1,
+        a.data[3] * k0 + b.data[3] * k1
+    };
 }
 
 
 
 
 // ...参数是 Quat 类型全名
-#define TMATH_GENERIC_QUAT_OPERATORS(...)
+#define TMATH_GENERIC_QUAT_OPERATORS(...) \
+    friend constexpr inline bool operator==(const __VA_ARGS__& lhs, const __VA_ARGS__& rhs) noexcept \
+    { return TMATH_NAMESPACE_NAME::operator==(lhs, rhs); } \
+    \
+    friend constexpr inline bool operator!=(const __VA_ARGS__& lhs, const __VA_ARGS__& rhs) noexcept \
+    { return TMATH_NAMESPACE_NAME::operator!=(lhs, rhs); } \
+    \
+    friend constexpr inline __VA_ARGS__ operator*(const __VA_ARGS__& lhs, const __VA_ARGS__& rhs) noexcept \
+    { return TMATH_NAMESPACE_NAME::operator*(lhs, rhs); } \
+    \
+    friend constexpr inline __VA_ARGS__& operator*=(__VA_ARGS__& lhs, const __VA_ARGS__& rhs) noexcept \
+    { return TMATH_NAMESPACE_NAME::operator*=(lhs, rhs); } \
+    \
+    template<TMATH_NAMESPACE_NAME::is_vector4 Vec4> \
+    friend constexpr inline __VA_ARGS__& operator*=(__VA_ARGS__& lhs, const Vec4& rhs) noexcept \
+    { return TMATH_NAMESPACE_NAME::operator*=(lhs, rhs); }
 
 #define TMATH_QUAT_OPERATORS(quat_type_name) TMATH_GENERIC_QUAT_OPERATORS(quat_type_name)
 
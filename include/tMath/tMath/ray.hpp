@@ -0,0 +1,131 @@
+#pragma once
+
+#include "impl/fwd_vector.hpp"
+#include "impl/math_defs.hpp"
+#include "bounds.hpp"
+#include "number.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+TMATH_NAMESPACE_BEGIN
+
+// 光线与三角形 / AABB 的求交，光线上的点为 origin + t * direction，direction 不要求是单位向量
+// 求交函数只在找到比 hit.t 更近的交点时更新 hit，hit.t 的初始值就是光线的最远距离，依次测试多个图元即可得到最近的交点
+// 计算顺序与 tSimd 的批量版本 (tsimd::intersect_*) 相同，不支持 FMA 的指令集结果完全一致
+
+// ============================================= types =============================================
+
+template<is_vector3_floating_point Vec3>
+struct Ray
+{
+    Vec3 origin;
+    Vec3 direction;
+};
+
+/**
+ * t 为交点在光线上的参数，(u, v) 为三角形的重心坐标: 交点 = (1 - u - v) * v0 + u * v1 + v * v2
+ * 与 AABB 求交时只使用 t
+ */
+template<is_floating_point F>
+struct RayHit
+{
+    F t;
+    F u;
+    F v;
+};
+
+
+
+// ============================================= functions =============================================
+
+template<is_vector3_floating_point Vec3>
+constexpr Vec3 ray_at(const Ray<Vec3>& ray, const vector_component_t<Vec3> t) noexcept
+{
+    return {
+        ray.origin.data[0] + t * ray.direction.data[0],
+        ray.origin.data[1] + t * ray.direction.data[1],
+        ray.origin.data[2] + t * ray.direction.data[2]
+    };
+}
+
+/**
+ * Möller–Trumbore 光线与三角形求交，双面 (不剔除背面)
+ * 与三角形所在平面平行的光线 (det == 0) 没有交点
+ * 参考: Möller, Trumbore, "Fast, Minimum Storage Ray/Triangle Intersection"
+ * @param t_min 交点需要满足 t_min < t < hit.t
+ * @return 是否更新了 hit
+ */
+template<is_vector3_floating_point Vec3>
+constexpr bool intersect_triangle(const Ray<Vec3>& ray, const Vec3& v0, const Vec3& v1, const Vec3& v2,
+                                  const vector_component_t<Vec3> t_min, RayHit<vector_component_t<Vec3>>& hit) noexcept
+{
+    using Field = vector_component_t<Vec3>;
+    const Field ox = ray.origin.data[0], oy = ray.origin.data[1], oz = ray.origin.data[2];
+    const Field dx = ray.direction.data[0], dy = ray.direction.data[1], dz = ray.direction.data[2];
+
+    const Field e1x = v1.data[0] - v0.data[0], e1y = v1.data[1] - v0.data[1], e1z = v1.data[2] - v0.data[2];
+    const Field e2x = v2.data[0] - v0.data[0], e2y = v2.data[1] - v0.data[1], e2z = v2.data[2] - v0.data[2];
+
+    // p = cross(d, e2)
+    const Field px = dy * e2z - dz * e2y;
+    const Field py = dz * e2x - dx * e2z;
+    const Field pz = dx * e2y - dy * e2x;
+    const Field inv_det = static_cast<Field>(1) / (e1x * px + e1y * py + e1z * pz);
+
+    // s = o - v0，q = cross(s, e1)
+    const Field sx = ox - v0.data[0], sy = oy - v0.data[1], sz = oz - v0.data[2];
+    const Field u = (sx * px + sy * py + sz * pz) * inv_det;
+    const Field qx = sy * e1z - sz * e1y;
+    const Field qy = sz * e1x - sx * e1z;
+    const Field qz = sx * e1y - sy * e1x;
+    const Field v = (dx * qx + dy * qy + dz * qz) * inv_det;
+    const Field t = (e2x * qx + e2y * qy + e2z * qz) * inv_det;
+
+    // det == 0 时 u / v 为 inf 或 NaN，下面的比较不会成立
+    if (u >= 0 && v >= 0 && u + v <= 1 && t > t_min && t < hit.t)
+    {
+        hit = { t, u, v };
+        return true;
+    }
+    return false;
+}
+
+/**
+ * slab 方法的光线与 AABB 求交，hit.t 更新为进入 AABB 的距离 (起点在 AABB 内时为 t_min)，不修改 hit.u / hit.v
+ * 方向分量为0时 1 / d 为 inf，起点恰好在该轴的边界平面上时结果不确定 (0 * inf)
+ * min / max 按 x86 的 minps / maxps 定义 (a < b ? a : b)，与 tSimd 的结果完全一致
+ * @param t_min 交点需要满足 t_min <= t < hit.t
+ * @return 是否更新了 hit
+ */
+template<is_vector3_floating_point Vec3>
+constexpr bool intersect_aabb(const Ray<Vec3>& ray, const AABB<Vec3>& box,
+                              const vector_component_t<Vec3> t_min, RayHit<vector_component_t<Vec3>>& hit) noexcept
+{
+    using Field = vector_component_t<Vec3>;
+    const auto min_ = [](const Field a, const Field b) { return a < b ? a : b; };
+    const auto max_ = [](const Field a, const Field b) { return a > b ? a : b; };
+
+    // 每个轴上进入 / 离开 slab 的距离
+    Field t_in[3], t_out[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const Field inv = static_cast<Field>(1) / ray.direction.data[i];
+        const Field t0 = (box.min.data[i] - ray.origin.data[i]) * inv;
+        const Field t1 = (box.max.data[i] - ray.origin.data[i]) * inv;
+        t_in[i] = min_(t0, t1);
+        t_out[i] = max_(t0, t1);
+    }
+    const Field t_near = max_(max_(max_(t_in[0], t_in[1]), t_in[2]), t_min);
+    const Field t_far = min_(min_(t_out[0], t_out[1]), t_out[2]);
+
+    if (t_near <= t_far && t_near < hit.t)
+    {
+        hit.t = t_near;
+        return true;
+    }
+    return false;
+}
+
+TMATH_NAMESPACE_END
+
+TMATH_DIAGNOSTICS_POP
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "impl/platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * 以 Op::Lanes 为步长遍历 [0, count)，末尾不足一个batch的元素也只调用一次fn，不需要再写标量的剩余循环
+ *
+ * fn 的签名: void(size_t offset, auto lanes)
+ * 1. 完整的batch: lanes 为 std::integral_constant<size_t, Op::Lanes>
+ * 2. 末尾的batch: lanes 为剩余元素个数 (size_t, 一定小于 Op::Lanes)
+ * 在 fn 内部统一使用 Op::load_partial / Op::store_partial 读写即可，完整batch时编译期会折叠成普通的 loadu / storeu
+ *
+ * 注意: fn 需要标记 TSIMD_DYN_FUNC_ATTR，GCC/clang 不会把指令集不一致的 SimdOp 函数内联到 fn 中
+ *
+ * @code
+ * for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+ * {
+ *     batch_t a = op::load_partial(arr + i, lanes);
+ *     op::store_partial(out + i, op::add(a, a), lanes);
+ * });
+ * @endcode
+ */
+template<typename Op, typename Fn>
+TMATH_FORCE_INLINE void for_each_batch(const size_t count, Fn&& fn) noexcept(std::is_nothrow_invocable_v<Fn&, size_t, size_t>)
+{
+    constexpr size_t Lanes = Op::Lanes;
+
+    size_t i = 0;
+    for (; i + Lanes <= count; i += Lanes)
+    {
+        fn(i, std::integral_constant<size_t, Lanes>{});
+    }
+
+    if (i < count)
+    {
+        fn(i, count - i);
+    }
+}
+
+namespace detail
+{
+    template<typename Fn, size_t... K>
+    TMATH_FORCE_INLINE void unroll_impl(Fn& fn, std::index_sequence<K...>)
+    {
+        (fn(std::integral_constant<size_t, K>{}), ...);
+    }
+}
+
+/**
+ * 依次调用 fn(std::integral_constant<size_t, K>{})，K = 0, 1, ..., N - 1，在编译期展开
+ * 用于多个独立的累加器: 每个累加器是一条单独的依赖链，可以隐藏 add / mul_add 的延迟
+ * 与 for_each_batch 一样，fn 需要标记 TSIMD_DYN_FUNC_ATTR
+ *
+ * @code
+ * unroll<4>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+ * {
+ *     acc[k] = op::add(acc[k], op::loadu(arr + i + k * op::Lanes));
+ * });
+ * @endcode
+ */
+template<size_t N, typename Fn>
+TMATH_FORCE_INLINE void unroll(Fn&& fn)
+{
+    detail::unroll_impl(fn, std::make_index_sequence<N>{});
+}
+
+namespace detail
+{
+    template<size_t Lanes, typename Fn, size_t... K>
+    TMATH_FORCE_INLINE void unrolled_block(Fn& fn, const size_t i, std::index_sequence<K...>)
+    {
+        (fn(std::integral_constant<size_t, K>{}, i + K * Lanes, std::integral_constant<size_t, Lanes>{}), ...);
+    }
+}
+
+/**
+ * 与 for_each_batch 相同，但每次循环处理 U 个完整的batch (在编译期展开)
+ * fn 的签名: void(auto k, size_t offset, auto lanes)，k 为 std::integral_constant<size_t, ...>，表示使用第几个累加器
+ * 1. 每组 U 个完整的batch: k = 0, 1, ..., U - 1
+ * 2. 剩余不到 U 个的完整batch: k = 0 (已经不需要隐藏延迟)
+ * 3. 末尾不足一个batch的元素: k = min(1, U - 1)，lanes 为剩余元素个数 (size_t)
+ * 不需要累加器的函数 (例如 y = a * x + y) 忽略 k 即可，展开只是为了减少循环的开销
+ */
+template<typename Op, size_t U, typename Fn>
+TMATH_FORCE_INLINE void for_each_batch_unrolled(const size_t count, Fn&& fn)
+{
+    static_assert(U > 0);
+    constexpr size_t Lanes = Op::Lanes;
+    constexpr size_t Block = U * Lanes;
+
+    size_t i = 0;
+    for (; i + Block <= count; i += Block)
+    {
+        detail::unrolled_block<Lanes>(fn, i, std::make_index_sequence<U>{});
+    }
+    for (; i + Lanes <= count; i += Lanes)
+    {
+        fn(std::integral_constant<size_t, 0>{}, i, std::integral_constant<size_t, Lanes>{});
+    }
+    if (i < count)
+    {
+        fn(std::integral_constant<size_t, (U > 1 ? 1 : 0)>{}, i, count - i);
+    }
+}
+
+// ------------------------------------------ 存储方式的选择 ------------------------------------------
+
+namespace detail
+{
+    inline std::atomic<size_t> streaming_store_threshold{ 16 * 1024 * 1024 };
+}
+
+/**
+ * 批量函数的输出超过这个字节数 (默认 16MB，大约是 LLC 的大小) 时，完整的batch使用 stream (非时间性存储)
+ * 远大于 LLC 的输出用普通的 store 会把有用的数据挤出缓存，并且每个缓存行都要先读一次 (RFO)，内存流量翻倍
+ * 0 表示总是使用 stream，SIZE_MAX 表示从不使用
+ */
+inline size_t streaming_store_threshold() noexcept
+{
+    return detail::streaming_store_threshold.load(std::memory_order_relaxed);
+}
+
+inline void set_streaming_store_threshold(const size_t bytes) noexcept
+{
+    detail::streaming_store_threshold.store(bytes, std::memory_order_relaxed);
+}
+
+// for_each_batch_store 使用 stream 时，完整batch的 lanes 类型
+template<size_t Lanes>
+struct StreamingLanes : std::integral_constant<size_t, Lanes> {};
+
+template<typename T>
+inline constexpr bool is_streaming_lanes_v = false;
+
+template<size_t Lanes>
+inline constexpr bool is_streaming_lanes_v<StreamingLanes<Lanes>> = true;
+
+// out 写入 count 个元素时，是否使用 stream: 超过阈值，并且 out 按 BatchAlignment 对齐
+template<typename Op>
+bool use_streaming_store(const typename Op::scalar_t* out, const size_t count) noexcept
+{
+    return count * Op::ElementSize >= streaming_store_threshold() && reinterpret_cast<uintptr_t>(out) % Op::BatchAlignment == 0;
+}
+
+/**
+ * 与 for_each_batch 相同，out 为输出的起点 (多个输出时传入第一个，其他输出需要有相同的对齐)
+ * use_streaming_store 为 true 时，完整的batch的 lanes 为 StreamingLanes<Op::Lanes>，fn 中用 TSIMD_STORE_BATCH 存储
+ * 返回是否使用了 stream，为 true 时需要在最后调用 Op::fence()
+ *
+ * @code
+ * if (for_each_batch_store<op>(N, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+ * {
+ *     TSIMD_STORE_BATCH(op, out + i, op::add(op::load_partial(a + i, lanes), vb), lanes);
+ * }))
+ * {
+ *     op::fence();
+ * }
+ * @endcode
+ */
+template<typename Op, typename Fn>
+TMATH_FORCE_INLINE bool for_each_batch_store(const size_t count, const typename Op::scalar_t* out, Fn&& fn) noexcept(std::is_nothrow_invocable_v<Fn&, size_t, size_t>)
+{
+    constexpr size_t Lanes = Op::Lanes;
+
+    const bool streaming = use_streaming_store<Op>(out, count);
+    size_t i = 0;
+    if (streaming)
+    {
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            fn(i, StreamingLanes<Lanes>{});
+        }
+    }
+    else
+    {
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            fn(i, std::integral_constant<size_t, Lanes>{});
+        }
+    }
+
+    if (i < count)
+    {
+        fn(i, count - i);
+    }
+    return streaming;
+}
+
+// 根据 lanes 的类型选择 op::stream 或 op::store_partial
+#define TSIMD_STORE_BATCH(op, mem, v, lanes) \
+    do \
+    { \
+        if constexpr (::tsimd::is_streaming_lanes_v<std::remove_cvref_t<decltype(lanes)>>) \
+        { \
+            op::stream(mem, v); \
+        } \
+        else \
+        { \
+            op::store_partial(mem, v, lanes); \
+        } \
+    } while (false)
+
+TSIMD_NAMESPACE_END
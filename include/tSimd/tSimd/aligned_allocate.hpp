@@ -11,6 +11,9 @@
 
 TSIMD_NAMESPACE_BEGIN
 
+// x86 的缓存行大小，不使用 std::hardware_destructive_interference_size (GCC 会对它给出 ABI 警告)
+inline constexpr size_t CacheLineSize = 64;
+
 inline void* aligned_allocate(size_t bytes, size_t alignment) noexcept
 {
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
@@ -42,8 +45,26 @@ inline void aligned_free(void* mem) noexcept
 }
 
 
-// 以最大对齐字节进行分配
-template<typename T>
+// AlignedAllocator 的默认分配策略: 以最大对齐字节进行分配 (aligned_allocate)
+// 其他策略见 page_allocate.hpp (大页 / NUMA)，策略需要提供 allocate(bytes) / deallocate(ptr, bytes) / operator==
+struct DefaultAllocPolicy
+{
+    [[nodiscard]] static void* allocate(const size_t bytes) noexcept
+    {
+        static size_t align = InstructionSelector::required_alignment();
+        return aligned_allocate(bytes, align);
+    }
+
+    static void deallocate(void* const mem, const size_t /*bytes*/) noexcept
+    {
+        aligned_free(mem);
+    }
+
+    constexpr bool operator==(const DefaultAllocPolicy&) const noexcept = default;
+};
+
+// 以最大对齐字节进行分配，Policy 决定内存的来源
+template<typename T, typename Policy = DefaultAllocPolicy>
 struct AlignedAllocator
 {
     static_assert(!std::is_const_v<T>);
@@ -54,6 +75,10 @@ struct AlignedAllocator
     using size_type       = size_t;
     using difference_type = ptrdiff_t;
 
+    // 有状态的策略 (例如 NUMA 节点) 跟随容器移动
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
     static size_t alignment()
     {
         return InstructionSelector::required_alignment();
@@ -61,10 +86,12 @@ struct AlignedAllocator
 
     constexpr AlignedAllocator() noexcept = default;
 
+    constexpr explicit AlignedAllocator(const Policy& policy) noexcept : policy(policy) {}
+
     constexpr AlignedAllocator(const AlignedAllocator&) noexcept = default;
 
     template <class Other>
-    constexpr AlignedAllocator(const AlignedAllocator<Other>&) noexcept {}
+    constexpr AlignedAllocator(const AlignedAllocator<Other, Policy>& other) noexcept : policy(other.policy) {}
 
     constexpr ~AlignedAllocator() = default;
 
@@ -72,10 +99,7 @@ struct AlignedAllocator
 
     [[nodiscard]] constexpr T* allocate(const size_t count)
     {
-        static size_t align = InstructionSelector::required_alignment();
-
-        size_t bytes = count * sizeof(T);
-        void* ptr = aligned_allocate(bytes, align);
+        void* ptr = policy.allocate(count * sizeof(T));
 
         if (!ptr)
         {
@@ -87,8 +111,16 @@ struct AlignedAllocator
 
     constexpr void deallocate(T* const mem, const size_t count)
     {
-        aligned_free(mem);
+        policy.deallocate(mem, count * sizeof(T));
     }
+
+    template <class Other>
+    constexpr bool operator==(const AlignedAllocator<Other, Policy>& other) const noexcept
+    {
+        return policy == other.policy;
+    }
+
+    TMATH_NO_UNIQUE_ADDRESS Policy policy{};
 };
 
 TSIMD_NAMESPACE_END
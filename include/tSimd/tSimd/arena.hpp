@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "impl/platform.hpp"
+#include "aligned_allocate.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * 线性 (bump) 分配器，用于每帧的临时缓冲区
+ * 预先分配一大块内存，每次分配只移动偏移量 (O(1))，不能单独释放，只能整体 reset 或回退到 marker
+ *
+ * 1. 默认按 InstructionSelector::required_alignment() 对齐，可以直接交给 load / store
+ * 2. 当前块不够时，分配一个新的块 (至少 block_size)，reset 时把所有块合并成一个，之后的帧不再需要新的块
+ * 3. 不会调用析构函数，只能存放 trivially destructible 的类型
+ *
+ * 不是线程安全的，多线程请使用 thread_local_arena()
+ */
+class SimdArena final
+{
+public:
+    // 块的对齐，取缓存行和 SIMD 对齐中较大的一个，所以 allocate 的 alignment 不能超过它
+    static size_t block_alignment() noexcept
+    {
+        return std::max(CacheLineSize, InstructionSelector::required_alignment());
+    }
+
+    // 回退的位置
+    struct Marker
+    {
+        size_t block;
+        size_t offset;
+    };
+
+    static constexpr size_t DefaultBlockSize = 1024 * 1024;
+
+    explicit SimdArena(const size_t block_size = DefaultBlockSize) : block_size_(std::max<size_t>(block_size, 1))
+    {
+        blocks_.push_back(allocate_block(block_size_));
+    }
+
+    ~SimdArena()
+    {
+        for (const auto& b : blocks_)
+        {
+            aligned_free(b.data);
+        }
+    }
+
+    SimdArena(const SimdArena&) = delete;
+    SimdArena& operator=(const SimdArena&) = delete;
+
+    /**
+     * 分配 bytes 字节，alignment 必须是 2 的幂且不超过 block_alignment()
+     * bytes == 0 时也返回一个有效的指针
+     */
+    [[nodiscard]] void* allocate(const size_t bytes, const size_t alignment = InstructionSelector::required_alignment())
+    {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= block_alignment());
+
+        const Block& b = blocks_[current_];
+        const size_t p = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (p + bytes <= b.size) [[likely]]
+        {
+            offset_ = p + bytes;
+            return b.data + p;
+        }
+        return allocate_slow(bytes); // 新的块的起点满足任何 alignment
+    }
+
+    // 分配 count 个 T，不进行初始化
+    template<typename T>
+        requires std::is_trivially_destructible_v<T>
+    [[nodiscard]] std::span<T> allocate_span(const size_t count)
+    {
+        const size_t alignment = std::max(alignof(T), InstructionSelector::required_alignment());
+        return { static_cast<T*>(allocate(count * sizeof(T), alignment)), count };
+    }
+
+    // 如果 [ptr, ptr + bytes) 是最后一次分配的内存，回收这部分，否则什么也不做
+    void deallocate(void* const ptr, const size_t bytes) noexcept
+    {
+        const Block& b = blocks_[current_];
+        if (static_cast<std::byte*>(ptr) + bytes == b.data + offset_)
+        {
+            offset_ = static_cast<size_t>(static_cast<std::byte*>(ptr) - b.data);
+        }
+    }
+
+    [[nodiscard]] Marker marker() const noexcept
+    {
+        return { current_, offset_ };
+    }
+
+    // 释放 marker 之后分配的所有内存，marker 之后又 rewind 到更早位置的 marker 会失效
+    void rewind(const Marker m) noexcept
+    {
+        assert(m.block < current_ || (m.block == current_ && m.offset <= offset_));
+        current_ = m.block;
+        offset_ = m.offset;
+    }
+
+    // 释放所有内存，如果这一帧使用了多个块，合并成一个足够大的块
+    void reset()
+    {
+        current_ = 0;
+        offset_ = 0;
+        if (blocks_.size() == 1)
+        {
+            return;
+        }
+
+        const size_t total = capacity();
+        for (const auto& b : blocks_)
+        {
+            aligned_free(b.data);
+        }
+        blocks_.clear();
+        blocks_.push_back(allocate_block(total));
+    }
+
+    // 已经使用的字节数 (包括对齐的填充和前面的块末尾没有用到的部分)
+    [[nodiscard]] size_t used() const noexcept
+    {
+        size_t n = offset_;
+        for (size_t i = 0; i < current_; ++i)
+        {
+            n += blocks_[i].size;
+        }
+        return n;
+    }
+
+    // 所有块的总字节数
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        size_t n = 0;
+        for (const auto& b : blocks_)
+        {
+            n += b.size;
+        }
+        return n;
+    }
+
+    [[nodiscard]] size_t block_count() const noexcept
+    {
+        return blocks_.size();
+    }
+
+private:
+    struct Block
+    {
+        std::byte* data;
+        size_t size;
+    };
+
+    static Block allocate_block(const size_t bytes)
+    {
+        auto* data = aligned_allocate<std::byte*>(bytes, block_alignment());
+        if (!data)
+        {
+            throw std::bad_alloc();
+        }
+        return { data, bytes };
+    }
+
+    void* allocate_slow(const size_t bytes)
+    {
+        // rewind 之后，后面的块可以重复使用
+        while (current_ + 1 < blocks_.size())
+        {
+            ++current_;
+            offset_ = 0;
+            if (bytes <= blocks_[current_].size)
+            {
+                offset_ = bytes;
+                return blocks_[current_].data;
+            }
+        }
+
+        blocks_.push_back(allocate_block(std::max(block_size_, bytes)));
+        current_ = blocks_.size() - 1;
+        offset_ = bytes;
+        return blocks_[current_].data;
+    }
+
+    std::vector<Block> blocks_;
+    size_t current_ = 0;
+    size_t offset_ = 0;
+    size_t block_size_;
+};
+
+/**
+ * RAII 的作用域，析构时回退到构造时的位置，可以嵌套
+ * {
+ *     ArenaScope scope(arena);
+ *     auto tmp = arena.allocate_span<float>(n);
+ *     ...
+ * } // tmp 被释放
+ */
+class ArenaScope final
+{
+public:
+    explicit ArenaScope(SimdArena& arena) noexcept : arena_(arena), marker_(arena.marker()) {}
+
+    ~ArenaScope()
+    {
+        arena_.rewind(marker_);
+    }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    SimdArena& arena_;
+    SimdArena::Marker marker_;
+};
+
+/**
+ * 从 SimdArena 分配的标准库分配器，例如 std::vector<float, ArenaAllocator<float>>
+ * deallocate 只能回收最后一次分配的内存，vector 扩容时旧的内存直到 reset / rewind 才会释放，最好预先 reserve
+ * 容器的生命周期不能超过 arena 的 reset / rewind
+ */
+template<typename T>
+struct ArenaAllocator
+{
+    static_assert(!std::is_const_v<T>);
+    static_assert(!std::is_function_v<T>);
+    static_assert(!std::is_reference_v<T>);
+
+    using value_type      = T;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+
+    explicit ArenaAllocator(SimdArena& arena) noexcept : arena(&arena) {}
+
+    template <class Other>
+    ArenaAllocator(const ArenaAllocator<Other>& other) noexcept : arena(other.arena) {}
+
+    [[nodiscard]] T* allocate(const size_t count)
+    {
+        const size_t alignment = std::max(alignof(T), InstructionSelector::required_alignment());
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignment));
+    }
+
+    void deallocate(T* const mem, const size_t count) noexcept
+    {
+        arena->deallocate(mem, count * sizeof(T));
+    }
+
+    template <class Other>
+    bool operator==(const ArenaAllocator<Other>& other) const noexcept
+    {
+        return arena == other.arena;
+    }
+
+    SimdArena* arena;
+};
+
+/**
+ * 当前线程的 arena，第一次调用时创建 (DefaultBlockSize)
+ * 在 parallel_for 的 fn 中使用时，每个分块用 ArenaScope 回退，避免一直增长
+ */
+inline SimdArena& thread_local_arena()
+{
+    thread_local SimdArena arena;
+    return arena;
+}
+
+TSIMD_NAMESPACE_END
@@ -9,43 +9,94 @@
 // Scalar
 #if defined(TSIMD_INSTRUCTION_FEATURE_SCALAR)
     #include "impl/ops/Scalar/Scalar_float32.hpp"
+    #include "impl/ops/Scalar/Scalar_float64.hpp"
+    #include "impl/ops/Scalar/Scalar_int32.hpp"
+    #include "impl/ops/Scalar/Scalar_uint32.hpp"
+    #include "impl/ops/Scalar/Scalar_int16.hpp"
+    #include "impl/ops/Scalar/Scalar_uint8.hpp"
 #endif
 
 
 // SSE
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE)
     #include "impl/ops/x86/SSE_family/float32/SSE_float32.hpp"
+    #include "impl/ops/x86/SSE_family/float64/SSE_float64.hpp"
+    #include "impl/ops/x86/SSE_family/int32/SSE_int32.hpp"
+    #include "impl/ops/x86/SSE_family/uint32/SSE_uint32.hpp"
+    #include "impl/ops/x86/SSE_family/int16/SSE_int16.hpp"
+    #include "impl/ops/x86/SSE_family/uint8/SSE_uint8.hpp"
 #endif
 
 // SSE2
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE2)
     #include "impl/ops/x86/SSE_family/float32/SSE2_float32.hpp"
+    #include "impl/ops/x86/SSE_family/float64/SSE2_float64.hpp"
+    #include "impl/ops/x86/SSE_family/int32/SSE2_int32.hpp"
+    #include "impl/ops/x86/SSE_family/uint32/SSE2_uint32.hpp"
+    #include "impl/ops/x86/SSE_family/int16/SSE2_int16.hpp"
+    #include "impl/ops/x86/SSE_family/uint8/SSE2_uint8.hpp"
 #endif
 
 // SSE3
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE3)
     #include "impl/ops/x86/SSE_family/float32/SSE3_float32.hpp"
+    #include "impl/ops/x86/SSE_family/float64/SSE3_float64.hpp"
+    #include "impl/ops/x86/SSE_family/int32/SSE3_int32.hpp"
+    #include "impl/ops/x86/SSE_family/uint32/SSE3_uint32.hpp"
+    #include "impl/ops/x86/SSE_family/int16/SSE3_int16.hpp"
+    #include "impl/ops/x86/SSE_family/uint8/SSE3_uint8.hpp"
 #endif
 
 // SSE4.1
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE4_1)
     #include "impl/ops/x86/SSE_family/float32/SSE4_1_float32.hpp"
+    #include "impl/ops/x86/SSE_family/float64/SSE4_1_float64.hpp"
+    #include "impl/ops/x86/SSE_family/int32/SSE4_1_int32.hpp"
+    #include "impl/ops/x86/SSE_family/uint32/SSE4_1_uint32.hpp"
+    #include "impl/ops/x86/SSE_family/int16/SSE4_1_int16.hpp"
+    #include "impl/ops/x86/SSE_family/uint8/SSE4_1_uint8.hpp"
 #endif
 
 
 // AVX
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX)
     #include "impl/ops/x86/AVX_family/float32/AVX_float32.hpp"
+    #include "impl/ops/x86/AVX_family/float64/AVX_float64.hpp"
+    #include "impl/ops/x86/AVX_family/int32/AVX_int32.hpp"
+    #include "impl/ops/x86/AVX_family/uint32/AVX_uint32.hpp"
+    #include "impl/ops/x86/AVX_family/int16/AVX_int16.hpp"
+    #include "impl/ops/x86/AVX_family/uint8/AVX_uint8.hpp"
 #endif
 
 // AVX2
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2)
     #include "impl/ops/x86/AVX_family/float32/AVX2_float32.hpp"
+    #include "impl/ops/x86/AVX_family/float64/AVX2_float64.hpp"
+    #include "impl/ops/x86/AVX_family/int32/AVX2_int32.hpp"
+    #include "impl/ops/x86/AVX_family/uint32/AVX2_uint32.hpp"
+    #include "impl/ops/x86/AVX_family/int16/AVX2_int16.hpp"
+    #include "impl/ops/x86/AVX_family/uint8/AVX2_uint8.hpp"
 #endif
 
 // AVX2 + FMA3
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2) && defined(TSIMD_INSTRUCTION_FEATURE_FMA3)
     #include "impl/ops/x86/AVX_family/float32/AVX2_FMA3_float32.hpp"
+    #include "impl/ops/x86/AVX_family/float64/AVX2_FMA3_float64.hpp"
+    #include "impl/ops/x86/AVX_family/int32/AVX2_FMA3_int32.hpp"
+    #include "impl/ops/x86/AVX_family/uint32/AVX2_FMA3_uint32.hpp"
+    #include "impl/ops/x86/AVX_family/int16/AVX2_FMA3_int16.hpp"
+    #include "impl/ops/x86/AVX_family/uint8/AVX2_FMA3_uint8.hpp"
+#endif
+
+
+// AVX512_F
+#if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+    #include "impl/ops/x86/AVX512_family/float32/AVX512_F_float32.hpp"
+    #include "impl/ops/x86/AVX512_family/float64/AVX512_F_float64.hpp"
+    #include "impl/ops/x86/AVX512_family/int32/AVX512_F_int32.hpp"
+    #include "impl/ops/x86/AVX512_family/uint32/AVX512_F_uint32.hpp"
+    #include "impl/ops/x86/AVX512_family/int16/AVX512_F_int16.hpp"
+    #include "impl/ops/x86/AVX512_family/uint8/AVX512_F_uint8.hpp"
 #endif
 
 // clang-format on
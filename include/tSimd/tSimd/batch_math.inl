@@ -0,0 +1,335 @@
+// 注意: 这个文件没有 #pragma once，需要在 dispatch_this_file.hpp 和 batch.hpp 之后包含，
+// 每一遍 dispatch 都会重新包含一次，为当前的 TSIMD_DYN_INSTRUCTION 生成一份 float32 的向量数学函数
+//
+// 用法:
+// #define TSIMD_DISPATCH_THIS_FILE "this_file.cpp"
+// #include <tSimd/dispatch_this_file.hpp>
+// #include <tSimd/batch.hpp>
+// #include <tSimd/batch_math.inl>
+//
+// 然后在 TSIMD_DYN_FUNC_ATTR 函数中调用 math::sin(batch) / math::exp(batch) 等
+//
+// 实现参考 Cephes 的单精度版本: 先做无分支的区间规约 (round + Cody-Waite)，再计算多项式，
+// 特殊值 (inf / NaN / 0 / 负数) 全部通过 cmp_* + select 处理，没有任何逐lane的分支
+//
+// 误差 (与double精度的 std:: 函数比较，在下面的区间内测得的最大ULP，所有后端一致，见 tests/tSimd/batch/test_math.inl):
+// sin / cos / sincos  |x| <= 8192         2.5 ulp (|x| <= pi 时 1.5 ulp)
+// tan                 |x| <= 8192         3.5 ulp
+// exp                 [-87, 88]           1 ulp
+// exp2                [-126, 127]         1.5 ulp
+// log                 (0, FLT_MAX]        1 ulp (包括非正规数)
+// log2                (0, FLT_MAX]        1.5 ulp (包括非正规数)
+// pow                 见 pow 的注释
+// atan                全部                2.5 ulp
+// atan2               全部有限值           2 ulp
+// sqrt                全部                0.5 ulp (IEEE 754 正确舍入)
+// rsqrt               全部                1.5 ulp (1 / sqrt，不是 rsqrt 近似指令)
+
+#if !defined(TSIMD_DYN_INSTRUCTION)
+    #error "include <tSimd/dispatch_this_file.hpp> before batch_math.inl"
+#endif
+
+#include <limits>
+
+#undef TSIMD_DETAIL_MATH_FUNC
+#define TSIMD_DETAIL_MATH_FUNC TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION::math
+{
+    using op_f32 = TSIMD_DYN_SIMD_OP(float32);
+    using batch_f32 = op_f32::batch_t;
+    using mask_f32 = op_f32::mask_t;
+
+    namespace detail
+    {
+        // 多项式求值 (Horner): ((c0 * x + c1) * x + c2) * x + ...
+        template<typename... Coefficients>
+        TSIMD_DETAIL_MATH_FUNC batch_f32 poly(const batch_f32 x, const float32 c0, const Coefficients... cs) noexcept
+        {
+            batch_f32 y = op_f32::set(c0);
+            ((y = op_f32::mul_add(y, x, op_f32::set(cs))), ...);
+            return y;
+        }
+
+        TSIMD_DETAIL_MATH_FUNC batch_f32 neg(const batch_f32 x) noexcept
+        {
+            return op_f32::sub(op_f32::zero(), x);
+        }
+
+        TSIMD_DETAIL_MATH_FUNC mask_f32 is_nan(const batch_f32 x) noexcept
+        {
+            return op_f32::cmp_ne(x, x);
+        }
+
+        // 钳制到 [lo, hi]，NaN 保持不变
+        TSIMD_DETAIL_MATH_FUNC batch_f32 clamp(const batch_f32 x, const float32 lo, const float32 hi) noexcept
+        {
+            const batch_f32 vlo = op_f32::set(lo);
+            const batch_f32 vhi = op_f32::set(hi);
+            const batch_f32 t = op_f32::select(op_f32::cmp_lt(x, vlo), vlo, x);
+            return op_f32::select(op_f32::cmp_gt(t, vhi), vhi, t);
+        }
+
+        // y * 2^n，n 为整数值，范围 [-252, 254]
+        // 拆成两次 exp2i，避免 2^n 本身溢出或者成为非正规数，结果的上溢/下溢由最后一次乘法自然产生
+        TSIMD_DETAIL_MATH_FUNC batch_f32 scale_by_exp2(const batch_f32 y, const batch_f32 n) noexcept
+        {
+            const batch_f32 n1 = op_f32::round(op_f32::mul_add(n, op_f32::set(0.5f), op_f32::set(-0.25f))); // floor(n / 2)
+            const batch_f32 n2 = op_f32::sub(n, n1);
+            return op_f32::mul(op_f32::mul(y, op_f32::exp2i(n1)), op_f32::exp2i(n2));
+        }
+
+        // x = 2^e * (1 + t)，t 的范围 [sqrt(0.5) - 1, sqrt(2) - 1]，只对正数和非正规数有效
+        TSIMD_DETAIL_MATH_FUNC void log_reduce(const batch_f32 x, batch_f32& t, batch_f32& e) noexcept
+        {
+            // 非正规数先放大 2^23，保证 get_exponent / get_mantissa 在所有后端的结果一致
+            const mask_f32 denormal = op_f32::cmp_lt(x, op_f32::set(1.17549435e-38f));
+            const batch_f32 xs = op_f32::select(denormal, op_f32::mul(x, op_f32::set(8388608.0f)), x);
+
+            batch_f32 m = op_f32::get_mantissa(xs);
+            e = op_f32::add(op_f32::get_exponent(xs), op_f32::select(denormal, op_f32::set(-23.0f), op_f32::zero()));
+
+            const mask_f32 big = op_f32::cmp_gt(m, op_f32::set(1.41421356237309504880f));
+            m = op_f32::select(big, op_f32::mul(m, op_f32::set(0.5f)), m);
+            e = op_f32::select(big, op_f32::add(e, op_f32::set(1.0f)), e);
+
+            t = op_f32::sub(m, op_f32::set(1.0f));
+        }
+
+        // log(1 + t) - t 的高阶部分，不包括 -0.5 * t^2
+        TSIMD_DETAIL_MATH_FUNC batch_f32 log_poly(const batch_f32 t, const batch_f32 z) noexcept
+        {
+            const batch_f32 p = poly(t,
+                7.0376836292E-2f, -1.1514610310E-1f, 1.1676998740E-1f,
+                -1.2420140846E-1f, 1.4249322787E-1f, -1.6668057665E-1f,
+                2.0000714765E-1f, -2.4999993993E-1f, 3.3333331174E-1f);
+            return op_f32::mul(op_f32::mul(t, z), p);
+        }
+
+        // log / log2 的特殊值: +inf -> +inf, 0 -> -inf, 负数 / NaN -> NaN
+        TSIMD_DETAIL_MATH_FUNC batch_f32 log_special(const batch_f32 x, const batch_f32 y) noexcept
+        {
+            constexpr float32 inf = std::numeric_limits<float32>::infinity();
+
+            batch_f32 r = op_f32::select(op_f32::cmp_eq(x, op_f32::set(inf)), x, y);
+            r = op_f32::select(op_f32::cmp_eq(x, op_f32::zero()), op_f32::set(-inf), r);
+            const mask_f32 invalid = op_f32::mask_or(op_f32::cmp_lt(x, op_f32::zero()), is_nan(x));
+            return op_f32::select(invalid, op_f32::set(std::numeric_limits<float32>::quiet_NaN()), r);
+        }
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 sqrt(const batch_f32 x) noexcept
+    {
+        return op_f32::sqrt(x);
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 rsqrt(const batch_f32 x) noexcept
+    {
+        return op_f32::div(op_f32::set(1.0f), op_f32::sqrt(x));
+    }
+
+    /**
+     * 同时计算 sin 和 cos，sin / cos / tan 都基于这个函数
+     * x = q * pi/2 + r，|r| <= pi/4，pi/2 拆成四段 (Cody-Waite)
+     * 前三段的有效位不超过11位，|x| <= 8192 时 q * C 都是精确的，所以在 k * pi/2 附近 (sin / cos 的零点) 也能保持相对误差
+     * |x| 更大时精度逐渐下降，inf / NaN 的结果为 NaN
+     */
+    TSIMD_DETAIL_MATH_FUNC void sincos(const batch_f32 x, batch_f32& out_sin, batch_f32& out_cos) noexcept
+    {
+        const batch_f32 q = op_f32::round(op_f32::mul(x, op_f32::set(0.636619772367581343076f)));
+
+        batch_f32 r = op_f32::mul_add(q, op_f32::set(-1.5703125f), x);
+        r = op_f32::mul_add(q, op_f32::set(-4.837512969970703125e-4f), r);
+        r = op_f32::mul_add(q, op_f32::set(-7.549533620476723e-8f), r);
+        r = op_f32::mul_add(q, op_f32::set(-2.5633440682570896e-12f), r);
+        const batch_f32 z = op_f32::mul(r, r);
+
+        // sin(r) = r + r^3 * P(r^2)
+        const batch_f32 ps = op_f32::mul_add(op_f32::mul(z, r), detail::poly(z, -1.9515295891E-4f, 8.3321608736E-3f, -1.6666654611E-1f), r);
+        // cos(r) = 1 - 0.5 * r^2 + r^4 * P(r^2)
+        const batch_f32 pc = op_f32::add(
+            op_f32::mul_add(op_f32::mul(z, z), detail::poly(z, 2.443315711809948E-5f, -1.388731625493765E-3f, 4.166664568298827E-2f), op_f32::mul(z, op_f32::set(-0.5f))),
+            op_f32::set(1.0f));
+
+        // 象限 m = q mod 4 (q 为整数值，floor(q / 4) = round(q / 4 - 0.375))
+        const batch_f32 m = op_f32::sub(q, op_f32::mul(op_f32::set(4.0f), op_f32::round(op_f32::mul_add(q, op_f32::set(0.25f), op_f32::set(-0.375f)))));
+        const mask_f32 m1 = op_f32::cmp_eq(m, op_f32::set(1.0f));
+        const mask_f32 m2 = op_f32::cmp_eq(m, op_f32::set(2.0f));
+        const mask_f32 m3 = op_f32::cmp_eq(m, op_f32::set(3.0f));
+
+        // m = 1, 3 时 sin / cos 互换; m = 2, 3 时 sin 取反; m = 1, 2 时 cos 取反
+        const mask_f32 swap = op_f32::mask_or(m1, m3);
+        const batch_f32 s = op_f32::select(swap, pc, ps);
+        const batch_f32 c = op_f32::select(swap, ps, pc);
+
+        out_sin = op_f32::select(op_f32::mask_or(m2, m3), detail::neg(s), s);
+        out_sin = op_f32::select(op_f32::cmp_eq(x, op_f32::zero()), x, out_sin); // sin(-0) = -0
+        out_cos = op_f32::select(op_f32::mask_or(m1, m2), detail::neg(c), c);
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 sin(const batch_f32 x) noexcept
+    {
+        batch_f32 s, c;
+        sincos(x, s, c);
+        return s;
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 cos(const batch_f32 x) noexcept
+    {
+        batch_f32 s, c;
+        sincos(x, s, c);
+        return c;
+    }
+
+    // sin / cos，误差是两者之和
+    TSIMD_DETAIL_MATH_FUNC batch_f32 tan(const batch_f32 x) noexcept
+    {
+        batch_f32 s, c;
+        sincos(x, s, c);
+        return op_f32::div(s, c);
+    }
+
+    /**
+     * x = n * ln2 + r，|r| <= ln2 / 2，ln2 拆成两段
+     * x > 88.72 时上溢为 inf，x < -103.97 时下溢为 0，中间为非正规数
+     */
+    TSIMD_DETAIL_MATH_FUNC batch_f32 exp(const batch_f32 x) noexcept
+    {
+        const batch_f32 xc = detail::clamp(x, -104.0f, 89.0f);
+        const batch_f32 n = op_f32::round(op_f32::mul(xc, op_f32::set(1.44269504088896341f)));
+
+        batch_f32 r = op_f32::mul_add(n, op_f32::set(-0.693359375f), xc);
+        r = op_f32::mul_add(n, op_f32::set(2.12194440e-4f), r);
+
+        // exp(r) = 1 + r + r^2 * P(r)
+        const batch_f32 p = detail::poly(r,
+            1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f,
+            4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f);
+        const batch_f32 y = op_f32::add(op_f32::mul_add(op_f32::mul(r, r), p, r), op_f32::set(1.0f));
+
+        return detail::scale_by_exp2(y, n);
+    }
+
+    /**
+     * x = n + r，|r| <= 0.5
+     * x >= 128 时上溢为 inf，x < -150 时下溢为 0，中间为非正规数
+     */
+    TSIMD_DETAIL_MATH_FUNC batch_f32 exp2(const batch_f32 x) noexcept
+    {
+        const batch_f32 xc = detail::clamp(x, -151.0f, 129.0f);
+        const batch_f32 n = op_f32::round(xc);
+        const batch_f32 r = op_f32::sub(xc, n);
+
+        // 2^r = 1 + r * P(r)
+        const batch_f32 p = detail::poly(r,
+            1.535336188319500E-4f, 1.339887440266574E-3f, 9.618437357674640E-3f,
+            5.550332471162809E-2f, 2.402264791363012E-1f, 6.931472028550421E-1f);
+        const batch_f32 y = op_f32::mul_add(r, p, op_f32::set(1.0f));
+
+        return detail::scale_by_exp2(y, n);
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 log(const batch_f32 x) noexcept
+    {
+        batch_f32 t, e;
+        detail::log_reduce(x, t, e);
+        const batch_f32 z = op_f32::mul(t, t);
+
+        // log(x) = e * ln2 + log(1 + t)，ln2 拆成两段
+        batch_f32 y = op_f32::mul_add(e, op_f32::set(-2.12194440e-4f), detail::log_poly(t, z));
+        y = op_f32::mul_add(z, op_f32::set(-0.5f), y);
+        const batch_f32 r = op_f32::mul_add(e, op_f32::set(0.693359375f), op_f32::add(t, y));
+
+        return detail::log_special(x, r);
+    }
+
+    TSIMD_DETAIL_MATH_FUNC batch_f32 log2(const batch_f32 x) noexcept
+    {
+        batch_f32 t, e;
+        detail::log_reduce(x, t, e);
+        const batch_f32 z = op_f32::mul(t, t);
+
+        // log2(x) = e + log(1 + t) * log2(e)，log2(e) = 1 + L，先累加小的项
+        const batch_f32 y = op_f32::mul_add(z, op_f32::set(-0.5f), detail::log_poly(t, z));
+        const batch_f32 L = op_f32::set(0.44269504088896340736f);
+        batch_f32 r = op_f32::mul(y, L);
+        r = op_f32::mul_add(t, L, r);
+        r = op_f32::add(op_f32::add(op_f32::add(r, y), t), e);
+
+        return detail::log_special(x, r);
+    }
+
+    /**
+     * x^y = 2^(y * log2|x|)
+     * log2 的误差会被 y 放大，误差随 |y * log2(x)| 增大: 不超过 2 + |y * log2(x)| ulp
+     *
+     * 特殊值:
+     * 1. y == 0 或 x == 1 时为 1 (即使另一个参数是 NaN)
+     * 2. x < 0: y 为整数时结果为 |x|^y，y 为奇数时取负; y 不是整数时为 NaN
+     * 3. x == 0: y > 0 时为 0，y < 0 时为 inf (不区分 +0 / -0)
+     */
+    TSIMD_DETAIL_MATH_FUNC batch_f32 pow(const batch_f32 x, const batch_f32 y) noexcept
+    {
+        const batch_f32 one = op_f32::set(1.0f);
+        const batch_f32 ax = op_f32::abs(x);
+        batch_f32 r = exp2(op_f32::mul(y, log2(ax)));
+
+        // 负数的底
+        const mask_f32 y_int = op_f32::cmp_eq(op_f32::round(y), y);
+        const batch_f32 half_y = op_f32::mul(y, op_f32::set(0.5f));
+        const mask_f32 y_odd = op_f32::mask_and(y_int, op_f32::cmp_ne(op_f32::round(half_y), half_y));
+        const mask_f32 x_neg = op_f32::cmp_lt(x, op_f32::zero());
+        r = op_f32::select(op_f32::mask_and(x_neg, y_odd), detail::neg(r), r);
+        r = op_f32::select(op_f32::mask_and(x_neg, op_f32::mask_not(y_int)), op_f32::set(std::numeric_limits<float32>::quiet_NaN()), r);
+
+        return op_f32::select(op_f32::mask_or(op_f32::cmp_eq(y, op_f32::zero()), op_f32::cmp_eq(x, one)), one, r);
+    }
+
+    /**
+     * 区间规约到 |x| <= tan(pi/8):
+     * |x| > tan(3pi/8): atan(x) = pi/2 - atan(1/x)
+     * |x| > tan(pi/8):  atan(x) = pi/4 + atan((x - 1) / (x + 1))
+     */
+    TSIMD_DETAIL_MATH_FUNC batch_f32 atan(const batch_f32 x) noexcept
+    {
+        const batch_f32 one = op_f32::set(1.0f);
+        const batch_f32 ax = op_f32::abs(x);
+
+        const mask_f32 big = op_f32::cmp_gt(ax, op_f32::set(2.414213562373095f));
+        const mask_f32 mid = op_f32::mask_and(op_f32::cmp_gt(ax, op_f32::set(0.4142135623730950f)), op_f32::mask_not(big));
+
+        batch_f32 y0 = op_f32::select(mid, op_f32::set(0.785398163397448309616f), op_f32::zero());
+        y0 = op_f32::select(big, op_f32::set(1.57079632679489661923f), y0);
+
+        batch_f32 xr = op_f32::select(mid, op_f32::div(op_f32::sub(ax, one), op_f32::add(ax, one)), ax);
+        xr = op_f32::select(big, detail::neg(op_f32::div(one, ax)), xr);
+
+        const batch_f32 z = op_f32::mul(xr, xr);
+        const batch_f32 p = detail::poly(z, 8.05374449538e-2f, -1.38776856032E-1f, 1.99777106478E-1f, -3.33329491539E-1f);
+        const batch_f32 r = op_f32::add(y0, op_f32::mul_add(op_f32::mul(p, z), xr, xr));
+
+        return op_f32::select(op_f32::cmp_lt(x, op_f32::zero()), detail::neg(r), r);
+    }
+
+    /**
+     * 基于 atan(y / x)，x < 0 时根据 y 的符号加减 pi
+     * 与 std::atan2 的区别: x, y 同时为 0 时结果为 0 (不区分 +0 / -0)，x, y 同时为 inf 时结果为 NaN
+     */
+    TSIMD_DETAIL_MATH_FUNC batch_f32 atan2(const batch_f32 y, const batch_f32 x) noexcept
+    {
+        const batch_f32 zero = op_f32::zero();
+        const batch_f32 pi = op_f32::set(3.14159265358979323846f);
+        const batch_f32 half_pi = op_f32::set(1.57079632679489661923f);
+
+        const mask_f32 y_neg = op_f32::cmp_lt(y, zero);
+        batch_f32 r = atan(op_f32::div(y, x));
+        r = op_f32::select(op_f32::cmp_lt(x, zero), op_f32::add(r, op_f32::select(y_neg, detail::neg(pi), pi)), r);
+
+        // x == 0 时 y / x 的符号取决于 x 的符号位，单独处理
+        batch_f32 on_axis = op_f32::select(op_f32::cmp_gt(y, zero), half_pi, zero);
+        on_axis = op_f32::select(y_neg, detail::neg(half_pi), on_axis);
+        return op_f32::select(op_f32::cmp_eq(x, zero), op_f32::select(detail::is_nan(y), y, on_axis), r);
+    }
+}
+
+#undef TSIMD_DETAIL_MATH_FUNC
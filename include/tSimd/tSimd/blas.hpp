@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+
+#include "impl/platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+class ThreadPool;
+
+/**
+ * float32 的 BLAS level 1 / 2 函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/blas.cpp)
+ * 参数顺序与本库的其他数组函数一致 (指针在前，元素个数在后)，没有 BLAS 的 incx / incy，数组都是连续的
+ * 指针不要求对齐，所有指针都按 BatchAlignment 对齐时使用对齐的 load / store
+ * 输入和输出不能重叠
+ */
+namespace blas
+{
+    // y = alpha * x + y，alpha 为0时直接返回 (与 BLAS 一致，x 中的 NaN 不会传播)
+    void axpy(float32 alpha, const float32* x, float32* y, size_t count) noexcept;
+
+    // y = alpha * x + beta * y，beta 为0时不读取 y (y 可以未初始化)
+    void axpby(float32 alpha, const float32* x, float32 beta, float32* y, size_t count) noexcept;
+
+    // x = alpha * x
+    void scal(float32 alpha, float32* x, size_t count) noexcept;
+
+    // sum(x[i] * y[i])，与 reduce::dot 相同
+    float32 dot(const float32* x, const float32* y, size_t count) noexcept;
+
+    // sqrt(sum(x[i]^2))，平方和上溢或下溢时用 max(|x[i]|) 缩放后重新计算，结果不会因此变成 inf / 0
+    float32 nrm2(const float32* x, size_t count) noexcept;
+
+    // sum(|x[i]|)
+    float32 asum(const float32* x, size_t count) noexcept;
+
+    // 第一个 |x[i]| 最大的元素的下标 (从0开始)，忽略 NaN，count 为0 (或全部是 NaN) 时返回0
+    size_t iamax(const float32* x, size_t count) noexcept;
+
+    enum class Layout : uint8_t
+    {
+        RowMajor,
+        ColumnMajor,
+    };
+
+    /**
+     * y = alpha * A * x + beta * y，A 为 rows x cols 的矩阵，x 有 cols 个元素，y 有 rows 个元素
+     * lda: 行主序时为相邻两行的间隔，列主序时为相邻两列的间隔 (元素个数，不小于 cols / rows)
+     * beta 为0时不读取 y
+     */
+    void gemv(Layout layout, size_t rows, size_t cols, float32 alpha, const float32* A, size_t lda,
+              const float32* x, float32 beta, float32* y) noexcept;
+
+    /**
+     * C = alpha * A * B + beta * C，A 为 M x K，B 为 K x N，C 为 M x N，三个矩阵使用同一种 layout，不支持转置
+     * lda / ldb / ldc: 相邻两行 (行主序) 或相邻两列 (列主序) 的间隔
+     * beta 为0时不读取 C
+     * pool 不为空时，把 C 切分成若干块在线程池中并行计算 (矩阵较小时仍然在当前线程计算)
+     * 每个线程的打包缓冲区分配失败时返回 false (不抛出异常): 单线程时 C 没有被修改，并行时部分块可能已经写入
+     * 实现见 src/tSimd/impl/gemm.cpp
+     */
+    bool gemm(Layout layout, size_t M, size_t N, size_t K, float32 alpha, const float32* A, size_t lda,
+              const float32* B, size_t ldb, float32 beta, float32* C, size_t ldc, ThreadPool* pool = nullptr) noexcept;
+
+    /**
+     * gemm 的分块参数，由运行时选择的指令集决定 (行主序)
+     * mr x nr: 微内核计算的 C 的块，mr * nr / Lanes 个累加器放在寄存器中
+     * kc: B 的 kc x nr 的条带放在 L1 中
+     * mc: A 打包后的 mc x kc 的块放在 L2 中
+     * nc: B 打包后的 kc x nc 的块放在 L3 中
+     */
+    struct GemmBlocking
+    {
+        size_t mr;
+        size_t nr;
+        size_t kc;
+        size_t mc;
+        size_t nc;
+    };
+
+    GemmBlocking gemm_blocking() noexcept;
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+#include "impl/platform.hpp"
+#include "stream.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    /**
+     * 视锥体剔除的批量函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/culling.cpp)
+     * planes 为 6 个平面，每个4个元素 (a, b, c, d)，法线指向内侧并且已经归一化
+     * center / extents 为 (x, y, z) 三个分量的指针数组 (SoA)
+     * 可见的下标按升序写入 visible，返回个数，visible 需要能放下 count 个下标
+     * 计算顺序与 tMath (bounds.hpp) 的 intersects 相同，并且不使用 FMA
+     * (前提见 CMakeLists.txt 中 FP contraction 的说明)
+     */
+    size_t cull_spheres(const float32* planes, const float32* const* center, const float32* radius, uint32* visible, size_t count) noexcept;
+    size_t cull_aabbs(const float32* planes, const float32* const* center, const float32* const* extents, uint32* visible, size_t count) noexcept;
+}
+
+/**
+ * 任意内存布局为 6 * 4 个连续 float32 的视锥体类型，例如 float32[24]、tMath 的 Frustum<Vector4<float>>
+ */
+template<typename F>
+concept frustum_planes_layout = std::is_standard_layout_v<F> && sizeof(F) == 24 * sizeof(float32);
+
+/**
+ * 包围球的视锥体剔除，保守测试: 球心到每个平面的距离都 >= -radius 时可见
+ * 每条指令测试 Lanes 个包围球，可见的下标用 movemask 无分支地压缩写入 visible
+ * @param visible 至少 centers.size() 个元素，按升序写入可见的下标
+ * @return 可见的个数
+ */
+template<frustum_planes_layout Frustum>
+size_t cull_spheres(const Frustum& frustum, const Vec3Stream<float32>& centers, const float32* radii, uint32* visible) noexcept
+{
+    return detail::cull_spheres(reinterpret_cast<const float32*>(&frustum), centers.components().data(), radii, visible, centers.size());
+}
+
+/**
+ * AABB 的视锥体剔除，AABB 用中心和半边长表示
+ * 中心到平面的距离 + AABB 在法线上的投影半径 < 0 时在平面外侧，与 cull_spheres 一样是保守测试
+ */
+template<frustum_planes_layout Frustum>
+size_t cull_aabbs(const Frustum& frustum, const Vec3Stream<float32>& centers, const Vec3Stream<float32>& extents, uint32* visible) noexcept
+{
+    assert(centers.size() == extents.size());
+    return detail::cull_aabbs(reinterpret_cast<const float32*>(&frustum), centers.components().data(), extents.components().data(), visible, centers.size());
+}
+
+TSIMD_NAMESPACE_END
@@ -10,6 +10,18 @@
 #undef TSIMD_ONCE
 #define TSIMD_ONCE 0
 
+// AVX512_F
+#if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+    #undef TSIMD_DYN_INSTRUCTION
+    #define TSIMD_DYN_INSTRUCTION TSIMD_DYN_INSTRUCTION_AVX512_F
+
+    // 此时 TSIMD_DYN_FUNC_ATTR 等于 AVX512_F
+    #undef TSIMD_DYN_FUNC_ATTR
+    #define TSIMD_DYN_FUNC_ATTR TSIMD_AVX512_F_INTRINSIC_ATTR
+
+    #include TSIMD_DISPATCH_THIS_FILE
+#endif
+
 // AVX2 + FMA3
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2) && defined(TSIMD_INSTRUCTION_FEATURE_FMA3)
     #undef TSIMD_DYN_INSTRUCTION
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "impl/platform.hpp"
+#include "impl/float16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * float32 <-> float16 数组的批量转换，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/float16.cpp)
+ * AVX2 / AVX-512 使用 F16C 的 vcvtps2ph / vcvtph2ps，其他指令集逐个元素用软件转换，结果相同 (round to nearest even)
+ *
+ * 顶点、特征等很大的数组用 float16 存储可以减半内存带宽，计算时再转换成 float32
+ * 直接读写 float16 数组的数学函数见 math.hpp 中 float16 的重载
+ *
+ * 输入输出不要求对齐，count 可以是任意值，输入输出不能重叠
+ */
+void f32_to_f16(const float32* in, float16* out, size_t count) noexcept;
+void f16_to_f32(const float16* in, float32* out, size_t count) noexcept;
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <bit>
+#include <type_traits>
+
+#include "platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * IEEE 754 binary16 (半精度) 的存储类型，只用于存储，不提供算术运算
+ * 计算时用 op::load_f16 转换成 float32 的batch，算完再用 op::store_f16 转换回来
+ * 与 float32 的转换使用 round to nearest even，和 F16C 的 vcvtps2ph (imm = 0) 结果一致
+ */
+struct float16
+{
+    // 与 float32 一样，默认构造不初始化 (trivial)，可以直接 memcpy
+    uint16 bits;
+
+    float16() noexcept = default;
+
+    constexpr explicit float16(float32 f) noexcept;
+
+    constexpr explicit operator float32() const noexcept;
+
+    static constexpr float16 from_bits(const uint16 bits) noexcept
+    {
+        float16 h{};
+        h.bits = bits;
+        return h;
+    }
+
+    constexpr bool operator==(const float16&) const noexcept = default;
+};
+
+static_assert(sizeof(float16) == 2 && alignof(float16) == 2 && std::is_trivial_v<float16>);
+
+namespace detail
+{
+    // 没有 F16C 的指令集用这两个函数逐个元素转换
+    constexpr uint16 float32_to_float16_bits(const float32 f) noexcept
+    {
+        const uint32 x = std::bit_cast<uint32>(f);
+        const auto sign = static_cast<uint16>((x >> 16) & 0x8000u);
+        const uint32 abs_x = x & 0x7FFFFFFFu;
+
+        // inf / NaN: NaN 保留高位的尾数并置 quiet 位
+        if (abs_x >= 0x7F800000u)
+        {
+            const uint32 nan_bits = abs_x > 0x7F800000u ? (0x200u | ((abs_x >> 13) & 0x3FFu)) : 0u;
+            return static_cast<uint16>(sign | 0x7C00u | nan_bits);
+        }
+
+        // 舍入后超过 65504
+        if (abs_x >= 0x477FF000u)
+        {
+            return static_cast<uint16>(sign | 0x7C00u);
+        }
+
+        // 规格化数: 指数的偏移从 127 改为 15，尾数舍去低13位
+        if (abs_x >= 0x38800000u)
+        {
+            const uint32 r = abs_x - (112u << 23);
+            return static_cast<uint16>(sign | ((r + 0xFFFu + ((r >> 13) & 1u)) >> 13));
+        }
+
+        // 半精度的非规格化数 (< 2^-14)，以 2^-24 为单位舍入
+        const uint32 e = abs_x >> 23;
+        if (e < 102) // < 2^-25，舍入到0
+        {
+            return sign;
+        }
+        const uint32 mant = (abs_x & 0x7FFFFFu) | 0x800000u;
+        const uint32 shift = 126 - e;
+        return static_cast<uint16>(sign | ((mant + (1u << (shift - 1)) - 1u + ((mant >> shift) & 1u)) >> shift));
+    }
+
+    constexpr float32 float16_bits_to_float32(const uint16 h) noexcept
+    {
+        const uint32 sign = static_cast<uint32>(h & 0x8000u) << 16;
+        const uint32 e = (h >> 10) & 0x1Fu;
+        const uint32 mant = h & 0x3FFu;
+
+        if (e == 0x1F)
+        {
+            // inf / NaN，NaN 置 quiet 位 (与 vcvtph2ps 一致)
+            return std::bit_cast<float32>(sign | 0x7F800000u | (mant << 13) | (mant != 0 ? 0x400000u : 0u));
+        }
+        if (e == 0)
+        {
+            // 0 和非规格化数: mant * 2^-24，float32 可以精确表示
+            return std::bit_cast<float32>(sign | std::bit_cast<uint32>(static_cast<float32>(mant) * 0x1p-24f));
+        }
+        return std::bit_cast<float32>(sign | ((e + 112) << 23) | (mant << 13));
+    }
+}
+
+constexpr float16::float16(const float32 f) noexcept : bits(detail::float32_to_float16_bits(f))
+{
+}
+
+constexpr float16::operator float32() const noexcept
+{
+    return detail::float16_bits_to_float32(bits);
+}
+
+TSIMD_NAMESPACE_END
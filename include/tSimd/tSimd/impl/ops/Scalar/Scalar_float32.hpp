@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cmath>
+
 #include "_Scalar_types.hpp"
 
 TSIMD_NAMESPACE_BEGIN
@@ -7,7 +9,10 @@ TSIMD_NAMESPACE_BEGIN
 template<>
 struct SimdOp<SimdInstruction::Scalar, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(Scalar, float32, Scalar::Batch<float32>, Alignment::Scalar)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(Scalar, float32, Scalar::Batch<float32>, Scalar::Mask<float32>, Alignment::Scalar)
+
+    // gather / scatter 的下标，与 SimdOp<Scalar, int32>::batch_t 相同
+    using index_t = Scalar::Batch<int32>;
 
     TSIMD_OP_SIG_SCALAR(batch_t, load, (const float32* mem))
     {
@@ -29,6 +34,57 @@ struct SimdOp<SimdInstruction::Scalar, float32>
         *mem = v.v;
     }
 
+    // 标量没有非时间性存储，与 store 相同
+    TSIMD_OP_SIG_SCALAR(void, stream, (float32* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SCALAR)
+
+    // stream 是普通的存储，只需要阻止编译器重排
+    TSIMD_OP_SIG_SCALAR(void, fence, ())
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load_partial, (const float32* mem, size_t count))
+    {
+        return { count > 0 ? *mem : 0.0f };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_partial, (float32* mem, batch_t v, size_t count))
+    {
+        if (count > 0)
+        {
+            *mem = v.v;
+        }
+    }
+
+    // 半精度 <-> float32，mem 不要求对齐
+    TSIMD_OP_SIG_SCALAR(batch_t, load_f16, (const float16* mem))
+    {
+        return { static_cast<float32>(*mem) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_f16, (float16* mem, batch_t v))
+    {
+        *mem = float16(v.v);
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load_f16_partial, (const float16* mem, size_t count))
+    {
+        return { count > 0 ? static_cast<float32>(*mem) : 0.0f };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_f16_partial, (float16* mem, batch_t v, size_t count))
+    {
+        if (count > 0)
+        {
+            *mem = float16(v.v);
+        }
+    }
+
     TSIMD_OP_SIG_SCALAR(batch_t, zero, ())
     {
         return { 0.0f };
@@ -64,10 +120,297 @@ struct SimdOp<SimdInstruction::Scalar, float32>
         return v.v;
     }
 
+    TSIMD_OP_SIG_SCALAR(batch_t, broadcast_min, (batch_t v))
+    {
+        return v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, broadcast_max, (batch_t v))
+    {
+        return v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(float32, reduce_min, (batch_t v))
+    {
+        return v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(float32, reduce_max, (batch_t v))
+    {
+        return v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(float32, reduce_mul, (batch_t v))
+    {
+        return v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(size_t, argmin, (batch_t))
+    {
+        return 0;
+    }
+
+    TSIMD_OP_SIG_SCALAR(size_t, argmax, (batch_t))
+    {
+        return 0;
+    }
+
     TSIMD_OP_SIG_SCALAR(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
     {
         return { a.v * b.v + c.v };
     }
+
+    // a * b - c
+    TSIMD_OP_SIG_SCALAR(batch_t, mul_sub, (batch_t a, batch_t b, batch_t c))
+    {
+        return { a.v * b.v - c.v };
+    }
+
+    // c - a * b
+    TSIMD_OP_SIG_SCALAR(batch_t, neg_mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { c.v - a.v * b.v };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v == rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v != rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v <= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v > rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v >= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { mask.v ? a.v : b.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, any, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, all, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SCALAR(uint32, movemask, (mask_t mask))
+    {
+        return mask.v ? 1u : 0u;
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v && rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v || rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_not, (mask_t mask))
+    {
+        return { !mask.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, abs, (batch_t v))
+    {
+        return { std::fabs(v.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, neg, (batch_t v))
+    {
+        return { -v.v };
+    }
+
+    // 与 minps / maxps 一致: 有 NaN 或者两个数都是0时返回 rhs
+    TSIMD_OP_SIG_SCALAR(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v ? lhs.v : rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v > rhs.v ? lhs.v : rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sqrt, (batch_t v))
+    {
+        return { std::sqrt(v.v) };
+    }
+
+    // 标量没有近似指令，rcp / rsqrt 及其近似版本都是精确的除法
+    TSIMD_OP_SIG_SCALAR(batch_t, rcp_approx, (batch_t v))
+    {
+        return { 1.0f / v.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, rsqrt_approx, (batch_t v))
+    {
+        return { 1.0f / std::sqrt(v.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, rcp, (batch_t v))
+    {
+        return { 1.0f / v.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, rsqrt, (batch_t v))
+    {
+        return { 1.0f / std::sqrt(v.v) };
+    }
+
+    // 四舍六入五取偶，与默认舍入模式下的 cvtps_epi32 / roundps 一致
+    TSIMD_OP_SIG_SCALAR(batch_t, round, (batch_t v))
+    {
+        return { std::nearbyint(v.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, floor, (batch_t v))
+    {
+        return { std::floor(v.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, ceil, (batch_t v))
+    {
+        return { std::ceil(v.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, trunc, (batch_t v))
+    {
+        return { std::trunc(v.v) };
+    }
+
+    // 2^n，n为整数值，范围 [-126, 127]
+    TSIMD_OP_SIG_SCALAR(batch_t, exp2i, (batch_t n))
+    {
+        // n 为 NaN / inf 时不能转换成int
+        return { std::isfinite(n.v) ? std::ldexp(1.0f, static_cast<int>(n.v)) : n.v };
+    }
+
+    // floor(log2(|v|))，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_SCALAR(batch_t, get_exponent, (batch_t v))
+    {
+        return { static_cast<float32>(std::ilogb(v.v)) };
+    }
+
+    // |v| / 2^get_exponent(v)，范围 [1, 2)，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_SCALAR(batch_t, get_mantissa, (batch_t v))
+    {
+        int exponent;
+        return { std::fabs(std::frexp(v.v, &exponent)) * 2.0f };
+    }
+
+    // ------------------------ 下标访问 ------------------------
+
+    TSIMD_OP_SIG_SCALAR(index_t, load_index, (const int32* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, gather, (const float32* base, index_t idx))
+    {
+        return { base[idx.v] };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, scatter, (float32* base, index_t idx, batch_t v))
+    {
+        base[idx.v] = v.v;
+    }
+
+    // ------------------------ lane重排 ------------------------
+    // 只有1个lane，模式只能是 <0> (shuffle 为 <0> 或 <1>)
+
+    template<int... I>
+    TSIMD_OP_SIG_SCALAR(batch_t, permute, (batch_t v))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, Lanes, I...>, "invalid permute pattern");
+        return v;
+    }
+
+    template<int... I>
+    TSIMD_OP_SIG_SCALAR(batch_t, shuffle, (batch_t a, batch_t b))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, 2 * Lanes, I...>, "invalid shuffle pattern");
+        return ((I == 0) && ...) ? a : b;
+    }
+
+    template<int N>
+    TSIMD_OP_SIG_SCALAR(batch_t, broadcast_lane, (batch_t v))
+    {
+        static_assert(N == 0, "invalid lane");
+        return v;
+    }
+
+    // ------------------------ 交错存储的多分量数据 (AoS) ------------------------
+
+    TSIMD_OP_SIG_SCALAR(void, deinterleave2, (const float32* mem, batch_t& x, batch_t& y))
+    {
+        x.v = mem[0];
+        y.v = mem[1];
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, interleave2, (float32* mem, batch_t x, batch_t y))
+    {
+        mem[0] = x.v;
+        mem[1] = y.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, deinterleave3, (const float32* mem, batch_t& x, batch_t& y, batch_t& z))
+    {
+        x.v = mem[0];
+        y.v = mem[1];
+        z.v = mem[2];
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, interleave3, (float32* mem, batch_t x, batch_t y, batch_t z))
+    {
+        mem[0] = x.v;
+        mem[1] = y.v;
+        mem[2] = z.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, deinterleave4, (const float32* mem, batch_t& x, batch_t& y, batch_t& z, batch_t& w))
+    {
+        x.v = mem[0];
+        y.v = mem[1];
+        z.v = mem[2];
+        w.v = mem[3];
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, interleave4, (float32* mem, batch_t x, batch_t y, batch_t z, batch_t w))
+    {
+        mem[0] = x.v;
+        mem[1] = y.v;
+        mem[2] = z.v;
+        mem[3] = w.v;
+    }
 };
 
 TSIMD_DETAIL_CHECK_SCALAR_OP(SimdOp<SimdInstruction::Scalar, float32>);
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "_Scalar_types.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::Scalar, float64>
+{
+    // Alignment::Scalar 按 float32 定义为4，float64 需要8字节对齐
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(Scalar, float64, Scalar::Batch<float64>, Scalar::Mask<float64>, alignof(float64))
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load, (const float64* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, loadu, (const float64* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store, (float64* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, storeu, (float64* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    // 标量没有非时间性存储，与 store 相同
+    TSIMD_OP_SIG_SCALAR(void, stream, (float64* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SCALAR)
+
+    // stream 是普通的存储，只需要阻止编译器重排
+    TSIMD_OP_SIG_SCALAR(void, fence, ())
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load_partial, (const float64* mem, size_t count))
+    {
+        return { count > 0 ? *mem : 0.0 };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_partial, (float64* mem, batch_t v, size_t count))
+    {
+        if (count > 0)
+        {
+            *mem = v.v;
+        }
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, zero, ())
+    {
+        return { 0.0 };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, set, (float64 x))
+    {
+        return { x };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v + rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v - rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, mul, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v * rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, div, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v / rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(float64, reduce_sum, (batch_t v))
+    {
+        return v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { a.v * b.v + c.v };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v == rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v != rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v <= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v > rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v >= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { mask.v ? a.v : b.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, any, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, all, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SCALAR(uint32, movemask, (mask_t mask))
+    {
+        return mask.v ? 1u : 0u;
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v && rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v || rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_not, (mask_t mask))
+    {
+        return { !mask.v };
+    }
+};
+
+TSIMD_DETAIL_CHECK_SCALAR_OP(SimdOp<SimdInstruction::Scalar, float64>);
+
+TSIMD_NAMESPACE_END
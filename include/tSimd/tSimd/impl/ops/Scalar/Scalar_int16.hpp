@@ -0,0 +1,223 @@
+#pragma once
+
+#include "_Scalar_types.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::Scalar, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(Scalar, int16, Scalar::Batch<int16>, Scalar::Mask<int16>, alignof(int16))
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load, (const int16* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, loadu, (const int16* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store, (int16* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, storeu, (int16* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    // 标量没有非时间性存储，与 store 相同
+    TSIMD_OP_SIG_SCALAR(void, stream, (int16* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SCALAR)
+
+    // stream 是普通的存储，只需要阻止编译器重排
+    TSIMD_OP_SIG_SCALAR(void, fence, ())
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load_partial, (const int16* mem, size_t count))
+    {
+        return { count > 0 ? *mem : int16(0) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_partial, (int16* mem, batch_t v, size_t count))
+    {
+        if (count > 0)
+        {
+            *mem = v.v;
+        }
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, zero, ())
+    {
+        return { int16(0) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, set, (int16 x))
+    {
+        return { x };
+    }
+
+    // 与SIMD指令一致，溢出时环绕
+    TSIMD_OP_SIG_SCALAR(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(static_cast<uint16>(lhs.v) + static_cast<uint16>(rhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(static_cast<uint16>(lhs.v) - static_cast<uint16>(rhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(lhs.v & rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(lhs.v | rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(lhs.v ^ rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_not, (batch_t v))
+    {
+        return { static_cast<int16>(~v.v) };
+    }
+
+    // count: [0, 位宽)
+    TSIMD_OP_SIG_SCALAR(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { static_cast<int16>(static_cast<uint16>(v.v) << count) };
+    }
+
+    // 有符号类型为算术右移，无符号类型为逻辑右移
+    TSIMD_OP_SIG_SCALAR(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { static_cast<int16>(v.v >> count) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v ? lhs.v : rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v ? rhs.v : lhs.v };
+    }
+
+    // 只保留乘积的低位
+    TSIMD_OP_SIG_SCALAR(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<int16>(static_cast<uint32>(lhs.v) * static_cast<uint32>(rhs.v)) };
+    }
+
+    // 饱和加减
+    TSIMD_OP_SIG_SCALAR(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        const int r = int(lhs.v) + int(rhs.v);
+        return { static_cast<int16>(r < -32768 ? -32768 : (r > 32767 ? 32767 : r)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        const int r = int(lhs.v) - int(rhs.v);
+        return { static_cast<int16>(r < -32768 ? -32768 : (r > 32767 ? 32767 : r)) };
+    }
+
+    // 读取 Lanes 个 uint8，零扩展为 int16
+    TSIMD_OP_SIG_SCALAR(batch_t, load_widen, (const uint8* mem))
+    {
+        return { int16(*mem) };
+    }
+
+    // 饱和转换为 uint8 ([0, 255])，写入 Lanes 个元素
+    TSIMD_OP_SIG_SCALAR(void, store_narrow, (uint8* mem, batch_t v))
+    {
+        *mem = static_cast<uint8>(v.v < 0 ? 0 : (v.v > 255 ? 255 : v.v));
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v == rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v != rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v <= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v > rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v >= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { mask.v ? a.v : b.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, any, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, all, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SCALAR(uint32, movemask, (mask_t mask))
+    {
+        return mask.v ? 1u : 0u;
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v && rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v || rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_not, (mask_t mask))
+    {
+        return { !mask.v };
+    }
+};
+
+TSIMD_DETAIL_CHECK_SCALAR_OP(SimdOp<SimdInstruction::Scalar, int16>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "_Scalar_types.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::Scalar, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(Scalar, uint8, Scalar::Batch<uint8>, Scalar::Mask<uint8>, alignof(uint8))
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load, (const uint8* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, loadu, (const uint8* mem))
+    {
+        return { *mem };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store, (uint8* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, storeu, (uint8* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    // 标量没有非时间性存储，与 store 相同
+    TSIMD_OP_SIG_SCALAR(void, stream, (uint8* mem, batch_t v))
+    {
+        *mem = v.v;
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SCALAR)
+
+    // stream 是普通的存储，只需要阻止编译器重排
+    TSIMD_OP_SIG_SCALAR(void, fence, ())
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, load_partial, (const uint8* mem, size_t count))
+    {
+        return { count > 0 ? *mem : uint8(0) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(void, store_partial, (uint8* mem, batch_t v, size_t count))
+    {
+        if (count > 0)
+        {
+            *mem = v.v;
+        }
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, zero, ())
+    {
+        return { uint8(0) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, set, (uint8 x))
+    {
+        return { x };
+    }
+
+    // 与SIMD指令一致，溢出时环绕
+    TSIMD_OP_SIG_SCALAR(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<uint8>(static_cast<uint8>(lhs.v) + static_cast<uint8>(rhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<uint8>(static_cast<uint8>(lhs.v) - static_cast<uint8>(rhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<uint8>(lhs.v & rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<uint8>(lhs.v | rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { static_cast<uint8>(lhs.v ^ rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, bit_not, (batch_t v))
+    {
+        return { static_cast<uint8>(~v.v) };
+    }
+
+    // count: [0, 位宽)
+    TSIMD_OP_SIG_SCALAR(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { static_cast<uint8>(static_cast<uint8>(v.v) << count) };
+    }
+
+    // 有符号类型为算术右移，无符号类型为逻辑右移
+    TSIMD_OP_SIG_SCALAR(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { static_cast<uint8>(v.v >> count) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v ? lhs.v : rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v ? rhs.v : lhs.v };
+    }
+
+    // 饱和加减
+    TSIMD_OP_SIG_SCALAR(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        const int r = int(lhs.v) + int(rhs.v);
+        return { static_cast<uint8>(r < 0 ? 0 : (r > 255 ? 255 : r)) };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        const int r = int(lhs.v) - int(rhs.v);
+        return { static_cast<uint8>(r < 0 ? 0 : (r > 255 ? 255 : r)) };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v == rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v != rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v < rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v <= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v > rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { lhs.v >= rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { mask.v ? a.v : b.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, any, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    TSIMD_OP_SIG_SCALAR(bool, all, (mask_t mask))
+    {
+        return mask.v;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SCALAR(uint32, movemask, (mask_t mask))
+    {
+        return mask.v ? 1u : 0u;
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v && rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { lhs.v || rhs.v };
+    }
+
+    TSIMD_OP_SIG_SCALAR(mask_t, mask_not, (mask_t mask))
+    {
+        return { !mask.v };
+    }
+};
+
+TSIMD_DETAIL_CHECK_SCALAR_OP(SimdOp<SimdInstruction::Scalar, uint8>);
+
+TSIMD_NAMESPACE_END
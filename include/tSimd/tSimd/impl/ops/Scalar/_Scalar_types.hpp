@@ -9,6 +9,13 @@ namespace Scalar
     template<typename scalar_type>
     struct Batch;
 
+    // cmp_* 的结果，所有元素类型共用
+    template<typename scalar_type>
+    struct Mask
+    {
+        bool v;
+    };
+
     template<>
     struct Batch<float32>
     {
@@ -20,6 +27,30 @@ namespace Scalar
     {
         float64 v;
     };
+
+    template<>
+    struct Batch<int32>
+    {
+        int32 v;
+    };
+
+    template<>
+    struct Batch<uint32>
+    {
+        uint32 v;
+    };
+
+    template<>
+    struct Batch<int16>
+    {
+        int16 v;
+    };
+
+    template<>
+    struct Batch<uint8>
+    {
+        uint8 v;
+    };
 }
 
 TSIMD_NAMESPACE_END
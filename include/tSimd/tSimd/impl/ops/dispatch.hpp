@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 #if defined(TSIMD_TEST_INTRINSIC) && defined(TSIMD_IS_TESTING)
@@ -9,7 +10,12 @@
 #include <type_traits>
 #include <concepts>
 
+#if defined(TMATH_COMPILER_MSVC)
+    #include <xmmintrin.h> // _mm_prefetch
+#endif
+
 #include "../platform.hpp"
+#include "../float16.hpp"
 #include "func_attr.hpp"
 
 TSIMD_NAMESPACE_BEGIN
@@ -33,6 +39,7 @@ struct InstructionSetSupports
 
     // 这两个是独立指令集，在tsimd库中，AVX的op不使用FMA3指令，AVX2的op分成两套:
     // 1. AVX2, 2. AVX2+FMA3。一套不使用FMA3，另一套使用FMA3
+    // F16C 不单独分发，AVX2 要求同时支持 F16C (所有支持AVX2的CPU都有F16C)，AVX2 / AVX2_FMA3 / AVX-512 的 load_f16 / store_f16 使用 F16C
     bool F16C = false, FMA3 = false;
 
     bool AVX2       = false;
@@ -53,6 +60,7 @@ struct InstructionSetSupports
 #define TSIMD_DYN_INSTRUCTION_AVX        AVX
 #define TSIMD_DYN_INSTRUCTION_AVX2       AVX2
 #define TSIMD_DYN_INSTRUCTION_AVX2_FMA3  AVX2_FMA3
+#define TSIMD_DYN_INSTRUCTION_AVX512_F   AVX512_F
 
 namespace detail
 {
@@ -108,6 +116,10 @@ namespace detail
         AVX2_FMA3,
     #endif
 
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+        AVX512_F,
+    #endif
+
         Num
     };
     static_assert(underlying(SimdInstructionIndex::Num) > 0);
@@ -176,6 +188,13 @@ namespace detail
     #define TSIMD_DETAIL_AVX2_FMA3_FUNC_IMPL(func_name) TSIMD_DETAIL_ONE_EMPTY_FUNC
 #endif
 
+// AVX512_F
+#if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+    #define TSIMD_DETAIL_AVX512_F_FUNC_IMPL(func_name) TSIMD_DETAIL_ONE_FUNC_IMPL(func_name, TSIMD_DYN_INSTRUCTION_AVX512_F)
+#else
+    #define TSIMD_DETAIL_AVX512_F_FUNC_IMPL(func_name) TSIMD_DETAIL_ONE_EMPTY_FUNC
+#endif
+
 // function table
 #define TSIMD_DETAIL_DYN_DISPATCH_FUNC_POINTER_STATIC_ARRAY(func_name) \
     /* ------------------------------------- scalar ------------------------------------- */ \
@@ -187,7 +206,8 @@ namespace detail
     TSIMD_DETAIL_SSE4_1_FUNC_IMPL(func_name) \
     TSIMD_DETAIL_AVX_FUNC_IMPL(func_name) \
     TSIMD_DETAIL_AVX2_FUNC_IMPL(func_name) \
-    TSIMD_DETAIL_AVX2_FMA3_FUNC_IMPL(func_name)
+    TSIMD_DETAIL_AVX2_FMA3_FUNC_IMPL(func_name) \
+    TSIMD_DETAIL_AVX512_F_FUNC_IMPL(func_name)
 
 #if !defined(TSIMD_DETAIL_DYN_DISPATCH_FUNC_POINTER_STATIC_ARRAY)
     #error "have not defined DYN_DISPATCH_FUNC_POINTER_STATIC_ARRAY to cache the simd function pointers"
@@ -195,24 +215,184 @@ namespace detail
 
 
 // -------------------------- dispatch function ---------------------------
+// 这个枚举用于SimdOp的模板参数，也用于查询/限制运行时分发的指令集
+// 从低到高排序，值的大小可以直接比较
+enum class SimdInstruction : int
+{
+    Scalar,
+
+    SSE,
+    SSE2,
+    SSE3,
+    SSE4_1,
+    AVX,
+    AVX2,
+    AVX2_FMA3,
+    AVX512_F
+};
+
 class InstructionSelector final
 {
 public:
     static const InstructionSetSupports& get_support_info() noexcept;
     static size_t required_alignment() noexcept;
 
-    // 测试时直接返回索引即可，正式版本才使用运行时CPUID判断
-    static int dyn_func_index() noexcept;
+    /**
+     * 限制运行时分发可以使用的最高指令集 (例如避免 AVX-512 的降频)
+     * 必须在第一次分发之前调用，第一次分发之后指令集已经确定，返回 false 且不生效
+     *
+     * 也可以通过环境变量 TSIMD_MAX_ISA 限制 (第一次分发时读取)，例如 TSIMD_MAX_ISA=avx2
+     * 可用的值与 instruction_name() 相同，不区分大小写，忽略 '_' 和 '.' (avx512f, sse4.1 均可)，无法识别的值会被忽略，并在 stderr 输出一行提示
+     * 两者同时存在时，取较低的一个
+     *
+     * 最终的结果不会超过CPU支持的指令集，也不会低于当前平台的 fallback 指令集 (x86 64 为 SSE2)
+     */
+    static bool set_max_instruction(SimdInstruction max_instruction) noexcept;
+
+    // 运行时分发使用的指令集，第一次调用时确定，之后不再改变
+    static SimdInstruction selected_instruction() noexcept;
+
+    // 不考虑上面的限制，CPU支持的最高指令集
+    static SimdInstruction max_supported_instruction() noexcept;
+
+    static const char* instruction_name(SimdInstruction instruction) noexcept;
 };
 
+namespace detail
+{
+    // SimdInstruction -> 函数指针表的索引
+    // 索引与当前编译单元的 SimdInstructionIndex 对应 (测试时的函数指针表包含 Scalar 和 SSE，正式版本不一定包含)
+    static constexpr int instruction_index(const SimdInstruction instruction) noexcept
+    {
+        switch (instruction)
+        {
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SCALAR)
+        case SimdInstruction::Scalar:       return underlying(SimdInstructionIndex::Scalar);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SSE)
+        case SimdInstruction::SSE:          return underlying(SimdInstructionIndex::SSE);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SSE2)
+        case SimdInstruction::SSE2:         return underlying(SimdInstructionIndex::SSE2);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SSE3)
+        case SimdInstruction::SSE3:         return underlying(SimdInstructionIndex::SSE3);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_SSE4_1)
+        case SimdInstruction::SSE4_1:       return underlying(SimdInstructionIndex::SSE4_1);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX)
+        case SimdInstruction::AVX:          return underlying(SimdInstructionIndex::AVX);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2)
+        case SimdInstruction::AVX2:         return underlying(SimdInstructionIndex::AVX2);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2) && defined(TSIMD_INSTRUCTION_FEATURE_FMA3)
+        case SimdInstruction::AVX2_FMA3:    return underlying(SimdInstructionIndex::AVX2_FMA3);
+    #endif
+    #if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+        case SimdInstruction::AVX512_F:     return underlying(SimdInstructionIndex::AVX512_F);
+    #endif
+        default:
+            // 函数指针表中没有这一项，使用 fallback (表中的第0项)
+            return 0;
+        }
+    }
+
+    // 每个编译单元各自缓存一份，所以是 static
+    static int dyn_func_index() noexcept
+    {
+        static const int i = instruction_index(InstructionSelector::selected_instruction());
+        return i;
+    }
+}
+
+namespace detail
+{
+    /**
+     * 每个 TSIMD_DYN_DISPATCH_FUNC 对应一个缓存的函数指针 (PFN_resolved::func_name)，初始值为 first_call
+     * 第一次调用时查表，把选中的函数写回缓存，之后的调用只有一次 relaxed load (普通的mov) 和一次间接调用，
+     * 不再经过 detail::dyn_func_index() 中的 static 局部变量检查
+     *
+     * 多个线程同时第一次调用时，写入的都是同一个值，所以 relaxed 就足够了
+     */
+    template<auto& Table, auto& Slot, typename Fn = typename std::remove_cvref_t<decltype(Slot)>::value_type>
+    struct DynResolver;
+
+    template<auto& Table, auto& Slot, typename R, typename... Args>
+    struct DynResolver<Table, Slot, R(*)(Args...) noexcept>
+    {
+        static R first_call(Args... args) noexcept
+        {
+            const auto fn = Table[dyn_func_index()];
+            Slot.store(fn, std::memory_order_relaxed);
+            return fn(static_cast<Args&&>(args)...);
+        }
+    };
+
+    template<auto& Table, auto& Slot, typename R, typename... Args>
+    struct DynResolver<Table, Slot, R(*)(Args...)>
+    {
+        static R first_call(Args... args)
+        {
+            const auto fn = Table[dyn_func_index()];
+            Slot.store(fn, std::memory_order_relaxed);
+            return fn(static_cast<Args&&>(args)...);
+        }
+    };
+}
+
 #define TSIMD_DYN_DISPATCH_FUNC(func_name) \
     /* 构建静态数组，存储函数指针 (使用命名空间包裹，限定只能在类外使用) */ \
     namespace TSIMD_NAMESPACE_NAME::PFN_table { \
         static inline decltype(&TSIMD_NAMESPACE_NAME::TSIMD_DYN_INSTRUCTION::func_name) func_name[] = { \
             TSIMD_DETAIL_DYN_DISPATCH_FUNC_POINTER_STATIC_ARRAY(func_name) \
         }; \
+    } \
+    /* 缓存查表的结果，见 detail::DynResolver */ \
+    namespace TSIMD_NAMESPACE_NAME::PFN_resolved { \
+        static inline std::atomic<decltype(&TSIMD_NAMESPACE_NAME::TSIMD_DYN_INSTRUCTION::func_name)> func_name{ \
+            &TSIMD_NAMESPACE_NAME::detail::DynResolver<TSIMD_NAMESPACE_NAME::PFN_table::func_name, func_name>::first_call \
+        }; \
     }
 
+/**
+ * 函数模板版本，为每一组模板参数生成一张函数指针表 (变量模板)，例如:
+ * template<typename T> TSIMD_DYN_FUNC_ATTR void kernel_impl(const T* arr, size_t N, T* out);
+ *
+ * TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_impl);
+ * TSIMD_DYN_CALL(kernel_impl<float>)(...);
+ * TSIMD_DYN_CALL(kernel_impl<double>)(...);
+ */
+#define TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(func_name) \
+    namespace TSIMD_NAMESPACE_NAME::PFN_table { \
+        template<typename... TemplateArgs> \
+        static inline decltype(&TSIMD_NAMESPACE_NAME::TSIMD_DYN_INSTRUCTION::func_name<TemplateArgs...>) func_name[] = { \
+            TSIMD_DETAIL_DYN_DISPATCH_FUNC_POINTER_STATIC_ARRAY(func_name<TemplateArgs...>) \
+        }; \
+    } \
+    namespace TSIMD_NAMESPACE_NAME::PFN_resolved { \
+        template<typename... TemplateArgs> \
+        static inline std::atomic<decltype(&TSIMD_NAMESPACE_NAME::TSIMD_DYN_INSTRUCTION::func_name<TemplateArgs...>)> func_name{ \
+            &TSIMD_NAMESPACE_NAME::detail::DynResolver<TSIMD_NAMESPACE_NAME::PFN_table::func_name<TemplateArgs...>, func_name<TemplateArgs...>>::first_call \
+        }; \
+    }
+
+// 每次调用都查表: 调用 detail::dyn_func_index() (包含 static 局部变量的检查)，再读取函数指针表
+#define TSIMD_DYN_TABLE_LOOKUP(func_name) \
+    TSIMD_NAMESPACE_NAME::PFN_table::func_name[TSIMD_NAMESPACE_NAME::detail::dyn_func_index()]
+
+// 只在第一次调用时查表，之后直接读取缓存的函数指针
+#define TSIMD_DYN_RESOLVED(func_name) \
+    TSIMD_NAMESPACE_NAME::PFN_resolved::func_name.load(std::memory_order_relaxed)
+
+/**
+ * TSIMD_DYN_CALL 使用的分发方式:
+ * 1. 默认: TSIMD_DYN_RESOLVED，每个函数只查一次表
+ * 2. 定义 TSIMD_DISPATCH_PER_CALL: TSIMD_DYN_TABLE_LOOKUP，每次调用都查表 (旧的行为)
+ *
+ * 两种方式选出的函数相同，可以在同一个程序中混用
+ */
 // 测试时直接返回索引即可，正式版本才使用运行时CPUID判断
 #if defined(TSIMD_TEST_INTRINSIC) && defined(TSIMD_IS_TESTING)
     #define TSIMD_DYN_FUNC_POINTER(func_name) \
@@ -223,9 +403,10 @@ public:
             if (!supports.TSIMD_TEST_INTRINSIC) { std::abort(); } \
             return TSIMD_NAMESPACE_NAME::PFN_table::func_name[idx]; \
         }()
+#elif defined(TSIMD_DISPATCH_PER_CALL)
+    #define TSIMD_DYN_FUNC_POINTER(func_name) TSIMD_DYN_TABLE_LOOKUP(func_name)
 #else
-    #define TSIMD_DYN_FUNC_POINTER(func_name) \
-        TSIMD_NAMESPACE_NAME::PFN_table::func_name[TSIMD_NAMESPACE_NAME::InstructionSelector::dyn_func_index()]
+    #define TSIMD_DYN_FUNC_POINTER(func_name) TSIMD_DYN_RESOLVED(func_name)
 #endif
 
 
@@ -240,22 +421,11 @@ public:
 
 
 // --------------------------------- SimdOp ---------------------------------
-// 这个枚举用于SimdOp的模板参数
-enum class SimdInstruction : int
-{
-    Scalar,
-
-    SSE,
-    SSE2,
-    SSE3,
-    SSE4_1,
-    AVX,
-    AVX2,
-    AVX2_FMA3
-};
-
 template<typename T>
-concept scalar_type = std::is_same_v<T, float>;
+concept scalar_type =
+    std::is_same_v<T, float32> || std::is_same_v<T, float64> ||
+    std::is_same_v<T, int32> || std::is_same_v<T, uint32> ||
+    std::is_same_v<T, int16> || std::is_same_v<T, uint8>;
 
 template<SimdInstruction Instruction, scalar_type ScalarType>
 struct SimdOp;
@@ -266,9 +436,10 @@ struct SimdOp;
 #define TSIMD_DETAIL_SIMD_OP_STRUCT_NAME(instruction, scalar_elem_type) \
     SimdOp_##instruction##_##scalar_elem_type
 
-#define TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(instruction_type, elem_type, batch_type, batch_alignment) \
+#define TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(instruction_type, elem_type, batch_type, mask_type, batch_alignment) \
     /* 类型萃取 */ \
     using batch_t = batch_type; \
+    using mask_t = mask_type; /* cmp_* 的返回值，select / any / all / movemask 的参数 */ \
     using scalar_t = elem_type; \
     \
     /* 常量 */ \
@@ -281,6 +452,130 @@ struct SimdOp;
     /* static check */ \
     static_assert(Lanes % 2 == 0 || Lanes == 1, "Lanes must be 2 * N or 1");
 
+// prefetch 的目标缓存层级，与 _MM_HINT_T0 / T1 / T2 / NTA 对应
+enum class PrefetchHint
+{
+    T0,  // 所有层级
+    T1,  // L2 及以上
+    T2,  // L3 及以上
+    NTA, // 非时间性 (只用一次的数据)，尽量不污染缓存
+};
+
+namespace detail
+{
+    template<PrefetchHint Hint>
+    TMATH_FORCE_INLINE void prefetch(const void* mem) noexcept
+    {
+#if defined(TMATH_COMPILER_MSVC)
+        constexpr int hint = Hint == PrefetchHint::T0 ? _MM_HINT_T0 : Hint == PrefetchHint::T1 ? _MM_HINT_T1 : Hint == PrefetchHint::T2 ? _MM_HINT_T2 : _MM_HINT_NTA;
+        _mm_prefetch(static_cast<const char*>(mem), hint);
+#else
+        // locality: 3 = T0, 2 = T1, 1 = T2, 0 = NTA
+        __builtin_prefetch(mem, 0, 3 - static_cast<int>(Hint));
+#endif
+    }
+}
+
+/**
+ * 每个 SimdOp 都有的内存提示函数
+ * prefetch<Hint>(mem): 预取 mem 所在的缓存行，只是提示，不会产生异常 (mem 可以是无效地址)
+ * 依赖模板参数的 op 需要写成 op::template prefetch<PrefetchHint::NTA>(mem)，默认为 T0
+ */
+#define TSIMD_DETAIL_SIMD_OP_PREFETCH(instruction_type) \
+    template<PrefetchHint Hint = PrefetchHint::T0> \
+    TSIMD_OP_SIG_##instruction_type(void, prefetch, (const void* mem)) \
+    { \
+        detail::prefetch<Hint>(mem); \
+    }
+
+/**
+ * float32 的 rcp(v) / rsqrt(v): 近似指令 (rcp_approx / rsqrt_approx) 加一次 Newton-Raphson 迭代
+ * 展开在 SimdOp 内，使用当前 SimdOp 的 mul_add / neg_mul_add，所以有 FMA 的指令集需要重新展开一次
+ * 近似值为 0 / inf 时 (输入为 inf / 0 / 非正规数) 迭代会得到 NaN，这时保留近似值
+ * 结果不超过 3 ulp (rcp) / 3.5 ulp (rsqrt)，有 FMA 时更小，见 tests/tSimd/batch/test_math.inl
+ */
+#define TSIMD_DETAIL_SIMD_OP_RCP_RSQRT(instruction_type) \
+    TSIMD_OP_SIG_##instruction_type(batch_t, rcp, (batch_t v)) \
+    { \
+        /* y + y * (1 - v * y) */ \
+        const batch_t y = rcp_approx(v); \
+        const batch_t r = mul_add(y, neg_mul_add(v, y, set(1.0f)), y); \
+        return select(cmp_eq(r, r), r, y); \
+    } \
+    \
+    TSIMD_OP_SIG_##instruction_type(batch_t, rsqrt, (batch_t v)) \
+    { \
+        /* y + y * (0.5 - 0.5 * v * y^2) */ \
+        const batch_t y = rsqrt_approx(v); \
+        const batch_t half = set(0.5f); \
+        const batch_t r = mul_add(y, neg_mul_add(half, mul(mul(v, y), y), half), y); \
+        return select(cmp_eq(r, r), r, y); \
+    }
+
+/**
+ * 没有 roundps 的指令集用当前 SimdOp 的 round (四舍六入五取偶) 实现 floor / ceil / trunc
+ * ceil(v) = -floor(-v)，保证 (-1, 0) 的结果为 -0
+ */
+#define TSIMD_DETAIL_SIMD_OP_FLOOR_CEIL_TRUNC(instruction_type) \
+    TSIMD_OP_SIG_##instruction_type(batch_t, floor, (batch_t v)) \
+    { \
+        const batch_t r = round(v); \
+        return select(cmp_gt(r, v), sub(r, set(1.0f)), r); \
+    } \
+    \
+    TSIMD_OP_SIG_##instruction_type(batch_t, ceil, (batch_t v)) \
+    { \
+        return neg(floor(neg(v))); \
+    } \
+    \
+    TSIMD_OP_SIG_##instruction_type(batch_t, trunc, (batch_t v)) \
+    { \
+        return select(cmp_lt(v, zero()), ceil(v), floor(v)); \
+    }
+
+namespace detail
+{
+    /**
+     * permute<I...> / shuffle<I...> 的下标检查: 恰好 Lanes 个，每个都在 [0, Limit) 内
+     * permute 的 Limit 为 Lanes，shuffle 为 2 * Lanes ([Lanes, 2 * Lanes) 表示第二个参数的lane)
+     */
+    template<size_t Lanes, size_t Limit, int... I>
+    inline constexpr bool valid_lane_pattern = sizeof...(I) == Lanes && ((I >= 0 && static_cast<size_t>(I) < Limit) && ...);
+
+    // 第k位为 pred(k, I_k)，用于计算 blend 等指令的立即数
+    template<int... I, typename Pred>
+    consteval uint32_t lane_pattern_bits(Pred pred)
+    {
+        uint32_t bits = 0;
+        int k = 0;
+        ((bits |= pred(k, I) ? (1u << k) : 0u, ++k), ...);
+        return bits;
+    }
+
+    // 前4个下标的低2位组成的 _MM_SHUFFLE 立即数 (shufps / vpermilps)
+    template<int... I>
+    consteval int x4_lane_imm()
+    {
+        constexpr int p[] = { I... };
+        return (p[0] & 3) | ((p[1] & 3) << 2) | ((p[2] & 3) << 4) | ((p[3] & 3) << 6);
+    }
+
+    // 每个128位组 (4个32位lane) 使用相同的组内模式，可以用一条带立即数的 vpermilps 完成
+    template<int... I>
+    consteval bool is_x4_lane_pattern()
+    {
+        constexpr int p[] = { I... };
+        for (int k = 0; k < static_cast<int>(sizeof...(I)); ++k)
+        {
+            if (p[k & 3] >= 4 || p[k] != p[k & 3] + (k & ~3))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
 namespace detail
 {
     template<typename T>
@@ -62,22 +62,30 @@
     TSIMD_AVX_INTRINSIC_ATTR
 
 
-// avx2
-#define TSIMD_AVX2_INTRINSIC_ATTR TMATH_FUNC_ATTR_INTRINSIC_TARGETS("avx2")
+// avx2 (+f16c)
+#define TSIMD_AVX2_INTRINSIC_ATTR TMATH_FUNC_ATTR_INTRINSIC_TARGETS("avx2,f16c")
 #define TSIMD_OP_AVX2_API \
     TMATH_FORCE_INLINE \
     TMATH_FLATTEN \
     TSIMD_AVX2_INTRINSIC_ATTR
 
 
-// avx2+fma3
-#define TSIMD_AVX2_FMA3_INTRINSIC_ATTR TMATH_FUNC_ATTR_INTRINSIC_TARGETS("avx2,fma")
+// avx2+fma3 (+f16c)
+#define TSIMD_AVX2_FMA3_INTRINSIC_ATTR TMATH_FUNC_ATTR_INTRINSIC_TARGETS("avx2,fma,f16c")
 #define TSIMD_OP_AVX2_FMA3_API \
     TMATH_FORCE_INLINE \
     TMATH_FLATTEN \
     TSIMD_AVX2_FMA3_INTRINSIC_ATTR
 
 
+// avx512f (AVX512F 自带 FMA 指令，f16c 需要单独打开，否则不能内联继承自 AVX2_FMA3 的op)
+#define TSIMD_AVX512_F_INTRINSIC_ATTR TMATH_FUNC_ATTR_INTRINSIC_TARGETS("avx512f,f16c")
+#define TSIMD_OP_AVX512_F_API \
+    TMATH_FORCE_INLINE \
+    TMATH_FLATTEN \
+    TSIMD_AVX512_F_INTRINSIC_ATTR
+
+
 // func sig
 #define TSIMD_OP_SIG_SCALAR(ret, func_name, params)     TSIMD_OP_SCALAR_API     static ret TSIMD_SCALAR_CALL_CONV   func_name params noexcept
 
@@ -90,3 +98,5 @@
 #define TSIMD_OP_SIG_AVX(ret, func_name, params)        TSIMD_OP_AVX_API        static ret TSIMD_CALL_CONV          func_name params noexcept
 #define TSIMD_OP_SIG_AVX2(ret, func_name, params)       TSIMD_OP_AVX2_API       static ret TSIMD_CALL_CONV          func_name params noexcept
 #define TSIMD_OP_SIG_AVX2_FMA3(ret, func_name, params)  TSIMD_OP_AVX2_FMA3_API  static ret TSIMD_CALL_CONV          func_name params noexcept
+
+#define TSIMD_OP_SIG_AVX512_F(ret, func_name, params)   TSIMD_OP_AVX512_F_API   static ret TSIMD_CALL_CONV          func_name params noexcept
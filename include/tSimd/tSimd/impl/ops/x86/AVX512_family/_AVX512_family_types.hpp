@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../../../platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace AVX512_family
+{
+    template<typename scalar_type>
+    struct Batch;
+
+    template<typename scalar_type>
+    struct Mask;
+}
+
+TSIMD_NAMESPACE_END
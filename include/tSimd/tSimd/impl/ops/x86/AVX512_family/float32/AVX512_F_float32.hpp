@@ -0,0 +1,545 @@
+#pragma once
+
+#include <bit>
+#include <cstring>
+
+#include "_AVX512_family_float32_type.hpp"
+#include "../int32/_AVX512_family_int32_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::AVX512_F, float32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX512_F, float32, AVX512_family::Batch<float32>, AVX512_family::Mask<float32>, Alignment::AVX512_Family)
+
+    // gather / scatter 的下标，与 SimdOp<..., int32>::batch_t 相同
+    using index_t = AVX512_family::Batch<int32>;
+
+    // GCC 12 中部分不带mask的 AVX-512 intrinsic 会误报 -Wuninitialized，这些地方使用全1掩码的 maskz 版本
+    static constexpr __mmask16 full_mask = 0xFFFF;
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, load, (const float32* mem))
+    {
+        return { _mm512_load_ps(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, loadu, (const float32* mem))
+    {
+        return { _mm512_loadu_ps(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store, (float32* mem, batch_t v))
+    {
+        _mm512_store_ps(mem, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, storeu, (float32* mem, batch_t v))
+    {
+        _mm512_storeu_ps(mem, v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX512_F(void, stream, (float32* mem, batch_t v))
+    {
+        _mm512_stream_ps(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX512_F)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX512_F(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // opmask 中为0的lane不会访问内存 (fault suppression)，load的结果置0
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_partial, (const float32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        const __mmask16 mask = static_cast<__mmask16>((1u << count) - 1u);
+        return { _mm512_maskz_loadu_ps(mask, mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_partial, (float32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        const __mmask16 mask = static_cast<__mmask16>((1u << count) - 1u);
+        _mm512_mask_storeu_ps(mem, mask, v.v);
+    }
+
+    // 半精度 <-> float32 (AVX512F 的 vcvtph2ps / vcvtps2ph)，舍入方式为 round to nearest even
+    // 同样使用 full_mask 的 maskz 版本 (见 full_mask 的注释)
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_f16, (const float16* mem))
+    {
+        return { _mm512_maskz_cvtph_ps(full_mask, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_f16, (float16* mem, batch_t v))
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem), _mm512_maskz_cvtps_ph(full_mask, v.v, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    // 16位的掩码读写需要 AVX512BW，这里经过栈上的临时变量
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_f16_partial, (const float16* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return load_f16(mem);
+        }
+
+        __m256i h = _mm256_setzero_si256();
+        std::memcpy(&h, mem, count * sizeof(float16));
+        return { _mm512_maskz_cvtph_ps(full_mask, h) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_f16_partial, (float16* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            store_f16(mem, v);
+            return;
+        }
+
+        const __m256i h = _mm512_maskz_cvtps_ph(full_mask, v.v, _MM_FROUND_TO_NEAREST_INT);
+        std::memcpy(mem, &h, count * sizeof(float16));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, zero, ())
+    {
+        return { _mm512_setzero_ps() };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, set, (float32 x))
+    {
+        return { _mm512_set1_ps(x) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_add_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_sub_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, mul, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_mul_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, div, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_div_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(float32, reduce_sum, (batch_t v))
+    {
+        // 全程在512位寄存器内做折半相加，最后取第0个lane
+        // (GCC 12 的 _mm512_castps512_ps256 / _mm512_shuffle_f32x4 内部使用了 undefined 的 passthrough，
+        //  -O2 下会误报 -Wuninitialized，所以这里使用全1掩码的 maskz 版本，生成的指令相同)
+
+        // [1+9, 2+10, ..., 8+16, ...]
+        __m512 t = _mm512_add_ps(v.v, _mm512_maskz_shuffle_f32x4(full_mask, v.v, v.v, _MM_SHUFFLE(3, 2, 3, 2)));
+        // [1+5+9+13, ..., 4+8+12+16, ...]
+        t = _mm512_add_ps(t, _mm512_maskz_shuffle_f32x4(full_mask, t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+
+        // 128位内部，与 SSE 一致
+        t = _mm512_add_ps(t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(1, 0, 3, 2)));
+        t = _mm512_add_ps(t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        return _mm512_cvtss_f32(t);
+    }
+
+    // 依次交换256位、128位、64位、32位，结果的每个lane都是所有lane的最小值 / 最大值 (maskz 的原因见 reduce_sum)
+    // 有 NaN 时结果不确定
+    TSIMD_OP_SIG_AVX512_F(batch_t, broadcast_min, (batch_t v))
+    {
+        __m512 t = _mm512_maskz_min_ps(full_mask, v.v, _mm512_maskz_shuffle_f32x4(full_mask, v.v, v.v, _MM_SHUFFLE(1, 0, 3, 2)));
+        t = _mm512_maskz_min_ps(full_mask, t, _mm512_maskz_shuffle_f32x4(full_mask, t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+        t = _mm512_maskz_min_ps(full_mask, t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(1, 0, 3, 2)));
+        return { _mm512_maskz_min_ps(full_mask, t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(2, 3, 0, 1))) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, broadcast_max, (batch_t v))
+    {
+        __m512 t = _mm512_maskz_max_ps(full_mask, v.v, _mm512_maskz_shuffle_f32x4(full_mask, v.v, v.v, _MM_SHUFFLE(1, 0, 3, 2)));
+        t = _mm512_maskz_max_ps(full_mask, t, _mm512_maskz_shuffle_f32x4(full_mask, t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+        t = _mm512_maskz_max_ps(full_mask, t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(1, 0, 3, 2)));
+        return { _mm512_maskz_max_ps(full_mask, t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(2, 3, 0, 1))) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(float32, reduce_min, (batch_t v))
+    {
+        return _mm512_cvtss_f32(broadcast_min(v).v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(float32, reduce_max, (batch_t v))
+    {
+        return _mm512_cvtss_f32(broadcast_max(v).v);
+    }
+
+    // 与 reduce_sum 相同的折半顺序
+    TSIMD_OP_SIG_AVX512_F(float32, reduce_mul, (batch_t v))
+    {
+        __m512 t = _mm512_mul_ps(v.v, _mm512_maskz_shuffle_f32x4(full_mask, v.v, v.v, _MM_SHUFFLE(3, 2, 3, 2)));
+        t = _mm512_mul_ps(t, _mm512_maskz_shuffle_f32x4(full_mask, t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+        t = _mm512_mul_ps(t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(1, 0, 3, 2)));
+        t = _mm512_mul_ps(t, _mm512_maskz_permute_ps(full_mask, t, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm512_cvtss_f32(t);
+    }
+
+    // 第一个最小值 / 最大值所在的lane，v 中不能有 NaN
+    TSIMD_OP_SIG_AVX512_F(size_t, argmin, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_min(v)))));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(size_t, argmax, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_max(v)))));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm512_fmadd_ps(a.v, b.v, c.v) };
+    }
+
+    // a * b - c
+    TSIMD_OP_SIG_AVX512_F(batch_t, mul_sub, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm512_fmsub_ps(a.v, b.v, c.v) };
+    }
+
+    // c - a * b
+    TSIMD_OP_SIG_AVX512_F(batch_t, neg_mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm512_fnmadd_ps(a.v, b.v, c.v) };
+    }
+
+    // 比较结果直接写入opmask寄存器，select 为 mask_blend
+    // 与C++的比较运算符一致: 有NaN时只有 cmp_ne 为true
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_EQ_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_NEQ_UQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_LT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_LE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_GT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_ps_mask(lhs.v, rhs.v, _CMP_GE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm512_mask_blend_ps(mask.v, b.v, a.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, any, (mask_t mask))
+    {
+        return mask.v != 0;
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, all, (mask_t mask))
+    {
+        return mask.v == 0xFFFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX512_F(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask16>(lhs.v & rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask16>(lhs.v | rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_not, (mask_t mask))
+    {
+        return { static_cast<__mmask16>(~mask.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, abs, (batch_t v))
+    {
+        return { _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(v.v), _mm512_set1_epi32(0x7FFFFFFF))) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, neg, (batch_t v))
+    {
+        return { _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(v.v), _mm512_set1_epi32(static_cast<int32>(0x80000000u)))) };
+    }
+
+    // 有 NaN 或者两个数都是0时返回 rhs
+    TSIMD_OP_SIG_AVX512_F(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_maskz_min_ps(full_mask, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_maskz_max_ps(full_mask, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, sqrt, (batch_t v))
+    {
+        return { _mm512_maskz_sqrt_ps(full_mask, v.v) };
+    }
+
+    // vrcp14ps / vrsqrt14ps，相对误差不超过 2^-14
+    TSIMD_OP_SIG_AVX512_F(batch_t, rcp_approx, (batch_t v))
+    {
+        return { _mm512_maskz_rcp14_ps(full_mask, v.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, rsqrt_approx, (batch_t v))
+    {
+        return { _mm512_maskz_rsqrt14_ps(full_mask, v.v) };
+    }
+
+    TSIMD_DETAIL_SIMD_OP_RCP_RSQRT(AVX512_F)
+
+    // 四舍六入五取偶
+    TSIMD_OP_SIG_AVX512_F(batch_t, round, (batch_t v))
+    {
+        return { _mm512_maskz_roundscale_ps(full_mask, v.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, floor, (batch_t v))
+    {
+        return { _mm512_maskz_roundscale_ps(full_mask, v.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, ceil, (batch_t v))
+    {
+        return { _mm512_maskz_roundscale_ps(full_mask, v.v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, trunc, (batch_t v))
+    {
+        return { _mm512_maskz_roundscale_ps(full_mask, v.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) };
+    }
+
+    // 2^n，n为整数值，范围 [-126, 127]
+    TSIMD_OP_SIG_AVX512_F(batch_t, exp2i, (batch_t n))
+    {
+        return { _mm512_maskz_scalef_ps(full_mask, _mm512_set1_ps(1.0f), n.v) };
+    }
+
+    // floor(log2(|v|))，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_AVX512_F(batch_t, get_exponent, (batch_t v))
+    {
+        return { _mm512_maskz_getexp_ps(full_mask, v.v) };
+    }
+
+    // |v| / 2^get_exponent(v)，范围 [1, 2)，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_AVX512_F(batch_t, get_mantissa, (batch_t v))
+    {
+        return { _mm512_maskz_getmant_ps(full_mask, v.v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero) };
+    }
+
+    // ------------------------ 以4个float (128位) 为一组的操作，用于4x4矩阵 ------------------------
+    // 与SSE相同，AVX-512有4组 (低128位为第0组)
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_x4_strided, (const float32* mem, size_t stride, size_t groups))
+    {
+        if (stride == 4 && groups == 4)
+        {
+            return loadu(mem);
+        }
+
+        // insertf32x4 的 passthrough 是输入本身，没有 -Wuninitialized 的问题
+        __m512 r = _mm512_insertf32x4(_mm512_setzero_ps(), _mm_loadu_ps(mem), 0);
+        if (groups > 1) { r = _mm512_insertf32x4(r, _mm_loadu_ps(mem + stride), 1); }
+        if (groups > 2) { r = _mm512_insertf32x4(r, _mm_loadu_ps(mem + 2 * stride), 2); }
+        if (groups > 3) { r = _mm512_insertf32x4(r, _mm_loadu_ps(mem + 3 * stride), 3); }
+        return { r };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_x4_strided, (float32* mem, size_t stride, batch_t v, size_t groups))
+    {
+        if (stride == 4 && groups == 4)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        _mm_storeu_ps(mem, _mm512_maskz_extractf32x4_ps(0xF, v.v, 0));
+        if (groups > 1) { _mm_storeu_ps(mem + stride, _mm512_maskz_extractf32x4_ps(0xF, v.v, 1)); }
+        if (groups > 2) { _mm_storeu_ps(mem + 2 * stride, _mm512_maskz_extractf32x4_ps(0xF, v.v, 2)); }
+        if (groups > 3) { _mm_storeu_ps(mem + 3 * stride, _mm512_maskz_extractf32x4_ps(0xF, v.v, 3)); }
+    }
+
+    // vpermilps 在128位内部进行
+    TSIMD_OP_SIG_AVX512_F(batch_t, splat_x4, (batch_t v, size_t lane))
+    {
+        switch (lane)
+        {
+        case 0:  return { _mm512_maskz_permute_ps(full_mask, v.v, _MM_SHUFFLE(0, 0, 0, 0)) };
+        case 1:  return { _mm512_maskz_permute_ps(full_mask, v.v, _MM_SHUFFLE(1, 1, 1, 1)) };
+        case 2:  return { _mm512_maskz_permute_ps(full_mask, v.v, _MM_SHUFFLE(2, 2, 2, 2)) };
+        default: return { _mm512_maskz_permute_ps(full_mask, v.v, _MM_SHUFFLE(3, 3, 3, 3)) };
+        }
+    }
+
+    // unpack / shuffle 都是在128位内部进行的，四组各自转置
+    TSIMD_OP_SIG_AVX512_F(void, transpose_x4, (batch_t& r0, batch_t& r1, batch_t& r2, batch_t& r3))
+    {
+        const __m512 t0 = _mm512_maskz_unpacklo_ps(full_mask, r0.v, r1.v); // [a0 b0 a1 b1]
+        const __m512 t1 = _mm512_maskz_unpackhi_ps(full_mask, r0.v, r1.v); // [a2 b2 a3 b3]
+        const __m512 t2 = _mm512_maskz_unpacklo_ps(full_mask, r2.v, r3.v); // [c0 d0 c1 d1]
+        const __m512 t3 = _mm512_maskz_unpackhi_ps(full_mask, r2.v, r3.v); // [c2 d2 c3 d3]
+
+        r0.v = _mm512_maskz_shuffle_ps(full_mask, t0, t2, _MM_SHUFFLE(1, 0, 1, 0)); // [a0 b0 c0 d0]
+        r1.v = _mm512_maskz_shuffle_ps(full_mask, t0, t2, _MM_SHUFFLE(3, 2, 3, 2)); // [a1 b1 c1 d1]
+        r2.v = _mm512_maskz_shuffle_ps(full_mask, t1, t3, _MM_SHUFFLE(1, 0, 1, 0)); // [a2 b2 c2 d2]
+        r3.v = _mm512_maskz_shuffle_ps(full_mask, t1, t3, _MM_SHUFFLE(3, 2, 3, 2)); // [a3 b3 c3 d3]
+    }
+
+    // ------------------------ 下标访问 ------------------------
+
+    TSIMD_OP_SIG_AVX512_F(index_t, load_index, (const int32* mem))
+    {
+        return { _mm512_loadu_si512(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, gather, (const float32* base, index_t idx))
+    {
+        return { _mm512_mask_i32gather_ps(_mm512_setzero_ps(), full_mask, idx.v, base, 4) };
+    }
+
+    // 下标重复时保留后面的lane (vscatterdps 按lane的顺序写入)
+    TSIMD_OP_SIG_AVX512_F(void, scatter, (float32* base, index_t idx, batch_t v))
+    {
+        _mm512_i32scatter_ps(base, idx.v, v.v, 4);
+    }
+
+    // ------------------------ lane重排 ------------------------
+
+    template<int... I>
+    TSIMD_OP_SIG_AVX512_F(batch_t, permute, (batch_t v))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, Lanes, I...>, "invalid permute pattern");
+        if constexpr (detail::is_x4_lane_pattern<I...>())
+        {
+            return { _mm512_maskz_permute_ps(full_mask, v.v, detail::x4_lane_imm<I...>()) };
+        }
+        else
+        {
+            // _mm512_setr_epi32 是宏，不能展开参数包
+            static constexpr int32 idx[] = { I... };
+            return { _mm512_maskz_permutexvar_ps(full_mask, _mm512_loadu_si512(idx), v.v) };
+        }
+    }
+
+    // vpermt2ps: 下标的第4位选择 a / b
+    template<int... I>
+    TSIMD_OP_SIG_AVX512_F(batch_t, shuffle, (batch_t a, batch_t b))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, 2 * Lanes, I...>, "invalid shuffle pattern");
+        static constexpr int32 idx[] = { I... };
+        return { _mm512_maskz_permutex2var_ps(full_mask, a.v, _mm512_loadu_si512(idx), b.v) };
+    }
+
+    template<int N>
+    TSIMD_OP_SIG_AVX512_F(batch_t, broadcast_lane, (batch_t v))
+    {
+        static_assert(N >= 0 && N < static_cast<int>(Lanes), "invalid lane");
+        return { _mm512_maskz_permutexvar_ps(full_mask, _mm512_set1_epi32(N), v.v) };
+    }
+
+    // ------------------------ 交错存储的多分量数据 (AoS) ------------------------
+    // 与SSE相同，四组各自重排
+
+    TSIMD_OP_SIG_AVX512_F(void, deinterleave2, (const float32* mem, batch_t& x, batch_t& y))
+    {
+        const __m512 a = load_x4_strided(mem, 8, Lanes / 4).v;
+        const __m512 b = load_x4_strided(mem + 4, 8, Lanes / 4).v;
+        x.v = _mm512_maskz_shuffle_ps(full_mask, a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm512_maskz_shuffle_ps(full_mask, a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, interleave2, (float32* mem, batch_t x, batch_t y))
+    {
+        store_x4_strided(mem, 8, { _mm512_maskz_unpacklo_ps(full_mask, x.v, y.v) }, Lanes / 4);
+        store_x4_strided(mem + 4, 8, { _mm512_maskz_unpackhi_ps(full_mask, x.v, y.v) }, Lanes / 4);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, deinterleave3, (const float32* mem, batch_t& x, batch_t& y, batch_t& z))
+    {
+        const __m512 a = load_x4_strided(mem, 12, Lanes / 4).v;
+        const __m512 b = load_x4_strided(mem + 4, 12, Lanes / 4).v;
+        const __m512 c = load_x4_strided(mem + 8, 12, Lanes / 4).v;
+        x.v = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm512_maskz_shuffle_ps(full_mask, b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm512_maskz_shuffle_ps(full_mask, b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z.v = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm512_maskz_shuffle_ps(full_mask, c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, interleave3, (float32* mem, batch_t x, batch_t y, batch_t z))
+    {
+        const __m512 a = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, x.v, y.v, _MM_SHUFFLE(0, 0, 0, 0)), _mm512_maskz_shuffle_ps(full_mask, z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m512 b = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_maskz_shuffle_ps(full_mask, x.v, y.v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m512 c = _mm512_maskz_shuffle_ps(full_mask, _mm512_maskz_shuffle_ps(full_mask, z.v, x.v, _MM_SHUFFLE(3, 3, 2, 2)), _mm512_maskz_shuffle_ps(full_mask, y.v, z.v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        store_x4_strided(mem, 12, { a }, Lanes / 4);
+        store_x4_strided(mem + 4, 12, { b }, Lanes / 4);
+        store_x4_strided(mem + 8, 12, { c }, Lanes / 4);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, deinterleave4, (const float32* mem, batch_t& x, batch_t& y, batch_t& z, batch_t& w))
+    {
+        x = load_x4_strided(mem, 16, Lanes / 4);
+        y = load_x4_strided(mem + 4, 16, Lanes / 4);
+        z = load_x4_strided(mem + 8, 16, Lanes / 4);
+        w = load_x4_strided(mem + 12, 16, Lanes / 4);
+        transpose_x4(x, y, z, w);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, interleave4, (float32* mem, batch_t x, batch_t y, batch_t z, batch_t w))
+    {
+        transpose_x4(x, y, z, w);
+        store_x4_strided(mem, 16, x, Lanes / 4);
+        store_x4_strided(mem + 4, 16, y, Lanes / 4);
+        store_x4_strided(mem + 8, 16, z, Lanes / 4);
+        store_x4_strided(mem + 12, 16, w, Lanes / 4);
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX512_F, float32>);
+
+TSIMD_NAMESPACE_END
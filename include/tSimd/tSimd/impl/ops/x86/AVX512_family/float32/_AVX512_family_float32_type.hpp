@@ -0,0 +1,26 @@
+#pragma once
+
+#include <immintrin.h> // AVX-512
+
+#include "../_AVX512_family_types.hpp"
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace AVX512_family
+{
+    template<>
+    struct Batch<float32>
+    {
+        __m512 v;
+    };
+
+    template<>
+    struct Mask<float32>
+    {
+        // 每个lane一位的 opmask
+        __mmask16 v;
+    };
+}
+
+TSIMD_NAMESPACE_END
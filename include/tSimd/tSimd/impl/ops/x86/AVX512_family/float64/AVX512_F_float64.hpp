@@ -0,0 +1,191 @@
+#pragma once
+
+#include "_AVX512_family_float64_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::AVX512_F, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX512_F, float64, AVX512_family::Batch<float64>, AVX512_family::Mask<float64>, Alignment::AVX512_Family)
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, load, (const float64* mem))
+    {
+        return { _mm512_load_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, loadu, (const float64* mem))
+    {
+        return { _mm512_loadu_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store, (float64* mem, batch_t v))
+    {
+        _mm512_store_pd(mem, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, storeu, (float64* mem, batch_t v))
+    {
+        _mm512_storeu_pd(mem, v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX512_F(void, stream, (float64* mem, batch_t v))
+    {
+        _mm512_stream_pd(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX512_F)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX512_F(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // opmask 中为0的lane不会访问内存 (fault suppression)，load的结果置0
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_partial, (const float64* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        const __mmask8 mask = static_cast<__mmask8>((1u << count) - 1u);
+        return { _mm512_maskz_loadu_pd(mask, mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_partial, (float64* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        const __mmask8 mask = static_cast<__mmask8>((1u << count) - 1u);
+        _mm512_mask_storeu_pd(mem, mask, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, zero, ())
+    {
+        return { _mm512_setzero_pd() };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, set, (float64 x))
+    {
+        return { _mm512_set1_pd(x) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_add_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_sub_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, mul, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_mul_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, div, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_div_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(float64, reduce_sum, (batch_t v))
+    {
+        // 与 float32 相同，使用 maskz 版本避免 GCC 12 的 -Wuninitialized 误报
+        constexpr __mmask8 all = 0xFF;
+
+        // [1+5, 2+6, 3+7, 4+8, ...]
+        __m512d t = _mm512_add_pd(v.v, _mm512_maskz_shuffle_f64x2(all, v.v, v.v, _MM_SHUFFLE(3, 2, 3, 2)));
+        // [1+3+5+7, 2+4+6+8, ...]
+        t = _mm512_add_pd(t, _mm512_maskz_shuffle_f64x2(all, t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+        // 128位内部交换两个lane
+        t = _mm512_add_pd(t, _mm512_maskz_permute_pd(all, t, 0b01010101));
+
+        return _mm512_cvtsd_f64(t);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm512_fmadd_pd(a.v, b.v, c.v) };
+    }
+
+    // 比较结果直接写入opmask寄存器，select 为 mask_blend
+    // 与C++的比较运算符一致: 有NaN时只有 cmp_ne 为true
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_EQ_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_NEQ_UQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_LT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_LE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_GT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmp_pd_mask(lhs.v, rhs.v, _CMP_GE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm512_mask_blend_pd(mask.v, b.v, a.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, any, (mask_t mask))
+    {
+        return mask.v != 0;
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, all, (mask_t mask))
+    {
+        return mask.v == 0xFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX512_F(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask8>(lhs.v & rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask8>(lhs.v | rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_not, (mask_t mask))
+    {
+        return { static_cast<__mmask8>(~mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX512_F, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <immintrin.h> // AVX-512
+
+#include "../_AVX512_family_types.hpp"
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace AVX512_family
+{
+    template<>
+    struct Batch<float64>
+    {
+        __m512d v;
+    };
+
+    template<>
+    struct Mask<float64>
+    {
+        // 每个lane一位的 opmask
+        __mmask8 v;
+    };
+}
+
+TSIMD_NAMESPACE_END
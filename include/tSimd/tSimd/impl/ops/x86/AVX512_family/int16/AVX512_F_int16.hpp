@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../AVX_family/int16/AVX2_FMA3_int16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// 8/16位整数的512位指令属于 AVX512BW，AVX512F 下继续使用256位的 AVX2 实现
+template<>
+struct SimdOp<SimdInstruction::AVX512_F, int16> : SimdOp<SimdInstruction::AVX2_FMA3, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX512_F, int16, AVX_family::Batch<int16>, AVX_family::Mask<int16>, Alignment::AVX_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX512_F, int16>);
+
+TSIMD_NAMESPACE_END
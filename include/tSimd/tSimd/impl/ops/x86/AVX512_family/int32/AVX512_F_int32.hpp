@@ -0,0 +1,243 @@
+#pragma once
+
+#include "_AVX512_family_int32_type.hpp"
+#include "../float32/_AVX512_family_float32_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::AVX512_F, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX512_F, int32, AVX512_family::Batch<int32>, AVX512_family::Mask<int32>, Alignment::AVX512_Family)
+
+    // GCC 12 中部分不带mask的 AVX-512 intrinsic 会误报 -Wuninitialized，这些地方使用全1掩码的 maskz 版本
+    static constexpr __mmask16 full_mask = 0xFFFF;
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, load, (const int32* mem))
+    {
+        return { _mm512_load_si512(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, loadu, (const int32* mem))
+    {
+        return { _mm512_loadu_si512(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store, (int32* mem, batch_t v))
+    {
+        _mm512_store_si512(mem, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, storeu, (int32* mem, batch_t v))
+    {
+        _mm512_storeu_si512(mem, v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX512_F(void, stream, (int32* mem, batch_t v))
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(mem), v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX512_F)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX512_F(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // opmask 中为0的lane不会访问内存 (fault suppression)，load的结果置0
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_partial, (const int32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        const __mmask16 mask = static_cast<__mmask16>((1u << count) - 1u);
+        return { _mm512_maskz_loadu_epi32(mask, mem) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(void, store_partial, (int32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        const __mmask16 mask = static_cast<__mmask16>((1u << count) - 1u);
+        _mm512_mask_storeu_epi32(mem, mask, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, zero, ())
+    {
+        return { _mm512_setzero_si512() };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, set, (int32 x))
+    {
+        return { _mm512_set1_epi32(static_cast<int>(x)) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_add_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_sub_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_mullo_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_and_si512(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_or_si512(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_xor_si512(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm512_xor_si512(v.v, _mm512_set1_epi32(-1)) };
+    }
+
+    // count: [0, 32)
+    TSIMD_OP_SIG_AVX512_F(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { _mm512_maskz_sll_epi32(full_mask, v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { _mm512_maskz_sra_epi32(full_mask, v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_maskz_min_epi32(full_mask, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_maskz_max_epi32(full_mask, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(int32, reduce_sum, (batch_t v))
+    {
+        // 与 float32 相同的折半相加
+        __m512i t = _mm512_add_epi32(v.v, _mm512_maskz_shuffle_i32x4(full_mask, v.v, v.v, _MM_SHUFFLE(3, 2, 3, 2)));
+        t = _mm512_add_epi32(t, _mm512_maskz_shuffle_i32x4(full_mask, t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+        t = _mm512_add_epi32(t, _mm512_maskz_shuffle_epi32(full_mask, t, _MM_PERM_BADC));
+        t = _mm512_add_epi32(t, _mm512_maskz_shuffle_epi32(full_mask, t, _MM_PERM_CDAB));
+        return static_cast<int32>(_mm512_cvtsi512_si32(t));
+    }
+
+    // 读取 Lanes 个 int16，符号扩展为 int32
+    TSIMD_OP_SIG_AVX512_F(batch_t, load_widen, (const int16* mem))
+    {
+        return { _mm512_maskz_cvtepi16_epi32(full_mask, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mem))) };
+    }
+
+    // 饱和转换为 int16，写入 Lanes 个元素
+    TSIMD_OP_SIG_AVX512_F(void, store_narrow, (int16* mem, batch_t v))
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem), _mm512_maskz_cvtsepi32_epi16(full_mask, v.v));
+    }
+
+    TSIMD_OP_SIG_AVX512_F(AVX512_family::Batch<float32>, to_float32, (batch_t v))
+    {
+        return { _mm512_maskz_cvtepi32_ps(full_mask, v.v) };
+    }
+
+    // 向0取整，超出 int32 范围时返回 0x80000000
+    TSIMD_OP_SIG_AVX512_F(batch_t, from_float32, (AVX512_family::Batch<float32> v))
+    {
+        return { _mm512_maskz_cvttps_epi32(full_mask, v.v) };
+    }
+
+    // 比较结果直接写入opmask寄存器，select 为 mask_blend
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmpeq_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmpneq_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmplt_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmple_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmpgt_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm512_cmpge_epi32_mask(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm512_mask_blend_epi32(mask.v, b.v, a.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, any, (mask_t mask))
+    {
+        return mask.v != 0;
+    }
+
+    TSIMD_OP_SIG_AVX512_F(bool, all, (mask_t mask))
+    {
+        return mask.v == 0xFFFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX512_F(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask16>(lhs.v & rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { static_cast<__mmask16>(lhs.v | rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX512_F(mask_t, mask_not, (mask_t mask))
+    {
+        return { static_cast<__mmask16>(~mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX512_F, int32>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../AVX_family/uint8/AVX2_FMA3_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// 8/16位整数的512位指令属于 AVX512BW，AVX512F 下继续使用256位的 AVX2 实现
+template<>
+struct SimdOp<SimdInstruction::AVX512_F, uint8> : SimdOp<SimdInstruction::AVX2_FMA3, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX512_F, uint8, AVX_family::Batch<uint8>, AVX_family::Mask<uint8>, Alignment::AVX_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX512_F, uint8>);
+
+TSIMD_NAMESPACE_END
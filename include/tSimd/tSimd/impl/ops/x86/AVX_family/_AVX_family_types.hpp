@@ -1,6 +1,11 @@
 #pragma once
 
+#include <cstdint>
+
+#include <immintrin.h> // AVX
+
 #include "../../../platform.hpp"
+#include "../../func_attr.hpp"
 
 TSIMD_NAMESPACE_BEGIN
 
@@ -8,6 +13,70 @@ namespace AVX_family
 {
     template<typename scalar_type>
     struct Batch;
+
+    template<typename scalar_type>
+    struct Mask;
+
+    namespace detail
+    {
+        // 前8个为-1 (最高位为1)，后8个为0
+        // 从 [8 - count] 开始读取8个int32，恰好得到前 count 个lane为-1的mask
+        inline constexpr int32_t partial_mask_table_epi32[16] = {
+            -1, -1, -1, -1, -1, -1, -1, -1,
+             0,  0,  0,  0,  0,  0,  0,  0
+        };
+
+        // 同上，用于64位lane
+        inline constexpr int64_t partial_mask_table_epi64[8] = {
+            -1, -1, -1, -1,
+             0,  0,  0,  0
+        };
+    }
+
+    /**
+     * maskload / maskstore 使用的mask，前 count 个32位lane的最高位为1
+     * @param count [0, 8]
+     */
+    TSIMD_OP_AVX_API __m256i TSIMD_CALL_CONV partial_mask_epi32(const size_t count) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::partial_mask_table_epi32 + 8 - count));
+    }
+
+    /**
+     * maskload / maskstore 使用的mask，前 count 个64位lane的最高位为1
+     * @param count [0, 4]
+     */
+    TSIMD_OP_AVX_API __m256i TSIMD_CALL_CONV partial_mask_epi64(const size_t count) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(detail::partial_mask_table_epi64 + 4 - count));
+    }
+
+    // AVX 没有256位整数运算，拆成两个128位分别计算
+    TSIMD_OP_AVX_API __m128i TSIMD_CALL_CONV lo128(const __m256i v) noexcept
+    {
+        return _mm256_castsi256_si128(v);
+    }
+
+    TSIMD_OP_AVX_API __m128i TSIMD_CALL_CONV hi128(const __m256i v) noexcept
+    {
+        return _mm256_extractf128_si256(v, 0b1);
+    }
+
+    TSIMD_OP_AVX_API __m256i TSIMD_CALL_CONV combine128(const __m128i lo, const __m128i hi) noexcept
+    {
+        return _mm256_set_m128i(hi, lo);
+    }
 }
 
+// half_op 为128位的SimdOp，例如 SimdOp<SimdInstruction::SSE4_1, int32>
+#define TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, func, lhs, rhs) \
+    AVX_family::combine128( \
+        half_op::func({ AVX_family::lo128(lhs) }, { AVX_family::lo128(rhs) }).v, \
+        half_op::func({ AVX_family::hi128(lhs) }, { AVX_family::hi128(rhs) }).v)
+
+#define TSIMD_DETAIL_AVX_SPLIT_SHIFT(half_op, func, x, count) \
+    AVX_family::combine128( \
+        half_op::func({ AVX_family::lo128(x) }, count).v, \
+        half_op::func({ AVX_family::hi128(x) }, count).v)
+
 TSIMD_NAMESPACE_END
@@ -1,14 +1,92 @@
 #pragma once
 
+#include <cstring>
+
 #include "AVX_float32.hpp"
 
 TSIMD_NAMESPACE_BEGIN
 
-// AVX2与AVX的浮点运算指令一致
+// AVX2与AVX的浮点运算指令一致，只有需要整数指令的 exp2i / get_exponent，gather / 跨128位的重排，以及使用 F16C 的半精度转换在这里重写
 template<>
 struct SimdOp<SimdInstruction::AVX2, float32> : SimdOp<SimdInstruction::AVX, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, float32, AVX_family::Batch<float32>, Alignment::AVX_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, float32, AVX_family::Batch<float32>, AVX_family::Mask<float32>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2(batch_t, exp2i, (batch_t n))
+    {
+        const __m256i biased = _mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127));
+        return { _mm256_castsi256_ps(_mm256_slli_epi32(biased, 23)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, get_exponent, (batch_t v))
+    {
+        const __m256i biased = _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(v.v), _mm256_set1_epi32(0x7F800000)), 23);
+        return { _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, _mm256_set1_epi32(127))) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, gather, (const float32* base, index_t idx))
+    {
+        return { _mm256_i32gather_ps(base, idx.v, 4) };
+    }
+
+    // vpermps 可以跨128位
+    template<int... I>
+    TSIMD_OP_SIG_AVX2(batch_t, permute, (batch_t v))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, Lanes, I...>, "invalid permute pattern");
+        if constexpr (detail::is_x4_lane_pattern<I...>())
+        {
+            return { _mm256_permute_ps(v.v, detail::x4_lane_imm<I...>()) };
+        }
+        else
+        {
+            return { _mm256_permutevar8x32_ps(v.v, _mm256_setr_epi32(I...)) };
+        }
+    }
+
+    template<int... I>
+    TSIMD_OP_SIG_AVX2(batch_t, shuffle, (batch_t a, batch_t b))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, 2 * Lanes, I...>, "invalid shuffle pattern");
+        constexpr int from_b = static_cast<int>(detail::lane_pattern_bits<I...>([](int, int i) { return i >= 8; }));
+        return { _mm256_blend_ps(permute<(I & 7)...>(a).v, permute<(I & 7)...>(b).v, from_b) };
+    }
+
+    // vcvtph2ps / vcvtps2ph (F16C)，舍入方式为 round to nearest even
+    TSIMD_OP_SIG_AVX2(batch_t, load_f16, (const float16* mem))
+    {
+        return { _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_AVX2(void, store_f16, (float16* mem, batch_t v))
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), _mm256_cvtps_ph(v.v, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    // 没有16位的 maskload，经过栈上的临时变量读写，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_AVX2(batch_t, load_f16_partial, (const float16* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return load_f16(mem);
+        }
+
+        __m128i h = _mm_setzero_si128();
+        std::memcpy(&h, mem, count * sizeof(float16));
+        return { _mm256_cvtph_ps(h) };
+    }
+
+    TSIMD_OP_SIG_AVX2(void, store_f16_partial, (float16* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            store_f16(mem, v);
+            return;
+        }
+
+        const __m128i h = _mm256_cvtps_ph(v.v, _MM_FROUND_TO_NEAREST_INT);
+        std::memcpy(mem, &h, count * sizeof(float16));
+    }
 };
 TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX, float32>);
 
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <bit>
+
 #include "_AVX_family_float32_type.hpp"
+#include "../int32/_AVX_family_int32_type.hpp"
 
 TSIMD_NAMESPACE_BEGIN
 
 template<>
 struct SimdOp<SimdInstruction::AVX, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX, float32, AVX_family::Batch<float32>, Alignment::AVX_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX, float32, AVX_family::Batch<float32>, AVX_family::Mask<float32>, Alignment::AVX_Family)
+
+    // gather / scatter 的下标，与 SimdOp<..., int32>::batch_t 相同
+    using index_t = AVX_family::Batch<int32>;
 
     TSIMD_OP_SIG_AVX(batch_t, load, (const float32* mem))
     {
@@ -29,6 +35,74 @@ struct SimdOp<SimdInstruction::AVX, float32>
         _mm256_storeu_ps(mem, v.v);
     }
 
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX(void, stream, (float32* mem, batch_t v))
+    {
+        _mm256_stream_ps(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // maskload: mask为0的lane不会访问内存，也不会触发越界异常，结果置0
+    TSIMD_OP_SIG_AVX(batch_t, load_partial, (const float32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        return { _mm256_maskload_ps(mem, AVX_family::partial_mask_epi32(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_partial, (float32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        _mm256_maskstore_ps(mem, AVX_family::partial_mask_epi32(count), v.v);
+    }
+
+    // 半精度 <-> float32，mem 不要求对齐
+    // AVX 不要求 F16C，与SSE一样逐个元素用软件转换
+    TSIMD_OP_SIG_AVX(batch_t, load_f16_partial, (const float16* mem, size_t count))
+    {
+        alignas(Alignment::AVX_Family) float32 tmp[Lanes] = {};
+        for (size_t k = 0; k < count && k < Lanes; ++k)
+        {
+            tmp[k] = static_cast<float32>(mem[k]);
+        }
+        return load(tmp);
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_f16_partial, (float16* mem, batch_t v, size_t count))
+    {
+        alignas(Alignment::AVX_Family) float32 tmp[Lanes];
+        store(tmp, v);
+        for (size_t k = 0; k < count && k < Lanes; ++k)
+        {
+            mem[k] = float16(tmp[k]);
+        }
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, load_f16, (const float16* mem))
+    {
+        return load_f16_partial(mem, Lanes);
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_f16, (float16* mem, batch_t v))
+    {
+        store_f16_partial(mem, v, Lanes);
+    }
+
     TSIMD_OP_SIG_AVX(batch_t, zero, ())
     {
         return { _mm256_setzero_ps() };
@@ -81,10 +155,405 @@ struct SimdOp<SimdInstruction::AVX, float32>
         return _mm_cvtss_f32(low);
     }
 
+    // 先交换两个128位再在128位内部蝶形折半，结果的每个lane都是所有lane的最小值 / 最大值
+    // 有 NaN 时结果不确定
+    TSIMD_OP_SIG_AVX(batch_t, broadcast_min, (batch_t v))
+    {
+        __m256 t = _mm256_min_ps(v.v, _mm256_permute2f128_ps(v.v, v.v, 0x01));
+        t = _mm256_min_ps(t, _mm256_permute_ps(t, _MM_SHUFFLE(2, 3, 0, 1)));
+        return { _mm256_min_ps(t, _mm256_permute_ps(t, _MM_SHUFFLE(1, 0, 3, 2))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, broadcast_max, (batch_t v))
+    {
+        __m256 t = _mm256_max_ps(v.v, _mm256_permute2f128_ps(v.v, v.v, 0x01));
+        t = _mm256_max_ps(t, _mm256_permute_ps(t, _MM_SHUFFLE(2, 3, 0, 1)));
+        return { _mm256_max_ps(t, _mm256_permute_ps(t, _MM_SHUFFLE(1, 0, 3, 2))) };
+    }
+
+    TSIMD_OP_SIG_AVX(float32, reduce_min, (batch_t v))
+    {
+        return _mm256_cvtss_f32(broadcast_min(v).v);
+    }
+
+    TSIMD_OP_SIG_AVX(float32, reduce_max, (batch_t v))
+    {
+        return _mm256_cvtss_f32(broadcast_max(v).v);
+    }
+
+    TSIMD_OP_SIG_AVX(float32, reduce_mul, (batch_t v))
+    {
+        __m128 t = _mm_mul_ps(_mm256_castps256_ps128(v.v), _mm256_extractf128_ps(v.v, 0b1));
+        t = _mm_mul_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtss_f32(_mm_mul_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    // 第一个最小值 / 最大值所在的lane，v 中不能有 NaN
+    TSIMD_OP_SIG_AVX(size_t, argmin, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_min(v)))));
+    }
+
+    TSIMD_OP_SIG_AVX(size_t, argmax, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_max(v)))));
+    }
+
     TSIMD_OP_SIG_AVX(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
     {
         return { _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v) };
     }
+
+    // a * b - c
+    TSIMD_OP_SIG_AVX(batch_t, mul_sub, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm256_sub_ps(_mm256_mul_ps(a.v, b.v), c.v) };
+    }
+
+    // c - a * b
+    TSIMD_OP_SIG_AVX(batch_t, neg_mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm256_sub_ps(c.v, _mm256_mul_ps(a.v, b.v)) };
+    }
+
+    // 与C++的比较运算符一致: 有NaN时只有 cmp_ne 为true
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_EQ_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_NEQ_UQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_LT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_LE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_GT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_ps(lhs.v, rhs.v, _CMP_GE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_ps(b.v, a.v, mask.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(bool, any, (mask_t mask))
+    {
+        return !_mm256_testz_ps(mask.v, mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX(bool, all, (mask_t mask))
+    {
+        return _mm256_movemask_ps(mask.v) == 0xFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm256_movemask_ps(mask.v));
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_and_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_or_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm256_xor_ps(mask.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, abs, (batch_t v))
+    {
+        return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, neg, (batch_t v))
+    {
+        return { _mm256_xor_ps(v.v, _mm256_set1_ps(-0.0f)) };
+    }
+
+    // 有 NaN 或者两个数都是0时返回 rhs
+    TSIMD_OP_SIG_AVX(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_min_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_max_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, sqrt, (batch_t v))
+    {
+        return { _mm256_sqrt_ps(v.v) };
+    }
+
+    // 近似指令，相对误差不超过 1.5 * 2^-12，非正规数的输入视为0
+    TSIMD_OP_SIG_AVX(batch_t, rcp_approx, (batch_t v))
+    {
+        return { _mm256_rcp_ps(v.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, rsqrt_approx, (batch_t v))
+    {
+        return { _mm256_rsqrt_ps(v.v) };
+    }
+
+    TSIMD_DETAIL_SIMD_OP_RCP_RSQRT(AVX)
+
+    // 四舍六入五取偶
+    TSIMD_OP_SIG_AVX(batch_t, round, (batch_t v))
+    {
+        return { _mm256_round_ps(v.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, floor, (batch_t v))
+    {
+        return { _mm256_round_ps(v.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, ceil, (batch_t v))
+    {
+        return { _mm256_round_ps(v.v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, trunc, (batch_t v))
+    {
+        return { _mm256_round_ps(v.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) };
+    }
+
+    // 2^n，n为整数值，范围 [-126, 127]
+    // AVX 没有256位的整数运算，拆成两个128位
+    TSIMD_OP_SIG_AVX(batch_t, exp2i, (batch_t n))
+    {
+        const __m256i i = _mm256_cvtps_epi32(n.v);
+        const __m128i bias = _mm_set1_epi32(127);
+        const __m128i lo = _mm_slli_epi32(_mm_add_epi32(AVX_family::lo128(i), bias), 23);
+        const __m128i hi = _mm_slli_epi32(_mm_add_epi32(AVX_family::hi128(i), bias), 23);
+        return { _mm256_castsi256_ps(AVX_family::combine128(lo, hi)) };
+    }
+
+    // floor(log2(|v|))，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_AVX(batch_t, get_exponent, (batch_t v))
+    {
+        const __m256i bits = _mm256_castps_si256(_mm256_and_ps(v.v, _mm256_set1_ps(std::bit_cast<float32>(0x7F800000u))));
+        const __m128i bias = _mm_set1_epi32(127);
+        const __m128i lo = _mm_sub_epi32(_mm_srli_epi32(AVX_family::lo128(bits), 23), bias);
+        const __m128i hi = _mm_sub_epi32(_mm_srli_epi32(AVX_family::hi128(bits), 23), bias);
+        return { _mm256_cvtepi32_ps(AVX_family::combine128(lo, hi)) };
+    }
+
+    // |v| / 2^get_exponent(v)，范围 [1, 2)，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_AVX(batch_t, get_mantissa, (batch_t v))
+    {
+        // 保留尾数位，指数位替换成 1.0f 的指数
+        const __m256 mantissa_bits = _mm256_set1_ps(std::bit_cast<float32>(0x007FFFFFu));
+        return { _mm256_or_ps(_mm256_and_ps(v.v, mantissa_bits), _mm256_set1_ps(1.0f)) };
+    }
+
+    // ------------------------ 以4个float (128位) 为一组的操作，用于4x4矩阵 ------------------------
+    // 与SSE相同，AVX有2组 (低128位为第0组)
+
+    TSIMD_OP_SIG_AVX(batch_t, load_x4_strided, (const float32* mem, size_t stride, size_t groups))
+    {
+        if (stride == 4 && groups == 2)
+        {
+            return loadu(mem);
+        }
+
+        const __m128 lo = _mm_loadu_ps(mem);
+        const __m128 hi = (groups > 1) ? _mm_loadu_ps(mem + stride) : _mm_setzero_ps();
+        return { _mm256_set_m128(hi, lo) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_x4_strided, (float32* mem, size_t stride, batch_t v, size_t groups))
+    {
+        if (stride == 4 && groups == 2)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        _mm_storeu_ps(mem, _mm256_castps256_ps128(v.v));
+        if (groups > 1)
+        {
+            _mm_storeu_ps(mem + stride, _mm256_extractf128_ps(v.v, 1));
+        }
+    }
+
+    // vpermilps 在128位内部进行
+    TSIMD_OP_SIG_AVX(batch_t, splat_x4, (batch_t v, size_t lane))
+    {
+        switch (lane)
+        {
+        case 0:  return { _mm256_permute_ps(v.v, _MM_SHUFFLE(0, 0, 0, 0)) };
+        case 1:  return { _mm256_permute_ps(v.v, _MM_SHUFFLE(1, 1, 1, 1)) };
+        case 2:  return { _mm256_permute_ps(v.v, _MM_SHUFFLE(2, 2, 2, 2)) };
+        default: return { _mm256_permute_ps(v.v, _MM_SHUFFLE(3, 3, 3, 3)) };
+        }
+    }
+
+    // unpack / shuffle 都是在128位内部进行的，两组各自转置
+    TSIMD_OP_SIG_AVX(void, transpose_x4, (batch_t& r0, batch_t& r1, batch_t& r2, batch_t& r3))
+    {
+        const __m256 t0 = _mm256_unpacklo_ps(r0.v, r1.v); // [a0 b0 a1 b1]
+        const __m256 t1 = _mm256_unpackhi_ps(r0.v, r1.v); // [a2 b2 a3 b3]
+        const __m256 t2 = _mm256_unpacklo_ps(r2.v, r3.v); // [c0 d0 c1 d1]
+        const __m256 t3 = _mm256_unpackhi_ps(r2.v, r3.v); // [c2 d2 c3 d3]
+
+        r0.v = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)); // [a0 b0 c0 d0]
+        r1.v = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)); // [a1 b1 c1 d1]
+        r2.v = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)); // [a2 b2 c2 d2]
+        r3.v = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)); // [a3 b3 c3 d3]
+    }
+
+    // ------------------------ 下标访问 ------------------------
+
+    TSIMD_OP_SIG_AVX(index_t, load_index, (const int32* mem))
+    {
+        return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mem)) };
+    }
+
+    // AVX 没有 gather 指令，逐个读取 (AVX2 重写)
+    TSIMD_OP_SIG_AVX(batch_t, gather, (const float32* base, index_t idx))
+    {
+        alignas(32) int32 i[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(i), idx.v);
+        return { _mm256_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]], base[i[4]], base[i[5]], base[i[6]], base[i[7]]) };
+    }
+
+    // 按lane的顺序写入，下标重复时保留后面的lane
+    TSIMD_OP_SIG_AVX(void, scatter, (float32* base, index_t idx, batch_t v))
+    {
+        alignas(32) int32 i[8];
+        alignas(32) float32 x[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(i), idx.v);
+        _mm256_store_ps(x, v.v);
+        // 手动展开: 循环形式下每次写入 base 之后都要重新读取 i / x，慢3倍左右
+        base[i[0]] = x[0];
+        base[i[1]] = x[1];
+        base[i[2]] = x[2];
+        base[i[3]] = x[3];
+        base[i[4]] = x[4];
+        base[i[5]] = x[5];
+        base[i[6]] = x[6];
+        base[i[7]] = x[7];
+    }
+
+    // ------------------------ lane重排 ------------------------
+
+    // vpermilps 只能在128位内部重排，跨128位的模式: 原始和交换高低128位的各重排一次，再按lane混合
+    template<int... I>
+    TSIMD_OP_SIG_AVX(batch_t, permute, (batch_t v))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, Lanes, I...>, "invalid permute pattern");
+        if constexpr (detail::is_x4_lane_pattern<I...>())
+        {
+            return { _mm256_permute_ps(v.v, detail::x4_lane_imm<I...>()) };
+        }
+        else
+        {
+            constexpr int cross = static_cast<int>(detail::lane_pattern_bits<I...>([](int k, int i) { return (i >> 2) != (k >> 2); }));
+            const __m256i idx = _mm256_setr_epi32(I...); // vpermilps 只使用低2位
+            const __m256 same = _mm256_permutevar_ps(v.v, idx);
+            const __m256 swapped = _mm256_permutevar_ps(_mm256_permute2f128_ps(v.v, v.v, 0x01), idx);
+            return { _mm256_blend_ps(same, swapped, cross) };
+        }
+    }
+
+    template<int... I>
+    TSIMD_OP_SIG_AVX(batch_t, shuffle, (batch_t a, batch_t b))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, 2 * Lanes, I...>, "invalid shuffle pattern");
+        constexpr int from_b = static_cast<int>(detail::lane_pattern_bits<I...>([](int, int i) { return i >= 8; }));
+        return { _mm256_blend_ps(permute<(I & 7)...>(a).v, permute<(I & 7)...>(b).v, from_b) };
+    }
+
+    template<int N>
+    TSIMD_OP_SIG_AVX(batch_t, broadcast_lane, (batch_t v))
+    {
+        static_assert(N >= 0 && N < static_cast<int>(Lanes), "invalid lane");
+        // 先把 N 所在的128位复制到两组
+        const __m256 half = _mm256_permute2f128_ps(v.v, v.v, N < 4 ? 0x00 : 0x11);
+        return { _mm256_permute_ps(half, _MM_SHUFFLE(N & 3, N & 3, N & 3, N & 3)) };
+    }
+
+    // ------------------------ 交错存储的多分量数据 (AoS) ------------------------
+    // 与SSE相同，两组各自重排
+
+    TSIMD_OP_SIG_AVX(void, deinterleave2, (const float32* mem, batch_t& x, batch_t& y))
+    {
+        const __m256 a = load_x4_strided(mem, 8, Lanes / 4).v;
+        const __m256 b = load_x4_strided(mem + 4, 8, Lanes / 4).v;
+        x.v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    TSIMD_OP_SIG_AVX(void, interleave2, (float32* mem, batch_t x, batch_t y))
+    {
+        store_x4_strided(mem, 8, { _mm256_unpacklo_ps(x.v, y.v) }, Lanes / 4);
+        store_x4_strided(mem + 4, 8, { _mm256_unpackhi_ps(x.v, y.v) }, Lanes / 4);
+    }
+
+    TSIMD_OP_SIG_AVX(void, deinterleave3, (const float32* mem, batch_t& x, batch_t& y, batch_t& z))
+    {
+        const __m256 a = load_x4_strided(mem, 12, Lanes / 4).v;
+        const __m256 b = load_x4_strided(mem + 4, 12, Lanes / 4).v;
+        const __m256 c = load_x4_strided(mem + 8, 12, Lanes / 4).v;
+        x.v = _mm256_shuffle_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z.v = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    TSIMD_OP_SIG_AVX(void, interleave3, (float32* mem, batch_t x, batch_t y, batch_t z))
+    {
+        const __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        store_x4_strided(mem, 12, { a }, Lanes / 4);
+        store_x4_strided(mem + 4, 12, { b }, Lanes / 4);
+        store_x4_strided(mem + 8, 12, { c }, Lanes / 4);
+    }
+
+    TSIMD_OP_SIG_AVX(void, deinterleave4, (const float32* mem, batch_t& x, batch_t& y, batch_t& z, batch_t& w))
+    {
+        x = load_x4_strided(mem, 16, Lanes / 4);
+        y = load_x4_strided(mem + 4, 16, Lanes / 4);
+        z = load_x4_strided(mem + 8, 16, Lanes / 4);
+        w = load_x4_strided(mem + 12, 16, Lanes / 4);
+        transpose_x4(x, y, z, w);
+    }
+
+    TSIMD_OP_SIG_AVX(void, interleave4, (float32* mem, batch_t x, batch_t y, batch_t z, batch_t w))
+    {
+        transpose_x4(x, y, z, w);
+        store_x4_strided(mem, 16, x, Lanes / 4);
+        store_x4_strided(mem + 4, 16, y, Lanes / 4);
+        store_x4_strided(mem + 8, 16, z, Lanes / 4);
+        store_x4_strided(mem + 12, 16, w, Lanes / 4);
+    }
 };
 TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX, float32>);
 
@@ -14,6 +14,13 @@ namespace AVX_family
     {
         __m256 v;
     };
+
+    template<>
+    struct Mask<float32>
+    {
+        // 每个lane为全1或全0
+        __m256 v;
+    };
 }
 
 TSIMD_NAMESPACE_END
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "AVX2_float64.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2 + FMA指令特化
+template<>
+struct SimdOp<SimdInstruction::AVX2_FMA3, float64> : SimdOp<SimdInstruction::AVX2, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2_FMA3, float64, AVX_family::Batch<float64>, AVX_family::Mask<float64>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2_FMA3(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm256_fmadd_pd(a.v, b.v, c.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2_FMA3, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "AVX_float64.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2与AVX的浮点运算指令一致
+template<>
+struct SimdOp<SimdInstruction::AVX2, float64> : SimdOp<SimdInstruction::AVX, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, float64, AVX_family::Batch<float64>, AVX_family::Mask<float64>, Alignment::AVX_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2, float64>);
+
+TSIMD_NAMESPACE_END
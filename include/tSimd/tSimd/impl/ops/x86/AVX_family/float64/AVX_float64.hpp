@@ -0,0 +1,192 @@
+#pragma once
+
+#include "_AVX_family_float64_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::AVX, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX, float64, AVX_family::Batch<float64>, AVX_family::Mask<float64>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX(batch_t, load, (const float64* mem))
+    {
+        return { _mm256_load_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, loadu, (const float64* mem))
+    {
+        return { _mm256_loadu_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store, (float64* mem, batch_t v))
+    {
+        _mm256_store_pd(mem, v.v);
+    }
+
+    TSIMD_OP_SIG_AVX(void, storeu, (float64* mem, batch_t v))
+    {
+        _mm256_storeu_pd(mem, v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX(void, stream, (float64* mem, batch_t v))
+    {
+        _mm256_stream_pd(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // maskload: mask为0的lane不会访问内存，也不会触发越界异常，结果置0
+    TSIMD_OP_SIG_AVX(batch_t, load_partial, (const float64* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        return { _mm256_maskload_pd(mem, AVX_family::partial_mask_epi64(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_partial, (float64* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        _mm256_maskstore_pd(mem, AVX_family::partial_mask_epi64(count), v.v);
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, zero, ())
+    {
+        return { _mm256_setzero_pd() };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, set, (float64 x))
+    {
+        return { _mm256_set1_pd(x) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_add_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_sub_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, mul, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_mul_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, div, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_div_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(float64, reduce_sum, (batch_t v))
+    {
+        // [4, 3, 2, 1]
+        // hadd
+        // [34, 34, 12, 12]
+        __m256d t1 = _mm256_hadd_pd(v.v, v.v);
+
+        // low = [12, 12]
+        // high = [34, 34]
+        __m128d low = _mm256_castpd256_pd128(t1);
+        __m128d high = _mm256_extractf128_pd(t1, 0b1);
+
+        // add
+        // [1234, 1234]
+        // get lane[0]
+        low = _mm_add_pd(low, high);
+        return _mm_cvtsd_f64(low);
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v) };
+    }
+
+    // 与C++的比较运算符一致: 有NaN时只有 cmp_ne 为true
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_EQ_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_NEQ_UQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_LT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_LE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_GT_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmp_pd(lhs.v, rhs.v, _CMP_GE_OQ) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_pd(b.v, a.v, mask.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(bool, any, (mask_t mask))
+    {
+        return !_mm256_testz_pd(mask.v, mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX(bool, all, (mask_t mask))
+    {
+        return _mm256_movemask_pd(mask.v) == 0xF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm256_movemask_pd(mask.v));
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_and_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_or_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm256_xor_pd(mask.v, _mm256_castsi256_pd(_mm256_set1_epi32(-1))) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <immintrin.h> // AVX
+
+#include "../_AVX_family_types.hpp"
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace AVX_family
+{
+    template<>
+    struct Batch<float64>
+    {
+        __m256d v;
+    };
+
+    template<>
+    struct Mask<float64>
+    {
+        // 每个lane为全1或全0
+        __m256d v;
+    };
+}
+
+TSIMD_NAMESPACE_END
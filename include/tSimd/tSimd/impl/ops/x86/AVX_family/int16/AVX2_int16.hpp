@@ -0,0 +1,127 @@
+#pragma once
+
+#include "AVX_int16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2 使用256位的整数指令
+template<>
+struct SimdOp<SimdInstruction::AVX2, int16> : SimdOp<SimdInstruction::AVX, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, int16, AVX_family::Batch<int16>, AVX_family::Mask<int16>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_add_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_sub_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_mullo_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_and_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_or_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_xor_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_xor_si256(v.v, _mm256_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { _mm256_sll_epi16(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { _mm256_sra_epi16(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_min_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_max_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_adds_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_subs_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, load_widen, (const uint8* mem))
+    {
+        return { _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_AVX2(void, store_narrow, (uint8* mem, batch_t v))
+    {
+        // 与 int32 -> int16 相同，packus 之后需要重新排列64位元素
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(v.v, v.v), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), _mm256_castsi256_si128(packed));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpgt_epi16(rhs.v, lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_gt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpgt_epi16(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_lt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2, int16>);
+
+TSIMD_NAMESPACE_END
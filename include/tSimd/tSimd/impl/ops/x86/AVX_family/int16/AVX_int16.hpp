@@ -0,0 +1,233 @@
+#pragma once
+
+#include "_AVX_family_int16_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX 只有256位的浮点运算，整数运算拆成两个128位的 SSE4.1 运算
+template<>
+struct SimdOp<SimdInstruction::AVX, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX, int16, AVX_family::Batch<int16>, AVX_family::Mask<int16>, Alignment::AVX_Family)
+
+    using half_op = SimdOp<SimdInstruction::SSE4_1, int16>;
+
+    TSIMD_OP_SIG_AVX(batch_t, load, (const int16* mem))
+    {
+        return { _mm256_load_si256(reinterpret_cast<const __m256i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, loadu, (const int16* mem))
+    {
+        return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store, (int16* mem, batch_t v))
+    {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    TSIMD_OP_SIG_AVX(void, storeu, (int16* mem, batch_t v))
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX(void, stream, (int16* mem, batch_t v))
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // 没有8/16位的 maskload，经过栈上的缓冲区中转，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_AVX(batch_t, load_partial, (const int16* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        alignas(BatchAlignment) int16 buffer[Lanes] = {};
+        std::memcpy(buffer, mem, count * sizeof(int16));
+        return load(buffer);
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_partial, (int16* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        alignas(BatchAlignment) int16 buffer[Lanes];
+        store(buffer, v);
+        std::memcpy(mem, buffer, count * sizeof(int16));
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, zero, ())
+    {
+        return { _mm256_setzero_si256() };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, set, (int16 x))
+    {
+        return { _mm256_set1_epi16(static_cast<short>(x)) };
+    }
+
+    // 按位运算使用浮点域的指令
+    TSIMD_OP_SIG_AVX(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(v.v), _mm256_castsi256_ps(_mm256_set1_epi32(-1)))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, add, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, sub, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, mullo, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_SHIFT(half_op, shift_left, v.v, count) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_SHIFT(half_op, shift_right, v.v, count) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, min, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, max, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, add_sat, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, sub_sat, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, load_widen, (const uint8* mem))
+    {
+        return { AVX_family::combine128(half_op::load_widen(mem).v, half_op::load_widen(mem + half_op::Lanes).v) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_narrow, (uint8* mem, batch_t v))
+    {
+        half_op::store_narrow(mem, { AVX_family::lo128(v.v) });
+        half_op::store_narrow(mem + half_op::Lanes, { AVX_family::hi128(v.v) });
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_eq, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_ne, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_lt, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_le, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_gt, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_ge, lhs.v, rhs.v) };
+    }
+
+    // blendv_ps 只看每32位的最高位，8/16位的lane用 and / andnot / or 组合
+    TSIMD_OP_SIG_AVX(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        const __m256 m = _mm256_castsi256_ps(mask.v);
+        return { _mm256_castps_si256(_mm256_or_ps(_mm256_and_ps(m, _mm256_castsi256_ps(a.v)), _mm256_andnot_ps(m, _mm256_castsi256_ps(b.v)))) };
+    }
+
+    TSIMD_OP_SIG_AVX(bool, any, (mask_t mask))
+    {
+        return !_mm256_testz_si256(mask.v, mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX(bool, all, (mask_t mask))
+    {
+        return _mm256_testc_si256(mask.v, _mm256_set1_epi32(-1)) != 0;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX(uint32, movemask, (mask_t mask))
+    {
+        return half_op::movemask({ AVX_family::lo128(mask.v) }) | (half_op::movemask({ AVX_family::hi128(mask.v) }) << half_op::Lanes);
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(mask.v), _mm256_castsi256_ps(_mm256_set1_epi32(-1)))) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX, int16>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "AVX_int32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2 使用256位的整数指令
+template<>
+struct SimdOp<SimdInstruction::AVX2, int32> : SimdOp<SimdInstruction::AVX, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, int32, AVX_family::Batch<int32>, AVX_family::Mask<int32>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_add_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_sub_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_mullo_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_and_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_or_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_xor_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_xor_si256(v.v, _mm256_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { _mm256_sll_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { _mm256_sra_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_min_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_max_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(int32, reduce_sum, (batch_t v))
+    {
+        // 高低128位相加之后，与 SSE 一致
+        __m128i t1 = _mm_add_epi32(_mm256_castsi256_si128(v.v), _mm256_extracti128_si256(v.v, 0b1));
+        t1 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2)));
+        t1 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<int32>(_mm_cvtsi128_si32(t1));
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, load_widen, (const int16* mem))
+    {
+        return { _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_AVX2(void, store_narrow, (int16* mem, batch_t v))
+    {
+        // packs 在每个128位内部进行: [q3, q2, q1, q0] = [hi, hi, lo, lo] (每个q为64位)
+        // permute4x64 之后低128位为 [hi, lo]
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(v.v, v.v), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), _mm256_castsi256_si128(packed));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpgt_epi32(rhs.v, lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_gt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpgt_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_lt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2, int32>);
+
+TSIMD_NAMESPACE_END
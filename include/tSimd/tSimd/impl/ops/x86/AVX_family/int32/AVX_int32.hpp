@@ -0,0 +1,234 @@
+#pragma once
+
+#include "_AVX_family_int32_type.hpp"
+#include "../float32/_AVX_family_float32_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX 只有256位的浮点运算，整数运算拆成两个128位的 SSE4.1 运算
+template<>
+struct SimdOp<SimdInstruction::AVX, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX, int32, AVX_family::Batch<int32>, AVX_family::Mask<int32>, Alignment::AVX_Family)
+
+    using half_op = SimdOp<SimdInstruction::SSE4_1, int32>;
+
+    TSIMD_OP_SIG_AVX(batch_t, load, (const int32* mem))
+    {
+        return { _mm256_load_si256(reinterpret_cast<const __m256i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, loadu, (const int32* mem))
+    {
+        return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store, (int32* mem, batch_t v))
+    {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    TSIMD_OP_SIG_AVX(void, storeu, (int32* mem, batch_t v))
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_AVX(void, stream, (int32* mem, batch_t v))
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(mem), v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(AVX)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_AVX(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // maskload: mask为0的lane不会访问内存，也不会触发越界异常，结果置0
+    TSIMD_OP_SIG_AVX(batch_t, load_partial, (const int32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        return { _mm256_castps_si256(_mm256_maskload_ps(reinterpret_cast<const float*>(mem), AVX_family::partial_mask_epi32(count))) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_partial, (int32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        _mm256_maskstore_ps(reinterpret_cast<float*>(mem), AVX_family::partial_mask_epi32(count), _mm256_castsi256_ps(v.v));
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, zero, ())
+    {
+        return { _mm256_setzero_si256() };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, set, (int32 x))
+    {
+        return { _mm256_set1_epi32(static_cast<int>(x)) };
+    }
+
+    // 按位运算使用浮点域的指令
+    TSIMD_OP_SIG_AVX(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(v.v), _mm256_castsi256_ps(_mm256_set1_epi32(-1)))) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, add, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, sub, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, mullo, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_SHIFT(half_op, shift_left, v.v, count) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_SHIFT(half_op, shift_right, v.v, count) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, min, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, max, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(int32, reduce_sum, (batch_t v))
+    {
+        return half_op::reduce_sum(half_op::add({ AVX_family::lo128(v.v) }, { AVX_family::hi128(v.v) }));
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, load_widen, (const int16* mem))
+    {
+        return { AVX_family::combine128(half_op::load_widen(mem).v, half_op::load_widen(mem + half_op::Lanes).v) };
+    }
+
+    TSIMD_OP_SIG_AVX(void, store_narrow, (int16* mem, batch_t v))
+    {
+        half_op::store_narrow(mem, { AVX_family::lo128(v.v) });
+        half_op::store_narrow(mem + half_op::Lanes, { AVX_family::hi128(v.v) });
+    }
+
+    TSIMD_OP_SIG_AVX(AVX_family::Batch<float32>, to_float32, (batch_t v))
+    {
+        return { _mm256_cvtepi32_ps(v.v) };
+    }
+
+    // 向0取整，超出 int32 范围时返回 0x80000000
+    TSIMD_OP_SIG_AVX(batch_t, from_float32, (AVX_family::Batch<float32> v))
+    {
+        return { _mm256_cvttps_epi32(v.v) };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_AVX(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_eq, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_ne, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_lt, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_le, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_gt, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { TSIMD_DETAIL_AVX_SPLIT_BINARY(half_op, cmp_ge, lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b.v), _mm256_castsi256_ps(a.v), _mm256_castsi256_ps(mask.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(bool, any, (mask_t mask))
+    {
+        return !_mm256_testz_si256(mask.v, mask.v);
+    }
+
+    TSIMD_OP_SIG_AVX(bool, all, (mask_t mask))
+    {
+        return _mm256_testc_si256(mask.v, _mm256_set1_epi32(-1)) != 0;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_AVX(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(mask.v)));
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(lhs.v), _mm256_castsi256_ps(rhs.v))) };
+    }
+
+    TSIMD_OP_SIG_AVX(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(mask.v), _mm256_castsi256_ps(_mm256_set1_epi32(-1)))) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX, int32>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "AVX_uint32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2 使用256位的整数指令
+template<>
+struct SimdOp<SimdInstruction::AVX2, uint32> : SimdOp<SimdInstruction::AVX, uint32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, uint32, AVX_family::Batch<uint32>, AVX_family::Mask<uint32>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_add_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_sub_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_mullo_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_and_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_or_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_xor_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_xor_si256(v.v, _mm256_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { _mm256_sll_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { _mm256_srl_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_min_epu32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_max_epu32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(uint32, reduce_sum, (batch_t v))
+    {
+        // 高低128位相加之后，与 SSE 一致
+        __m128i t1 = _mm_add_epi32(_mm256_castsi256_si128(v.v), _mm256_extracti128_si256(v.v, 0b1));
+        t1 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2)));
+        t1 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<uint32>(_mm_cvtsi128_si32(t1));
+    }
+
+    // 没有无符号比较指令，lhs >= rhs 等价于 max(lhs, rhs) == lhs
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_ge(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi32(_mm256_min_epu32(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_le(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi32(_mm256_max_epu32(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2, uint32>);
+
+TSIMD_NAMESPACE_END
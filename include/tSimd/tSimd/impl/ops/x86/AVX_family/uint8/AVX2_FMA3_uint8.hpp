@@ -0,0 +1,15 @@
+#pragma once
+
+#include "AVX2_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// FMA3 只影响浮点运算
+template<>
+struct SimdOp<SimdInstruction::AVX2_FMA3, uint8> : SimdOp<SimdInstruction::AVX2, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2_FMA3, uint8, AVX_family::Batch<uint8>, AVX_family::Mask<uint8>, Alignment::AVX_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2_FMA3, uint8>);
+
+TSIMD_NAMESPACE_END
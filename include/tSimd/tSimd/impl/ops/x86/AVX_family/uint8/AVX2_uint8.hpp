@@ -0,0 +1,119 @@
+#pragma once
+
+#include "AVX_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// AVX2 使用256位的整数指令
+template<>
+struct SimdOp<SimdInstruction::AVX2, uint8> : SimdOp<SimdInstruction::AVX, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(AVX2, uint8, AVX_family::Batch<uint8>, AVX_family::Mask<uint8>, Alignment::AVX_Family)
+
+    TSIMD_OP_SIG_AVX2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_add_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_sub_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_and_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_or_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_xor_si256(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, bit_not, (batch_t v))
+    {
+        return { _mm256_xor_si256(v.v, _mm256_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    // 没有8位移位指令，按16位移位之后清除从相邻字节移入的位
+    TSIMD_OP_SIG_AVX2(batch_t, shift_left, (batch_t v, int count))
+    {
+        const __m256i mask = _mm256_set1_epi8(static_cast<char>(0xFFu << count));
+        return { _mm256_and_si256(_mm256_sll_epi16(v.v, _mm_cvtsi32_si128(count)), mask) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, shift_right, (batch_t v, int count))
+    {
+        const __m256i mask = _mm256_set1_epi8(static_cast<char>(0xFFu >> count));
+        return { _mm256_and_si256(_mm256_srl_epi16(v.v, _mm_cvtsi32_si128(count)), mask) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_min_epu8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_max_epu8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_adds_epu8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_subs_epu8(lhs.v, rhs.v) };
+    }
+
+    // 没有无符号比较指令，lhs >= rhs 等价于 max(lhs, rhs) == lhs
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_ge(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi8(_mm256_min_epu8(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_le(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_AVX2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm256_cmpeq_epi8(_mm256_max_epu8(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm256_blendv_epi8(b.v, a.v, mask.v) };
+    }
+
+    TSIMD_OP_SIG_AVX2(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm256_movemask_epi8(mask.v));
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::AVX2, uint8>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstring> // std::memcpy
+
+#include <immintrin.h> // AVX
+
+#include "../_AVX_family_types.hpp"
+#include "../../SSE_family/uint8/SSE4_1_uint8.hpp" // AVX 使用两个128位的 SSE4.1 运算
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace AVX_family
+{
+    template<>
+    struct Batch<uint8>
+    {
+        __m256i v;
+    };
+
+    template<>
+    struct Mask<uint8>
+    {
+        // 每个lane为全1或全0
+        __m256i v;
+    };
+}
+
+TSIMD_NAMESPACE_END
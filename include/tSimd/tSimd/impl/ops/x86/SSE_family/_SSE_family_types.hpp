@@ -8,6 +8,9 @@ namespace SSE_family
 {
     template<typename scalar_type>
     struct Batch;
+
+    template<typename scalar_type>
+    struct Mask;
 }
 
 TSIMD_NAMESPACE_END
\ No newline at end of file
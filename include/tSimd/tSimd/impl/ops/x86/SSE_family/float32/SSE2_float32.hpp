@@ -4,11 +4,33 @@
 
 TSIMD_NAMESPACE_BEGIN
 
-// SSE2 的浮点运算与SSE一致
+// SSE2 的浮点运算与SSE一致，只有需要整数指令的 round / exp2i / get_exponent 在这里重写 (floor / ceil / trunc 基于 round，重新展开)
 template<>
 struct SimdOp<SimdInstruction::SSE2, float32> : SimdOp<SimdInstruction::SSE, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE2, float32, SSE_family::Batch<float32>, Alignment::SSE_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE2, float32, SSE_family::Batch<float32>, SSE_family::Mask<float32>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE2(batch_t, round, (batch_t v))
+    {
+        // |v| >= 2^23 (包括 inf / NaN) 时 v 本身就是整数，cvtps_epi32 可能会溢出
+        const __m128 r = _mm_cvtepi32_ps(_mm_cvtps_epi32(v.v));
+        const __m128 in_range = _mm_cmplt_ps(abs(v).v, _mm_set1_ps(8388608.0f));
+        return select({ in_range }, { _mm_or_ps(r, _mm_and_ps(v.v, _mm_set1_ps(-0.0f))) }, v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_FLOOR_CEIL_TRUNC(SSE2)
+
+    TSIMD_OP_SIG_SSE2(batch_t, exp2i, (batch_t n))
+    {
+        const __m128i biased = _mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127));
+        return { _mm_castsi128_ps(_mm_slli_epi32(biased, 23)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, get_exponent, (batch_t v))
+    {
+        const __m128i biased = _mm_srli_epi32(_mm_and_si128(_mm_castps_si128(v.v), _mm_set1_epi32(0x7F800000)), 23);
+        return { _mm_cvtepi32_ps(_mm_sub_epi32(biased, _mm_set1_epi32(127))) };
+    }
 };
 TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE2, float32>);
 
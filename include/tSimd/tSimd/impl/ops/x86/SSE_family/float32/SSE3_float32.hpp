@@ -7,7 +7,7 @@ TSIMD_NAMESPACE_BEGIN
 template<>
 struct SimdOp<SimdInstruction::SSE3, float32> : SimdOp<SimdInstruction::SSE2, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, float32, SSE_family::Batch<float32>, Alignment::SSE_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, float32, SSE_family::Batch<float32>, SSE_family::Mask<float32>, Alignment::SSE_Family)
 
     TSIMD_OP_SIG_SSE3(float32, reduce_sum, (batch_t v))
     {
@@ -7,7 +7,32 @@ TSIMD_NAMESPACE_BEGIN
 template<>
 struct SimdOp<SimdInstruction::SSE4_1, float32> : SimdOp<SimdInstruction::SSE3, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, float32, SSE_family::Batch<float32>, Alignment::SSE_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, float32, SSE_family::Batch<float32>, SSE_family::Mask<float32>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_ps(b.v, a.v, mask.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, round, (batch_t v))
+    {
+        return { _mm_round_ps(v.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, floor, (batch_t v))
+    {
+        return { _mm_round_ps(v.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, ceil, (batch_t v))
+    {
+        return { _mm_round_ps(v.v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, trunc, (batch_t v))
+    {
+        return { _mm_round_ps(v.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) };
+    }
 };
 TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, float32>);
 
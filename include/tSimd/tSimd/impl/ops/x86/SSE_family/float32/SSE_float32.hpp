@@ -1,13 +1,21 @@
 #pragma once
 
+#include <bit>
+#include <cmath>
+#include <cstring>
+
 #include "_SSE_family_float32_type.hpp"
+#include "../int32/_SSE_family_int32_type.hpp"
 
 TSIMD_NAMESPACE_BEGIN
 
 template<>
 struct SimdOp<SimdInstruction::SSE, float32>
 {
-    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, float32, SSE_family::Batch<float32>, Alignment::SSE_Family)
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, float32, SSE_family::Batch<float32>, SSE_family::Mask<float32>, Alignment::SSE_Family)
+
+    // gather / scatter 的下标，SSE2 及以上与 SimdOp<..., int32>::batch_t 相同 (SSE 的 int32 是标量，用 load_index 读取)
+    using index_t = SSE_family::Batch<int32>;
 
     TSIMD_OP_SIG_SSE(batch_t, load, (const float32* mem))
     {
@@ -29,6 +37,109 @@ struct SimdOp<SimdInstruction::SSE, float32>
         _mm_storeu_ps(mem, v.v);
     }
 
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_SSE(void, stream, (float32* mem, batch_t v))
+    {
+        _mm_stream_ps(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SSE)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_SSE(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // 只读取前 count 个元素，其余lane置0，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_SSE(batch_t, load_partial, (const float32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        const __m128 z = _mm_setzero_ps();
+        switch (count)
+        {
+        case 1:
+            // [0, 0, 0, a]
+            return { _mm_load_ss(mem) };
+        case 2:
+            // [0, 0, b, a]
+            return { _mm_loadl_pi(z, reinterpret_cast<const __m64*>(mem)) };
+        case 3:
+        {
+            // low = [0, 0, b, a], high = [0, 0, 0, c]
+            // movelh: [0, c, b, a]
+            __m128 low = _mm_loadl_pi(z, reinterpret_cast<const __m64*>(mem));
+            __m128 high = _mm_load_ss(mem + 2);
+            return { _mm_movelh_ps(low, high) };
+        }
+        default:
+            return { z };
+        }
+    }
+
+    // 只写入前 count 个元素
+    TSIMD_OP_SIG_SSE(void, store_partial, (float32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        switch (count)
+        {
+        case 1:
+            _mm_store_ss(mem, v.v);
+            break;
+        case 2:
+            _mm_storel_pi(reinterpret_cast<__m64*>(mem), v.v);
+            break;
+        case 3:
+            // [d, c, b, a] -> 写入 b, a，再把 c 移到 lane[0] 写入
+            _mm_storel_pi(reinterpret_cast<__m64*>(mem), v.v);
+            _mm_store_ss(mem + 2, _mm_movehl_ps(v.v, v.v));
+            break;
+        default:
+            break;
+        }
+    }
+
+    // 半精度 <-> float32，mem 不要求对齐
+    // 没有 F16C，逐个元素用软件转换 (detail::float32_to_float16_bits)
+    TSIMD_OP_SIG_SSE(batch_t, load_f16_partial, (const float16* mem, size_t count))
+    {
+        alignas(Alignment::SSE_Family) float32 tmp[Lanes] = {};
+        for (size_t k = 0; k < count && k < Lanes; ++k)
+        {
+            tmp[k] = static_cast<float32>(mem[k]);
+        }
+        return load(tmp);
+    }
+
+    TSIMD_OP_SIG_SSE(void, store_f16_partial, (float16* mem, batch_t v, size_t count))
+    {
+        alignas(Alignment::SSE_Family) float32 tmp[Lanes];
+        store(tmp, v);
+        for (size_t k = 0; k < count && k < Lanes; ++k)
+        {
+            mem[k] = float16(tmp[k]);
+        }
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, load_f16, (const float16* mem))
+    {
+        return load_f16_partial(mem, Lanes);
+    }
+
+    TSIMD_OP_SIG_SSE(void, store_f16, (float16* mem, batch_t v))
+    {
+        store_f16_partial(mem, v, Lanes);
+    }
+
    TSIMD_OP_SIG_SSE(batch_t, zero, ())
     {
         return { _mm_setzero_ps() };
@@ -78,10 +189,387 @@ struct SimdOp<SimdInstruction::SSE, float32>
         return _mm_cvtss_f32(t1);
     }
 
+    // 蝶形折半 (与 reduce_sum 的第一种写法相同)，结果的每个lane都是所有lane的最小值 / 最大值
+    // 有 NaN 时结果不确定
+    TSIMD_OP_SIG_SSE(batch_t, broadcast_min, (batch_t v))
+    {
+        const __m128 t = _mm_min_ps(v.v, _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return { _mm_min_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2))) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, broadcast_max, (batch_t v))
+    {
+        const __m128 t = _mm_max_ps(v.v, _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return { _mm_max_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2))) };
+    }
+
+    TSIMD_OP_SIG_SSE(float32, reduce_min, (batch_t v))
+    {
+        return _mm_cvtss_f32(broadcast_min(v).v);
+    }
+
+    TSIMD_OP_SIG_SSE(float32, reduce_max, (batch_t v))
+    {
+        return _mm_cvtss_f32(broadcast_max(v).v);
+    }
+
+    // (a*b) * (c*d)
+    TSIMD_OP_SIG_SSE(float32, reduce_mul, (batch_t v))
+    {
+        const __m128 t = _mm_mul_ps(v.v, _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtss_f32(_mm_mul_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    // 第一个最小值 / 最大值所在的lane，v 中不能有 NaN
+    TSIMD_OP_SIG_SSE(size_t, argmin, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_min(v)))));
+    }
+
+    TSIMD_OP_SIG_SSE(size_t, argmax, (batch_t v))
+    {
+        return static_cast<size_t>(std::countr_zero(movemask(cmp_eq(v, broadcast_max(v)))));
+    }
+
     TSIMD_OP_SIG_SSE(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
     {
         return { _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v) };
     }
+
+    // a * b - c
+    TSIMD_OP_SIG_SSE(batch_t, mul_sub, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm_sub_ps(_mm_mul_ps(a.v, b.v), c.v) };
+    }
+
+    // c - a * b
+    TSIMD_OP_SIG_SSE(batch_t, neg_mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm_sub_ps(c.v, _mm_mul_ps(a.v, b.v)) };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SSE(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpneq_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmplt_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmple_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpgt_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpge_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE(bool, any, (mask_t mask))
+    {
+        return _mm_movemask_ps(mask.v) != 0;
+    }
+
+    TSIMD_OP_SIG_SSE(bool, all, (mask_t mask))
+    {
+        return _mm_movemask_ps(mask.v) == 0xF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SSE(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm_movemask_ps(mask.v));
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_and_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_or_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(mask_t, mask_not, (mask_t mask))
+    {
+        // SSE1 没有整数指令，无法直接构造全1的常量:
+        // mask中全1的lane是NaN，与自身比较为false，全0的lane为true，恰好取反
+        return { _mm_cmpeq_ps(mask.v, mask.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, abs, (batch_t v))
+    {
+        return { _mm_andnot_ps(_mm_set1_ps(-0.0f), v.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, neg, (batch_t v))
+    {
+        return { _mm_xor_ps(v.v, _mm_set1_ps(-0.0f)) };
+    }
+
+    // 有 NaN 或者两个数都是0时返回 rhs
+    TSIMD_OP_SIG_SSE(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_min_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_max_ps(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, sqrt, (batch_t v))
+    {
+        return { _mm_sqrt_ps(v.v) };
+    }
+
+    // 近似指令，相对误差不超过 1.5 * 2^-12，非正规数的输入视为0
+    TSIMD_OP_SIG_SSE(batch_t, rcp_approx, (batch_t v))
+    {
+        return { _mm_rcp_ps(v.v) };
+    }
+
+    TSIMD_OP_SIG_SSE(batch_t, rsqrt_approx, (batch_t v))
+    {
+        return { _mm_rsqrt_ps(v.v) };
+    }
+
+    TSIMD_DETAIL_SIMD_OP_RCP_RSQRT(SSE)
+
+    // 四舍六入五取偶
+    TSIMD_OP_SIG_SSE(batch_t, round, (batch_t v))
+    {
+        // |v| < 2^23 时，加上再减去 2^23 会把小数部分按当前舍入模式舍去，其余情况 v 本身就是整数 (或 inf / NaN)
+        const __m128 magic = _mm_set1_ps(8388608.0f);
+        const __m128 sign = _mm_and_ps(v.v, _mm_set1_ps(-0.0f));
+        const __m128 a = abs(v).v;
+        const __m128 r = _mm_or_ps(_mm_sub_ps(_mm_add_ps(a, magic), magic), sign);
+        return select({ _mm_cmplt_ps(a, magic) }, { r }, v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_FLOOR_CEIL_TRUNC(SSE)
+
+    // 2^n，n为整数值，范围 [-126, 127]
+    // SSE1 没有整数指令，逐个lane计算
+    TSIMD_OP_SIG_SSE(batch_t, exp2i, (batch_t n))
+    {
+        alignas(BatchAlignment) float32 lanes[Lanes];
+        _mm_store_ps(lanes, n.v);
+        for (float32& x : lanes)
+        {
+            x = std::isfinite(x) ? std::ldexp(1.0f, static_cast<int>(x)) : x;
+        }
+        return { _mm_load_ps(lanes) };
+    }
+
+    // floor(log2(|v|))，只保证正规数 (normal) 的结果
+    // SSE1 没有整数指令，逐个lane计算
+    TSIMD_OP_SIG_SSE(batch_t, get_exponent, (batch_t v))
+    {
+        alignas(BatchAlignment) float32 lanes[Lanes];
+        _mm_store_ps(lanes, v.v);
+        for (float32& x : lanes)
+        {
+            x = static_cast<float32>(std::ilogb(x));
+        }
+        return { _mm_load_ps(lanes) };
+    }
+
+    // |v| / 2^get_exponent(v)，范围 [1, 2)，只保证正规数 (normal) 的结果
+    TSIMD_OP_SIG_SSE(batch_t, get_mantissa, (batch_t v))
+    {
+        // 保留尾数位，指数位替换成 1.0f 的指数
+        const __m128 mantissa_bits = _mm_set1_ps(std::bit_cast<float32>(0x007FFFFFu));
+        return { _mm_or_ps(_mm_and_ps(v.v, mantissa_bits), _mm_set1_ps(1.0f)) };
+    }
+
+    // ------------------------ 以4个float (128位) 为一组的操作，用于4x4矩阵 ------------------------
+    // 一个batch有 Lanes / 4 组，第g组对应内存 mem + g * stride，只处理前 groups 组 (1 <= groups <= Lanes / 4)
+    // 读取时其余的组置0，写入时其余的组不写入。Scalar 的 Lanes 为1，没有这些函数
+    // SSE 只有1组
+
+    // 第g组为 mem[g * stride + (0..3)]
+    TSIMD_OP_SIG_SSE(batch_t, load_x4_strided, (const float32* mem, size_t stride, size_t groups))
+    {
+        (void)stride;
+        (void)groups;
+        return loadu(mem);
+    }
+
+    TSIMD_OP_SIG_SSE(void, store_x4_strided, (float32* mem, size_t stride, batch_t v, size_t groups))
+    {
+        (void)stride;
+        (void)groups;
+        storeu(mem, v);
+    }
+
+    // 每一组内部，4个lane都为该组的第 lane 个元素 (lane 为 0~3)
+    TSIMD_OP_SIG_SSE(batch_t, splat_x4, (batch_t v, size_t lane))
+    {
+        switch (lane)
+        {
+        case 0:  return { _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(0, 0, 0, 0)) };
+        case 1:  return { _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(1, 1, 1, 1)) };
+        case 2:  return { _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 2, 2, 2)) };
+        default: return { _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(3, 3, 3, 3)) };
+        }
+    }
+
+    // 每一组内部，把 r0~r3 看作4x4矩阵的4行，原地转置
+    TSIMD_OP_SIG_SSE(void, transpose_x4, (batch_t& r0, batch_t& r1, batch_t& r2, batch_t& r3))
+    {
+        _MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+    }
+
+    // ------------------------ 下标访问 ------------------------
+    // 下标以元素为单位 (base[idx[i]])，不检查越界
+
+    TSIMD_OP_SIG_SSE(index_t, load_index, (const int32* mem))
+    {
+        // SSE 没有整数的load，memcpy 同样生成一条 movups
+        index_t r;
+        std::memcpy(&r.v, mem, sizeof(r.v));
+        return r;
+    }
+
+    // 没有 gather 指令，逐个读取
+    TSIMD_OP_SIG_SSE(batch_t, gather, (const float32* base, index_t idx))
+    {
+        alignas(16) int32 i[4];
+        std::memcpy(i, &idx.v, sizeof(i));
+        return { _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]) };
+    }
+
+    // 按lane的顺序写入，下标重复时保留后面的lane
+    TSIMD_OP_SIG_SSE(void, scatter, (float32* base, index_t idx, batch_t v))
+    {
+        alignas(16) int32 i[4];
+        alignas(16) float32 x[4];
+        std::memcpy(i, &idx.v, sizeof(i));
+        _mm_store_ps(x, v.v);
+        base[i[0]] = x[0];
+        base[i[1]] = x[1];
+        base[i[2]] = x[2];
+        base[i[3]] = x[3];
+    }
+
+    // ------------------------ lane重排 ------------------------
+    // 模式在编译期确定，依赖模板参数的 op 需要写成 op::template permute<...>(v)
+
+    // 结果的第k个lane为 v[I_k]，I_k 在 [0, Lanes) 内
+    template<int... I>
+    TSIMD_OP_SIG_SSE(batch_t, permute, (batch_t v))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, Lanes, I...>, "invalid permute pattern");
+        return { _mm_shuffle_ps(v.v, v.v, detail::x4_lane_imm<I...>()) };
+    }
+
+    // 结果的第k个lane为 I_k < Lanes ? a[I_k] : b[I_k - Lanes]
+    template<int... I>
+    TSIMD_OP_SIG_SSE(batch_t, shuffle, (batch_t a, batch_t b))
+    {
+        static_assert(detail::valid_lane_pattern<Lanes, 2 * Lanes, I...>, "invalid shuffle pattern");
+        constexpr int p[] = { I... };
+        if constexpr (p[0] < 4 && p[1] < 4 && p[2] >= 4 && p[3] >= 4)
+        {
+            // shufps: 低两个lane来自a，高两个lane来自b
+            return { _mm_shuffle_ps(a.v, b.v, detail::x4_lane_imm<I...>()) };
+        }
+        else
+        {
+            constexpr uint32 from_b = detail::lane_pattern_bits<I...>([](int, int i) { return i >= 4; });
+            const __m128 m = _mm_setr_ps(
+                std::bit_cast<float32>(0u - (from_b & 1u)), std::bit_cast<float32>(0u - ((from_b >> 1) & 1u)),
+                std::bit_cast<float32>(0u - ((from_b >> 2) & 1u)), std::bit_cast<float32>(0u - ((from_b >> 3) & 1u)));
+            return select({ m }, permute<(I & 3)...>(b), permute<(I & 3)...>(a));
+        }
+    }
+
+    // 所有lane都为 v[N]
+    template<int N>
+    TSIMD_OP_SIG_SSE(batch_t, broadcast_lane, (batch_t v))
+    {
+        static_assert(N >= 0 && N < static_cast<int>(Lanes), "invalid lane");
+        return { _mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(N, N, N, N)) };
+    }
+
+    // ------------------------ 交错存储的多分量数据 (AoS) ------------------------
+    // deinterleaveK: 从 mem 读取 Lanes 个K分量的元素 (x0 y0 x1 y1 ...)，拆成K个batch
+    // interleaveK: 逆操作，写入 K * Lanes 个元素
+    // 先用 load_x4_strided 把第 g 个128位组对应的K个128位数据放到同一组，再在128位内部重排，AVX / AVX-512 与SSE的算法相同
+
+    TSIMD_OP_SIG_SSE(void, deinterleave2, (const float32* mem, batch_t& x, batch_t& y))
+    {
+        const __m128 a = load_x4_strided(mem, 8, Lanes / 4).v;     // [x0 y0 x1 y1]
+        const __m128 b = load_x4_strided(mem + 4, 8, Lanes / 4).v; // [x2 y2 x3 y3]
+        x.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    TSIMD_OP_SIG_SSE(void, interleave2, (float32* mem, batch_t x, batch_t y))
+    {
+        store_x4_strided(mem, 8, { _mm_unpacklo_ps(x.v, y.v) }, Lanes / 4);
+        store_x4_strided(mem + 4, 8, { _mm_unpackhi_ps(x.v, y.v) }, Lanes / 4);
+    }
+
+    // 每个分量用3次 shufps: 先各取两个元素 [p p q q]，再合并偶数lane
+    TSIMD_OP_SIG_SSE(void, deinterleave3, (const float32* mem, batch_t& x, batch_t& y, batch_t& z))
+    {
+        const __m128 a = load_x4_strided(mem, 12, Lanes / 4).v;     // [x0 y0 z0 x1]
+        const __m128 b = load_x4_strided(mem + 4, 12, Lanes / 4).v; // [y1 z1 x2 y2]
+        const __m128 c = load_x4_strided(mem + 8, 12, Lanes / 4).v; // [z2 x3 y3 z3]
+        x.v = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        y.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    TSIMD_OP_SIG_SSE(void, interleave3, (float32* mem, batch_t x, batch_t y, batch_t z))
+    {
+        const __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        store_x4_strided(mem, 12, { a }, Lanes / 4);
+        store_x4_strided(mem + 4, 12, { b }, Lanes / 4);
+        store_x4_strided(mem + 8, 12, { c }, Lanes / 4);
+    }
+
+    TSIMD_OP_SIG_SSE(void, deinterleave4, (const float32* mem, batch_t& x, batch_t& y, batch_t& z, batch_t& w))
+    {
+        x = load_x4_strided(mem, 16, Lanes / 4);
+        y = load_x4_strided(mem + 4, 16, Lanes / 4);
+        z = load_x4_strided(mem + 8, 16, Lanes / 4);
+        w = load_x4_strided(mem + 12, 16, Lanes / 4);
+        transpose_x4(x, y, z, w);
+    }
+
+    TSIMD_OP_SIG_SSE(void, interleave4, (float32* mem, batch_t x, batch_t y, batch_t z, batch_t w))
+    {
+        transpose_x4(x, y, z, w);
+        store_x4_strided(mem, 16, x, Lanes / 4);
+        store_x4_strided(mem + 4, 16, y, Lanes / 4);
+        store_x4_strided(mem + 8, 16, z, Lanes / 4);
+        store_x4_strided(mem + 12, 16, w, Lanes / 4);
+    }
 };
 TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, float32>);
 
@@ -17,6 +17,13 @@ namespace SSE_family
     {
         __m128 v;
     };
+
+    template<>
+    struct Mask<float32>
+    {
+        // 每个lane为全1或全0
+        __m128 v;
+    };
 }
 
 TSIMD_NAMESPACE_END
\ No newline at end of file
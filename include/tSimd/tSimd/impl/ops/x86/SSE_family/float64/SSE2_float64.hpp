@@ -0,0 +1,189 @@
+#pragma once
+
+#include "_SSE_family_float64_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE2, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE2, float64, SSE_family::Batch<float64>, SSE_family::Mask<float64>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE2(batch_t, load, (const float64* mem))
+    {
+        return { _mm_load_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, loadu, (const float64* mem))
+    {
+        return { _mm_loadu_pd(mem) };
+    }
+
+    TSIMD_OP_SIG_SSE2(void, store, (float64* mem, batch_t v))
+    {
+        _mm_store_pd(mem, v.v);
+    }
+
+    TSIMD_OP_SIG_SSE2(void, storeu, (float64* mem, batch_t v))
+    {
+        _mm_storeu_pd(mem, v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_SSE2(void, stream, (float64* mem, batch_t v))
+    {
+        _mm_stream_pd(mem, v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SSE2)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_SSE2(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // 只读取前 count 个元素，其余lane置0，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_SSE2(batch_t, load_partial, (const float64* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        // [0, a]
+        return { count == 1 ? _mm_load_sd(mem) : _mm_setzero_pd() };
+    }
+
+    // 只写入前 count 个元素
+    TSIMD_OP_SIG_SSE2(void, store_partial, (float64* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        if (count == 1)
+        {
+            _mm_store_sd(mem, v.v);
+        }
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, zero, ())
+    {
+        return { _mm_setzero_pd() };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, set, (float64 x))
+    {
+        return { _mm_set1_pd(x) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_add_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_sub_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, mul, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_mul_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, div, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_div_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(float64, reduce_sum, (batch_t v))
+    {
+        // [b, a]
+        //   +
+        // [a, b]
+        // [a+b, a+b]
+        // get lane[0]
+        __m128d t1 = _mm_shuffle_pd(v.v, v.v, 0b01);
+        t1 = _mm_add_pd(v.v, t1);
+        return _mm_cvtsd_f64(t1);
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, mul_add, (batch_t a, batch_t b, batch_t c))
+    {
+        return { _mm_add_pd(_mm_mul_pd(a.v, b.v), c.v) };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpneq_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmplt_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmple_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpgt_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpge_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_or_pd(_mm_and_pd(mask.v, a.v), _mm_andnot_pd(mask.v, b.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, any, (mask_t mask))
+    {
+        return _mm_movemask_pd(mask.v) != 0;
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, all, (mask_t mask))
+    {
+        return _mm_movemask_pd(mask.v) == 0x3;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SSE2(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm_movemask_pd(mask.v));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_and_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_or_pd(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm_xor_pd(mask.v, _mm_castsi128_pd(_mm_set1_epi32(-1))) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE2, float64>);
+
+TSIMD_NAMESPACE_END
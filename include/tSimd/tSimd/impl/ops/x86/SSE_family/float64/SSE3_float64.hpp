@@ -0,0 +1,22 @@
+#pragma once
+
+#include "SSE2_float64.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE3, float64> : SimdOp<SimdInstruction::SSE2, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, float64, SSE_family::Batch<float64>, SSE_family::Mask<float64>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE3(float64, reduce_sum, (batch_t v))
+    {
+        // input: [b, a]
+        // hadd: [a+b, a+b]
+        // get lane[0]
+        return _mm_cvtsd_f64(_mm_hadd_pd(v.v, v.v));
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE3, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "SSE3_float64.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE4_1, float64> : SimdOp<SimdInstruction::SSE3, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, float64, SSE_family::Batch<float64>, SSE_family::Mask<float64>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_pd(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../../Scalar/Scalar_float64.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE 没有双精度浮点指令 (从SSE2开始才有 __m128d)，直接使用标量实现
+template<>
+struct SimdOp<SimdInstruction::SSE, float64> : SimdOp<SimdInstruction::Scalar, float64>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, float64, Scalar::Batch<float64>, Scalar::Mask<float64>, alignof(float64))
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, float64>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <xmmintrin.h> // SSE
+#include <emmintrin.h> // SSE2
+#include <pmmintrin.h> // SSE3
+#include <smmintrin.h> // SSE4.1
+
+#include "../_SSE_family_types.hpp"
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace SSE_family
+{
+    template<>
+    struct Batch<float64>
+    {
+        __m128d v;
+    };
+
+    template<>
+    struct Mask<float64>
+    {
+        // 每个lane为全1或全0
+        __m128d v;
+    };
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "SSE2_int16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE3 没有新增整数指令
+template<>
+struct SimdOp<SimdInstruction::SSE3, int16> : SimdOp<SimdInstruction::SSE2, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, int16, SSE_family::Batch<int16>, SSE_family::Mask<int16>, Alignment::SSE_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE3, int16>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "SSE3_int16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE4_1, int16> : SimdOp<SimdInstruction::SSE3, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, int16, SSE_family::Batch<int16>, SSE_family::Mask<int16>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, load_widen, (const uint8* mem))
+    {
+        return { _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, int16>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../../Scalar/Scalar_int16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE 没有整数指令 (从SSE2开始才有 __m128i)，直接使用标量实现
+template<>
+struct SimdOp<SimdInstruction::SSE, int16> : SimdOp<SimdInstruction::Scalar, int16>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, int16, Scalar::Batch<int16>, Scalar::Mask<int16>, alignof(int16))
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, int16>);
+
+TSIMD_NAMESPACE_END
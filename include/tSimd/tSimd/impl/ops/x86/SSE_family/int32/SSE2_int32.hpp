@@ -0,0 +1,250 @@
+#pragma once
+
+#include "_SSE_family_int32_type.hpp"
+#include "../float32/_SSE_family_float32_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE2, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE2, int32, SSE_family::Batch<int32>, SSE_family::Mask<int32>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE2(batch_t, load, (const int32* mem))
+    {
+        return { _mm_load_si128(reinterpret_cast<const __m128i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, loadu, (const int32* mem))
+    {
+        return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(void, store, (int32* mem, batch_t v))
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    TSIMD_OP_SIG_SSE2(void, storeu, (int32* mem, batch_t v))
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_SSE2(void, stream, (int32* mem, batch_t v))
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SSE2)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_SSE2(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // 整数没有按元素个数读取的指令，经过栈上的缓冲区中转，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_SSE2(batch_t, load_partial, (const int32* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        alignas(BatchAlignment) int32 buffer[Lanes] = {};
+        std::memcpy(buffer, mem, count * sizeof(int32));
+        return load(buffer);
+    }
+
+    TSIMD_OP_SIG_SSE2(void, store_partial, (int32* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        alignas(BatchAlignment) int32 buffer[Lanes];
+        store(buffer, v);
+        std::memcpy(mem, buffer, count * sizeof(int32));
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, zero, ())
+    {
+        return { _mm_setzero_si128() };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, set, (int32 x))
+    {
+        return { _mm_set1_epi32(static_cast<int>(x)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_add_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_sub_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_and_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_or_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_xor_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_not, (batch_t v))
+    {
+        // cmpeq(v, v) 为全1
+        return { _mm_xor_si128(v.v, _mm_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    // SSE2 没有 mullo_epi32: 分别计算偶数和奇数lane的64位乘积，取低32位再交错合并
+    TSIMD_OP_SIG_SSE2(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        __m128i even = _mm_mul_epu32(lhs.v, rhs.v);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs.v, 32), _mm_srli_epi64(rhs.v, 32));
+        return { _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))) };
+    }
+
+    // count: [0, 位宽)
+    TSIMD_OP_SIG_SSE2(batch_t, shift_left, (batch_t v, int count))
+    {
+        return { _mm_sll_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, shift_right, (batch_t v, int count))
+    {
+        return { _mm_sra_epi32(v.v, _mm_cvtsi32_si128(count)) };
+    }
+
+    // SSE2 没有 min/max_epi32，使用比较 + 按位选择
+    TSIMD_OP_SIG_SSE2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        __m128i gt = _mm_cmpgt_epi32(lhs.v, rhs.v);
+        return { _mm_or_si128(_mm_and_si128(gt, rhs.v), _mm_andnot_si128(gt, lhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        __m128i gt = _mm_cmpgt_epi32(lhs.v, rhs.v);
+        return { _mm_or_si128(_mm_and_si128(gt, lhs.v), _mm_andnot_si128(gt, rhs.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(int32, reduce_sum, (batch_t v))
+    {
+        // [d, c, b, a] + [b, a, d, c] = [b+d, a+c, b+d, a+c]
+        // + [a+c, b+d, a+c, b+d]
+        // get lane[0]
+        __m128i t1 = _mm_add_epi32(v.v, _mm_shuffle_epi32(v.v, _MM_SHUFFLE(1, 0, 3, 2)));
+        t1 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<int32>(_mm_cvtsi128_si32(t1));
+    }
+
+    // 读取 Lanes 个 int16，符号扩展为 int32
+    TSIMD_OP_SIG_SSE2(batch_t, load_widen, (const int16* mem))
+    {
+        // [h, g, f, e, d, c, b, a] -> [d, d, c, c, b, b, a, a] -> 算术右移16位
+        __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mem));
+        return { _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16) };
+    }
+
+    // 饱和转换为 int16，写入 Lanes 个元素
+    TSIMD_OP_SIG_SSE2(void, store_narrow, (int16* mem, batch_t v))
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(mem), _mm_packs_epi32(v.v, v.v));
+    }
+
+    TSIMD_OP_SIG_SSE2(SSE_family::Batch<float32>, to_float32, (batch_t v))
+    {
+        return { _mm_cvtepi32_ps(v.v) };
+    }
+
+    // 向0取整，超出 int32 范围时返回 0x80000000
+    TSIMD_OP_SIG_SSE2(batch_t, from_float32, (SSE_family::Batch<float32> v))
+    {
+        return { _mm_cvttps_epi32(v.v) };
+    }
+
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmplt_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_gt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpgt_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_lt(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_or_si128(_mm_and_si128(mask.v, a.v), _mm_andnot_si128(mask.v, b.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, any, (mask_t mask))
+    {
+        return _mm_movemask_epi8(mask.v) != 0;
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, all, (mask_t mask))
+    {
+        return _mm_movemask_epi8(mask.v) == 0xFFFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SSE2(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(mask.v)));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_and_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_or_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm_xor_si128(mask.v, _mm_set1_epi32(-1)) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE2, int32>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "SSE2_int32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE3 没有新增整数指令
+template<>
+struct SimdOp<SimdInstruction::SSE3, int32> : SimdOp<SimdInstruction::SSE2, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, int32, SSE_family::Batch<int32>, SSE_family::Mask<int32>, Alignment::SSE_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE3, int32>);
+
+TSIMD_NAMESPACE_END
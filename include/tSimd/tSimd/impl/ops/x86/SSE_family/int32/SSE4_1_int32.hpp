@@ -0,0 +1,39 @@
+#pragma once
+
+#include "SSE3_int32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE4_1, int32> : SimdOp<SimdInstruction::SSE3, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, int32, SSE_family::Batch<int32>, SSE_family::Mask<int32>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_mullo_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_min_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_max_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, load_widen, (const int16* mem))
+    {
+        return { _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mem))) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, int32>);
+
+TSIMD_NAMESPACE_END
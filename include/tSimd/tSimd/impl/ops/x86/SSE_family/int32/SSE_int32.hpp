@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../../Scalar/Scalar_int32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE 没有整数指令 (从SSE2开始才有 __m128i)，直接使用标量实现
+template<>
+struct SimdOp<SimdInstruction::SSE, int32> : SimdOp<SimdInstruction::Scalar, int32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, int32, Scalar::Batch<int32>, Scalar::Mask<int32>, alignof(int32))
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, int32>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "SSE3_uint32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE4_1, uint32> : SimdOp<SimdInstruction::SSE3, uint32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, uint32, SSE_family::Batch<uint32>, SSE_family::Mask<uint32>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, mullo, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_mullo_epi32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_min_epu32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_max_epu32(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_epi8(b.v, a.v, mask.v) };
+    }
+
+    // SSE4.1 有 min_epu32 / max_epu32，lhs >= rhs 等价于 max(lhs, rhs) == lhs
+    TSIMD_OP_SIG_SSE4_1(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi32(_mm_min_epu32(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE4_1(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi32(_mm_max_epu32(lhs.v, rhs.v), lhs.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, uint32>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../../Scalar/Scalar_uint32.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE 没有整数指令 (从SSE2开始才有 __m128i)，直接使用标量实现
+template<>
+struct SimdOp<SimdInstruction::SSE, uint32> : SimdOp<SimdInstruction::Scalar, uint32>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, uint32, Scalar::Batch<uint32>, Scalar::Mask<uint32>, alignof(uint32))
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, uint32>);
+
+TSIMD_NAMESPACE_END
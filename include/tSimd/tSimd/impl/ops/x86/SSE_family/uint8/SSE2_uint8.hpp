@@ -0,0 +1,217 @@
+#pragma once
+
+#include "_SSE_family_uint8_type.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE2, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE2, uint8, SSE_family::Batch<uint8>, SSE_family::Mask<uint8>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE2(batch_t, load, (const uint8* mem))
+    {
+        return { _mm_load_si128(reinterpret_cast<const __m128i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, loadu, (const uint8* mem))
+    {
+        return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(mem)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(void, store, (uint8* mem, batch_t v))
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    TSIMD_OP_SIG_SSE2(void, storeu, (uint8* mem, batch_t v))
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    // 非时间性存储 (绕过缓存，不读取目标缓存行)，mem 必须按 BatchAlignment 对齐
+    TSIMD_OP_SIG_SSE2(void, stream, (uint8* mem, batch_t v))
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(mem), v.v);
+    }
+
+    TSIMD_DETAIL_SIMD_OP_PREFETCH(SSE2)
+
+    // 让之前的 stream 对其他线程可见 (sfence)，在一批 stream 之后、通知其他线程之前调用
+    TSIMD_OP_SIG_SSE2(void, fence, ())
+    {
+        _mm_sfence();
+    }
+
+    // 整数没有按元素个数读取的指令，经过栈上的缓冲区中转，不会访问 mem[count] 之后的内存
+    TSIMD_OP_SIG_SSE2(batch_t, load_partial, (const uint8* mem, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            return loadu(mem);
+        }
+
+        alignas(BatchAlignment) uint8 buffer[Lanes] = {};
+        std::memcpy(buffer, mem, count * sizeof(uint8));
+        return load(buffer);
+    }
+
+    TSIMD_OP_SIG_SSE2(void, store_partial, (uint8* mem, batch_t v, size_t count))
+    {
+        if (count >= Lanes)
+        {
+            storeu(mem, v);
+            return;
+        }
+
+        alignas(BatchAlignment) uint8 buffer[Lanes];
+        store(buffer, v);
+        std::memcpy(mem, buffer, count * sizeof(uint8));
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, zero, ())
+    {
+        return { _mm_setzero_si128() };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, set, (uint8 x))
+    {
+        return { _mm_set1_epi8(static_cast<char>(x)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, add, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_add_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, sub, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_sub_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_and, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_and_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_or, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_or_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_xor, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_xor_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, bit_not, (batch_t v))
+    {
+        // cmpeq(v, v) 为全1
+        return { _mm_xor_si128(v.v, _mm_cmpeq_epi32(v.v, v.v)) };
+    }
+
+    // 没有8位移位指令，按16位移位之后清除从相邻字节移入的位
+    TSIMD_OP_SIG_SSE2(batch_t, shift_left, (batch_t v, int count))
+    {
+        const __m128i mask = _mm_set1_epi8(static_cast<char>(0xFFu << count));
+        return { _mm_and_si128(_mm_sll_epi16(v.v, _mm_cvtsi32_si128(count)), mask) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, shift_right, (batch_t v, int count))
+    {
+        const __m128i mask = _mm_set1_epi8(static_cast<char>(0xFFu >> count));
+        return { _mm_and_si128(_mm_srl_epi16(v.v, _mm_cvtsi32_si128(count)), mask) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, min, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_min_epu8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, max, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_max_epu8(lhs.v, rhs.v) };
+    }
+
+    // 饱和加减
+    TSIMD_OP_SIG_SSE2(batch_t, add_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_adds_epu8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, sub_sat, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_subs_epu8(lhs.v, rhs.v) };
+    }
+
+    // 没有无符号比较指令，lhs >= rhs 等价于 max(lhs, rhs) == lhs
+    // 比较的结果为 mask_t，配合 select 实现无分支的条件运算
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_eq, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi8(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ne, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_eq(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_lt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_ge(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_le, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi8(_mm_min_epu8(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_gt, (batch_t lhs, batch_t rhs))
+    {
+        return mask_not(cmp_le(lhs, rhs));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, cmp_ge, (batch_t lhs, batch_t rhs))
+    {
+        return { _mm_cmpeq_epi8(_mm_max_epu8(lhs.v, rhs.v), lhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_or_si128(_mm_and_si128(mask.v, a.v), _mm_andnot_si128(mask.v, b.v)) };
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, any, (mask_t mask))
+    {
+        return _mm_movemask_epi8(mask.v) != 0;
+    }
+
+    TSIMD_OP_SIG_SSE2(bool, all, (mask_t mask))
+    {
+        return _mm_movemask_epi8(mask.v) == 0xFFFF;
+    }
+
+    // 第i位对应第i个lane
+    TSIMD_OP_SIG_SSE2(uint32, movemask, (mask_t mask))
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(mask.v));
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_and, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_and_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_or, (mask_t lhs, mask_t rhs))
+    {
+        return { _mm_or_si128(lhs.v, rhs.v) };
+    }
+
+    TSIMD_OP_SIG_SSE2(mask_t, mask_not, (mask_t mask))
+    {
+        return { _mm_xor_si128(mask.v, _mm_set1_epi32(-1)) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE2, uint8>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "SSE2_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE3 没有新增整数指令
+template<>
+struct SimdOp<SimdInstruction::SSE3, uint8> : SimdOp<SimdInstruction::SSE2, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE3, uint8, SSE_family::Batch<uint8>, SSE_family::Mask<uint8>, Alignment::SSE_Family)
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE3, uint8>);
+
+TSIMD_NAMESPACE_END
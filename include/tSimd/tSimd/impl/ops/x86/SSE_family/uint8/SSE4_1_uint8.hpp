@@ -0,0 +1,19 @@
+#pragma once
+
+#include "SSE3_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+template<>
+struct SimdOp<SimdInstruction::SSE4_1, uint8> : SimdOp<SimdInstruction::SSE3, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE4_1, uint8, SSE_family::Batch<uint8>, SSE_family::Mask<uint8>, Alignment::SSE_Family)
+
+    TSIMD_OP_SIG_SSE4_1(batch_t, select, (mask_t mask, batch_t a, batch_t b))
+    {
+        return { _mm_blendv_epi8(b.v, a.v, mask.v) };
+    }
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE4_1, uint8>);
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../../Scalar/Scalar_uint8.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// SSE 没有整数指令 (从SSE2开始才有 __m128i)，直接使用标量实现
+template<>
+struct SimdOp<SimdInstruction::SSE, uint8> : SimdOp<SimdInstruction::Scalar, uint8>
+{
+    TSIMD_DETAIL_SIMD_OP_TRAITS_AND_CONSTANTS(SSE, uint8, Scalar::Batch<uint8>, Scalar::Mask<uint8>, alignof(uint8))
+};
+TSIMD_DETAIL_CHECK_SIMD_OP(SimdOp<SimdInstruction::SSE, uint8>);
+
+TSIMD_NAMESPACE_END
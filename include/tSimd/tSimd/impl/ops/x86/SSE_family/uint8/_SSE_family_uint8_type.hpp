@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstring> // std::memcpy
+
+#include <xmmintrin.h> // SSE
+#include <emmintrin.h> // SSE2
+#include <pmmintrin.h> // SSE3
+#include <smmintrin.h> // SSE4.1
+
+#include "../_SSE_family_types.hpp"
+#include "../../../dispatch.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace SSE_family
+{
+    template<>
+    struct Batch<uint8>
+    {
+        __m128i v;
+    };
+
+    template<>
+    struct Mask<uint8>
+    {
+        // 每个lane为全1或全0
+        __m128i v;
+    };
+}
+
+TSIMD_NAMESPACE_END
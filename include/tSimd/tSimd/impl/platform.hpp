@@ -2,6 +2,7 @@
 
 #include "../common_macros.hpp"
 
+#include <cstdint>
 #include <limits>
 
 // compiler
@@ -27,7 +28,7 @@
 
 // SIMD support
 // AVX512 -> AVX2 -> FMA3(独立的指令开关) -> AVX -> SSE4.1(不一定有SSE4.2) -> SSE3 -> SSE2
-//                -> F16C(独立的指令开关) -> AVX
+//                -> F16C(独立的指令开关，AVX2 要求同时支持) -> AVX
 // SSE4.2 -> SSE4.1
 // x86 64 -> SSE2
 
@@ -122,6 +123,15 @@ namespace Alignment
 using float32 = float;
 using float64 = double;
 
+using int8 = std::int8_t;
+using int16 = std::int16_t;
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint8 = std::uint8_t;
+using uint16 = std::uint16_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
 static_assert(sizeof(float32) == 4 && std::numeric_limits<float32>::is_iec559);
 static_assert(sizeof(float64) == 8 && std::numeric_limits<float64>::is_iec559);
 
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "impl/platform.hpp"
+#include "aligned_allocate.hpp"
+#include "stream.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    /**
+     * SoA 矩阵的批量函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/matrix.cpp)
+     * 矩阵传入 dims * dims 个元素数组的指针，按行主序排列: m[r * dims + c] 为第r行第c列，dims 只支持 3 / 4
+     * 每条指令处理 Lanes 个矩阵，不需要在寄存器内做 shuffle
+     * 结果与 matrix.hpp 中对应的 AoS 函数完全相同: mul / transform 按右折叠的顺序使用 mul_add (与 mat4_mul 相同)，
+     * inverse / determinant 不使用 mul_add，与 tMath 的标量版本一致
+     * (前提见 CMakeLists.txt 中 FP contraction 的说明)
+     * 允许原地计算 (out == a 或 out == b)，但输入输出不能部分重叠
+     */
+    void mat_stream_mul(const float32* const* a, const float32* const* b, float32* const* out, size_t dims, size_t count) noexcept;
+    void mat_stream_transpose(const float32* const* m, float32* const* out, size_t dims, size_t count) noexcept;
+    void mat_stream_determinant(const float32* const* m, float32* out, size_t dims, size_t count) noexcept;
+    void mat_stream_inverse(const float32* const* m, float32* const* out, size_t dims, size_t count) noexcept;
+
+    // out[i] = m[i] * (v[i], 1) 的前三个分量，m 为 4x4 的仿射矩阵 (忽略最后一行)
+    void mat_stream_transform_points(const float32* const* m, const float32* const* v, float32* const* out, size_t count) noexcept;
+    // out[i] = m[i] * v[i]，4x4 时只使用左上角 3x3 (w = 0)
+    void mat_stream_transform_vectors(const float32* const* m, const float32* const* v, float32* const* out, size_t dims, size_t count) noexcept;
+
+    // AoS: count 个连续存放的矩阵，每个 dims * dims 个元素 <-> SoA
+    void mat_stream_import(const float32* aos, float32* const* soa, size_t dims, bool column_major, size_t count) noexcept;
+    void mat_stream_export(const float32* const* soa, float32* aos, size_t dims, bool column_major, size_t count) noexcept;
+}
+
+/**
+ * SoA 的矩阵数组，N x N 个元素各自存放在一段连续、对齐的内存中
+ * m00: [m00_0, m00_1, m00_2, ...]
+ * m01: [m01_0, m01_1, m01_2, ...]
+ * ...
+ *
+ * 与 matrix.hpp 的 AoS 批量函数相比，这里的每条指令处理 Lanes 个矩阵 (AVX-512 一次16个)，适合大量独立的小矩阵
+ * (例如每根骨骼 / 每个实例的变换)，单个矩阵的读写 (get / set / push_back) 只是为了方便
+ *
+ * 元素按 (行, 列) 访问，与存储顺序无关，行主序 / 列主序只在导入导出时区分
+ * 目前只实现了 float32
+ */
+template<typename T, size_t N>
+class MatStream
+{
+    static_assert(std::is_same_v<T, float32>, "MatStream only supports float32 for now");
+    static_assert(N == 3 || N == 4, "MatStream only supports 3x3 or 4x4 matrices");
+
+public:
+    using value_type = T;
+    // 行主序的 N * N 个元素
+    using matrix_type = std::array<T, N * N>;
+    using element_type = std::vector<T, AlignedAllocator<T>>;
+
+    static constexpr size_t Rows = N;
+    static constexpr size_t Elements = N * N;
+
+    MatStream() = default;
+
+    // 新的矩阵为0矩阵
+    explicit MatStream(const size_t count)
+    {
+        resize(count);
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return elements_[0].size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return elements_[0].empty();
+    }
+
+    void resize(const size_t count)
+    {
+        for (auto& e : elements_)
+        {
+            e.resize(count);
+        }
+    }
+
+    void reserve(const size_t count)
+    {
+        for (auto& e : elements_)
+        {
+            e.reserve(count);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for (auto& e : elements_)
+        {
+            e.clear();
+        }
+    }
+
+    // ------------------------------- 元素数组 -------------------------------
+    [[nodiscard]] T* element(const size_t row, const size_t col) noexcept
+    {
+        assert(row < N && col < N);
+        return elements_[row * N + col].data();
+    }
+
+    [[nodiscard]] const T* element(const size_t row, const size_t col) const noexcept
+    {
+        assert(row < N && col < N);
+        return elements_[row * N + col].data();
+    }
+
+    // 传给 detail::mat_stream_* 的元素指针数组 (行主序)
+    [[nodiscard]] std::array<const T*, Elements> elements() const noexcept
+    {
+        std::array<const T*, Elements> result;
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            result[i] = elements_[i].data();
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::array<T*, Elements> elements() noexcept
+    {
+        std::array<T*, Elements> result;
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            result[i] = elements_[i].data();
+        }
+        return result;
+    }
+
+    // ------------------------------- 单个矩阵 -------------------------------
+    [[nodiscard]] matrix_type get(const size_t index) const noexcept
+    {
+        assert(index < size());
+
+        matrix_type m;
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            m[i] = elements_[i][index];
+        }
+        return m;
+    }
+
+    void set(const size_t index, const matrix_type& m) noexcept
+    {
+        assert(index < size());
+
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            elements_[i][index] = m[i];
+        }
+    }
+
+    void push_back(const matrix_type& m)
+    {
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            elements_[i].push_back(m[i]);
+        }
+    }
+
+    // ------------------------------- AoS <-> SoA -------------------------------
+    /**
+     * 从 AoS 数组导入，导入后 size() == count
+     * @param aos count 个连续存放的矩阵，每个矩阵 N * N 个元素，不要求对齐
+     */
+    void import_row_major(const T* aos, const size_t count)
+    {
+        resize(count);
+        detail::mat_stream_import(aos, elements().data(), N, false, count);
+    }
+
+    void import_column_major(const T* aos, const size_t count)
+    {
+        resize(count);
+        detail::mat_stream_import(aos, elements().data(), N, true, count);
+    }
+
+    /**
+     * 导出为 AoS 数组
+     * @param aos 至少 size() * N * N 个元素
+     */
+    void export_row_major(T* aos) const noexcept
+    {
+        detail::mat_stream_export(elements().data(), aos, N, false, size());
+    }
+
+    void export_column_major(T* aos) const noexcept
+    {
+        detail::mat_stream_export(elements().data(), aos, N, true, size());
+    }
+
+    // 任意内存布局为 N * N 个连续元素的矩阵类型，例如 tMath 的 Matrix4x4f
+    template<typename Mat>
+    void import_row_major(std::span<const Mat> matrices)
+    {
+        static_assert(sizeof(Mat) == Elements * sizeof(T) && std::is_standard_layout_v<Mat>, "Mat must be N * N tightly packed elements");
+        import_row_major(reinterpret_cast<const T*>(matrices.data()), matrices.size());
+    }
+
+    template<typename Mat>
+    void import_column_major(std::span<const Mat> matrices)
+    {
+        static_assert(sizeof(Mat) == Elements * sizeof(T) && std::is_standard_layout_v<Mat>, "Mat must be N * N tightly packed elements");
+        import_column_major(reinterpret_cast<const T*>(matrices.data()), matrices.size());
+    }
+
+    template<typename Mat>
+    void export_row_major(std::span<Mat> matrices) const noexcept
+    {
+        static_assert(sizeof(Mat) == Elements * sizeof(T) && std::is_standard_layout_v<Mat>, "Mat must be N * N tightly packed elements");
+        assert(matrices.size() >= size());
+        export_row_major(reinterpret_cast<T*>(matrices.data()));
+    }
+
+    template<typename Mat>
+    void export_column_major(std::span<Mat> matrices) const noexcept
+    {
+        static_assert(sizeof(Mat) == Elements * sizeof(T) && std::is_standard_layout_v<Mat>, "Mat must be N * N tightly packed elements");
+        assert(matrices.size() >= size());
+        export_column_major(reinterpret_cast<T*>(matrices.data()));
+    }
+
+private:
+    std::array<element_type, Elements> elements_;
+};
+
+template<typename T>
+using Mat3Stream = MatStream<T, 3>;
+
+template<typename T>
+using Mat4Stream = MatStream<T, 4>;
+
+// ------------------------------- 批量函数 -------------------------------
+// out 会被 resize 为输入的大小，out 可以是输入本身
+// 返回标量的函数 (determinant) 写入 out[0, m.size())
+
+// out[i] = a[i] * b[i]
+template<size_t N>
+void mul(const MatStream<float32, N>& a, const MatStream<float32, N>& b, MatStream<float32, N>& out)
+{
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    detail::mat_stream_mul(a.elements().data(), b.elements().data(), out.elements().data(), N, a.size());
+}
+
+template<size_t N>
+void transpose(const MatStream<float32, N>& m, MatStream<float32, N>& out)
+{
+    out.resize(m.size());
+    detail::mat_stream_transpose(m.elements().data(), out.elements().data(), N, m.size());
+}
+
+template<size_t N>
+void determinant(const MatStream<float32, N>& m, float32* out) noexcept
+{
+    detail::mat_stream_determinant(m.elements().data(), out, N, m.size());
+}
+
+// 不检查是否可逆，奇异矩阵的结果为 inf / NaN
+template<size_t N>
+void inverse(const MatStream<float32, N>& m, MatStream<float32, N>& out)
+{
+    out.resize(m.size());
+    detail::mat_stream_inverse(m.elements().data(), out.elements().data(), N, m.size());
+}
+
+// out[i] = m[i] * (p[i], 1)，m 为仿射矩阵，平移在第4列
+inline void transform_points(const Mat4Stream<float32>& m, const Vec3Stream<float32>& p, Vec3Stream<float32>& out)
+{
+    assert(m.size() == p.size());
+    out.resize(p.size());
+    detail::mat_stream_transform_points(m.elements().data(), p.components().data(), out.components().data(), p.size());
+}
+
+// out[i] = m[i] * v[i]，4x4 时只使用左上角 3x3 (方向向量不受平移影响)
+template<size_t N>
+void transform_vectors(const MatStream<float32, N>& m, const Vec3Stream<float32>& v, Vec3Stream<float32>& out)
+{
+    assert(m.size() == v.size());
+    out.resize(v.size());
+    detail::mat_stream_transform_vectors(m.elements().data(), v.components().data(), out.components().data(), N, v.size());
+}
+
+template<size_t N>
+MatStream<float32, N> operator*(const MatStream<float32, N>& a, const MatStream<float32, N>& b)
+{
+    MatStream<float32, N> out;
+    mul(a, b, out);
+    return out;
+}
+
+TSIMD_NAMESPACE_END
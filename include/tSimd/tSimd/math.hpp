@@ -0,0 +1,56 @@
+#pragma once
+
+#include "impl/platform.hpp"
+#include "impl/float16.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * float32 数组的向量数学函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/math.cpp)
+ * 每个元素的计算与 batch_math.inl 中的同名函数一致，误差也相同
+ *
+ * 1. 输入输出不要求对齐，count 可以是任意值 (末尾不足一个batch的部分使用 load_partial / store_partial)
+ * 2. 允许原地计算 (in == out)，但输入输出不能部分重叠
+ */
+namespace math
+{
+    void sin(const float32* in, float32* out, size_t count) noexcept;
+    void cos(const float32* in, float32* out, size_t count) noexcept;
+    void sincos(const float32* in, float32* out_sin, float32* out_cos, size_t count) noexcept;
+    void tan(const float32* in, float32* out, size_t count) noexcept;
+
+    void exp(const float32* in, float32* out, size_t count) noexcept;
+    void exp2(const float32* in, float32* out, size_t count) noexcept;
+    void log(const float32* in, float32* out, size_t count) noexcept;
+    void log2(const float32* in, float32* out, size_t count) noexcept;
+    // out[i] = x[i] ^ y[i]
+    void pow(const float32* x, const float32* y, float32* out, size_t count) noexcept;
+
+    void atan(const float32* in, float32* out, size_t count) noexcept;
+    // out[i] = atan2(y[i], x[i])
+    void atan2(const float32* y, const float32* x, float32* out, size_t count) noexcept;
+
+    void sqrt(const float32* in, float32* out, size_t count) noexcept;
+    void rsqrt(const float32* in, float32* out, size_t count) noexcept;
+
+    // float16 数组: 每个batch读取 float16 转换成 float32 计算，再转换回 float16 存储，不需要 float32 的临时数组
+    // 结果等于 float32 版本的结果舍入到 float16 (round to nearest even)
+    void sin(const float16* in, float16* out, size_t count) noexcept;
+    void cos(const float16* in, float16* out, size_t count) noexcept;
+    void sincos(const float16* in, float16* out_sin, float16* out_cos, size_t count) noexcept;
+    void tan(const float16* in, float16* out, size_t count) noexcept;
+
+    void exp(const float16* in, float16* out, size_t count) noexcept;
+    void exp2(const float16* in, float16* out, size_t count) noexcept;
+    void log(const float16* in, float16* out, size_t count) noexcept;
+    void log2(const float16* in, float16* out, size_t count) noexcept;
+    void pow(const float16* x, const float16* y, float16* out, size_t count) noexcept;
+
+    void atan(const float16* in, float16* out, size_t count) noexcept;
+    void atan2(const float16* y, const float16* x, float16* out, size_t count) noexcept;
+
+    void sqrt(const float16* in, float16* out, size_t count) noexcept;
+    void rsqrt(const float16* in, float16* out, size_t count) noexcept;
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "impl/platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * 4x4 float32 矩阵乘法，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/matrix.cpp)
+ * 行主序: m[row * 4 + col]，列主序: m[col * 4 + row]，矩阵之间紧密排列 (16个float)，不要求对齐
+ *
+ * 批量版本逐个相乘: out[i] = lhs[i] * rhs[i]，count 为矩阵 (向量) 的个数
+ * 每个寄存器放 Lanes / 4 个矩阵的同一行 (列)，AVX 一次处理2个矩阵，AVX-512 一次处理4个
+ *
+ * 求和的顺序与 tMath 的标量版本一致 (x0*y0 + (x1*y1 + (x2*y2 + x3*y3)))
+ * 不支持 FMA 的指令集结果与标量版本完全相同，支持 FMA 时只有舍入误差的区别
+ *
+ * 允许原地计算 (out == lhs 或 out == rhs)，但输入输出不能部分重叠
+ *
+ * 大量矩阵一起计算时，每个元素单独存放的 SoA 版本 (mat_stream.hpp 的 MatStream) 不需要转置，通常更快
+ */
+
+// out[i] = lhs[i] * rhs[i] (矩阵 * 矩阵)
+void mat4_mul_row_major(const float32* lhs, const float32* rhs, float32* out, size_t count = 1) noexcept;
+void mat4_mul_column_major(const float32* lhs, const float32* rhs, float32* out, size_t count = 1) noexcept;
+
+// out[i] = m[i] * v[i] (矩阵 * 列向量)，向量之间紧密排列 (4个float)
+void mat4_mul_vec4_row_major(const float32* m, const float32* v, float32* out, size_t count = 1) noexcept;
+void mat4_mul_vec4_column_major(const float32* m, const float32* v, float32* out, size_t count = 1) noexcept;
+
+/**
+ * 行列式和逆矩阵，计算顺序与 tMath 的标量版本相同，并且不使用 FMA，所有指令集的结果都与标量版本一致
+ * 一次处理 Lanes 个矩阵，每个寄存器放 Lanes 个矩阵的同一个元素，count 太小时大部分 lane 是空的，比标量版本慢
+ * 逆矩阵的转置等于转置的逆矩阵，所以除了 inverse_affine 之外行主序和列主序使用同一个函数
+ * 不检查是否可逆，奇异矩阵的结果为 inf / NaN
+ */
+
+// out[i] = det(m[i])
+void mat4_determinant(const float32* m, float32* out, size_t count = 1) noexcept;
+
+// out[i] = inverse(m[i])
+void mat4_inverse(const float32* m, float32* out, size_t count = 1) noexcept;
+
+// 只包含旋转和平移的仿射矩阵: [R t; 0 1] -> [R^T  -R^T * t; 0 1]
+void mat4_inverse_affine_row_major(const float32* m, float32* out, size_t count = 1) noexcept;
+void mat4_inverse_affine_column_major(const float32* m, float32* out, size_t count = 1) noexcept;
+
+// 左上角 3x3 矩阵的逆矩阵的转置 (法线矩阵)，其余部分为单位矩阵
+void mat4_inverse_transpose_3x3(const float32* m, float32* out, size_t count = 1) noexcept;
+
+TSIMD_NAMESPACE_END
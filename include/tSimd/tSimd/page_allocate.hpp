@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+#include "impl/platform.hpp"
+#include "aligned_allocate.hpp"
+#include "parallel.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// x86 64 的大页 (PMD) 大小
+inline constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+/**
+ * 直接从操作系统按页分配的策略，用于很大 (几百 MB 以上) 的数组 (实现见 src/tSimd/impl/page_allocate.cpp)
+ * 只有 Linux 支持这些选项，其他平台退化为按 HugePageSize 对齐的 aligned_allocate
+ *
+ * huge_page:
+ *   None:        mmap，按 4KB 页对齐
+ *   Transparent: mmap 一段按 2MB 对齐的区域，并用 madvise(MADV_HUGEPAGE) 提示内核使用透明大页 (THP)
+ *   Explicit:    mmap(MAP_HUGETLB) 使用预留的大页 (/proc/sys/vm/nr_hugepages)，没有足够的大页时退化为 Transparent
+ *
+ * numa_node >= 0 时用 mbind 把内存绑定到这个节点，只是尽力而为: 失败时 (例如节点不存在、内核不支持 NUMA) 不会报告，
+ * 内存仍然可以使用，只是物理页按默认策略分配；非 Linux 平台忽略 numa_node
+ *
+ * first_touch 为 true 时，分配后由 default_thread_pool() 的线程按 parallel_for 的分块写入 0
+ * 物理页分配在第一次写入它的线程所在的节点，所以物理页会分散到各个工作线程所在的节点上，而不是全部在当前线程的节点
+ * 但 ThreadPool 是 work stealing 的，分块与线程没有固定的对应关系，之后的 parallel_for 不保证访问的都是本地内存
+ * 线程池创建失败时退化为在当前线程写入 0
+ * 没有 first_touch 时，物理页在第一次访问时才分配 (内容同样为 0)
+ */
+struct PageAllocPolicy
+{
+    enum class HugePage : uint8_t
+    {
+        None,
+        Transparent,
+        Explicit,
+    };
+
+    HugePage huge_page = HugePage::Transparent;
+    int numa_node = -1;
+    bool first_touch = false;
+
+    [[nodiscard]] void* allocate(size_t bytes) const noexcept;
+    void deallocate(void* mem, size_t bytes) const noexcept;
+
+    constexpr bool operator==(const PageAllocPolicy&) const noexcept = default;
+};
+
+// 例如 std::vector<float, PageAllocator<float>> v(PageAllocator<float>({ .huge_page = PageAllocPolicy::HugePage::Explicit }));
+// 注意 vector(n, value) / resize 会在当前线程写入所有元素，first_touch 的效果会被覆盖
+template<typename T>
+using PageAllocator = AlignedAllocator<T, PageAllocPolicy>;
+
+/**
+ * 用 pool 的线程按 parallel_for<std::byte> 的分块 (grain 为 HugePageSize) 把 [mem, mem + bytes) 写 0
+ * 使每个大页的物理内存分配在写入它的线程所在的 NUMA 节点 (哪个线程写入哪个分块是不确定的)
+ */
+void first_touch(void* mem, size_t bytes, ThreadPool& pool) noexcept;
+
+// 使用 default_thread_pool()，创建线程池时抛出异常则在当前线程写入 0
+void first_touch(void* mem, size_t bytes) noexcept;
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "impl/platform.hpp"
+#include "impl/ops/dispatch.hpp"
+#include "aligned_allocate.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * parallel_for 的分块边界 (元素个数)
+ * 取缓存行和 SIMD 对齐 (AVX-512 为 64 字节) 中较大的一个，因此一定是 Lanes 的整数倍
+ * 数据的首地址对齐时 (AlignedAllocator / VecStream)，每个分块的起点都是对齐的，并且相邻分块不会写同一条缓存行
+ */
+template<typename T>
+size_t parallel_chunk_alignment() noexcept
+{
+    static_assert(CacheLineSize % sizeof(T) == 0);
+    return std::max(CacheLineSize, InstructionSelector::required_alignment()) / sizeof(T);
+}
+
+namespace detail
+{
+    struct ThreadPoolState;
+}
+
+/**
+ * 工作窃取 (work-stealing) 线程池 (实现见 src/tSimd/impl/parallel.cpp)
+ *
+ * 1. [begin, end) 按对齐的边界切分为若干个分块，平均分配到每个线程的队列中
+ * 2. 每个线程从自己队列的前端取分块，队列为空时从其他线程的队列窃取后一半
+ * 3. 调用 parallel_for 的线程也作为一个工作线程，所有分块完成后才返回
+ *
+ * 一个线程池同一时间只执行一个 parallel_for，其他线程的调用会等待
+ * 在 fn 中再次调用 parallel_for (嵌套) 时，直接在当前线程串行执行
+ */
+class ThreadPool final
+{
+public:
+    using RangeFunc = void (*)(void* context, size_t begin, size_t end) noexcept;
+
+    // thread_count 包含调用 parallel_for 的线程，0 为 std::thread::hardware_concurrency()
+    // 创建线程失败时抛出 std::system_error，已经启动的线程会先被停止并 join
+    explicit ThreadPool(size_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t thread_count() const noexcept;
+
+    /**
+     * 对每个分块调用 fn(chunk_begin, chunk_end)
+     * 除第一个分块的起点 (begin) 和最后一个分块的终点 (end) 外，分块边界都是 parallel_chunk_alignment<T>() 的整数倍
+     * 分块的大小为 grain 向上取整到对齐边界，只有一个分块时直接在当前线程执行
+     * fn 会被多个线程同时调用，不能抛出异常 (否则 std::terminate)
+     */
+    template<typename T = float32, typename Func>
+    void parallel_for(const size_t begin, const size_t end, const size_t grain, Func&& fn)
+    {
+        using F = std::remove_reference_t<Func>;
+        run(begin, end, grain, parallel_chunk_alignment<T>(),
+            [](void* context, const size_t chunk_begin, const size_t chunk_end) noexcept
+            {
+                (*static_cast<F*>(context))(chunk_begin, chunk_end);
+            },
+            const_cast<void*>(static_cast<const void*>(std::addressof(fn))));
+    }
+
+    // 类型擦除的版本，boundary 为分块边界的元素个数
+    void run(size_t begin, size_t end, size_t grain, size_t boundary, RangeFunc func, void* context) noexcept;
+
+private:
+    std::unique_ptr<detail::ThreadPoolState> state_;
+};
+
+// 全局线程池，第一次调用时创建，线程数为 std::thread::hardware_concurrency()
+ThreadPool& default_thread_pool();
+
+// 使用 default_thread_pool() 的 parallel_for
+template<typename T = float32, typename Func>
+void parallel_for(const size_t begin, const size_t end, const size_t grain, Func&& fn)
+{
+    default_thread_pool().parallel_for<T>(begin, end, grain, std::forward<Func>(fn));
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cassert>
+
+#include "impl/platform.hpp"
+#include "stream.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * slerp 的精度
+ * Exact: sin / atan2 的向量版本 (见 batch_math.inl)，与 std:: 的标量 slerp 只有几个 ulp 的区别
+ * Fast: 对 t 做多项式修正后的 nlerp，没有三角函数，每个分量的误差约 2e-4，适合动画混合
+ */
+enum class QuatAccuracy
+{
+    Exact,
+    Fast,
+};
+
+namespace detail
+{
+    /**
+     * SoA 四元数的批量函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/quat.cpp)
+     * 四元数的分量指针数组顺序为 (x, y, z, w)，向量为 (x, y, z)
+     * mul / rotate / nlerp 的计算顺序与 tMath 的标量版本相同，并且不使用 FMA
+     * (前提见 CMakeLists.txt 中 FP contraction 的说明)
+     * 允许原地计算 (out == a 或 out == b)，但输入输出不能部分重叠
+     */
+    void quat_mul(const float32* const* a, const float32* const* b, float32* const* out, size_t count) noexcept;
+    void quat_rotate(const float32* const* q, const float32* const* v, float32* const* out, size_t count) noexcept;
+    void quat_nlerp(const float32* const* a, const float32* const* b, float32 t, float32* const* out, size_t count) noexcept;
+    void quat_slerp(const float32* const* a, const float32* const* b, float32 t, float32* const* out, size_t count, QuatAccuracy accuracy) noexcept;
+}
+
+/**
+ * SoA 的四元数数组，分量顺序为 (x, y, z, w)，w 为实部
+ * 每条指令处理 Lanes 个四元数，AVX-512 一次16个
+ */
+template<typename T>
+using QuatStream = VecStream<T, 4>;
+
+// out[i] = a[i] * b[i] (Hamilton 乘积)
+inline void quat_mul(const QuatStream<float32>& a, const QuatStream<float32>& b, QuatStream<float32>& out)
+{
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    detail::quat_mul(a.components().data(), b.components().data(), out.components().data(), a.size());
+}
+
+// out[i] = q[i] * v[i] * q[i]^-1，q 为单位四元数
+inline void quat_rotate(const QuatStream<float32>& q, const Vec3Stream<float32>& v, Vec3Stream<float32>& out)
+{
+    assert(q.size() == v.size());
+    out.resize(v.size());
+    detail::quat_rotate(q.components().data(), v.components().data(), out.components().data(), v.size());
+}
+
+// 线性插值后归一化，沿最短路径 (dot < 0 时取 -b)
+inline void quat_nlerp(const QuatStream<float32>& a, const QuatStream<float32>& b, const float32 t, QuatStream<float32>& out)
+{
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    detail::quat_nlerp(a.components().data(), b.components().data(), t, out.components().data(), a.size());
+}
+
+// 球面线性插值，沿最短路径，|dot| > 0.9995 时退化为 nlerp (与 tMath 的 slerp 相同)
+inline void quat_slerp(const QuatStream<float32>& a, const QuatStream<float32>& b, const float32 t, QuatStream<float32>& out,
+                       const QuatAccuracy accuracy = QuatAccuracy::Exact)
+{
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    detail::quat_slerp(a.components().data(), b.components().data(), t, out.components().data(), a.size(), accuracy);
+}
+
+TSIMD_NAMESPACE_END
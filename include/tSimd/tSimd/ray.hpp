@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "impl/platform.hpp"
+#include "aligned_allocate.hpp"
+#include "stream.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+// 没有交点时 RayHits::prim 的值
+inline constexpr uint32 ray_miss = 0xFFFFFFFFu;
+
+namespace detail
+{
+    /**
+     * 光线包 (packet) 的求交函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/ray.cpp)
+     * 每次取 Lanes 条光线 (SSE 4 条，AVX 8 条，AVX-512 16 条)，依次与所有图元求交，光线的数据一直在寄存器中
+     * origin / direction 为 (x, y, z) 三个分量的指针数组 (SoA)
+     * t / u / v / prim 既是输入也是输出: 只有找到比 t 更近的交点时才更新，prim 为图元的下标
+     * 计算顺序与 tMath (ray.hpp) 的 intersect_triangle / intersect_aabb 相同，并且不使用 FMA
+     * (前提见 CMakeLists.txt 中 FP contraction 的说明)
+     */
+    // triangles: triangle_count 个三角形，每个为 (v0, v1, v2) 9 个元素
+    void intersect_triangles(const float32* const* origin, const float32* const* direction, float32 t_min,
+                             const float32* triangles, size_t triangle_count,
+                             float32* t, float32* u, float32* v, uint32* prim, size_t count) noexcept;
+    // boxes: box_count 个 AABB，每个为 (min, max) 6 个元素，不修改 u / v
+    void intersect_aabbs(const float32* const* origin, const float32* const* direction, float32 t_min,
+                         const float32* boxes, size_t box_count,
+                         float32* t, uint32* prim, size_t count) noexcept;
+}
+
+/**
+ * 每条光线最近的交点，SoA
+ * t 为交点在光线上的参数，(u, v) 为三角形的重心坐标 (与 AABB 求交时不使用)，prim 为图元的下标，没有交点时为 ray_miss
+ */
+struct RayHits
+{
+    using float_array = std::vector<float32, AlignedAllocator<float32>>;
+    using index_array = std::vector<uint32, AlignedAllocator<uint32>>;
+
+    float_array t;
+    float_array u;
+    float_array v;
+    index_array prim;
+
+    RayHits() = default;
+
+    explicit RayHits(const size_t count, const float32 t_max = std::numeric_limits<float32>::infinity())
+    {
+        reset(count, t_max);
+    }
+
+    // 所有光线设为没有交点，t_max 为光线的最远距离
+    void reset(const size_t count, const float32 t_max = std::numeric_limits<float32>::infinity())
+    {
+        t.assign(count, t_max);
+        u.assign(count, 0.0f);
+        v.assign(count, 0.0f);
+        prim.assign(count, ray_miss);
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return t.size();
+    }
+
+    [[nodiscard]] bool hit(const size_t i) const noexcept
+    {
+        return prim[i] != ray_miss;
+    }
+};
+
+/**
+ * 任意内存布局为 9 个连续 float32 的三角形类型 (v0, v1, v2)，例如 float32[9]、std::array<Vec3f, 3>
+ */
+template<typename T>
+concept triangle_layout = std::is_standard_layout_v<T> && sizeof(T) == 9 * sizeof(float32);
+
+/**
+ * 任意内存布局为 6 个连续 float32 的 AABB 类型 (min, max)，例如 tMath 的 AABB<Vec3f>
+ */
+template<typename T>
+concept aabb_layout = std::is_standard_layout_v<T> && sizeof(T) == 6 * sizeof(float32);
+
+/**
+ * Möller–Trumbore 光线与三角形求交 (双面)，每条光线找 t_min < t < hits.t 中最近的交点
+ * 多次调用 (例如分批传入三角形) 会保留之前找到的交点，prim 为本次调用中 triangles 的下标
+ * @param hits 大小需要与光线条数相同，一般先调用 hits.reset(count)
+ */
+template<triangle_layout Triangle>
+void intersect_triangles(const Vec3Stream<float32>& origins, const Vec3Stream<float32>& directions,
+                         std::span<const Triangle> triangles, RayHits& hits, const float32 t_min = 0.0f) noexcept
+{
+    assert(origins.size() == directions.size() && hits.size() == origins.size());
+    detail::intersect_triangles(origins.components().data(), directions.components().data(), t_min,
+                                reinterpret_cast<const float32*>(triangles.data()), triangles.size(),
+                                hits.t.data(), hits.u.data(), hits.v.data(), hits.prim.data(), origins.size());
+}
+
+/**
+ * slab 方法的光线与 AABB 求交，t 为进入 AABB 的距离 (起点在 AABB 内时为 t_min)，不修改 hits.u / hits.v
+ * 方向分量为0时 1 / d 为 inf，起点恰好在该轴的边界平面上时结果不确定 (0 * inf)
+ */
+template<aabb_layout Box>
+void intersect_aabbs(const Vec3Stream<float32>& origins, const Vec3Stream<float32>& directions,
+                     std::span<const Box> boxes, RayHits& hits, const float32 t_min = 0.0f) noexcept
+{
+    assert(origins.size() == directions.size() && hits.size() == origins.size());
+    detail::intersect_aabbs(origins.components().data(), directions.components().data(), t_min,
+                            reinterpret_cast<const float32*>(boxes.data()), boxes.size(),
+                            hits.t.data(), hits.prim.data(), origins.size());
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "impl/platform.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+/**
+ * float32 数组的归约，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/reduce.cpp)
+ * 输入不要求对齐，count 可以是任意值 (包括0)
+ *
+ * 每次循环使用多个独立的累加器 (batch)，隐藏 add / mul_add 的延迟，结果与逐个元素顺序累加的舍入不同
+ * 不同指令集的 Lanes 不同，所以同一个数组在不同的CPU上结果可能有很小的差别
+ */
+namespace reduce
+{
+    // 求和的方式
+    enum class Mode : uint8_t
+    {
+        // 8 个累加器，误差随元素个数线性增长 O(n * eps)
+        Fast,
+        // 每个累加器带补偿项 (Kahan summation)，误差 O(eps)，与 count 无关，大约慢 2~4 倍
+        // dot / norm2 只补偿加法的误差，每个乘积本身的舍入误差不补偿
+        Kahan,
+        // 每 1024 个元素用 Fast 求和，再两两相加，误差 O(log(n) * eps)，速度与 Fast 几乎相同
+        Pairwise,
+    };
+
+    float32 sum(const float32* in, size_t count, Mode mode = Mode::Fast) noexcept;
+    // sum(a[i] * b[i])
+    float32 dot(const float32* a, const float32* b, size_t count, Mode mode = Mode::Fast) noexcept;
+    // sqrt(sum(in[i]^2))，|in[i]| 超过 1.8e19 时平方会溢出
+    float32 norm2(const float32* in, size_t count, Mode mode = Mode::Fast) noexcept;
+
+    // 忽略 NaN，count 为0 (或全部是 NaN) 时 min 为 +inf，max 为 -inf
+    float32 min(const float32* in, size_t count) noexcept;
+    float32 max(const float32* in, size_t count) noexcept;
+
+    struct MinMax
+    {
+        float32 min = std::numeric_limits<float32>::infinity();
+        float32 max = -std::numeric_limits<float32>::infinity();
+    };
+
+    // 只读一遍数组
+    MinMax minmax(const float32* in, size_t count) noexcept;
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,428 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "impl/platform.hpp"
+#include "aligned_allocate.hpp"
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    /**
+     * SoA 流的批量函数，运行时根据CPU选择最高的指令集 (实现见 src/tSimd/impl/stream.cpp)
+     * 1. 逐分量的函数每次只处理一个分量数组，由 VecStream 对每个分量各调用一次
+     * 2. 需要同时访问所有分量的函数，传入分量指针数组和分量个数 (只支持 3 / 4)
+     * 允许原地计算 (in == out)，但输入输出不能部分重叠
+     */
+    void stream_add(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_sub(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_mul(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_div(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_mul_scalar(const float32* a, float32 s, float32* out, size_t count) noexcept;
+    void stream_div_scalar(const float32* a, float32 s, float32* out, size_t count) noexcept;
+    void stream_min(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_max(const float32* a, const float32* b, float32* out, size_t count) noexcept;
+    void stream_clamp(const float32* a, float32 lo, float32 hi, float32* out, size_t count) noexcept;
+    void stream_lerp(const float32* a, const float32* b, float32 t, float32* out, size_t count) noexcept;
+
+    void stream_dot(const float32* const* a, const float32* const* b, float32* out, size_t dims, size_t count) noexcept;
+    void stream_magnitude(const float32* const* a, float32* out, size_t dims, size_t count) noexcept;
+    void stream_distance(const float32* const* a, const float32* const* b, float32* out, size_t dims, size_t count) noexcept;
+    void stream_normalized(const float32* const* a, float32* const* out, size_t dims, size_t count) noexcept;
+    void stream_cross(const float32* const* a, const float32* const* b, float32* const* out, size_t count) noexcept;
+
+    // AoS: [x0, y0, z0, x1, y1, z1, ...] <-> SoA: x[], y[], z[]
+    void stream_import_aos(const float32* aos, float32* const* soa, size_t dims, size_t count) noexcept;
+    void stream_export_aos(const float32* const* soa, float32* aos, size_t dims, size_t count) noexcept;
+}
+
+/**
+ * SoA (Structure of Arrays) 的向量数组，每个分量各自存放在一段连续、对齐的内存中
+ * x: [x0, x1, x2, ...]
+ * y: [y0, y1, y2, ...]
+ * z: [z0, z1, z2, ...]
+ *
+ * 下面的批量函数 (add / dot / normalized ...) 每条指令处理 Lanes 个向量，不需要在寄存器内做 shuffle
+ * 单个向量的读写 (get / set / push_back) 只是为了方便，批量数据请使用 import_aos / export_aos
+ *
+ * 目前只实现了 float32
+ */
+template<typename T, size_t N>
+class VecStream
+{
+    static_assert(std::is_same_v<T, float32>, "VecStream only supports float32 for now");
+    static_assert(N == 3 || N == 4, "VecStream only supports 3 or 4 components");
+
+public:
+    using value_type = T;
+    using vector_type = std::array<T, N>;
+    using component_type = std::vector<T, AlignedAllocator<T>>;
+
+    static constexpr size_t Components = N;
+
+    VecStream() = default;
+
+    // 新的向量为0向量
+    explicit VecStream(const size_t count)
+    {
+        resize(count);
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return components_[0].size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return components_[0].empty();
+    }
+
+    void resize(const size_t count)
+    {
+        for (auto& c : components_)
+        {
+            c.resize(count);
+        }
+    }
+
+    void reserve(const size_t count)
+    {
+        for (auto& c : components_)
+        {
+            c.reserve(count);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for (auto& c : components_)
+        {
+            c.clear();
+        }
+    }
+
+    // ------------------------------- 分量数组 -------------------------------
+    [[nodiscard]] T* component(const size_t i) noexcept
+    {
+        assert(i < N);
+        return components_[i].data();
+    }
+
+    [[nodiscard]] const T* component(const size_t i) const noexcept
+    {
+        assert(i < N);
+        return components_[i].data();
+    }
+
+    [[nodiscard]] T* x() noexcept { return component(0); }
+    [[nodiscard]] T* y() noexcept { return component(1); }
+    [[nodiscard]] T* z() noexcept { return component(2); }
+    [[nodiscard]] T* w() noexcept requires (N >= 4) { return component(3); }
+
+    [[nodiscard]] const T* x() const noexcept { return component(0); }
+    [[nodiscard]] const T* y() const noexcept { return component(1); }
+    [[nodiscard]] const T* z() const noexcept { return component(2); }
+    [[nodiscard]] const T* w() const noexcept requires (N >= 4) { return component(3); }
+
+    // 传给 detail::stream_* 的分量指针数组
+    [[nodiscard]] std::array<const T*, N> components() const noexcept
+    {
+        std::array<const T*, N> result;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result[i] = components_[i].data();
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::array<T*, N> components() noexcept
+    {
+        std::array<T*, N> result;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result[i] = components_[i].data();
+        }
+        return result;
+    }
+
+    // ------------------------------- 单个向量 -------------------------------
+    [[nodiscard]] vector_type get(const size_t index) const noexcept
+    {
+        assert(index < size());
+
+        vector_type v;
+        for (size_t i = 0; i < N; ++i)
+        {
+            v[i] = components_[i][index];
+        }
+        return v;
+    }
+
+    void set(const size_t index, const vector_type& v) noexcept
+    {
+        assert(index < size());
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            components_[i][index] = v[i];
+        }
+    }
+
+    void push_back(const vector_type& v)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            components_[i].push_back(v[i]);
+        }
+    }
+
+    // ------------------------------- AoS <-> SoA -------------------------------
+    /**
+     * 从 AoS 数组导入，导入后 size() == count
+     * @param aos count 个连续存放的向量，每个向量 N 个分量，不要求对齐
+     */
+    void import_aos(const T* aos, const size_t count)
+    {
+        resize(count);
+        detail::stream_import_aos(aos, components().data(), N, count);
+    }
+
+    /**
+     * 导出为 AoS 数组
+     * @param aos 至少 size() * N 个元素
+     */
+    void export_aos(T* aos) const noexcept
+    {
+        detail::stream_export_aos(components().data(), aos, N, size());
+    }
+
+    // 任意内存布局为 N 个连续分量的向量类型，例如 tMath 的 Vector3f / Vector4f
+    template<typename Vec>
+    void import_aos(std::span<const Vec> vectors)
+    {
+        static_assert(sizeof(Vec) == N * sizeof(T) && std::is_standard_layout_v<Vec>, "Vec must be N tightly packed components");
+        import_aos(reinterpret_cast<const T*>(vectors.data()), vectors.size());
+    }
+
+    template<typename Vec>
+    void export_aos(std::span<Vec> vectors) const noexcept
+    {
+        static_assert(sizeof(Vec) == N * sizeof(T) && std::is_standard_layout_v<Vec>, "Vec must be N tightly packed components");
+        assert(vectors.size() >= size());
+        export_aos(reinterpret_cast<T*>(vectors.data()));
+    }
+
+private:
+    std::array<component_type, N> components_;
+};
+
+template<typename T>
+using Vec3Stream = VecStream<T, 3>;
+
+template<typename T>
+using Vec4Stream = VecStream<T, 4>;
+
+
+// ------------------------------- 批量函数 -------------------------------
+// out 会被 resize 为输入的大小，out 可以是输入本身
+// 返回标量的函数 (dot / magnitude / distance) 写入 out[0, a.size())
+
+namespace detail
+{
+    template<size_t N, typename Fn>
+    void stream_per_component(const VecStream<float32, N>& a, VecStream<float32, N>& out, Fn&& fn)
+    {
+        out.resize(a.size());
+        for (size_t i = 0; i < N; ++i)
+        {
+            fn(a.component(i), out.component(i), i);
+        }
+    }
+}
+
+#undef TSIMD_DETAIL_STREAM_BINARY_FUNC
+#define TSIMD_DETAIL_STREAM_BINARY_FUNC(func) \
+    template<size_t N> \
+    void func(const VecStream<float32, N>& a, const VecStream<float32, N>& b, VecStream<float32, N>& out) \
+    { \
+        assert(a.size() == b.size()); \
+        detail::stream_per_component(a, out, [&](const float32* in, float32* o, const size_t i) \
+        { \
+            detail::stream_##func(in, b.component(i), o, a.size()); \
+        }); \
+    }
+
+TSIMD_DETAIL_STREAM_BINARY_FUNC(add)
+TSIMD_DETAIL_STREAM_BINARY_FUNC(sub)
+TSIMD_DETAIL_STREAM_BINARY_FUNC(mul)
+TSIMD_DETAIL_STREAM_BINARY_FUNC(div)
+// 与 std::min / std::max 一致: 相等或有NaN时返回 a
+TSIMD_DETAIL_STREAM_BINARY_FUNC(min)
+TSIMD_DETAIL_STREAM_BINARY_FUNC(max)
+
+#undef TSIMD_DETAIL_STREAM_BINARY_FUNC
+
+template<size_t N>
+void mul(const VecStream<float32, N>& a, const float32 s, VecStream<float32, N>& out)
+{
+    detail::stream_per_component(a, out, [&](const float32* in, float32* o, size_t)
+    {
+        detail::stream_mul_scalar(in, s, o, a.size());
+    });
+}
+
+template<size_t N>
+void div(const VecStream<float32, N>& a, const float32 s, VecStream<float32, N>& out)
+{
+    detail::stream_per_component(a, out, [&](const float32* in, float32* o, size_t)
+    {
+        detail::stream_div_scalar(in, s, o, a.size());
+    });
+}
+
+// 每个分量分别 clamp 到 [lo[i], hi[i]]
+template<size_t N>
+void clamp(const VecStream<float32, N>& v, const std::array<float32, N>& lo, const std::array<float32, N>& hi, VecStream<float32, N>& out)
+{
+    detail::stream_per_component(v, out, [&](const float32* in, float32* o, const size_t i)
+    {
+        detail::stream_clamp(in, lo[i], hi[i], o, v.size());
+    });
+}
+
+// a + (b - a) * t
+template<size_t N>
+void lerp(const VecStream<float32, N>& a, const VecStream<float32, N>& b, const float32 t, VecStream<float32, N>& out)
+{
+    assert(a.size() == b.size());
+    detail::stream_per_component(a, out, [&](const float32* in, float32* o, const size_t i)
+    {
+        detail::stream_lerp(in, b.component(i), t, o, a.size());
+    });
+}
+
+template<size_t N>
+void dot(const VecStream<float32, N>& a, const VecStream<float32, N>& b, float32* out) noexcept
+{
+    assert(a.size() == b.size());
+    detail::stream_dot(a.components().data(), b.components().data(), out, N, a.size());
+}
+
+template<size_t N>
+void magnitude(const VecStream<float32, N>& a, float32* out) noexcept
+{
+    detail::stream_magnitude(a.components().data(), out, N, a.size());
+}
+
+template<size_t N>
+void distance(const VecStream<float32, N>& a, const VecStream<float32, N>& b, float32* out) noexcept
+{
+    assert(a.size() == b.size());
+    detail::stream_distance(a.components().data(), b.components().data(), out, N, a.size());
+}
+
+// 与 tMath 的 normalized 一致: 0向量返回0向量，模长为inf时返回NaN
+template<size_t N>
+void normalized(const VecStream<float32, N>& a, VecStream<float32, N>& out)
+{
+    out.resize(a.size());
+    detail::stream_normalized(a.components().data(), out.components().data(), N, a.size());
+}
+
+inline void cross(const Vec3Stream<float32>& a, const Vec3Stream<float32>& b, Vec3Stream<float32>& out)
+{
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    detail::stream_cross(a.components().data(), b.components().data(), out.components().data(), a.size());
+}
+
+// ------------------------------- 运算符 -------------------------------
+template<size_t N>
+VecStream<float32, N> operator+(const VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    VecStream<float32, N> out;
+    add(a, b, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N> operator-(const VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    VecStream<float32, N> out;
+    sub(a, b, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N> operator*(const VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    VecStream<float32, N> out;
+    mul(a, b, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N> operator/(const VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    VecStream<float32, N> out;
+    div(a, b, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N> operator*(const VecStream<float32, N>& a, const float32 s)
+{
+    VecStream<float32, N> out;
+    mul(a, s, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N> operator*(const float32 s, const VecStream<float32, N>& a)
+{
+    return a * s;
+}
+
+template<size_t N>
+VecStream<float32, N> operator/(const VecStream<float32, N>& a, const float32 s)
+{
+    VecStream<float32, N> out;
+    div(a, s, out);
+    return out;
+}
+
+template<size_t N>
+VecStream<float32, N>& operator+=(VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    add(a, b, a);
+    return a;
+}
+
+template<size_t N>
+VecStream<float32, N>& operator-=(VecStream<float32, N>& a, const VecStream<float32, N>& b)
+{
+    sub(a, b, a);
+    return a;
+}
+
+template<size_t N>
+VecStream<float32, N>& operator*=(VecStream<float32, N>& a, const float32 s)
+{
+    mul(a, s, a);
+    return a;
+}
+
+template<size_t N>
+VecStream<float32, N>& operator/=(VecStream<float32, N>& a, const float32 s)
+{
+    div(a, s, a);
+    return a;
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,492 @@
+#include "tSimd/blas.hpp"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "tSimd/algorithm.hpp"
+#include "tSimd/reduce.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/blas.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 每个函数有对齐 / 不对齐两个版本 (模板参数 Aligned)，运行时检查所有指针 (以及 lda) 是否按 BatchAlignment 对齐
+// axpy / scal 等只读写一遍内存的函数受内存带宽限制，展开 StreamUnroll 个batch只是为了减少循环的开销
+// 求和的函数与 reduce.cpp 一样使用 ReduceUnroll 个累加器，隐藏 add / mul_add 的延迟
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    namespace blas_detail
+    {
+        constexpr size_t StreamUnroll = 4;
+        constexpr size_t ReduceUnroll = 8;
+        // gemv 行主序每次计算的行数 / 列主序每次累加到 y 上的列数
+        constexpr size_t GemvRows = 8;
+        constexpr size_t GemvCols = 4;
+
+        template<typename op, typename... T>
+        TMATH_FORCE_INLINE bool all_aligned(const T*... p) noexcept
+        {
+            return ((reinterpret_cast<uintptr_t>(p) % op::BatchAlignment == 0) && ...);
+        }
+
+        template<typename op>
+        TMATH_FORCE_INLINE bool stride_aligned(const size_t lda) noexcept
+        {
+            return lda * sizeof(float32) % op::BatchAlignment == 0;
+        }
+
+        // 完整的batch (lanes 为 std::integral_constant) 在 Aligned 为 true 时使用 load / store
+        template<typename op, bool Aligned, typename Lanes>
+        TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t load(const float32* p, const Lanes lanes) noexcept
+        {
+            if constexpr (Aligned && !std::is_integral_v<Lanes>)
+            {
+                return op::load(p);
+            }
+            else
+            {
+                return op::load_partial(p, lanes);
+            }
+        }
+
+        template<typename op, bool Aligned, typename Lanes>
+        TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void store(float32* p, const typename op::batch_t v, const Lanes lanes) noexcept
+        {
+            if constexpr (Aligned && !std::is_integral_v<Lanes>)
+            {
+                op::store(p, v);
+            }
+            else
+            {
+                op::store_partial(p, v, lanes);
+            }
+        }
+
+        // fn(std::bool_constant<Aligned>)
+        template<typename Fn>
+        TMATH_FORCE_INLINE void with_alignment(const bool aligned, Fn&& fn)
+        {
+            if (aligned)
+            {
+                fn(std::true_type{});
+            }
+            else
+            {
+                fn(std::false_type{});
+            }
+        }
+
+        // ReduceUnroll 个累加器，初始值为 init，step(acc, i, lanes) 返回累加后的值，最后用 merge 两两合并
+        template<typename op, typename Step, typename Merge>
+        TSIMD_DYN_FUNC_ATTR typename op::batch_t accumulate(const size_t count, const typename op::batch_t init, Step&& step, Merge&& merge) noexcept
+        {
+            typename op::batch_t acc[ReduceUnroll];
+            unroll<ReduceUnroll>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+            {
+                acc[k] = init;
+            });
+
+            for_each_batch_unrolled<op, ReduceUnroll>(count, [&](const auto k, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                acc[k] = step(acc[k], i, lanes);
+            });
+
+            unroll<ReduceUnroll / 2>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+            {
+                acc[k] = merge(acc[k], acc[k + ReduceUnroll / 2]);
+            });
+            unroll<ReduceUnroll / 4>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+            {
+                acc[k] = merge(acc[k], acc[k + ReduceUnroll / 4]);
+            });
+            return merge(acc[0], acc[1]);
+        }
+
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void axpy(const float32 alpha, const float32* TMATH_RESTRICT x, float32* TMATH_RESTRICT y, const size_t count) noexcept
+        {
+            const auto va = op::set(alpha);
+            for_each_batch_unrolled<op, StreamUnroll>(count, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                store<op, Aligned>(y + i, op::mul_add(va, load<op, Aligned>(x + i, lanes), load<op, Aligned>(y + i, lanes)), lanes);
+            });
+        }
+
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void axpby(const float32 alpha, const float32* TMATH_RESTRICT x, const float32 beta, float32* TMATH_RESTRICT y, const size_t count) noexcept
+        {
+            const auto va = op::set(alpha);
+            if (beta == 0.0f)
+            {
+                for_each_batch_unrolled<op, StreamUnroll>(count, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    store<op, Aligned>(y + i, op::mul(va, load<op, Aligned>(x + i, lanes)), lanes);
+                });
+                return;
+            }
+
+            const auto vb = op::set(beta);
+            for_each_batch_unrolled<op, StreamUnroll>(count, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                store<op, Aligned>(y + i, op::mul_add(va, load<op, Aligned>(x + i, lanes), op::mul(vb, load<op, Aligned>(y + i, lanes))), lanes);
+            });
+        }
+
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void scal(const float32 alpha, float32* x, const size_t count) noexcept
+        {
+            const auto va = op::set(alpha);
+            for_each_batch_unrolled<op, StreamUnroll>(count, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                store<op, Aligned>(x + i, op::mul(va, load<op, Aligned>(x + i, lanes)), lanes);
+            });
+        }
+
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void fill_zero(float32* x, const size_t count) noexcept
+        {
+            for_each_batch_unrolled<op, StreamUnroll>(count, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                store<op, Aligned>(x + i, op::zero(), lanes);
+            });
+        }
+
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR float32 asum(const float32* x, const size_t count) noexcept
+        {
+            return op::reduce_sum(accumulate<op>(count, op::zero(),
+                [&](const auto acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    return op::add(acc, op::abs(load<op, Aligned>(x + i, lanes)));
+                },
+                [](const auto a, const auto b) TSIMD_DYN_FUNC_ATTR { return op::add(a, b); }));
+        }
+
+        // max(|x[i]|)，max 的第一个参数为 NaN 时返回第二个参数，所以 NaN 被忽略，末尾补的0也不影响结果
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR float32 amax(const float32* x, const size_t count) noexcept
+        {
+            return op::reduce_max(accumulate<op>(count, op::zero(),
+                [&](const auto acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    return op::max(op::abs(load<op, Aligned>(x + i, lanes)), acc);
+                },
+                [](const auto a, const auto b) TSIMD_DYN_FUNC_ATTR { return op::max(a, b); }));
+        }
+
+        // sum((x[i] * s1 * s2)^2)，缩放分成两次乘法，每个系数都不会超出 float32 的范围
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR float32 sum_sq_scaled(const float32* x, const size_t count, const float32 s1, const float32 s2) noexcept
+        {
+            const auto v1 = op::set(s1);
+            const auto v2 = op::set(s2);
+            return op::reduce_sum(accumulate<op>(count, op::zero(),
+                [&](const auto acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    const auto v = op::mul(op::mul(load<op, Aligned>(x + i, lanes), v1), v2);
+                    return op::mul_add(v, v, acc);
+                },
+                [](const auto a, const auto b) TSIMD_DYN_FUNC_ATTR { return op::add(a, b); }));
+        }
+
+        // 第一个 |x[i]| == value 的下标，找到后立即返回，没有时返回0
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR size_t find_abs(const float32* x, const size_t count, const float32 value) noexcept
+        {
+            constexpr size_t L = op::Lanes;
+            const auto v = op::set(value);
+
+            size_t i = 0;
+            for (; i + L <= count; i += L)
+            {
+                const uint32 bits = op::movemask(op::cmp_eq(op::abs(op::loadu(x + i)), v));
+                if (bits != 0)
+                {
+                    return i + static_cast<size_t>(std::countr_zero(bits));
+                }
+            }
+            if (i < count)
+            {
+                // 忽略 load_partial 补的0
+                const uint32 valid = (uint32{ 1 } << (count - i)) - 1;
+                const uint32 bits = op::movemask(op::cmp_eq(op::abs(op::load_partial(x + i, count - i)), v)) & valid;
+                if (bits != 0)
+                {
+                    return i + static_cast<size_t>(std::countr_zero(bits));
+                }
+            }
+            return 0;
+        }
+
+        // y[r] = alpha * dot(A[r, :], x) + beta * y[r]
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void gemv_row_major(const size_t rows, const size_t cols, const float32 alpha, const float32* TMATH_RESTRICT A, const size_t lda,
+                                                const float32* TMATH_RESTRICT x, const float32 beta, float32* TMATH_RESTRICT y) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            const auto finish = [&](const size_t r, const float32 d)
+            {
+                y[r] = beta == 0.0f ? alpha * d : alpha * d + beta * y[r];
+            };
+
+            // GemvRows 行共用 x 的 load，每行一个累加器，共 GemvRows 条独立的依赖链
+            size_t r = 0;
+            for (; r + GemvRows <= rows; r += GemvRows)
+            {
+                batch_t acc[GemvRows];
+                const float32* row[GemvRows];
+                unroll<GemvRows>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                {
+                    acc[k] = op::zero();
+                    row[k] = A + (r + k) * lda;
+                });
+
+                for_each_batch<op>(cols, [&](const size_t j, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    const batch_t xv = load<op, Aligned>(x + j, lanes);
+                    unroll<GemvRows>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                    {
+                        acc[k] = op::mul_add(load<op, Aligned>(row[k] + j, lanes), xv, acc[k]);
+                    });
+                });
+
+                unroll<GemvRows>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                {
+                    finish(r + k, op::reduce_sum(acc[k]));
+                });
+            }
+
+            for (; r < rows; ++r)
+            {
+                const float32* row = A + r * lda;
+                finish(r, op::reduce_sum(accumulate<op>(cols, op::zero(),
+                    [&](const auto acc, const size_t j, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                    {
+                        return op::mul_add(load<op, Aligned>(row + j, lanes), load<op, Aligned>(x + j, lanes), acc);
+                    },
+                    [](const auto a, const auto b) TSIMD_DYN_FUNC_ATTR { return op::add(a, b); })));
+            }
+        }
+
+        // y = beta * y，然后每次把 GemvCols 列累加到 y 上 (y 每 GemvCols 列只读写一次)
+        template<typename op, bool Aligned>
+        TSIMD_DYN_FUNC_ATTR void gemv_column_major(const size_t rows, const size_t cols, const float32 alpha, const float32* TMATH_RESTRICT A, const size_t lda,
+                                                   const float32* TMATH_RESTRICT x, const float32 beta, float32* TMATH_RESTRICT y) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            if (beta == 0.0f)
+            {
+                fill_zero<op, Aligned>(y, rows);
+            }
+            else if (beta != 1.0f)
+            {
+                scal<op, Aligned>(beta, y, rows);
+            }
+
+            size_t c = 0;
+            for (; c + GemvCols <= cols; c += GemvCols)
+            {
+                batch_t t[GemvCols];
+                const float32* col[GemvCols];
+                unroll<GemvCols>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                {
+                    t[k] = op::set(alpha * x[c + k]);
+                    col[k] = A + (c + k) * lda;
+                });
+
+                for_each_batch_unrolled<op, 2>(rows, [&](const auto, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+                {
+                    batch_t yv = load<op, Aligned>(y + i, lanes);
+                    unroll<GemvCols>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                    {
+                        yv = op::mul_add(t[k], load<op, Aligned>(col[k] + i, lanes), yv);
+                    });
+                    store<op, Aligned>(y + i, yv, lanes);
+                });
+            }
+
+            for (; c < cols; ++c)
+            {
+                axpy<op, Aligned>(alpha * x[c], A + c * lda, y, rows);
+            }
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void blas_axpy_impl(const float32 alpha, const float32* x, float32* y, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x, y), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            blas_detail::axpy<op, aligned()>(alpha, x, y, count);
+        });
+    }
+
+    TSIMD_DYN_FUNC_ATTR void blas_axpby_impl(const float32 alpha, const float32* x, const float32 beta, float32* y, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x, y), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            blas_detail::axpby<op, aligned()>(alpha, x, beta, y, count);
+        });
+    }
+
+    TSIMD_DYN_FUNC_ATTR void blas_scal_impl(const float32 alpha, float32* x, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            blas_detail::scal<op, aligned()>(alpha, x, count);
+        });
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 blas_asum_impl(const float32* x, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        float32 result = 0.0f;
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            result = blas_detail::asum<op, aligned()>(x, count);
+        });
+        return result;
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 blas_amax_impl(const float32* x, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        float32 result = 0.0f;
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            result = blas_detail::amax<op, aligned()>(x, count);
+        });
+        return result;
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 blas_sum_sq_scaled_impl(const float32* x, const size_t count, const float32 s1, const float32 s2) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        float32 result = 0.0f;
+        blas_detail::with_alignment(blas_detail::all_aligned<op>(x), [&](const auto aligned) TSIMD_DYN_FUNC_ATTR
+        {
+            result = blas_detail::sum_sq_scaled<op, aligned()>(x, count, s1, s2);
+        });
+        return result;
+    }
+
+    // 先求 max(|x[i]|)，再找第一个等于它的元素 (第二遍找到后提前结束)
+    TSIMD_DYN_FUNC_ATTR size_t blas_iamax_impl(const float32* x, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        return blas_detail::find_abs<op>(x, count, blas_amax_impl(x, count));
+    }
+
+    TSIMD_DYN_FUNC_ATTR void blas_gemv_impl(const blas::Layout layout, const size_t rows, const size_t cols, const float32 alpha, const float32* A, const size_t lda,
+                                            const float32* x, const float32 beta, float32* y) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        if (layout == blas::Layout::RowMajor)
+        {
+            const bool aligned = blas_detail::all_aligned<op>(A, x) && blas_detail::stride_aligned<op>(lda);
+            blas_detail::with_alignment(aligned, [&](const auto is_aligned) TSIMD_DYN_FUNC_ATTR
+            {
+                blas_detail::gemv_row_major<op, is_aligned()>(rows, cols, alpha, A, lda, x, beta, y);
+            });
+        }
+        else
+        {
+            const bool aligned = blas_detail::all_aligned<op>(A, y) && blas_detail::stride_aligned<op>(lda);
+            blas_detail::with_alignment(aligned, [&](const auto is_aligned) TSIMD_DYN_FUNC_ATTR
+            {
+                blas_detail::gemv_column_major<op, is_aligned()>(rows, cols, alpha, A, lda, x, beta, y);
+            });
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(blas_axpy_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_axpby_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_scal_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_asum_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_amax_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_sum_sq_scaled_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_iamax_impl);
+TSIMD_DYN_DISPATCH_FUNC(blas_gemv_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace blas
+{
+    void axpy(float32 alpha, const float32* x, float32* y, size_t count) noexcept
+    {
+        if (alpha == 0.0f)
+        {
+            return;
+        }
+        TSIMD_DYN_CALL(blas_axpy_impl)(alpha, x, y, count);
+    }
+
+    void axpby(float32 alpha, const float32* x, float32 beta, float32* y, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(blas_axpby_impl)(alpha, x, beta, y, count);
+    }
+
+    void scal(float32 alpha, float32* x, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(blas_scal_impl)(alpha, x, count);
+    }
+
+    float32 dot(const float32* x, const float32* y, size_t count) noexcept
+    {
+        return reduce::dot(x, y, count);
+    }
+
+    float32 nrm2(const float32* x, size_t count) noexcept
+    {
+        // 结果不小于 2^-40 时平方和不小于 2^-80，下溢成非正规数的项可以忽略
+        const float32 fast = reduce::norm2(x, count);
+        if (std::isnan(fast) || (fast >= 0x1p-40f && fast < std::numeric_limits<float32>::infinity()))
+        {
+            return fast;
+        }
+
+        // 缩放到 max(|x[i]|) 在 [1, 2) 内，2^-e 可能超出 float32 的范围，拆成两个系数
+        const float32 amax = TSIMD_DYN_CALL(blas_amax_impl)(x, count);
+        if (amax == 0.0f || std::isinf(amax))
+        {
+            return amax;
+        }
+        const int e = std::ilogb(amax);
+        const float32 s1 = std::ldexp(1.0f, -e / 2);
+        const float32 s2 = std::ldexp(1.0f, -e - (-e / 2));
+        return std::ldexp(std::sqrt(TSIMD_DYN_CALL(blas_sum_sq_scaled_impl)(x, count, s1, s2)), e);
+    }
+
+    float32 asum(const float32* x, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(blas_asum_impl)(x, count);
+    }
+
+    size_t iamax(const float32* x, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(blas_iamax_impl)(x, count);
+    }
+
+    void gemv(Layout layout, size_t rows, size_t cols, float32 alpha, const float32* A, size_t lda,
+              const float32* x, float32 beta, float32* y) noexcept
+    {
+        TSIMD_DYN_CALL(blas_gemv_impl)(layout, rows, cols, alpha, A, lda, x, beta, y);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,188 @@
+#include "tSimd/culling.hpp"
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/culling.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 每个batch先对6个平面求出被剔除的lane (mask_or)，再用 movemask 得到可见lane的位，最后无分支地压缩写入下标
+// 距离的计算顺序与 tMath (bounds.hpp) 相同: ((a*x + b*y) + c*z) + d，不使用 mul_add
+// 比较为 dist + r < 0 时剔除，NaN 的比较结果为 false，所以含 NaN 的包围体总是可见 (与标量版本一致)
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    namespace culling_detail
+    {
+        template<typename op>
+        struct Planes
+        {
+            typename op::batch_t a[6], b[6], c[6], d[6];
+        };
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Planes<op> load_planes(const float32* planes) noexcept
+        {
+            Planes<op> p;
+            for (size_t k = 0; k < 6; ++k)
+            {
+                p.a[k] = op::set(planes[k * 4 + 0]);
+                p.b[k] = op::set(planes[k * 4 + 1]);
+                p.c[k] = op::set(planes[k * 4 + 2]);
+                p.d[k] = op::set(planes[k * 4 + 3]);
+            }
+            return p;
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Planes<op> abs_normals(const Planes<op>& p) noexcept
+        {
+            Planes<op> r;
+            for (size_t k = 0; k < 6; ++k)
+            {
+                r.a[k] = op::abs(p.a[k]);
+                r.b[k] = op::abs(p.b[k]);
+                r.c[k] = op::abs(p.c[k]);
+                r.d[k] = p.d[k];
+            }
+            return r;
+        }
+
+        /**
+         * 可见lane (bits 的第k位) 的下标 i + k 写入 visible[n]，n 只在可见时加1
+         * 每个lane都会写一次，不可见的下标会被下一个可见的覆盖；因为 n <= i + k，不会越过 count
+         */
+        template<size_t MaxLanes, typename Lanes>
+        TMATH_FORCE_INLINE size_t compact(const uint32 bits, const size_t i, const Lanes lanes, uint32* visible, size_t n) noexcept
+        {
+            unroll<MaxLanes>([&](const auto k)
+            {
+                if (k < lanes)
+                {
+                    visible[n] = static_cast<uint32>(i + k);
+                    n += (bits >> k) & 1u;
+                }
+            });
+            return n;
+        }
+
+        // Radius::load 读取一个batch的半径数据，Radius::plane 返回在第k个平面法线上的投影半径
+        template<typename op, typename Radius>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR size_t cull(const float32* planes, const float32* const* center, const Radius& radius,
+                                                      uint32* visible, const size_t count) noexcept
+        {
+            const auto p = load_planes<op>(planes);
+            const auto zero = op::zero();
+
+            size_t n = 0;
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                const auto x = op::load_partial(center[0] + i, lanes);
+                const auto y = op::load_partial(center[1] + i, lanes);
+                const auto z = op::load_partial(center[2] + i, lanes);
+                const auto r = radius.template load<op>(i, lanes);
+
+                // 第k个平面: ((a*x + b*y) + c*z) + d + r < 0
+                const auto outside = [&](const size_t k) TSIMD_DYN_FUNC_ATTR
+                {
+                    const auto dist = op::add(op::add(op::add(op::mul(p.a[k], x), op::mul(p.b[k], y)), op::mul(p.c[k], z)), p.d[k]);
+                    return op::cmp_lt(op::add(dist, radius.template plane<op>(r, k)), zero);
+                };
+
+                auto culled = outside(0);
+                unroll<5>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                {
+                    culled = op::mask_or(culled, outside(k + 1));
+                });
+
+                const uint32 bits = ~op::movemask(culled);
+                n = compact<op::Lanes>(bits, i, lanes, visible, n);
+            });
+            return n;
+        }
+
+        // 包围球: 投影半径就是球的半径
+        struct SphereRadius
+        {
+            const float32* radius;
+
+            template<typename op, typename Lanes>
+            TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t load(const size_t i, const Lanes lanes) const noexcept
+            {
+                return op::load_partial(radius + i, lanes);
+            }
+
+            template<typename op>
+            TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t plane(const typename op::batch_t r, size_t) const noexcept
+            {
+                return r;
+            }
+        };
+
+        // AABB: (|a|*ex + |b|*ey) + |c|*ez
+        template<typename op>
+        struct AabbRadius
+        {
+            const float32* const* extents;
+            Planes<op> abs_planes;
+
+            struct Extents
+            {
+                typename op::batch_t x, y, z;
+            };
+
+            template<typename, typename Lanes>
+            TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Extents load(const size_t i, const Lanes lanes) const noexcept
+            {
+                return { op::load_partial(extents[0] + i, lanes), op::load_partial(extents[1] + i, lanes), op::load_partial(extents[2] + i, lanes) };
+            }
+
+            template<typename>
+            TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t plane(const Extents& e, const size_t k) const noexcept
+            {
+                return op::add(op::add(op::mul(abs_planes.a[k], e.x), op::mul(abs_planes.b[k], e.y)), op::mul(abs_planes.c[k], e.z));
+            }
+        };
+    }
+
+    TSIMD_DYN_FUNC_ATTR size_t cull_spheres_impl(const float32* planes, const float32* const* center, const float32* radius,
+                                                 uint32* visible, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        return culling_detail::cull<op>(planes, center, culling_detail::SphereRadius{ radius }, visible, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR size_t cull_aabbs_impl(const float32* planes, const float32* const* center, const float32* const* extents,
+                                               uint32* visible, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        const culling_detail::AabbRadius<op> radius{ extents, culling_detail::abs_normals<op>(culling_detail::load_planes<op>(planes)) };
+        return culling_detail::cull<op>(planes, center, radius, visible, count);
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(cull_spheres_impl);
+TSIMD_DYN_DISPATCH_FUNC(cull_aabbs_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    size_t cull_spheres(const float32* planes, const float32* const* center, const float32* radius, uint32* visible, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(cull_spheres_impl)(planes, center, radius, visible, count);
+    }
+
+    size_t cull_aabbs(const float32* planes, const float32* const* center, const float32* const* extents, uint32* visible, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(cull_aabbs_impl)(planes, center, extents, visible, count);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
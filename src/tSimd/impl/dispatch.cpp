@@ -8,6 +8,14 @@
 #endif
 
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
 
 TSIMD_NAMESPACE_BEGIN
@@ -180,51 +188,177 @@ namespace detail
 #endif
     }
 
-    int dyn_func_index_impl() noexcept
+    // 这个平台上，分发表中最低的指令集
+    constexpr SimdInstruction fallback_instruction() noexcept
+    {
+#if defined(TSIMD_INSTRUCTION_FEATURE_SCALAR)
+        return SimdInstruction::Scalar;
+#elif defined(TSIMD_INSTRUCTION_FEATURE_SSE2)
+        return SimdInstruction::SSE2;
+#else
+        #error "no fallback instruction"
+#endif
+    }
+
+    // 从最高级的指令往下判断，选出 CPU支持、并且不超过 max_instruction 的指令集
+    SimdInstruction select_instruction_impl(const SimdInstruction max_instruction) noexcept
     {
         const auto& supports = get_support_info_impl();
+        const auto allowed = [max_instruction](const SimdInstruction instruction) noexcept
+        {
+            return underlying(instruction) <= underlying(max_instruction);
+        };
+
+        // AVX2 及以上的op使用 F16C (load_f16 / store_f16)，F16C 不作为单独的指令集分发
+        // InstructionSetSupports 只描述CPU，所以这个要求放在这里而不是 AVX2 的检测中
+#if defined(TSIMD_INSTRUCTION_FEATURE_AVX512_F)
+        if (supports.AVX512_F && supports.F16C && allowed(SimdInstruction::AVX512_F))
+        {
+            return SimdInstruction::AVX512_F;
+        }
+#endif
 
-        // 从最高级的指令往下判断
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2) && defined(TSIMD_INSTRUCTION_FEATURE_FMA3)
-        if (supports.AVX2_FMA3)
+        if (supports.AVX2_FMA3 && supports.F16C && allowed(SimdInstruction::AVX2_FMA3))
         {
-            return underlying(SimdInstructionIndex::AVX2_FMA3);
+            return SimdInstruction::AVX2_FMA3;
         }
 #endif
 
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX2)
-        if (supports.AVX2)
+        if (supports.AVX2 && supports.F16C && allowed(SimdInstruction::AVX2))
         {
-            return underlying(SimdInstructionIndex::AVX2);
+            return SimdInstruction::AVX2;
         }
 #endif
 
 #if defined(TSIMD_INSTRUCTION_FEATURE_AVX)
-        if (supports.AVX)
+        if (supports.AVX && allowed(SimdInstruction::AVX))
+        {
+            return SimdInstruction::AVX;
+        }
+#endif
+
+#if defined(TSIMD_INSTRUCTION_FEATURE_SSE4_1)
+        if (supports.SSE4_1 && allowed(SimdInstruction::SSE4_1))
+        {
+            return SimdInstruction::SSE4_1;
+        }
+#endif
+
+#if defined(TSIMD_INSTRUCTION_FEATURE_SSE3)
+        if (supports.SSE3 && allowed(SimdInstruction::SSE3))
         {
-            return underlying(SimdInstructionIndex::AVX);
+            return SimdInstruction::SSE3;
         }
 #endif
 
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE2)
-        if (supports.SSE2)
+        if (supports.SSE2 && allowed(SimdInstruction::SSE2))
         {
-            return underlying(SimdInstructionIndex::SSE2);
+            return SimdInstruction::SSE2;
         }
 #endif
 
 #if defined(TSIMD_INSTRUCTION_FEATURE_SSE)
-        if (supports.SSE)
+        if (supports.SSE && allowed(SimdInstruction::SSE))
         {
-            return underlying(SimdInstructionIndex::SSE);
+            return SimdInstruction::SSE;
         }
 #endif
 
-#if defined(TSIMD_INSTRUCTION_FEATURE_SCALAR)
-        return underlying(SimdInstructionIndex::Scalar);
+        return fallback_instruction();
+    }
+
+    // ------------------------------- 限制最高指令集 -------------------------------
+    constexpr SimdInstruction all_instructions[] = {
+        SimdInstruction::Scalar,
+        SimdInstruction::SSE,
+        SimdInstruction::SSE2,
+        SimdInstruction::SSE3,
+        SimdInstruction::SSE4_1,
+        SimdInstruction::AVX,
+        SimdInstruction::AVX2,
+        SimdInstruction::AVX2_FMA3,
+        SimdInstruction::AVX512_F,
+    };
+
+    // set_max_instruction() 设置的值 (低位，默认不限制) 和是否已经分发 (SelectedBit) 放在同一个原子变量中
+    // 否则 "检查是否已经分发" 和 "写入限制" 之间可能发生第一次分发，读到旧的限制，而 set_max_instruction 仍然返回 true
+    constexpr uint32_t SelectedBit = 1u << 31;
+    std::atomic<uint32_t> g_max_instruction_state{ static_cast<uint32_t>(SimdInstruction::AVX512_F) };
+
+    // 比较时不区分大小写，忽略 '_' 和 '.'
+    std::string normalize_instruction_name(const std::string_view name)
+    {
+        std::string result;
+        for (const char c : name)
+        {
+            if (c == '_' || c == '.')
+            {
+                continue;
+            }
+            result.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+        return result;
+    }
+
+    std::optional<SimdInstruction> parse_instruction_name(const std::string_view name)
+    {
+        const std::string normalized = normalize_instruction_name(name);
+        for (const SimdInstruction instruction : all_instructions)
+        {
+            if (normalized == normalize_instruction_name(InstructionSelector::instruction_name(instruction)))
+            {
+                return instruction;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // 读取环境变量 TSIMD_MAX_ISA，没有设置或者无法识别时，返回 nullopt
+    // 无法识别时在 stderr 输出一行提示，避免拼写错误时不知不觉地使用了最高的指令集
+    std::optional<SimdInstruction> max_instruction_from_env()
+    {
+        constexpr const char* env_name = "TSIMD_MAX_ISA";
+
+#if defined(_MSC_VER)
+        char* buffer = nullptr;
+        size_t size = 0;
+        if (_dupenv_s(&buffer, &size, env_name) != 0 || buffer == nullptr)
+        {
+            return std::nullopt;
+        }
+        const std::string value = buffer;
+        std::free(buffer);
+#else
+        const char* env = std::getenv(env_name);
+        if (env == nullptr)
+        {
+            return std::nullopt;
+        }
+        const std::string value = env;
 #endif
 
-        std::unreachable();
+        const auto instruction = parse_instruction_name(value);
+        if (!instruction)
+        {
+            std::fprintf(stderr, "tsimd: unrecognized TSIMD_MAX_ISA value \"%s\", ignored\n", value.c_str());
+        }
+        return instruction;
+    }
+
+    SimdInstruction selected_instruction_impl() noexcept
+    {
+        // 标记为已经分发，同时取出标记之前设置的限制
+        const uint32_t state = g_max_instruction_state.fetch_or(SelectedBit);
+        SimdInstruction max_instruction = static_cast<SimdInstruction>(state & ~SelectedBit);
+        if (const auto env_max = max_instruction_from_env())
+        {
+            max_instruction = std::min(max_instruction, *env_max);
+        }
+
+        return select_instruction_impl(max_instruction);
     }
 
     size_t required_alignment() noexcept
@@ -247,13 +381,51 @@ namespace detail
     }
 }
 
-// 测试时，这段代码不会被调用
-int InstructionSelector::dyn_func_index() noexcept
+bool InstructionSelector::set_max_instruction(const SimdInstruction max_instruction) noexcept
+{
+    uint32_t state = detail::g_max_instruction_state.load();
+    do
+    {
+        if (state & detail::SelectedBit)
+        {
+            return false;
+        }
+    } while (!detail::g_max_instruction_state.compare_exchange_weak(state, static_cast<uint32_t>(max_instruction)));
+
+    return true;
+}
+
+// 测试时指定了 TSIMD_TEST_INTRINSIC 的话，分发不会调用这个函数
+SimdInstruction InstructionSelector::selected_instruction() noexcept
+{
+    static const SimdInstruction i = detail::selected_instruction_impl();
+    return i;
+}
+
+SimdInstruction InstructionSelector::max_supported_instruction() noexcept
 {
-    static int i = detail::dyn_func_index_impl();
+    static const SimdInstruction i = detail::select_instruction_impl(SimdInstruction::AVX512_F);
     return i;
 }
 
+const char* InstructionSelector::instruction_name(const SimdInstruction instruction) noexcept
+{
+    switch (instruction)
+    {
+    case SimdInstruction::Scalar:       return "Scalar";
+    case SimdInstruction::SSE:          return "SSE";
+    case SimdInstruction::SSE2:         return "SSE2";
+    case SimdInstruction::SSE3:         return "SSE3";
+    case SimdInstruction::SSE4_1:       return "SSE4_1";
+    case SimdInstruction::AVX:          return "AVX";
+    case SimdInstruction::AVX2:         return "AVX2";
+    case SimdInstruction::AVX2_FMA3:    return "AVX2_FMA3";
+    case SimdInstruction::AVX512_F:     return "AVX512_F";
+    }
+
+    return "Unknown";
+}
+
 const InstructionSetSupports& InstructionSelector::get_support_info() noexcept
 {
     static const InstructionSetSupports& s = detail::get_support_info_impl();
@@ -0,0 +1,58 @@
+#include "tSimd/float16.hpp"
+
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/float16.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    TSIMD_DYN_FUNC_ATTR void f32_to_f16_impl(const float32* TMATH_RESTRICT in, float16* TMATH_RESTRICT out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            op::store_f16_partial(out + i, op::load_partial(in + i, lanes), lanes);
+        });
+    }
+
+    // 输出是 float32，很大时使用 stream (见 for_each_batch_store)
+    TSIMD_DYN_FUNC_ATTR void f16_to_f32_impl(const float16* TMATH_RESTRICT in, float32* TMATH_RESTRICT out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            TSIMD_STORE_BATCH(op, out + i, op::load_f16_partial(in + i, lanes), lanes);
+        }))
+        {
+            op::fence();
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(f32_to_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(f16_to_f32_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+void f32_to_f16(const float32* in, float16* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(f32_to_f16_impl)(in, out, count);
+}
+
+void f16_to_f32(const float16* in, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(f16_to_f32_impl)(in, out, count);
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,368 @@
+#include "tSimd/blas.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "tSimd/algorithm.hpp"
+#include "tSimd/aligned_allocate.hpp"
+#include "tSimd/parallel.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/gemm.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 行主序的 C = alpha * A * B + beta * C，分块方式与 GotoBLAS / BLIS 相同:
+// for jc (nc 列):                     B 的 kc x nc 块打包后放在 L3
+//   for pc (kc):                      beta 只在第一个 kc 块使用，之后为1
+//     for ic (mc 行):                 A 的 mc x kc 块打包后放在 L2
+//       for jr (nr 列):               B 的 kc x nr 条带放在 L1，被所有 ir 复用
+//         for ir (mr 行):             微内核，mr x nr 的 C 块放在寄存器中
+// 打包后每个条带在内存中连续，末尾不足 mr / nr 的部分补0，微内核不需要处理边界
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    namespace gemm_detail
+    {
+        template<typename op>
+        struct Blocking
+        {
+            static constexpr size_t L = op::Lanes;
+            // 累加器 MR * NV 个，加上 NV 个 B 和 1 个广播的 A 不超过寄存器的个数 (AVX-512 32 个，其他 16 个)
+            // AVX-512: 14 x 32，AVX / AVX2: 6 x 16，SSE: 4 x 8，Scalar: 4 x 4
+            static constexpr size_t MR = L == 16 ? 14 : (L == 8 ? 6 : 4);
+            static constexpr size_t NV = L == 1 ? 4 : 2;
+            static constexpr size_t NR = NV * L;
+            // B 的 KC x NR 条带约 16KB (L1 的一半)
+            static constexpr size_t KC = 16 * 1024 / (NR * sizeof(float32));
+            // A 的 MC x KC 块约为 L2 的一半 (支持 AVX-512 的 CPU 按 1MB，其他按 256KB)
+            static constexpr size_t MC = (L == 16 ? 512 * 1024 : 128 * 1024) / (KC * sizeof(float32)) / MR * MR;
+            static constexpr size_t NC = 4096;
+
+            static_assert(MC % MR == 0 && NC % NR == 0);
+        };
+
+        // 打包 A 的 mc x kc 块: 每 MR 行一个条带，条带内按列存储 (Ap[p * MR + i] = A[i][p])
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR void pack_a(const size_t mc, const size_t kc, const float32* A, const size_t lda, float32* Ap) noexcept
+        {
+            constexpr size_t MR = Blocking<op>::MR;
+
+            for (size_t ir = 0; ir < mc; ir += MR)
+            {
+                const size_t mr = std::min(MR, mc - ir);
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    for (size_t i = 0; i < MR; ++i)
+                    {
+                        Ap[i] = i < mr ? A[(ir + i) * lda + p] : 0.0f;
+                    }
+                    Ap += MR;
+                }
+            }
+        }
+
+        // 打包 B 的 kc x nc 块: 每 NR 列一个条带，条带内按行存储 (Bp[p * NR + j] = B[p][j])
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR void pack_b(const size_t kc, const size_t nc, const float32* B, const size_t ldb, float32* Bp) noexcept
+        {
+            constexpr size_t L = op::Lanes;
+            constexpr size_t NV = Blocking<op>::NV;
+            constexpr size_t NR = Blocking<op>::NR;
+
+            for (size_t jr = 0; jr < nc; jr += NR)
+            {
+                const size_t nr = std::min(NR, nc - jr);
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    const float32* src = B + p * ldb + jr;
+                    unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                    {
+                        const size_t n = nr > v * L ? std::min(L, nr - v * L) : 0;
+                        op::store(Bp + v * L, n == 0 ? op::zero() : op::load_partial(src + v * L, n));
+                    });
+                    Bp += NR;
+                }
+            }
+        }
+
+        // C[0:mr, 0:nr] = alpha * Ap * Bp + beta * C，Ap / Bp 为打包后的条带
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR void micro_kernel(const size_t kc, const float32* TMATH_RESTRICT Ap, const float32* TMATH_RESTRICT Bp,
+                                              float32* TMATH_RESTRICT C, const size_t ldc, const float32 alpha, const float32 beta,
+                                              const size_t mr, const size_t nr) noexcept
+        {
+            using batch_t = typename op::batch_t;
+            constexpr size_t L = op::Lanes;
+            constexpr size_t MR = Blocking<op>::MR;
+            constexpr size_t NV = Blocking<op>::NV;
+            constexpr size_t NR = Blocking<op>::NR;
+
+            batch_t acc[MR][NV];
+            unroll<MR>([&](const auto i) TSIMD_DYN_FUNC_ATTR
+            {
+                unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                {
+                    acc[i][v] = op::zero();
+                });
+            });
+
+            for (size_t p = 0; p < kc; ++p)
+            {
+                batch_t b[NV];
+                unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                {
+                    b[v] = op::load(Bp + v * L);
+                });
+                unroll<MR>([&](const auto i) TSIMD_DYN_FUNC_ATTR
+                {
+                    const batch_t a = op::set(Ap[i]);
+                    unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                    {
+                        acc[i][v] = op::mul_add(a, b[v], acc[i][v]);
+                    });
+                });
+                Ap += MR;
+                Bp += NR;
+            }
+
+            const batch_t va = op::set(alpha);
+            const batch_t vb = op::set(beta);
+            if (mr == MR && nr == NR)
+            {
+                unroll<MR>([&](const auto i) TSIMD_DYN_FUNC_ATTR
+                {
+                    unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                    {
+                        float32* c = C + i * ldc + v * L;
+                        batch_t r = op::mul(va, acc[i][v]);
+                        if (beta != 0.0f)
+                        {
+                            r = op::mul_add(vb, op::loadu(c), r);
+                        }
+                        op::storeu(c, r);
+                    });
+                });
+                return;
+            }
+
+            // 边界上的块只写入 mr x nr
+            unroll<MR>([&](const auto i) TSIMD_DYN_FUNC_ATTR
+            {
+                if (i >= mr)
+                {
+                    return;
+                }
+                unroll<NV>([&](const auto v) TSIMD_DYN_FUNC_ATTR
+                {
+                    if (v * L >= nr)
+                    {
+                        return;
+                    }
+                    const size_t n = std::min(L, nr - v * L);
+                    float32* c = C + i * ldc + v * L;
+                    batch_t r = op::mul(va, acc[i][v]);
+                    if (beta != 0.0f)
+                    {
+                        r = op::mul_add(vb, op::load_partial(c, n), r);
+                    }
+                    op::store_partial(c, r, n);
+                });
+            });
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR void macro_kernel(const size_t mc, const size_t nc, const size_t kc, const float32* Ap, const float32* Bp,
+                                              float32* C, const size_t ldc, const float32 alpha, const float32 beta) noexcept
+        {
+            constexpr size_t MR = Blocking<op>::MR;
+            constexpr size_t NR = Blocking<op>::NR;
+
+            for (size_t jr = 0; jr < nc; jr += NR)
+            {
+                for (size_t ir = 0; ir < mc; ir += MR)
+                {
+                    micro_kernel<op>(kc, Ap + ir * kc, Bp + jr * kc, C + ir * ldc + jr, ldc, alpha, beta,
+                                     std::min(MR, mc - ir), std::min(NR, nc - jr));
+                }
+            }
+        }
+
+        // 打包用的缓冲区每个线程一份，只增长不释放，之后的调用不再分配内存
+        // gemm 是 noexcept 的，所以直接使用 aligned_allocate，分配失败时返回 nullptr 而不是抛出 std::bad_alloc
+        struct ThreadBuffer
+        {
+            float32* data = nullptr;
+            size_t capacity = 0;
+
+            ThreadBuffer() = default;
+            ThreadBuffer(const ThreadBuffer&) = delete;
+            ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+            ~ThreadBuffer()
+            {
+                aligned_free(data);
+            }
+
+            float32* reserve(const size_t count) noexcept
+            {
+                if (capacity < count)
+                {
+                    auto* const p = aligned_allocate<float32*>(count * sizeof(float32), InstructionSelector::required_alignment());
+                    if (!p)
+                    {
+                        return nullptr;
+                    }
+                    aligned_free(data);
+                    data = p;
+                    capacity = count;
+                }
+                return data;
+            }
+        };
+    }
+
+    // M / N / K 都大于0，alpha 不为0
+    // 打包的缓冲区分配失败时返回 false，此时还没有修改 C
+    TSIMD_DYN_FUNC_ATTR bool gemm_row_major_impl(const size_t M, const size_t N, const size_t K, const float32 alpha, const float32* A, const size_t lda,
+                                                 const float32* B, const size_t ldb, const float32 beta, float32* C, const size_t ldc) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        using blk = gemm_detail::Blocking<op>;
+
+        thread_local gemm_detail::ThreadBuffer a_buffer;
+        thread_local gemm_detail::ThreadBuffer b_buffer;
+
+        const auto round_up = [](const size_t x, const size_t n) { return (x + n - 1) / n * n; };
+        float32* Ap = a_buffer.reserve(round_up(std::min(M, blk::MC), blk::MR) * std::min(K, blk::KC));
+        float32* Bp = b_buffer.reserve(round_up(std::min(N, blk::NC), blk::NR) * std::min(K, blk::KC));
+        if (!Ap || !Bp)
+        {
+            return false;
+        }
+
+        for (size_t jc = 0; jc < N; jc += blk::NC)
+        {
+            const size_t nc = std::min(blk::NC, N - jc);
+            for (size_t pc = 0; pc < K; pc += blk::KC)
+            {
+                const size_t kc = std::min(blk::KC, K - pc);
+                const float32 beta_p = pc == 0 ? beta : 1.0f;
+
+                gemm_detail::pack_b<op>(kc, nc, B + pc * ldb + jc, ldb, Bp);
+                for (size_t ic = 0; ic < M; ic += blk::MC)
+                {
+                    const size_t mc = std::min(blk::MC, M - ic);
+                    gemm_detail::pack_a<op>(mc, kc, A + ic * lda + pc, lda, Ap);
+                    gemm_detail::macro_kernel<op>(mc, nc, kc, Ap, Bp, C + ic * ldc + jc, ldc, alpha, beta_p);
+                }
+            }
+        }
+        return true;
+    }
+
+    TSIMD_DYN_FUNC_ATTR blas::GemmBlocking gemm_blocking_impl() noexcept
+    {
+        using blk = gemm_detail::Blocking<TSIMD_DYN_SIMD_OP(float32)>;
+        return { blk::MR, blk::NR, blk::KC, blk::MC, blk::NC };
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(gemm_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(gemm_blocking_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace blas
+{
+    namespace
+    {
+        // M * N * K 小于这个值时不使用线程池，调度的开销 (微秒级) 与计算时间相当
+        constexpr size_t GemmParallelThreshold = size_t(1) << 21;
+        // 任务数为线程数的倍数，线程之间可以窃取，负载更均衡
+        constexpr size_t GemmTasksPerThread = 2;
+    }
+
+    GemmBlocking gemm_blocking() noexcept
+    {
+        return TSIMD_DYN_CALL(gemm_blocking_impl)();
+    }
+
+    bool gemm(Layout layout, size_t M, size_t N, size_t K, float32 alpha, const float32* A, size_t lda,
+              const float32* B, size_t ldb, float32 beta, float32* C, size_t ldc, ThreadPool* pool) noexcept
+    {
+        // 列主序的 C = A * B 等价于行主序的 C^T = B^T * A^T
+        if (layout == Layout::ColumnMajor)
+        {
+            std::swap(M, N);
+            std::swap(A, B);
+            std::swap(lda, ldb);
+        }
+
+        if (M == 0 || N == 0)
+        {
+            return true;
+        }
+        if (K == 0 || alpha == 0.0f)
+        {
+            for (size_t r = 0; r < M; ++r)
+            {
+                if (beta == 0.0f)
+                {
+                    std::fill_n(C + r * ldc, N, 0.0f);
+                }
+                else if (beta != 1.0f)
+                {
+                    scal(beta, C + r * ldc, N);
+                }
+            }
+            return true;
+        }
+
+        if (pool == nullptr || pool->thread_count() <= 1 || M * N * K < GemmParallelThreshold)
+        {
+            return TSIMD_DYN_CALL(gemm_row_major_impl)(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+
+        // C 按 mc 行 x col_width 列切分，每一块是一个任务，各自打包 A / B
+        const GemmBlocking blocking = gemm_blocking();
+        const size_t row_blocks = (M + blocking.mc - 1) / blocking.mc;
+        const size_t max_col_blocks = (N + blocking.nr - 1) / blocking.nr;
+        const size_t tasks_wanted = pool->thread_count() * GemmTasksPerThread;
+        const size_t col_blocks = std::clamp((tasks_wanted + row_blocks - 1) / row_blocks, size_t(1), max_col_blocks);
+        const size_t col_width = ((N + col_blocks - 1) / col_blocks + blocking.nr - 1) / blocking.nr * blocking.nr;
+        const size_t col_count = (N + col_width - 1) / col_width;
+
+        // 某个线程的缓冲区分配失败时，其他的块仍然会计算，最后返回 false
+        std::atomic<bool> ok{ true };
+        auto task = [&](const size_t begin, const size_t end) noexcept
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                const size_t i0 = t / col_count * blocking.mc;
+                const size_t j0 = t % col_count * col_width;
+                if (!TSIMD_DYN_CALL(gemm_row_major_impl)(std::min(blocking.mc, M - i0), std::min(col_width, N - j0), K, alpha,
+                                                         A + i0 * lda, lda, B + j0, ldb, beta, C + i0 * ldc + j0, ldc))
+                {
+                    ok.store(false, std::memory_order_relaxed);
+                }
+            }
+        };
+        pool->run(0, row_blocks * col_count, 1, 1,
+                  [](void* context, const size_t begin, const size_t end) noexcept
+                  {
+                      (*static_cast<decltype(task)*>(context))(begin, end);
+                  },
+                  &task);
+        return ok.load(std::memory_order_relaxed);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,300 @@
+#include "tSimd/math.hpp"
+
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/math.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+#include "tSimd/batch_math.inl"
+
+// 允许原地计算，所以这里的指针都没有 TMATH_RESTRICT
+// 每个batch先load再store同一段内存，in == out 时也是安全的
+
+// 一元函数: out[i] = func(in[i])
+#undef TSIMD_DETAIL_MATH_UNARY_KERNEL
+#define TSIMD_DETAIL_MATH_UNARY_KERNEL(func) \
+    TSIMD_DYN_FUNC_ATTR void math_##func##_impl(const float32* in, float32* out, const size_t count) noexcept \
+    { \
+        using op = TSIMD_DYN_SIMD_OP(float32); \
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR \
+        { \
+            TSIMD_STORE_BATCH(op, out + i, math::func(op::load_partial(in + i, lanes)), lanes); \
+        })) \
+        { \
+            op::fence(); \
+        } \
+    }
+
+// 二元函数: out[i] = func(a[i], b[i])
+#undef TSIMD_DETAIL_MATH_BINARY_KERNEL
+#define TSIMD_DETAIL_MATH_BINARY_KERNEL(func) \
+    TSIMD_DYN_FUNC_ATTR void math_##func##_impl(const float32* a, const float32* b, float32* out, const size_t count) noexcept \
+    { \
+        using op = TSIMD_DYN_SIMD_OP(float32); \
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR \
+        { \
+            TSIMD_STORE_BATCH(op, out + i, math::func(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes)), lanes); \
+        })) \
+        { \
+            op::fence(); \
+        } \
+    }
+
+// float16 版本: load_f16 -> func -> store_f16，输出是 float16，不使用 stream
+#undef TSIMD_DETAIL_MATH_UNARY_F16_KERNEL
+#define TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(func) \
+    TSIMD_DYN_FUNC_ATTR void math_##func##_f16_impl(const float16* in, float16* out, const size_t count) noexcept \
+    { \
+        using op = TSIMD_DYN_SIMD_OP(float32); \
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR \
+        { \
+            op::store_f16_partial(out + i, math::func(op::load_f16_partial(in + i, lanes)), lanes); \
+        }); \
+    }
+
+#undef TSIMD_DETAIL_MATH_BINARY_F16_KERNEL
+#define TSIMD_DETAIL_MATH_BINARY_F16_KERNEL(func) \
+    TSIMD_DYN_FUNC_ATTR void math_##func##_f16_impl(const float16* a, const float16* b, float16* out, const size_t count) noexcept \
+    { \
+        using op = TSIMD_DYN_SIMD_OP(float32); \
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR \
+        { \
+            op::store_f16_partial(out + i, math::func(op::load_f16_partial(a + i, lanes), op::load_f16_partial(b + i, lanes)), lanes); \
+        }); \
+    }
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(sin)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(cos)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(tan)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(exp)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(exp2)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(log)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(log2)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(atan)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(sqrt)
+    TSIMD_DETAIL_MATH_UNARY_KERNEL(rsqrt)
+
+    TSIMD_DETAIL_MATH_BINARY_KERNEL(pow)
+    TSIMD_DETAIL_MATH_BINARY_KERNEL(atan2)
+
+    TSIMD_DYN_FUNC_ATTR void math_sincos_impl(const float32* in, float32* out_sin, float32* out_cos, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        using batch_t = op::batch_t;
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t s, c;
+            math::sincos(op::load_partial(in + i, lanes), s, c);
+            op::store_partial(out_sin + i, s, lanes);
+            op::store_partial(out_cos + i, c, lanes);
+        });
+    }
+
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(sin)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(cos)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(tan)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(exp)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(exp2)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(log)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(log2)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(atan)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(sqrt)
+    TSIMD_DETAIL_MATH_UNARY_F16_KERNEL(rsqrt)
+
+    TSIMD_DETAIL_MATH_BINARY_F16_KERNEL(pow)
+    TSIMD_DETAIL_MATH_BINARY_F16_KERNEL(atan2)
+
+    TSIMD_DYN_FUNC_ATTR void math_sincos_f16_impl(const float16* in, float16* out_sin, float16* out_cos, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        using batch_t = op::batch_t;
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t s, c;
+            math::sincos(op::load_f16_partial(in + i, lanes), s, c);
+            op::store_f16_partial(out_sin + i, s, lanes);
+            op::store_f16_partial(out_cos + i, c, lanes);
+        });
+    }
+}
+
+#undef TSIMD_DETAIL_MATH_UNARY_KERNEL
+#undef TSIMD_DETAIL_MATH_BINARY_KERNEL
+#undef TSIMD_DETAIL_MATH_UNARY_F16_KERNEL
+#undef TSIMD_DETAIL_MATH_BINARY_F16_KERNEL
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(math_sin_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_cos_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_sincos_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_tan_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_exp_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_exp2_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_log_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_log2_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_pow_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_atan_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_atan2_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_sqrt_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_rsqrt_impl);
+
+TSIMD_DYN_DISPATCH_FUNC(math_sin_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_cos_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_sincos_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_tan_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_exp_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_exp2_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_log_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_log2_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_pow_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_atan_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_atan2_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_sqrt_f16_impl);
+TSIMD_DYN_DISPATCH_FUNC(math_rsqrt_f16_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace math
+{
+    void sin(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sin_impl)(in, out, count);
+    }
+
+    void cos(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_cos_impl)(in, out, count);
+    }
+
+    void sincos(const float32* in, float32* out_sin, float32* out_cos, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sincos_impl)(in, out_sin, out_cos, count);
+    }
+
+    void tan(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_tan_impl)(in, out, count);
+    }
+
+    void exp(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_exp_impl)(in, out, count);
+    }
+
+    void exp2(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_exp2_impl)(in, out, count);
+    }
+
+    void log(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_log_impl)(in, out, count);
+    }
+
+    void log2(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_log2_impl)(in, out, count);
+    }
+
+    void pow(const float32* x, const float32* y, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_pow_impl)(x, y, out, count);
+    }
+
+    void atan(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_atan_impl)(in, out, count);
+    }
+
+    void atan2(const float32* y, const float32* x, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_atan2_impl)(y, x, out, count);
+    }
+
+    void sqrt(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sqrt_impl)(in, out, count);
+    }
+
+    void rsqrt(const float32* in, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_rsqrt_impl)(in, out, count);
+    }
+
+    void sin(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sin_f16_impl)(in, out, count);
+    }
+
+    void cos(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_cos_f16_impl)(in, out, count);
+    }
+
+    void sincos(const float16* in, float16* out_sin, float16* out_cos, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sincos_f16_impl)(in, out_sin, out_cos, count);
+    }
+
+    void tan(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_tan_f16_impl)(in, out, count);
+    }
+
+    void exp(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_exp_f16_impl)(in, out, count);
+    }
+
+    void exp2(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_exp2_f16_impl)(in, out, count);
+    }
+
+    void log(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_log_f16_impl)(in, out, count);
+    }
+
+    void log2(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_log2_f16_impl)(in, out, count);
+    }
+
+    void pow(const float16* x, const float16* y, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_pow_f16_impl)(x, y, out, count);
+    }
+
+    void atan(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_atan_f16_impl)(in, out, count);
+    }
+
+    void atan2(const float16* y, const float16* x, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_atan2_f16_impl)(y, x, out, count);
+    }
+
+    void sqrt(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_sqrt_f16_impl)(in, out, count);
+    }
+
+    void rsqrt(const float16* in, float16* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(math_rsqrt_f16_impl)(in, out, count);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,1063 @@
+#include "tSimd/matrix.hpp"
+#include "tSimd/mat_stream.hpp"
+#include "tSimd/algorithm.hpp"
+
+#include <algorithm>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/matrix.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 允许原地计算，所以这里的指针都没有 TMATH_RESTRICT
+// 每次循环先 load 这一批矩阵的所有输入再 store，out == lhs / rhs 时也是安全的
+// 行主序 C = A * B: C的第i行 = A[i][0] * B的第0行 + ... + A[i][3] * B的第3行
+// 列主序 C = A * B: C的第j列 = B[j][0] * A的第0列 + ... + B[j][3] * A的第3列，即交换参数后的行主序
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    /**
+     * 每一组: s[0] * r0 + (s[1] * r1 + (s[2] * r2 + s[3] * r3))，s[k] 为 s 组内第k个元素
+     * 求和顺序与 tMath 标量版本的折叠表达式相同
+     */
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t mat4_combine(const typename op::batch_t s,
+        const typename op::batch_t r0, const typename op::batch_t r1, const typename op::batch_t r2, const typename op::batch_t r3) noexcept
+    {
+        auto acc = op::mul(op::splat_x4(s, 3), r3);
+        acc = op::mul_add(op::splat_x4(s, 2), r2, acc);
+        acc = op::mul_add(op::splat_x4(s, 1), r1, acc);
+        return op::mul_add(op::splat_x4(s, 0), r0, acc);
+    }
+
+    // 行主序 out[i] = a[i] * b[i]
+    template<typename op>
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_kernel(const float32* a, const float32* b, float32* out, const size_t count) noexcept
+    {
+        if constexpr (op::Lanes >= 4)
+        {
+            constexpr size_t G = op::Lanes / 4;
+
+            for (size_t i = 0; i < count; i += G)
+            {
+                const size_t groups = std::min(G, count - i);
+                const float32* pa = a + i * 16;
+                const float32* pb = b + i * 16;
+                float32* po = out + i * 16;
+
+                const auto b0 = op::load_x4_strided(pb + 0, 16, groups);
+                const auto b1 = op::load_x4_strided(pb + 4, 16, groups);
+                const auto b2 = op::load_x4_strided(pb + 8, 16, groups);
+                const auto b3 = op::load_x4_strided(pb + 12, 16, groups);
+
+                const auto a0 = op::load_x4_strided(pa + 0, 16, groups);
+                const auto a1 = op::load_x4_strided(pa + 4, 16, groups);
+                const auto a2 = op::load_x4_strided(pa + 8, 16, groups);
+                const auto a3 = op::load_x4_strided(pa + 12, 16, groups);
+
+                const auto c0 = mat4_combine<op>(a0, b0, b1, b2, b3);
+                const auto c1 = mat4_combine<op>(a1, b0, b1, b2, b3);
+                const auto c2 = mat4_combine<op>(a2, b0, b1, b2, b3);
+                const auto c3 = mat4_combine<op>(a3, b0, b1, b2, b3);
+
+                op::store_x4_strided(po + 0, 16, c0, groups);
+                op::store_x4_strided(po + 4, 16, c1, groups);
+                op::store_x4_strided(po + 8, 16, c2, groups);
+                op::store_x4_strided(po + 12, 16, c3, groups);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float32* pa = a + i * 16;
+                const float32* pb = b + i * 16;
+
+                float32 c[16];
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    for (size_t col = 0; col < 4; ++col)
+                    {
+                        c[row * 4 + col] = pa[row * 4 + 0] * pb[0 + col] + (pa[row * 4 + 1] * pb[4 + col] +
+                                          (pa[row * 4 + 2] * pb[8 + col] + pa[row * 4 + 3] * pb[12 + col]));
+                    }
+                }
+                std::copy_n(c, 16, out + i * 16);
+            }
+        }
+    }
+
+    // out[i] = m[i] * v[i]
+    template<typename op, bool RowMajor>
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_vec4_kernel(const float32* m, const float32* v, float32* out, const size_t count) noexcept
+    {
+        if constexpr (op::Lanes >= 4)
+        {
+            constexpr size_t G = op::Lanes / 4;
+
+            for (size_t i = 0; i < count; i += G)
+            {
+                const size_t groups = std::min(G, count - i);
+                const float32* pm = m + i * 16;
+
+                // 列主序直接读取到4列，行主序读取4行再转置
+                auto c0 = op::load_x4_strided(pm + 0, 16, groups);
+                auto c1 = op::load_x4_strided(pm + 4, 16, groups);
+                auto c2 = op::load_x4_strided(pm + 8, 16, groups);
+                auto c3 = op::load_x4_strided(pm + 12, 16, groups);
+                if constexpr (RowMajor)
+                {
+                    op::transpose_x4(c0, c1, c2, c3);
+                }
+
+                const auto vv = op::load_x4_strided(v + i * 4, 4, groups);
+                op::store_x4_strided(out + i * 4, 4, mat4_combine<op>(vv, c0, c1, c2, c3), groups);
+            }
+        }
+        else
+        {
+            // 行主序 m[row * 4 + k]，列主序 m[k * 4 + row]
+            constexpr size_t row_stride = RowMajor ? 4 : 1;
+            constexpr size_t k_stride = RowMajor ? 1 : 4;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float32* pm = m + i * 16;
+                const float32* pv = v + i * 4;
+
+                float32 r[4];
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    const float32* p = pm + row * row_stride;
+                    r[row] = p[0] * pv[0] + (p[k_stride] * pv[1] + (p[2 * k_stride] * pv[2] + p[3 * k_stride] * pv[3]));
+                }
+                std::copy_n(r, 4, out + i * 4);
+            }
+        }
+    }
+
+    // ------------------------ 行列式 / 逆矩阵 ------------------------
+    // 每次处理 n (<= Lanes) 个矩阵，e[j] 的第l个lane为第l个矩阵按存储顺序的第j个元素 (SoA)
+    // 这样所有计算都是逐lane的，与标量版本的计算顺序完全相同
+
+    // 第 g * 4 + k 个矩阵在第 g 组，k 相同的矩阵一起读取，返回需要读取的组数
+    constexpr size_t mat4_soa_groups(const size_t n, const size_t k) noexcept
+    {
+        return n > k ? (n - k + 3) / 4 : 0;
+    }
+
+    // 第 k, k + 4, k + 8 ... 个矩阵的同一行，每组4个float，组之间相隔4个矩阵
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t mat4_load_rows(const float32* row, const size_t n, const size_t k) noexcept
+    {
+        const size_t groups = mat4_soa_groups(n, k);
+        return groups > 0 ? op::load_x4_strided(row + k * 16, 64, groups) : op::zero();
+    }
+
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_store_rows(float32* row, const size_t n, const size_t k, const typename op::batch_t x) noexcept
+    {
+        const size_t groups = mat4_soa_groups(n, k);
+        if (groups > 0)
+        {
+            op::store_x4_strided(row + k * 16, 64, x, groups);
+        }
+    }
+
+    // 读取第 r 行: e[r * 4 + c]
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_load_soa_row(const float32* m, const size_t n, const size_t r, typename op::batch_t* e) noexcept
+    {
+        // x_k 的第g组为第 g * 4 + k 个矩阵的第r行，组内转置后第l个lane对应第l个矩阵
+        auto x0 = mat4_load_rows<op>(m + r * 4, n, 0);
+        auto x1 = mat4_load_rows<op>(m + r * 4, n, 1);
+        auto x2 = mat4_load_rows<op>(m + r * 4, n, 2);
+        auto x3 = mat4_load_rows<op>(m + r * 4, n, 3);
+        op::transpose_x4(x0, x1, x2, x3);
+        e[r * 4 + 0] = x0;
+        e[r * 4 + 1] = x1;
+        e[r * 4 + 2] = x2;
+        e[r * 4 + 3] = x3;
+    }
+
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_store_soa_row(float32* m, const size_t n, const size_t r, const typename op::batch_t* e) noexcept
+    {
+        auto x0 = e[r * 4 + 0];
+        auto x1 = e[r * 4 + 1];
+        auto x2 = e[r * 4 + 2];
+        auto x3 = e[r * 4 + 3];
+        op::transpose_x4(x0, x1, x2, x3);
+
+        mat4_store_rows<op>(m + r * 4, n, 0, x0);
+        mat4_store_rows<op>(m + r * 4, n, 1, x1);
+        mat4_store_rows<op>(m + r * 4, n, 2, x2);
+        mat4_store_rows<op>(m + r * 4, n, 3, x3);
+    }
+
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_load_soa(const float32* m, const size_t n, typename op::batch_t (&e)[16]) noexcept
+    {
+        if constexpr (op::Lanes >= 4)
+        {
+            mat4_load_soa_row<op>(m, n, 0, e);
+            mat4_load_soa_row<op>(m, n, 1, e);
+            mat4_load_soa_row<op>(m, n, 2, e);
+            mat4_load_soa_row<op>(m, n, 3, e);
+        }
+        else
+        {
+            (void)n;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                e[j] = op::set(m[j]);
+            }
+        }
+    }
+
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_store_soa(float32* m, const size_t n, const typename op::batch_t (&e)[16]) noexcept
+    {
+        if constexpr (op::Lanes >= 4)
+        {
+            mat4_store_soa_row<op>(m, n, 0, e);
+            mat4_store_soa_row<op>(m, n, 1, e);
+            mat4_store_soa_row<op>(m, n, 2, e);
+            mat4_store_soa_row<op>(m, n, 3, e);
+        }
+        else
+        {
+            (void)n;
+            for (size_t j = 0; j < 16; ++j)
+            {
+                op::store_partial(m + j, e[j], 1);
+            }
+        }
+    }
+
+    // a * b - c * d
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t mat4_minor(const typename op::batch_t a, const typename op::batch_t b,
+                                                        const typename op::batch_t c, const typename op::batch_t d) noexcept
+    {
+        return op::sub(op::mul(a, b), op::mul(c, d));
+    }
+
+    // x * cx - y * cy + z * cz
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t mat4_cofactor(const typename op::batch_t x, const typename op::batch_t cx,
+                                                           const typename op::batch_t y, const typename op::batch_t cy,
+                                                           const typename op::batch_t z, const typename op::batch_t cz) noexcept
+    {
+        return op::add(op::sub(op::mul(x, cx), op::mul(y, cy)), op::mul(z, cz));
+    }
+
+    // 上面两行和下面两行的 2x2 子式，以及行列式
+    template<typename op>
+    struct Mat4Minors
+    {
+        typename op::batch_t s[6];
+        typename op::batch_t c[6];
+        typename op::batch_t det;
+    };
+
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR Mat4Minors<op> mat4_minors(const typename op::batch_t (&a)[16]) noexcept
+    {
+        Mat4Minors<op> r;
+        r.s[0] = mat4_minor<op>(a[0], a[5], a[4], a[1]);
+        r.s[1] = mat4_minor<op>(a[0], a[6], a[4], a[2]);
+        r.s[2] = mat4_minor<op>(a[0], a[7], a[4], a[3]);
+        r.s[3] = mat4_minor<op>(a[1], a[6], a[5], a[2]);
+        r.s[4] = mat4_minor<op>(a[1], a[7], a[5], a[3]);
+        r.s[5] = mat4_minor<op>(a[2], a[7], a[6], a[3]);
+
+        r.c[5] = mat4_minor<op>(a[10], a[15], a[14], a[11]);
+        r.c[4] = mat4_minor<op>(a[9], a[15], a[13], a[11]);
+        r.c[3] = mat4_minor<op>(a[9], a[14], a[13], a[10]);
+        r.c[2] = mat4_minor<op>(a[8], a[15], a[12], a[11]);
+        r.c[1] = mat4_minor<op>(a[8], a[14], a[12], a[10]);
+        r.c[0] = mat4_minor<op>(a[8], a[13], a[12], a[9]);
+
+        // s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0
+        auto det = op::sub(op::mul(r.s[0], r.c[5]), op::mul(r.s[1], r.c[4]));
+        det = op::add(det, op::mul(r.s[2], r.c[3]));
+        det = op::add(det, op::mul(r.s[3], r.c[2]));
+        det = op::sub(det, op::mul(r.s[4], r.c[1]));
+        r.det = op::add(det, op::mul(r.s[5], r.c[0]));
+        return r;
+    }
+
+    template<typename op>
+    TSIMD_DYN_FUNC_ATTR void mat4_determinant_kernel(const float32* m, float32* out, const size_t count) noexcept
+    {
+        typename op::batch_t a[16];
+        for (size_t i = 0; i < count; i += op::Lanes)
+        {
+            const size_t n = std::min(op::Lanes, count - i);
+            mat4_load_soa<op>(m + i * 16, n, a);
+            op::store_partial(out + i, mat4_minors<op>(a).det, n);
+        }
+    }
+
+    // b = a 的逆矩阵，a / b 按存储顺序，行主序和列主序的公式相同 (转置的逆 = 逆的转置)
+    template<typename op>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void mat4_inverse_soa(const typename op::batch_t (&a)[16], typename op::batch_t (&b)[16]) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        const auto minors = mat4_minors<op>(a);
+        const auto& s = minors.s;
+        const auto& c = minors.c;
+        const batch_t inv_det = op::div(op::set(1.0f), minors.det);
+        const batch_t neg_inv_det = op::mul(inv_det, op::set(-1.0f));
+
+        b[0] = op::mul(mat4_cofactor<op>(a[5], c[5], a[6], c[4], a[7], c[3]), inv_det);
+        b[1] = op::mul(mat4_cofactor<op>(a[1], c[5], a[2], c[4], a[3], c[3]), neg_inv_det);
+        b[2] = op::mul(mat4_cofactor<op>(a[13], s[5], a[14], s[4], a[15], s[3]), inv_det);
+        b[3] = op::mul(mat4_cofactor<op>(a[9], s[5], a[10], s[4], a[11], s[3]), neg_inv_det);
+
+        b[4] = op::mul(mat4_cofactor<op>(a[4], c[5], a[6], c[2], a[7], c[1]), neg_inv_det);
+        b[5] = op::mul(mat4_cofactor<op>(a[0], c[5], a[2], c[2], a[3], c[1]), inv_det);
+        b[6] = op::mul(mat4_cofactor<op>(a[12], s[5], a[14], s[2], a[15], s[1]), neg_inv_det);
+        b[7] = op::mul(mat4_cofactor<op>(a[8], s[5], a[10], s[2], a[11], s[1]), inv_det);
+
+        b[8] = op::mul(mat4_cofactor<op>(a[4], c[4], a[5], c[2], a[7], c[0]), inv_det);
+        b[9] = op::mul(mat4_cofactor<op>(a[0], c[4], a[1], c[2], a[3], c[0]), neg_inv_det);
+        b[10] = op::mul(mat4_cofactor<op>(a[12], s[4], a[13], s[2], a[15], s[0]), inv_det);
+        b[11] = op::mul(mat4_cofactor<op>(a[8], s[4], a[9], s[2], a[11], s[0]), neg_inv_det);
+
+        b[12] = op::mul(mat4_cofactor<op>(a[4], c[3], a[5], c[1], a[6], c[0]), neg_inv_det);
+        b[13] = op::mul(mat4_cofactor<op>(a[0], c[3], a[1], c[1], a[2], c[0]), inv_det);
+        b[14] = op::mul(mat4_cofactor<op>(a[12], s[3], a[13], s[1], a[14], s[0]), neg_inv_det);
+        b[15] = op::mul(mat4_cofactor<op>(a[8], s[3], a[9], s[1], a[10], s[0]), inv_det);
+    }
+
+    template<typename op>
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_kernel(const float32* m, float32* out, const size_t count) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        batch_t a[16];
+        batch_t b[16];
+        for (size_t i = 0; i < count; i += op::Lanes)
+        {
+            const size_t n = std::min(op::Lanes, count - i);
+            mat4_load_soa<op>(m + i * 16, n, a);
+            mat4_inverse_soa<op>(a, b);
+            mat4_store_soa<op>(out + i * 16, n, b);
+        }
+    }
+
+    /**
+     * 3x3 的代数余子式 c[r * 3 + col]，返回行列式 (a0 * c00 + a1 * c01) + a2 * c02
+     * 第r行第col列的元素为 a[r * Stride + col]，4x4 矩阵的左上角 Stride 为4
+     */
+    template<typename op, size_t Stride>
+    TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t mat3_cofactors(const typename op::batch_t* a, typename op::batch_t (&c)[9]) noexcept
+    {
+        constexpr size_t R1 = Stride;
+        constexpr size_t R2 = Stride * 2;
+
+        c[0] = mat4_minor<op>(a[R1 + 1], a[R2 + 2], a[R1 + 2], a[R2 + 1]);
+        c[1] = mat4_minor<op>(a[R1 + 2], a[R2 + 0], a[R1 + 0], a[R2 + 2]);
+        c[2] = mat4_minor<op>(a[R1 + 0], a[R2 + 1], a[R1 + 1], a[R2 + 0]);
+        c[3] = mat4_minor<op>(a[2], a[R2 + 1], a[1], a[R2 + 2]);
+        c[4] = mat4_minor<op>(a[0], a[R2 + 2], a[2], a[R2 + 0]);
+        c[5] = mat4_minor<op>(a[1], a[R2 + 0], a[0], a[R2 + 1]);
+        c[6] = mat4_minor<op>(a[1], a[R1 + 2], a[2], a[R1 + 1]);
+        c[7] = mat4_minor<op>(a[2], a[R1 + 0], a[0], a[R1 + 2]);
+        c[8] = mat4_minor<op>(a[0], a[R1 + 1], a[1], a[R1 + 0]);
+
+        return op::add(op::add(op::mul(a[0], c[0]), op::mul(a[1], c[1])), op::mul(a[2], c[2]));
+    }
+
+    // 行主序的平移为 a[3], a[7], a[11]，列主序的平移为 a[12], a[13], a[14]
+    template<typename op, bool RowMajor>
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_affine_kernel(const float32* m, float32* out, const size_t count) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        batch_t a[16];
+        batch_t b[16];
+        for (size_t i = 0; i < count; i += op::Lanes)
+        {
+            const size_t n = std::min(op::Lanes, count - i);
+            mat4_load_soa<op>(m + i * 16, n, a);
+
+            const batch_t zero = op::zero();
+            const batch_t minus_one = op::set(-1.0f);
+            for (size_t r = 0; r < 3; ++r)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    b[r * 4 + c] = a[c * 4 + r];
+                }
+            }
+
+            // t' = -(R^T * t)
+            for (size_t r = 0; r < 3; ++r)
+            {
+                if constexpr (RowMajor)
+                {
+                    const batch_t t = op::add(op::add(op::mul(a[0 * 4 + r], a[3]), op::mul(a[1 * 4 + r], a[7])), op::mul(a[2 * 4 + r], a[11]));
+                    b[r * 4 + 3] = op::mul(t, minus_one);
+                    b[12 + r] = zero;
+                }
+                else
+                {
+                    const batch_t t = op::add(op::add(op::mul(a[r * 4 + 0], a[12]), op::mul(a[r * 4 + 1], a[13])), op::mul(a[r * 4 + 2], a[14]));
+                    b[12 + r] = op::mul(t, minus_one);
+                    b[r * 4 + 3] = zero;
+                }
+            }
+            b[15] = op::set(1.0f);
+
+            mat4_store_soa<op>(out + i * 16, n, b);
+        }
+    }
+
+    template<typename op>
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_transpose_3x3_kernel(const float32* m, float32* out, const size_t count) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        batch_t a[16];
+        batch_t b[16];
+        for (size_t i = 0; i < count; i += op::Lanes)
+        {
+            const size_t n = std::min(op::Lanes, count - i);
+            mat4_load_soa<op>(m + i * 16, n, a);
+
+            // 代数余子式矩阵 / 行列式
+            batch_t c[9];
+            const batch_t det = mat3_cofactors<op, 4>(a, c);
+            const batch_t inv_det = op::div(op::set(1.0f), det);
+            const batch_t zero = op::zero();
+
+            b[0] = op::mul(c[0], inv_det);
+            b[1] = op::mul(c[1], inv_det);
+            b[2] = op::mul(c[2], inv_det);
+            b[3] = zero;
+            b[4] = op::mul(c[3], inv_det);
+            b[5] = op::mul(c[4], inv_det);
+            b[6] = op::mul(c[5], inv_det);
+            b[7] = zero;
+            b[8] = op::mul(c[6], inv_det);
+            b[9] = op::mul(c[7], inv_det);
+            b[10] = op::mul(c[8], inv_det);
+            b[11] = zero;
+            b[12] = zero;
+            b[13] = zero;
+            b[14] = zero;
+            b[15] = op::set(1.0f);
+
+            mat4_store_soa<op>(out + i * 16, n, b);
+        }
+    }
+
+    // ------------------------ SoA 矩阵 (mat_stream.hpp) ------------------------
+    // 每个元素一个数组，e[r * N + c] 的第l个lane就是第 i + l 个矩阵的第r行第c列，不需要转置
+    // 与 AoS 版本相同，一次循环先 load 所有输入再 store，允许 out == a / b
+    // mul / transform 与 mat4_combine 相同，按右折叠的顺序使用 mul_add，逆矩阵 / 行列式不使用 mul_add
+    // 所以结果与 AoS 版本的对应函数完全相同
+    namespace mat_stream_detail
+    {
+        // 循环用 unroll 展开，否则 GCC 不会完全展开 16 次的循环，e 会经过栈上的数组
+        template<typename op, size_t N, typename Lanes>
+        TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void load(const float32* const* m, const size_t i, const Lanes lanes, typename op::batch_t (&e)[N * N]) noexcept
+        {
+            unroll<N * N>([&](const auto j) TSIMD_DYN_FUNC_ATTR
+            {
+                e[j] = op::load_partial(m[j] + i, lanes);
+            });
+        }
+
+        template<typename op, size_t N, typename Lanes>
+        TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR void store(float32* const* m, const size_t i, const Lanes lanes, const typename op::batch_t (&e)[N * N]) noexcept
+        {
+            unroll<N * N>([&](const auto j) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(m[j] + i, e[j], lanes);
+            });
+        }
+
+        // a[0] * b[0] + (a[1] * b[1] + (... + a[N - 1] * b[N - 1]))，b 的步长为 SB
+        template<typename op, size_t N, size_t SB>
+        TMATH_FORCE_INLINE TSIMD_DYN_FUNC_ATTR typename op::batch_t dot(const typename op::batch_t* a, const typename op::batch_t* b) noexcept
+        {
+            auto acc = op::mul(a[N - 1], b[(N - 1) * SB]);
+            for (size_t k = N - 1; k-- > 0;)
+            {
+                acc = op::mul_add(a[k], b[k * SB], acc);
+            }
+            return acc;
+        }
+
+        template<typename op, size_t N>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void mul(const float32* const* a, const float32* const* b, float32* const* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                // b 全部读取，a 每次读取一行: out 的第r行只依赖 a 的第r行，out == a 时逐行覆盖也是安全的
+                batch_t eb[N * N];
+                load<op, N>(b, i, lanes, eb);
+
+                unroll<N>([&](const auto r) TSIMD_DYN_FUNC_ATTR
+                {
+                    batch_t ea[N];
+                    unroll<N>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+                    {
+                        ea[k] = op::load_partial(a[r * N + k] + i, lanes);
+                    });
+                    unroll<N>([&](const auto c) TSIMD_DYN_FUNC_ATTR
+                    {
+                        op::store_partial(out[r * N + c] + i, dot<op, N, N>(ea, eb + c), lanes);
+                    });
+                });
+            });
+        }
+
+        template<typename op, size_t N>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void transpose(const float32* const* m, float32* const* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                batch_t e[N * N];
+                load<op, N>(m, i, lanes, e);
+                unroll<N * N>([&](const auto j) TSIMD_DYN_FUNC_ATTR
+                {
+                    op::store_partial(out[(j % N) * N + j / N] + i, e[j], lanes);
+                });
+            });
+        }
+
+        template<typename op>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void determinant3(const float32* const* m, float32* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                batch_t e[9];
+                batch_t c[9];
+                load<op, 3>(m, i, lanes, e);
+                op::store_partial(out + i, mat3_cofactors<op, 3>(e, c), lanes);
+            });
+        }
+
+        template<typename op>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void determinant4(const float32* const* m, float32* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                batch_t e[16];
+                load<op, 4>(m, i, lanes, e);
+                op::store_partial(out + i, mat4_minors<op>(e).det, lanes);
+            });
+        }
+
+        // 伴随矩阵 / 行列式
+        template<typename op>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void inverse3(const float32* const* m, float32* const* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                batch_t e[9];
+                batch_t c[9];
+                load<op, 3>(m, i, lanes, e);
+                const batch_t inv_det = op::div(op::set(1.0f), mat3_cofactors<op, 3>(e, c));
+
+                // 第r行第col列为 c[col * 3 + r]
+                unroll<9>([&](const auto j) TSIMD_DYN_FUNC_ATTR
+                {
+                    op::store_partial(out[j] + i, op::mul(c[(j % 3) * 3 + j / 3], inv_det), lanes);
+                });
+            });
+        }
+
+        template<typename op>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void inverse4(const float32* const* m, float32* const* out, const size_t count) noexcept
+        {
+            using batch_t = typename op::batch_t;
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                batch_t a[16];
+                batch_t b[16];
+                load<op, 4>(m, i, lanes, a);
+                mat4_inverse_soa<op>(a, b);
+                store<op, 4>(out, i, lanes, b);
+            });
+        }
+
+        // out_r = m[r][0] * x + (m[r][1] * y + (m[r][2] * z + m[r][3]))，与 w = 1 时的 mat4_mul_vec4 相同
+        template<typename op>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void transform_points(const float32* const* m, const float32* const* v, float32* const* out, const size_t count) noexcept
+        {
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                const auto x = op::load_partial(v[0] + i, lanes);
+                const auto y = op::load_partial(v[1] + i, lanes);
+                const auto z = op::load_partial(v[2] + i, lanes);
+
+                typename op::batch_t r[3];
+                unroll<3>([&](const auto row) TSIMD_DYN_FUNC_ATTR
+                {
+                    auto acc = op::mul_add(op::load_partial(m[row * 4 + 2] + i, lanes), z, op::load_partial(m[row * 4 + 3] + i, lanes));
+                    acc = op::mul_add(op::load_partial(m[row * 4 + 1] + i, lanes), y, acc);
+                    r[row] = op::mul_add(op::load_partial(m[row * 4 + 0] + i, lanes), x, acc);
+                });
+
+                op::store_partial(out[0] + i, r[0], lanes);
+                op::store_partial(out[1] + i, r[1], lanes);
+                op::store_partial(out[2] + i, r[2], lanes);
+            });
+        }
+
+        // out_r = m[r][0] * x + (m[r][1] * y + m[r][2] * z)，N 为4时忽略第4行第4列
+        template<typename op, size_t N>
+        TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void transform_vectors(const float32* const* m, const float32* const* v, float32* const* out, const size_t count) noexcept
+        {
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                const typename op::batch_t xyz[3] = {
+                    op::load_partial(v[0] + i, lanes),
+                    op::load_partial(v[1] + i, lanes),
+                    op::load_partial(v[2] + i, lanes)
+                };
+
+                typename op::batch_t r[3];
+                unroll<3>([&](const auto row) TSIMD_DYN_FUNC_ATTR
+                {
+                    const typename op::batch_t mr[3] = {
+                        op::load_partial(m[row * N + 0] + i, lanes),
+                        op::load_partial(m[row * N + 1] + i, lanes),
+                        op::load_partial(m[row * N + 2] + i, lanes)
+                    };
+                    r[row] = dot<op, 3, 1>(mr, xyz);
+                });
+
+                op::store_partial(out[0] + i, r[0], lanes);
+                op::store_partial(out[1] + i, r[1], lanes);
+                op::store_partial(out[2] + i, r[2], lanes);
+            });
+        }
+
+        // 存储顺序的第j个元素在 SoA 中的下标，列主序的第j个元素为第 j % N 行第 j / N 列
+        template<size_t N, bool ColumnMajor>
+        constexpr size_t soa_index(const size_t j) noexcept
+        {
+            return ColumnMajor ? (j % N) * N + j / N : j;
+        }
+
+        // 4x4 复用 AoS 版本的 mat4_load_soa (transpose_x4)，3x3 写成普通的循环由编译器向量化
+        template<typename op, size_t N, bool ColumnMajor>
+        TSIMD_DYN_FUNC_ATTR void import_aos(const float32* aos, float32* const* soa, const size_t count) noexcept
+        {
+            if constexpr (N == 4)
+            {
+                typename op::batch_t e[16];
+                for (size_t i = 0; i < count; i += op::Lanes)
+                {
+                    const size_t n = std::min(op::Lanes, count - i);
+                    mat4_load_soa<op>(aos + i * 16, n, e);
+                    for (size_t j = 0; j < 16; ++j)
+                    {
+                        op::store_partial(soa[soa_index<4, ColumnMajor>(j)] + i, e[j], n);
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    for (size_t j = 0; j < N * N; ++j)
+                    {
+                        soa[soa_index<N, ColumnMajor>(j)][i] = aos[i * N * N + j];
+                    }
+                }
+            }
+        }
+
+        template<typename op, size_t N, bool ColumnMajor>
+        TSIMD_DYN_FUNC_ATTR void export_aos(const float32* const* soa, float32* aos, const size_t count) noexcept
+        {
+            if constexpr (N == 4)
+            {
+                typename op::batch_t e[16];
+                for (size_t i = 0; i < count; i += op::Lanes)
+                {
+                    const size_t n = std::min(op::Lanes, count - i);
+                    for (size_t j = 0; j < 16; ++j)
+                    {
+                        e[j] = op::load_partial(soa[soa_index<4, ColumnMajor>(j)] + i, n);
+                    }
+                    mat4_store_soa<op>(aos + i * 16, n, e);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    for (size_t j = 0; j < N * N; ++j)
+                    {
+                        aos[i * N * N + j] = soa[soa_index<N, ColumnMajor>(j)][i];
+                    }
+                }
+            }
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_row_major_impl(const float32* lhs, const float32* rhs, float32* out, const size_t count) noexcept
+    {
+        mat4_mul_kernel<TSIMD_DYN_SIMD_OP(float32)>(lhs, rhs, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_column_major_impl(const float32* lhs, const float32* rhs, float32* out, const size_t count) noexcept
+    {
+        mat4_mul_kernel<TSIMD_DYN_SIMD_OP(float32)>(rhs, lhs, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_vec4_row_major_impl(const float32* m, const float32* v, float32* out, const size_t count) noexcept
+    {
+        mat4_mul_vec4_kernel<TSIMD_DYN_SIMD_OP(float32), true>(m, v, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_mul_vec4_column_major_impl(const float32* m, const float32* v, float32* out, const size_t count) noexcept
+    {
+        mat4_mul_vec4_kernel<TSIMD_DYN_SIMD_OP(float32), false>(m, v, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_determinant_impl(const float32* m, float32* out, const size_t count) noexcept
+    {
+        mat4_determinant_kernel<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_impl(const float32* m, float32* out, const size_t count) noexcept
+    {
+        mat4_inverse_kernel<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_affine_row_major_impl(const float32* m, float32* out, const size_t count) noexcept
+    {
+        mat4_inverse_affine_kernel<TSIMD_DYN_SIMD_OP(float32), true>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_affine_column_major_impl(const float32* m, float32* out, const size_t count) noexcept
+    {
+        mat4_inverse_affine_kernel<TSIMD_DYN_SIMD_OP(float32), false>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat4_inverse_transpose_3x3_impl(const float32* m, float32* out, const size_t count) noexcept
+    {
+        mat4_inverse_transpose_3x3_kernel<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_mul3_impl(const float32* const* a, const float32* const* b, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::mul<TSIMD_DYN_SIMD_OP(float32), 3>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_mul4_impl(const float32* const* a, const float32* const* b, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::mul<TSIMD_DYN_SIMD_OP(float32), 4>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_transpose3_impl(const float32* const* m, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::transpose<TSIMD_DYN_SIMD_OP(float32), 3>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_transpose4_impl(const float32* const* m, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::transpose<TSIMD_DYN_SIMD_OP(float32), 4>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_determinant3_impl(const float32* const* m, float32* out, const size_t count) noexcept
+    {
+        mat_stream_detail::determinant3<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_determinant4_impl(const float32* const* m, float32* out, const size_t count) noexcept
+    {
+        mat_stream_detail::determinant4<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_inverse3_impl(const float32* const* m, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::inverse3<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_inverse4_impl(const float32* const* m, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::inverse4<TSIMD_DYN_SIMD_OP(float32)>(m, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_transform_points_impl(const float32* const* m, const float32* const* v, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::transform_points<TSIMD_DYN_SIMD_OP(float32)>(m, v, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_transform_vectors3_impl(const float32* const* m, const float32* const* v, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::transform_vectors<TSIMD_DYN_SIMD_OP(float32), 3>(m, v, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_transform_vectors4_impl(const float32* const* m, const float32* const* v, float32* const* out, const size_t count) noexcept
+    {
+        mat_stream_detail::transform_vectors<TSIMD_DYN_SIMD_OP(float32), 4>(m, v, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_import3_row_major_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        mat_stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 3, false>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_import3_column_major_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        mat_stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 3, true>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_import4_row_major_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        mat_stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 4, false>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_import4_column_major_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        mat_stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 4, true>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_export3_row_major_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        mat_stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 3, false>(soa, aos, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_export3_column_major_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        mat_stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 3, true>(soa, aos, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_export4_row_major_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        mat_stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 4, false>(soa, aos, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void mat_stream_export4_column_major_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        mat_stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 4, true>(soa, aos, count);
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(mat4_mul_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_mul_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_mul_vec4_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_mul_vec4_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_determinant_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_inverse_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_inverse_affine_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_inverse_affine_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat4_inverse_transpose_3x3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_mul3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_mul4_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_transpose3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_transpose4_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_determinant3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_determinant4_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_inverse3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_inverse4_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_transform_points_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_transform_vectors3_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_transform_vectors4_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_import3_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_import3_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_import4_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_import4_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_export3_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_export3_column_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_export4_row_major_impl);
+TSIMD_DYN_DISPATCH_FUNC(mat_stream_export4_column_major_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+void mat4_mul_row_major(const float32* lhs, const float32* rhs, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_mul_row_major_impl)(lhs, rhs, out, count);
+}
+
+void mat4_mul_column_major(const float32* lhs, const float32* rhs, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_mul_column_major_impl)(lhs, rhs, out, count);
+}
+
+void mat4_mul_vec4_row_major(const float32* m, const float32* v, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_mul_vec4_row_major_impl)(m, v, out, count);
+}
+
+void mat4_mul_vec4_column_major(const float32* m, const float32* v, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_mul_vec4_column_major_impl)(m, v, out, count);
+}
+
+void mat4_determinant(const float32* m, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_determinant_impl)(m, out, count);
+}
+
+void mat4_inverse(const float32* m, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_inverse_impl)(m, out, count);
+}
+
+void mat4_inverse_affine_row_major(const float32* m, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_inverse_affine_row_major_impl)(m, out, count);
+}
+
+void mat4_inverse_affine_column_major(const float32* m, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_inverse_affine_column_major_impl)(m, out, count);
+}
+
+void mat4_inverse_transpose_3x3(const float32* m, float32* out, size_t count) noexcept
+{
+    TSIMD_DYN_CALL(mat4_inverse_transpose_3x3_impl)(m, out, count);
+}
+
+namespace detail
+{
+    void mat_stream_mul(const float32* const* a, const float32* const* b, float32* const* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(mat_stream_mul3_impl)(a, b, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(mat_stream_mul4_impl)(a, b, out, count);
+        }
+    }
+
+    void mat_stream_transpose(const float32* const* m, float32* const* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(mat_stream_transpose3_impl)(m, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(mat_stream_transpose4_impl)(m, out, count);
+        }
+    }
+
+    void mat_stream_determinant(const float32* const* m, float32* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(mat_stream_determinant3_impl)(m, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(mat_stream_determinant4_impl)(m, out, count);
+        }
+    }
+
+    void mat_stream_inverse(const float32* const* m, float32* const* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(mat_stream_inverse3_impl)(m, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(mat_stream_inverse4_impl)(m, out, count);
+        }
+    }
+
+    void mat_stream_transform_points(const float32* const* m, const float32* const* v, float32* const* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(mat_stream_transform_points_impl)(m, v, out, count);
+    }
+
+    void mat_stream_transform_vectors(const float32* const* m, const float32* const* v, float32* const* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(mat_stream_transform_vectors3_impl)(m, v, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(mat_stream_transform_vectors4_impl)(m, v, out, count);
+        }
+    }
+
+    void mat_stream_import(const float32* aos, float32* const* soa, size_t dims, bool column_major, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            if (column_major)
+            {
+                TSIMD_DYN_CALL(mat_stream_import3_column_major_impl)(aos, soa, count);
+            }
+            else
+            {
+                TSIMD_DYN_CALL(mat_stream_import3_row_major_impl)(aos, soa, count);
+            }
+        }
+        else
+        {
+            if (column_major)
+            {
+                TSIMD_DYN_CALL(mat_stream_import4_column_major_impl)(aos, soa, count);
+            }
+            else
+            {
+                TSIMD_DYN_CALL(mat_stream_import4_row_major_impl)(aos, soa, count);
+            }
+        }
+    }
+
+    void mat_stream_export(const float32* const* soa, float32* aos, size_t dims, bool column_major, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            if (column_major)
+            {
+                TSIMD_DYN_CALL(mat_stream_export3_column_major_impl)(soa, aos, count);
+            }
+            else
+            {
+                TSIMD_DYN_CALL(mat_stream_export3_row_major_impl)(soa, aos, count);
+            }
+        }
+        else
+        {
+            if (column_major)
+            {
+                TSIMD_DYN_CALL(mat_stream_export4_column_major_impl)(soa, aos, count);
+            }
+            else
+            {
+                TSIMD_DYN_CALL(mat_stream_export4_row_major_impl)(soa, aos, count);
+            }
+        }
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
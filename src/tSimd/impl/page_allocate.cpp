@@ -0,0 +1,158 @@
+#include "tSimd/page_allocate.hpp"
+
+#include <cstring>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    constexpr size_t SmallPageSize = 4096;
+
+    constexpr size_t round_up(const size_t n, const size_t alignment) noexcept
+    {
+        return (n + alignment - 1) / alignment * alignment;
+    }
+
+#if defined(__linux__)
+    // 实际映射的大小，deallocate 需要与 allocate 相同
+    size_t mapped_bytes(const size_t bytes, const PageAllocPolicy::HugePage huge_page) noexcept
+    {
+        return round_up(std::max<size_t>(bytes, 1), huge_page == PageAllocPolicy::HugePage::None ? SmallPageSize : HugePageSize);
+    }
+
+    // 多映射 HugePageSize，再把首尾多余的部分 munmap，得到按 2MB 对齐的区域
+    void* mmap_huge_aligned(const size_t bytes) noexcept
+    {
+        void* raw = mmap(nullptr, bytes + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        const auto begin = reinterpret_cast<uintptr_t>(raw);
+        const auto aligned = round_up(begin, HugePageSize);
+        if (aligned != begin)
+        {
+            munmap(raw, aligned - begin);
+        }
+        const size_t tail = begin + bytes + HugePageSize - (aligned + bytes);
+        if (tail != 0)
+        {
+            munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void mbind_node(void* mem, const size_t bytes, const int node) noexcept
+    {
+        constexpr int MPOL_BIND = 2; // linux/mempolicy.h，不依赖 libnuma
+        constexpr size_t MaskBits = sizeof(unsigned long) * 8;
+        if (node < 0 || static_cast<size_t>(node) >= MaskBits)
+        {
+            return;
+        }
+        const unsigned long mask = 1ul << node;
+        // 内核会先把 maxnode 减 1，所以传入 MaskBits + 1 才能使用 mask 的全部位
+        // 绑定只是尽力而为，失败时 (节点不存在 / 没有权限 / 内核不支持 NUMA) 保持默认的分配策略
+        (void)syscall(SYS_mbind, mem, bytes, MPOL_BIND, &mask, MaskBits + 1, 0);
+    }
+#endif
+}
+
+void* PageAllocPolicy::allocate(const size_t bytes) const noexcept
+{
+#if defined(__linux__)
+    const size_t size = detail::mapped_bytes(bytes, huge_page);
+
+    void* mem = nullptr;
+    if (huge_page == HugePage::Explicit)
+    {
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mem == MAP_FAILED)
+        {
+            mem = nullptr;
+        }
+    }
+    if (!mem && huge_page != HugePage::None)
+    {
+        mem = detail::mmap_huge_aligned(size);
+        if (mem)
+        {
+            (void)madvise(mem, size, MADV_HUGEPAGE);
+        }
+    }
+    if (huge_page == HugePage::None)
+    {
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED)
+        {
+            mem = nullptr;
+        }
+    }
+    if (!mem)
+    {
+        return nullptr;
+    }
+
+    // 必须在第一次写入之前绑定
+    detail::mbind_node(mem, size, numa_node);
+#else
+    void* mem = aligned_allocate(detail::round_up(std::max<size_t>(bytes, 1), HugePageSize), HugePageSize);
+    if (!mem)
+    {
+        return nullptr;
+    }
+#endif
+
+    if (first_touch)
+    {
+        tsimd::first_touch(mem, bytes);
+    }
+    return mem;
+}
+
+void PageAllocPolicy::deallocate(void* const mem, const size_t bytes) const noexcept
+{
+    if (!mem)
+    {
+        return;
+    }
+#if defined(__linux__)
+    munmap(mem, detail::mapped_bytes(bytes, huge_page));
+#else
+    aligned_free(mem);
+#endif
+}
+
+void first_touch(void* const mem, const size_t bytes, ThreadPool& pool) noexcept
+{
+    auto* const p = static_cast<std::byte*>(mem);
+    pool.parallel_for<std::byte>(0, bytes, HugePageSize, [p](const size_t begin, const size_t end) noexcept
+    {
+        std::memset(p + begin, 0, end - begin);
+    });
+}
+
+void first_touch(void* const mem, const size_t bytes) noexcept
+{
+    // default_thread_pool() 第一次调用时创建线程，可能抛出 std::system_error
+    ThreadPool* pool = nullptr;
+    try
+    {
+        pool = &default_thread_pool();
+    }
+    catch (...)
+    {
+        std::memset(mem, 0, bytes);
+        return;
+    }
+    first_touch(mem, bytes, *pool);
+}
+
+TSIMD_NAMESPACE_END
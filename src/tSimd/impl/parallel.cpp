@@ -0,0 +1,236 @@
+#include "tSimd/parallel.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    // 当前线程正在执行某个 parallel_for 的分块，嵌套调用时串行执行
+    thread_local bool t_in_parallel_for = false;
+
+    // 每个线程的分块队列，只保存分块序号的区间 [lo, hi)
+    // 独占缓存行，避免不同线程取分块时的伪共享
+    struct alignas(CacheLineSize) ChunkQueue
+    {
+        std::mutex mutex;
+        size_t lo = 0;
+        size_t hi = 0;
+    };
+
+    struct ThreadPoolState
+    {
+        size_t thread_count = 1;
+        std::vector<std::thread> threads;
+        std::unique_ptr<ChunkQueue[]> queues;
+
+        // 同一时间只执行一个 parallel_for
+        std::mutex job_mutex;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        uint64_t generation = 0;
+        size_t active = 0; // 还没有完成当前任务的工作线程 (不包括调用者)
+        bool stop = false;
+
+        // 当前任务，在 generation 增加之前写入
+        ThreadPool::RangeFunc func = nullptr;
+        void* context = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+        size_t aligned_begin = 0;
+        size_t chunk_size = 0;
+
+        ThreadPoolState() = default;
+        ThreadPoolState(const ThreadPoolState&) = delete;
+        ThreadPoolState& operator=(const ThreadPoolState&) = delete;
+
+        // 停止并等待已经启动的工作线程
+        // ThreadPool 的构造函数中创建线程失败 (抛出异常) 时，state_ 被析构，这里也会 join 已经启动的线程
+        ~ThreadPoolState()
+        {
+            {
+                std::lock_guard lock(mutex);
+                stop = true;
+            }
+            wake.notify_all();
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        }
+
+        void run_chunk(const size_t k) const noexcept
+        {
+            const size_t chunk_begin = std::max(begin, aligned_begin + k * chunk_size);
+            const size_t chunk_end = std::min(end, aligned_begin + (k + 1) * chunk_size);
+            func(context, chunk_begin, chunk_end);
+        }
+
+        bool pop(const size_t self, size_t& k) noexcept
+        {
+            ChunkQueue& q = queues[self];
+            std::lock_guard lock(q.mutex);
+            if (q.lo == q.hi)
+            {
+                return false;
+            }
+            k = q.lo++;
+            return true;
+        }
+
+        // 从其他线程的队列拿走后一半 (至少一个) 放入自己的队列，所有队列都为空时返回 false
+        bool steal(const size_t self) noexcept
+        {
+            for (size_t i = 1; i < thread_count; ++i)
+            {
+                ChunkQueue& victim = queues[(self + i) % thread_count];
+                size_t lo, hi;
+                {
+                    std::lock_guard lock(victim.mutex);
+                    if (victim.lo == victim.hi)
+                    {
+                        continue;
+                    }
+                    hi = victim.hi;
+                    lo = victim.lo + (victim.hi - victim.lo) / 2;
+                    victim.hi = lo;
+                }
+
+                // 自己的队列此时为空，其他线程不会从中取走分块
+                ChunkQueue& q = queues[self];
+                std::lock_guard lock(q.mutex);
+                q.lo = lo;
+                q.hi = hi;
+                return true;
+            }
+            return false;
+        }
+
+        void work(const size_t self) noexcept
+        {
+            t_in_parallel_for = true;
+            size_t k;
+            do
+            {
+                while (pop(self, k))
+                {
+                    run_chunk(k);
+                }
+            } while (steal(self));
+            t_in_parallel_for = false;
+        }
+
+        void worker_main(const size_t self) noexcept
+        {
+            uint64_t seen = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock lock(mutex);
+                    wake.wait(lock, [&] { return stop || generation != seen; });
+                    if (stop)
+                    {
+                        return;
+                    }
+                    seen = generation;
+                }
+
+                work(self);
+
+                std::lock_guard lock(mutex);
+                if (--active == 0)
+                {
+                    done.notify_one();
+                }
+            }
+        }
+    };
+}
+
+ThreadPool::ThreadPool(size_t thread_count) : state_(std::make_unique<detail::ThreadPoolState>())
+{
+    if (thread_count == 0)
+    {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    state_->thread_count = thread_count;
+    state_->queues = std::make_unique<detail::ChunkQueue[]>(thread_count);
+    state_->threads.reserve(thread_count - 1);
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        state_->threads.emplace_back([state = state_.get(), i] { state->worker_main(i); });
+    }
+}
+
+// 工作线程由 ThreadPoolState 的析构函数停止
+ThreadPool::~ThreadPool() = default;
+
+size_t ThreadPool::thread_count() const noexcept
+{
+    return state_->thread_count;
+}
+
+void ThreadPool::run(const size_t begin, const size_t end, const size_t grain, size_t boundary, const RangeFunc func, void* const context) noexcept
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    boundary = std::max<size_t>(boundary, 1);
+    const size_t chunk_size = (std::max<size_t>(grain, 1) + boundary - 1) / boundary * boundary;
+    const size_t aligned_begin = begin - begin % boundary;
+    const size_t chunk_count = (end - aligned_begin + chunk_size - 1) / chunk_size;
+
+    auto& s = *state_;
+    if (chunk_count <= 1 || s.thread_count <= 1 || detail::t_in_parallel_for)
+    {
+        func(context, begin, end);
+        return;
+    }
+
+    std::lock_guard job_lock(s.job_mutex);
+
+    // 每个线程分到连续的一段分块，多出来的分块给前面的线程
+    const size_t thread_count = std::min(s.thread_count, chunk_count);
+    for (size_t i = 0; i < s.thread_count; ++i)
+    {
+        auto& q = s.queues[i];
+        std::lock_guard lock(q.mutex);
+        q.lo = i < thread_count ? chunk_count * i / thread_count : 0;
+        q.hi = i < thread_count ? chunk_count * (i + 1) / thread_count : 0;
+    }
+
+    {
+        std::lock_guard lock(s.mutex);
+        s.func = func;
+        s.context = context;
+        s.begin = begin;
+        s.end = end;
+        s.aligned_begin = aligned_begin;
+        s.chunk_size = chunk_size;
+        s.active = s.thread_count - 1;
+        ++s.generation;
+    }
+    s.wake.notify_all();
+
+    s.work(0);
+
+    std::unique_lock lock(s.mutex);
+    s.done.wait(lock, [&] { return s.active == 0; });
+}
+
+ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+TSIMD_NAMESPACE_END
@@ -0,0 +1,253 @@
+#include "tSimd/quat.hpp"
+
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/quat.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+#include "tSimd/batch_math.inl"
+
+// 允许原地计算，所以这里的指针都没有 TMATH_RESTRICT
+// 每个batch先load所有输入再store，out == a / b 时也是安全的
+// mul / rotate / nlerp 的计算顺序与 tMath (quat.hpp) 相同，并且不使用 mul_add，保证结果与标量版本相同
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    namespace quat_detail
+    {
+        template<typename op>
+        struct Quat
+        {
+            typename op::batch_t x, y, z, w;
+        };
+
+        template<typename op, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Quat<op> load(const float32* const* q, const size_t i, const Lanes lanes) noexcept
+        {
+            return {
+                op::load_partial(q[0] + i, lanes),
+                op::load_partial(q[1] + i, lanes),
+                op::load_partial(q[2] + i, lanes),
+                op::load_partial(q[3] + i, lanes)
+            };
+        }
+
+        template<typename op, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE void store(float32* const* out, const size_t i, const Quat<op>& q, const Lanes lanes) noexcept
+        {
+            op::store_partial(out[0] + i, q.x, lanes);
+            op::store_partial(out[1] + i, q.y, lanes);
+            op::store_partial(out[2] + i, q.z, lanes);
+            op::store_partial(out[3] + i, q.w, lanes);
+        }
+
+        // ((ax*bx + ay*by) + az*bz) + aw*bw
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t dot(const Quat<op>& a, const Quat<op>& b) noexcept
+        {
+            return op::add(op::add(op::add(op::mul(a.x, b.x), op::mul(a.y, b.y)), op::mul(a.z, b.z)), op::mul(a.w, b.w));
+        }
+
+        // a * k0 + b * k1
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Quat<op> blend(const Quat<op>& a, const Quat<op>& b,
+                                                               const typename op::batch_t k0, const typename op::batch_t k1) noexcept
+        {
+            return {
+                op::add(op::mul(a.x, k0), op::mul(b.x, k1)),
+                op::add(op::mul(a.y, k0), op::mul(b.y, k1)),
+                op::add(op::mul(a.z, k0), op::mul(b.z, k1)),
+                op::add(op::mul(a.w, k0), op::mul(b.w, k1))
+            };
+        }
+
+        // 与 tMath 相同，除以 sqrt 而不是乘以 rsqrt 的近似值
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Quat<op> normalize(const Quat<op>& q) noexcept
+        {
+            const auto inv = op::div(op::set(1.0f), op::sqrt(dot(q, q)));
+            return { op::mul(q.x, inv), op::mul(q.y, inv), op::mul(q.z, inv), op::mul(q.w, inv) };
+        }
+
+        // dot < 0 ? -1 : 1
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t shortest_path_sign(const typename op::batch_t d) noexcept
+        {
+            return op::select(op::cmp_lt(d, op::zero()), op::set(-1.0f), op::set(1.0f));
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void quat_mul_impl(const float32* const* pa, const float32* const* pb, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto a = quat_detail::load<op>(pa, i, lanes);
+            const auto b = quat_detail::load<op>(pb, i, lanes);
+
+            const quat_detail::Quat<op> r = {
+                op::sub(op::add(op::add(op::mul(a.w, b.x), op::mul(a.x, b.w)), op::mul(a.y, b.z)), op::mul(a.z, b.y)),
+                op::add(op::add(op::sub(op::mul(a.w, b.y), op::mul(a.x, b.z)), op::mul(a.y, b.w)), op::mul(a.z, b.x)),
+                op::add(op::sub(op::add(op::mul(a.w, b.z), op::mul(a.x, b.y)), op::mul(a.y, b.x)), op::mul(a.z, b.w)),
+                op::sub(op::sub(op::sub(op::mul(a.w, b.w), op::mul(a.x, b.x)), op::mul(a.y, b.y)), op::mul(a.z, b.z))
+            };
+            quat_detail::store<op>(out, i, r, lanes);
+        });
+    }
+
+    // t = 2 * cross(q.xyz, v), v' = v + w * t + cross(q.xyz, t)
+    TSIMD_DYN_FUNC_ATTR void quat_rotate_impl(const float32* const* pq, const float32* const* pv, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto two = op::set(2.0f);
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto q = quat_detail::load<op>(pq, i, lanes);
+            const auto vx = op::load_partial(pv[0] + i, lanes);
+            const auto vy = op::load_partial(pv[1] + i, lanes);
+            const auto vz = op::load_partial(pv[2] + i, lanes);
+
+            const auto tx = op::mul(op::sub(op::mul(q.y, vz), op::mul(q.z, vy)), two);
+            const auto ty = op::mul(op::sub(op::mul(q.z, vx), op::mul(q.x, vz)), two);
+            const auto tz = op::mul(op::sub(op::mul(q.x, vy), op::mul(q.y, vx)), two);
+
+            op::store_partial(out[0] + i, op::add(op::add(vx, op::mul(q.w, tx)), op::sub(op::mul(q.y, tz), op::mul(q.z, ty))), lanes);
+            op::store_partial(out[1] + i, op::add(op::add(vy, op::mul(q.w, ty)), op::sub(op::mul(q.z, tx), op::mul(q.x, tz))), lanes);
+            op::store_partial(out[2] + i, op::add(op::add(vz, op::mul(q.w, tz)), op::sub(op::mul(q.x, ty), op::mul(q.y, tx))), lanes);
+        });
+    }
+
+    TSIMD_DYN_FUNC_ATTR void quat_nlerp_impl(const float32* const* pa, const float32* const* pb, const float32 t, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto k0 = op::set(1.0f - t);
+        const auto vt = op::set(t);
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto a = quat_detail::load<op>(pa, i, lanes);
+            const auto b = quat_detail::load<op>(pb, i, lanes);
+            const auto k1 = op::mul(vt, quat_detail::shortest_path_sign<op>(quat_detail::dot(a, b)));
+            quat_detail::store<op>(out, i, quat_detail::normalize(quat_detail::blend(a, b, k0, k1)), lanes);
+        });
+    }
+
+    /**
+     * theta = atan2(sqrt(1 - d^2), d)，k0 = sin((1 - t) * theta) / sin(theta)，k1 = sin(t * theta) / sin(theta)
+     * |d| > 0.9995 的lane使用 nlerp 的系数并归一化
+     */
+    TSIMD_DYN_FUNC_ATTR void quat_slerp_exact_impl(const float32* const* pa, const float32* const* pb, const float32 t, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto one = op::set(1.0f);
+        const auto vt = op::set(t);
+        const auto one_minus_t = op::set(1.0f - t);
+        const auto threshold = op::set(0.9995f);
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto a = quat_detail::load<op>(pa, i, lanes);
+            const auto b = quat_detail::load<op>(pb, i, lanes);
+
+            const auto d = quat_detail::dot(a, b);
+            const auto sign = quat_detail::shortest_path_sign<op>(d);
+            const auto cos_theta = op::abs(d);
+            const auto is_near = op::cmp_gt(cos_theta, threshold);
+
+            const auto sin_theta = op::sqrt(op::sub(one, op::mul(cos_theta, cos_theta)));
+            const auto theta = math::atan2(sin_theta, cos_theta);
+            const auto inv_sin_theta = op::div(one, sin_theta);
+            const auto k0 = op::mul(math::sin(op::mul(one_minus_t, theta)), inv_sin_theta);
+            const auto k1 = op::mul(math::sin(op::mul(vt, theta)), inv_sin_theta);
+
+            const auto r = quat_detail::blend(a, b, op::select(is_near, one_minus_t, k0), op::mul(op::select(is_near, vt, k1), sign));
+            const auto inv = op::select(is_near, op::div(one, op::sqrt(quat_detail::dot(r, r))), one);
+            quat_detail::store<op>(out, i, { op::mul(r.x, inv), op::mul(r.y, inv), op::mul(r.z, inv), op::mul(r.w, inv) }, lanes);
+        });
+    }
+
+    /**
+     * 对 t 做三次多项式修正后的 nlerp: t' = t + t * (t - 0.5) * (t - 1) * k(|d|, t)
+     * k 的系数按 |d| 拟合，使 nlerp(t') 的角度接近 slerp(t)，没有三角函数和除以 sin(theta)
+     * 参考: Arseny Kapoulkine, "Approximating slerp"
+     */
+    TSIMD_DYN_FUNC_ATTR void quat_slerp_fast_impl(const float32* const* pa, const float32* const* pb, const float32 t, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        // t 是标量，只有 k 需要逐lane计算
+        const float32 h = t - 0.5f;
+        const auto h2 = op::set(h * h);
+        const auto th = op::set(t * h * (t - 1.0f));
+        const auto vt = op::set(t);
+        const auto one = op::set(1.0f);
+
+        const auto a0 = op::set(1.0904f), a1 = op::set(-3.2452f), a2 = op::set(3.55645f), a3 = op::set(-1.43519f);
+        const auto b0 = op::set(0.848013f), b1 = op::set(-1.06021f), b2 = op::set(0.215638f);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto a = quat_detail::load<op>(pa, i, lanes);
+            const auto b = quat_detail::load<op>(pb, i, lanes);
+
+            const auto d = quat_detail::dot(a, b);
+            const auto ad = op::abs(d);
+            const auto ka = op::mul_add(op::mul_add(op::mul_add(a3, ad, a2), ad, a1), ad, a0);
+            const auto kb = op::mul_add(op::mul_add(b2, ad, b1), ad, b0);
+            const auto k = op::mul_add(ka, h2, kb);
+            const auto ot = op::mul_add(th, k, vt);
+
+            const auto k1 = op::mul(ot, quat_detail::shortest_path_sign<op>(d));
+            quat_detail::store<op>(out, i, quat_detail::normalize(quat_detail::blend(a, b, op::sub(one, ot), k1)), lanes);
+        });
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(quat_mul_impl);
+TSIMD_DYN_DISPATCH_FUNC(quat_rotate_impl);
+TSIMD_DYN_DISPATCH_FUNC(quat_nlerp_impl);
+TSIMD_DYN_DISPATCH_FUNC(quat_slerp_exact_impl);
+TSIMD_DYN_DISPATCH_FUNC(quat_slerp_fast_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    void quat_mul(const float32* const* a, const float32* const* b, float32* const* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(quat_mul_impl)(a, b, out, count);
+    }
+
+    void quat_rotate(const float32* const* q, const float32* const* v, float32* const* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(quat_rotate_impl)(q, v, out, count);
+    }
+
+    void quat_nlerp(const float32* const* a, const float32* const* b, float32 t, float32* const* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(quat_nlerp_impl)(a, b, t, out, count);
+    }
+
+    void quat_slerp(const float32* const* a, const float32* const* b, float32 t, float32* const* out, size_t count, QuatAccuracy accuracy) noexcept
+    {
+        if (accuracy == QuatAccuracy::Fast)
+        {
+            TSIMD_DYN_CALL(quat_slerp_fast_impl)(a, b, t, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(quat_slerp_exact_impl)(a, b, t, out, count);
+        }
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,218 @@
+#include "tSimd/ray.hpp"
+#include "tSimd/algorithm.hpp"
+
+#include <bit>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/ray.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 每个batch为一个光线包: 先load光线和当前最近的交点，再依次与所有图元求交，最后store一次
+// 图元的数据用 set 广播到所有lane，计算顺序与 tMath (ray.hpp) 相同，不使用 mul_add
+// 图元下标按位存放在 float32 的lane中 (std::bit_cast)，select 按位选择，不会改变下标
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    namespace ray_detail
+    {
+        template<typename op>
+        struct Vec3
+        {
+            typename op::batch_t x, y, z;
+        };
+
+        template<typename op, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Vec3<op> load(const float32* const* p, const size_t i, const Lanes lanes) noexcept
+        {
+            return { op::load_partial(p[0] + i, lanes), op::load_partial(p[1] + i, lanes), op::load_partial(p[2] + i, lanes) };
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Vec3<op> broadcast(const float32* p) noexcept
+        {
+            return { op::set(p[0]), op::set(p[1]), op::set(p[2]) };
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Vec3<op> sub(const Vec3<op>& a, const Vec3<op>& b) noexcept
+        {
+            return { op::sub(a.x, b.x), op::sub(a.y, b.y), op::sub(a.z, b.z) };
+        }
+
+        // (a.x*b.x + a.y*b.y) + a.z*b.z
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t dot(const Vec3<op>& a, const Vec3<op>& b) noexcept
+        {
+            return op::add(op::add(op::mul(a.x, b.x), op::mul(a.y, b.y)), op::mul(a.z, b.z));
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE Vec3<op> cross(const Vec3<op>& a, const Vec3<op>& b) noexcept
+        {
+            return {
+                op::sub(op::mul(a.y, b.z), op::mul(a.z, b.y)),
+                op::sub(op::mul(a.z, b.x), op::mul(a.x, b.z)),
+                op::sub(op::mul(a.x, b.y), op::mul(a.y, b.x))
+            };
+        }
+
+        // uint32 的下标 <-> float32 的lane，只用来搬运，不参与计算
+        template<typename op, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t load_prim(const uint32* prim, const Lanes lanes) noexcept
+        {
+            alignas(64) float32 tmp[op::Lanes] = {};
+            for (size_t k = 0; k < lanes; ++k)
+            {
+                tmp[k] = std::bit_cast<float32>(prim[k]);
+            }
+            return op::load(tmp);
+        }
+
+        template<typename op, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE void store_prim(uint32* prim, const typename op::batch_t v, const Lanes lanes) noexcept
+        {
+            alignas(64) float32 tmp[op::Lanes];
+            op::store(tmp, v);
+            for (size_t k = 0; k < lanes; ++k)
+            {
+                prim[k] = std::bit_cast<uint32>(tmp[k]);
+            }
+        }
+
+        template<typename op>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE typename op::batch_t prim_index(const size_t j) noexcept
+        {
+            return op::set(std::bit_cast<float32>(static_cast<uint32>(j)));
+        }
+    }
+
+    /**
+     * Möller–Trumbore: p = cross(d, e2)，det = dot(e1, p)，s = o - v0，q = cross(s, e1)
+     * u = dot(s, p) / det，v = dot(d, q) / det，t = dot(e2, q) / det
+     */
+    TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void intersect_triangles_impl(const float32* const* origin, const float32* const* direction, const float32 t_min,
+                                                                    const float32* triangles, const size_t triangle_count,
+                                                                    float32* t, float32* u, float32* v, uint32* prim, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        using namespace ray_detail;
+
+        const auto zero = op::zero();
+        const auto one = op::set(1.0f);
+        const auto vt_min = op::set(t_min);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto o = load<op>(origin, i, lanes);
+            const auto d = load<op>(direction, i, lanes);
+            auto best_t = op::load_partial(t + i, lanes);
+            auto best_u = op::load_partial(u + i, lanes);
+            auto best_v = op::load_partial(v + i, lanes);
+            auto best_prim = load_prim<op>(prim + i, lanes);
+
+            for (size_t j = 0; j < triangle_count; ++j)
+            {
+                const float32* tri = triangles + j * 9;
+                const auto v0 = broadcast<op>(tri);
+                const auto e1 = sub(broadcast<op>(tri + 3), v0);
+                const auto e2 = sub(broadcast<op>(tri + 6), v0);
+
+                const auto p = cross(d, e2);
+                const auto inv_det = op::div(one, dot(e1, p));
+                const auto s = sub(o, v0);
+                const auto hu = op::mul(dot(s, p), inv_det);
+                const auto q = cross(s, e1);
+                const auto hv = op::mul(dot(d, q), inv_det);
+                const auto ht = op::mul(dot(e2, q), inv_det);
+
+                // det == 0 时 u / v 为 inf 或 NaN，比较不会成立
+                const auto hit = op::mask_and(op::mask_and(op::mask_and(op::cmp_ge(hu, zero), op::cmp_ge(hv, zero)),
+                                                           op::cmp_le(op::add(hu, hv), one)),
+                                              op::mask_and(op::cmp_gt(ht, vt_min), op::cmp_lt(ht, best_t)));
+                best_t = op::select(hit, ht, best_t);
+                best_u = op::select(hit, hu, best_u);
+                best_v = op::select(hit, hv, best_v);
+                best_prim = op::select(hit, prim_index<op>(j), best_prim);
+            }
+
+            op::store_partial(t + i, best_t, lanes);
+            op::store_partial(u + i, best_u, lanes);
+            op::store_partial(v + i, best_v, lanes);
+            store_prim<op>(prim + i, best_prim, lanes);
+        });
+    }
+
+    /**
+     * slab: 每个轴上 t0 = (min - o) / d，t1 = (max - o) / d
+     * t_near = max(min(t0, t1)) 与 t_min 的最大值，t_far = min(max(t0, t1))，t_near <= t_far 时相交
+     */
+    TMATH_FLATTEN TSIMD_DYN_FUNC_ATTR void intersect_aabbs_impl(const float32* const* origin, const float32* const* direction, const float32 t_min,
+                                                                const float32* boxes, const size_t box_count,
+                                                                float32* t, uint32* prim, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+        using namespace ray_detail;
+
+        const auto one = op::set(1.0f);
+        const auto vt_min = op::set(t_min);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto o = load<op>(origin, i, lanes);
+            const auto d = load<op>(direction, i, lanes);
+            const Vec3<op> inv = { op::div(one, d.x), op::div(one, d.y), op::div(one, d.z) };
+            auto best_t = op::load_partial(t + i, lanes);
+            auto best_prim = load_prim<op>(prim + i, lanes);
+
+            for (size_t j = 0; j < box_count; ++j)
+            {
+                const float32* box = boxes + j * 6;
+                const auto b0 = sub(broadcast<op>(box), o);
+                const auto b1 = sub(broadcast<op>(box + 3), o);
+                const Vec3<op> t0 = { op::mul(b0.x, inv.x), op::mul(b0.y, inv.y), op::mul(b0.z, inv.z) };
+                const Vec3<op> t1 = { op::mul(b1.x, inv.x), op::mul(b1.y, inv.y), op::mul(b1.z, inv.z) };
+
+                const auto t_near = op::max(op::max(op::max(op::min(t0.x, t1.x), op::min(t0.y, t1.y)), op::min(t0.z, t1.z)), vt_min);
+                const auto t_far = op::min(op::min(op::max(t0.x, t1.x), op::max(t0.y, t1.y)), op::max(t0.z, t1.z));
+
+                const auto hit = op::mask_and(op::cmp_le(t_near, t_far), op::cmp_lt(t_near, best_t));
+                best_t = op::select(hit, t_near, best_t);
+                best_prim = op::select(hit, prim_index<op>(j), best_prim);
+            }
+
+            op::store_partial(t + i, best_t, lanes);
+            store_prim<op>(prim + i, best_prim, lanes);
+        });
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(intersect_triangles_impl);
+TSIMD_DYN_DISPATCH_FUNC(intersect_aabbs_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    void intersect_triangles(const float32* const* origin, const float32* const* direction, float32 t_min,
+                             const float32* triangles, size_t triangle_count,
+                             float32* t, float32* u, float32* v, uint32* prim, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(intersect_triangles_impl)(origin, direction, t_min, triangles, triangle_count, t, u, v, prim, count);
+    }
+
+    void intersect_aabbs(const float32* const* origin, const float32* const* direction, float32 t_min,
+                         const float32* boxes, size_t box_count,
+                         float32* t, uint32* prim, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(intersect_aabbs_impl)(origin, direction, t_min, boxes, box_count, t, prim, count);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -0,0 +1,296 @@
+#include "tSimd/reduce.hpp"
+
+#include <cmath>
+
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/reduce.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 求和的三种方式共用下面两个函数对象 (见 reduce_sum_mode):
+// term(i, lanes):      [i, i + lanes) 这一段的项，例如 dot 的 a * b，末尾不足一个batch的部分为0
+// step(acc, i, lanes): acc + term(i, lanes)，dot 使用 mul_add，少一次舍入
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // add 的延迟 3~4 个周期，每个周期可以发射 2 条，至少需要 8 个累加器才能跑满
+    constexpr size_t ReduceUnroll = 8;
+    // Kahan 每个累加器需要两个寄存器
+    constexpr size_t KahanUnroll = 4;
+    constexpr size_t PairwiseBlock = 1024;
+
+    // [begin, end) 的和，ReduceUnroll 个累加器最后两两合并，返回合并后的batch
+    template<typename op, typename Step>
+    TSIMD_DYN_FUNC_ATTR typename op::batch_t sum_fast(const size_t begin, const size_t end, Step& step) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        batch_t acc[ReduceUnroll];
+        unroll<ReduceUnroll>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            acc[k] = op::zero();
+        });
+
+        for_each_batch_unrolled<op, ReduceUnroll>(end - begin, [&](const auto k, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            acc[k] = step(acc[k], begin + i, lanes);
+        });
+
+        unroll<ReduceUnroll / 2>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            acc[k] = op::add(acc[k], acc[k + ReduceUnroll / 2]);
+        });
+        unroll<ReduceUnroll / 4>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            acc[k] = op::add(acc[k], acc[k + ReduceUnroll / 4]);
+        });
+        return op::add(acc[0], acc[1]);
+    }
+
+    // 按 PairwiseBlock 的整数倍二分，每一块用 sum_fast
+    template<typename op, typename Step>
+    TSIMD_DYN_FUNC_ATTR typename op::batch_t sum_pairwise(const size_t begin, const size_t end, Step& step) noexcept
+    {
+        const size_t count = end - begin;
+        if (count <= PairwiseBlock)
+        {
+            return sum_fast<op>(begin, end, step);
+        }
+
+        const size_t blocks = (count + PairwiseBlock - 1) / PairwiseBlock;
+        const size_t mid = begin + blocks / 2 * PairwiseBlock;
+        return op::add(sum_pairwise<op>(begin, mid, step), sum_pairwise<op>(mid, end, step));
+    }
+
+    // 每个lane是一个独立的 Kahan 累加器，最后用 float64 合并所有lane (s - c)
+    // 依赖 (t - s) - y 不被化简，不能使用 -ffast-math
+    template<typename op, typename Term>
+    TSIMD_DYN_FUNC_ATTR float32 sum_kahan(const size_t count, Term& term) noexcept
+    {
+        using batch_t = typename op::batch_t;
+        constexpr size_t L = op::Lanes;
+        constexpr size_t Block = KahanUnroll * L;
+
+        batch_t s[KahanUnroll];
+        batch_t c[KahanUnroll];
+        unroll<KahanUnroll>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            s[k] = op::zero();
+            c[k] = op::zero();
+        });
+
+        const auto kahan_add = [](batch_t& sum, batch_t& comp, const batch_t x) TSIMD_DYN_FUNC_ATTR
+        {
+            const batch_t y = op::sub(x, comp);
+            const batch_t t = op::add(sum, y);
+            comp = op::sub(op::sub(t, sum), y);
+            sum = t;
+        };
+
+        for_each_batch_unrolled<op, KahanUnroll>(count, [&](const auto k, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            kahan_add(s[k], c[k], term(i, lanes));
+        });
+
+        alignas(op::BatchAlignment) float32 sv[Block];
+        alignas(op::BatchAlignment) float32 cv[Block];
+        unroll<KahanUnroll>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            op::store(sv + k * L, s[k]);
+            op::store(cv + k * L, c[k]);
+        });
+
+        float64 total = 0.0;
+        for (size_t j = 0; j < Block; ++j)
+        {
+            total += static_cast<float64>(sv[j]) - static_cast<float64>(cv[j]);
+        }
+        return static_cast<float32>(total);
+    }
+
+    template<typename op, typename Term, typename Step>
+    TSIMD_DYN_FUNC_ATTR float32 reduce_sum_mode(const size_t count, const reduce::Mode mode, Term& term, Step& step) noexcept
+    {
+        switch (mode)
+        {
+        case reduce::Mode::Kahan:
+            return sum_kahan<op>(count, term);
+        case reduce::Mode::Pairwise:
+            return op::reduce_sum(sum_pairwise<op>(0, count, step));
+        default:
+            return op::reduce_sum(sum_fast<op>(0, count, step));
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 reduce_sum_impl(const float32* in, const size_t count, const reduce::Mode mode) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        auto term = [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            return op::load_partial(in + i, lanes);
+        };
+        auto step = [&](const op::batch_t acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            return op::add(acc, op::load_partial(in + i, lanes));
+        };
+        return reduce_sum_mode<op>(count, mode, term, step);
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 reduce_dot_impl(const float32* a, const float32* b, const size_t count, const reduce::Mode mode) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        auto term = [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            return op::mul(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes));
+        };
+        auto step = [&](const op::batch_t acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            return op::mul_add(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes), acc);
+        };
+        return reduce_sum_mode<op>(count, mode, term, step);
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 reduce_norm2_impl(const float32* in, const size_t count, const reduce::Mode mode) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        auto term = [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto x = op::load_partial(in + i, lanes);
+            return op::mul(x, x);
+        };
+        auto step = [&](const op::batch_t acc, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto x = op::load_partial(in + i, lanes);
+            return op::mul_add(x, x, acc);
+        };
+        return std::sqrt(reduce_sum_mode<op>(count, mode, term, step));
+    }
+
+    // 比较的结果为 false 时保留累加器，NaN 永远不会被选中
+    // 末尾不足一个batch时，重新读取最后 Lanes 个元素 (与前面重叠，不影响 min / max)
+    template<typename op, bool Min, bool Max>
+    TSIMD_DYN_FUNC_ATTR reduce::MinMax reduce_min_max(const float32* in, const size_t count) noexcept
+    {
+        using batch_t = typename op::batch_t;
+        constexpr size_t L = op::Lanes;
+        // min / max 同时计算时寄存器翻倍，累加器减半
+        constexpr size_t U = (Min && Max) ? ReduceUnroll / 2 : ReduceUnroll;
+
+        reduce::MinMax result;
+        if (count < L)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                result.min = in[i] < result.min ? in[i] : result.min;
+                result.max = in[i] > result.max ? in[i] : result.max;
+            }
+            return result;
+        }
+
+        batch_t lo[U];
+        batch_t hi[U];
+        unroll<U>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            lo[k] = op::set(result.min);
+            hi[k] = op::set(result.max);
+        });
+
+        const auto update = [](batch_t& lo_k, batch_t& hi_k, const batch_t x) TSIMD_DYN_FUNC_ATTR
+        {
+            if constexpr (Min)
+            {
+                lo_k = op::select(op::cmp_lt(x, lo_k), x, lo_k);
+            }
+            if constexpr (Max)
+            {
+                hi_k = op::select(op::cmp_gt(x, hi_k), x, hi_k);
+            }
+        };
+
+        for_each_batch_unrolled<op, U>(count, [&](const auto k, const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            // lanes 为 size_t 时是末尾不足一个batch的部分
+            const float32* p = std::is_integral_v<decltype(lanes)> ? in + count - L : in + i;
+            update(lo[k], hi[k], op::loadu(p));
+        });
+
+        unroll<U - 1>([&](const auto k) TSIMD_DYN_FUNC_ATTR
+        {
+            lo[0] = op::select(op::cmp_lt(lo[k + 1], lo[0]), lo[k + 1], lo[0]);
+            hi[0] = op::select(op::cmp_gt(hi[k + 1], hi[0]), hi[k + 1], hi[0]);
+        });
+        result.min = op::reduce_min(lo[0]);
+        result.max = op::reduce_max(hi[0]);
+        return result;
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 reduce_min_impl(const float32* in, const size_t count) noexcept
+    {
+        return reduce_min_max<TSIMD_DYN_SIMD_OP(float32), true, false>(in, count).min;
+    }
+
+    TSIMD_DYN_FUNC_ATTR float32 reduce_max_impl(const float32* in, const size_t count) noexcept
+    {
+        return reduce_min_max<TSIMD_DYN_SIMD_OP(float32), false, true>(in, count).max;
+    }
+
+    TSIMD_DYN_FUNC_ATTR reduce::MinMax reduce_minmax_impl(const float32* in, const size_t count) noexcept
+    {
+        return reduce_min_max<TSIMD_DYN_SIMD_OP(float32), true, true>(in, count);
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(reduce_sum_impl);
+TSIMD_DYN_DISPATCH_FUNC(reduce_dot_impl);
+TSIMD_DYN_DISPATCH_FUNC(reduce_norm2_impl);
+TSIMD_DYN_DISPATCH_FUNC(reduce_min_impl);
+TSIMD_DYN_DISPATCH_FUNC(reduce_max_impl);
+TSIMD_DYN_DISPATCH_FUNC(reduce_minmax_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace reduce
+{
+    float32 sum(const float32* in, size_t count, Mode mode) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_sum_impl)(in, count, mode);
+    }
+
+    float32 dot(const float32* a, const float32* b, size_t count, Mode mode) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_dot_impl)(a, b, count, mode);
+    }
+
+    float32 norm2(const float32* in, size_t count, Mode mode) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_norm2_impl)(in, count, mode);
+    }
+
+    float32 min(const float32* in, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_min_impl)(in, count);
+    }
+
+    float32 max(const float32* in, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_max_impl)(in, count);
+    }
+
+    MinMax minmax(const float32* in, size_t count) noexcept
+    {
+        return TSIMD_DYN_CALL(reduce_minmax_impl)(in, count);
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
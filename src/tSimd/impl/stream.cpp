@@ -0,0 +1,525 @@
+#include "tSimd/stream.hpp"
+
+#include <limits>
+
+#include "tSimd/algorithm.hpp"
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "impl/stream.cpp" // this file
+#include "tSimd/dispatch_this_file.hpp" // auto dispatch
+#include "tSimd/batch.hpp"
+
+// 允许原地计算，所以这里的指针都没有 TMATH_RESTRICT
+// 每个batch先load所有输入再store，in == out 时也是安全的
+// 逐分量的函数输出很大时使用 stream (见 for_each_batch_store)，不改变计算结果
+// 求和的顺序与 tMath 的标量版本一致 ((x*x + y*y) + z*z)，并且不使用 mul_add，保证结果与标量版本相同
+
+// 逐分量的二元函数: out[i] = expr(a, b)
+#undef TSIMD_DETAIL_STREAM_BINARY_KERNEL
+#define TSIMD_DETAIL_STREAM_BINARY_KERNEL(func, ...) \
+    TSIMD_DYN_FUNC_ATTR void stream_##func##_impl(const float32* pa, const float32* pb, float32* out, const size_t count) noexcept \
+    { \
+        using op = TSIMD_DYN_SIMD_OP(float32); \
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR \
+        { \
+            const auto a = op::load_partial(pa + i, lanes); \
+            const auto b = op::load_partial(pb + i, lanes); \
+            TSIMD_STORE_BATCH(op, out + i, (__VA_ARGS__), lanes); \
+        })) \
+        { \
+            op::fence(); \
+        } \
+    }
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(add, op::add(a, b))
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(sub, op::sub(a, b))
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(mul, op::mul(a, b))
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(div, op::div(a, b))
+    // std::min: (b < a) ? b : a, std::max: (a < b) ? b : a
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(min, op::select(op::cmp_lt(b, a), b, a))
+    TSIMD_DETAIL_STREAM_BINARY_KERNEL(max, op::select(op::cmp_lt(a, b), b, a))
+
+    TSIMD_DYN_FUNC_ATTR void stream_mul_scalar_impl(const float32* a, const float32 s, float32* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto vs = op::set(s);
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            TSIMD_STORE_BATCH(op, out + i, op::mul(op::load_partial(a + i, lanes), vs), lanes);
+        }))
+        {
+            op::fence();
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_div_scalar_impl(const float32* a, const float32 s, float32* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        // 不改成乘以 1/s，结果与逐个相除一致
+        const auto vs = op::set(s);
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            TSIMD_STORE_BATCH(op, out + i, op::div(op::load_partial(a + i, lanes), vs), lanes);
+        }))
+        {
+            op::fence();
+        }
+    }
+
+    // (v < lo) ? lo : (v > hi) ? hi : v
+    TSIMD_DYN_FUNC_ATTR void stream_clamp_impl(const float32* a, const float32 lo, const float32 hi, float32* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto vlo = op::set(lo);
+        const auto vhi = op::set(hi);
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto v = op::load_partial(a + i, lanes);
+            TSIMD_STORE_BATCH(op, out + i, op::select(op::cmp_lt(v, vlo), vlo, op::select(op::cmp_gt(v, vhi), vhi, v)), lanes);
+        }))
+        {
+            op::fence();
+        }
+    }
+
+    // a + (b - a) * t
+    TSIMD_DYN_FUNC_ATTR void stream_lerp_impl(const float32* pa, const float32* pb, const float32 t, float32* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        const auto vt = op::set(t);
+        if (for_each_batch_store<op>(count, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto a = op::load_partial(pa + i, lanes);
+            const auto b = op::load_partial(pb + i, lanes);
+            TSIMD_STORE_BATCH(op, out + i, op::add(a, op::mul(op::sub(b, a), vt)), lanes);
+        }))
+        {
+            op::fence();
+        }
+    }
+
+    // ------------------------------- 需要所有分量的函数 -------------------------------
+    namespace stream_detail
+    {
+        template<size_t N, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE auto load_dot(const float32* const* a, const float32* const* b, const size_t i, const Lanes lanes) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            auto sum = op::mul(op::load_partial(a[0] + i, lanes), op::load_partial(b[0] + i, lanes));
+            for (size_t d = 1; d < N; ++d)
+            {
+                sum = op::add(sum, op::mul(op::load_partial(a[d] + i, lanes), op::load_partial(b[d] + i, lanes)));
+            }
+            return sum;
+        }
+
+        template<size_t N, typename Lanes>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE auto load_distance_sq(const float32* const* a, const float32* const* b, const size_t i, const Lanes lanes) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            auto d0 = op::sub(op::load_partial(a[0] + i, lanes), op::load_partial(b[0] + i, lanes));
+            auto sum = op::mul(d0, d0);
+            for (size_t d = 1; d < N; ++d)
+            {
+                const auto delta = op::sub(op::load_partial(a[d] + i, lanes), op::load_partial(b[d] + i, lanes));
+                sum = op::add(sum, op::mul(delta, delta));
+            }
+            return sum;
+        }
+
+        template<size_t N>
+        TSIMD_DYN_FUNC_ATTR void dot(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(out + i, load_dot<N>(a, b, i, lanes), lanes);
+            });
+        }
+
+        template<size_t N>
+        TSIMD_DYN_FUNC_ATTR void magnitude(const float32* const* a, float32* out, const size_t count) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(out + i, op::sqrt(load_dot<N>(a, a, i, lanes)), lanes);
+            });
+        }
+
+        template<size_t N>
+        TSIMD_DYN_FUNC_ATTR void distance(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(out + i, op::sqrt(load_distance_sq<N>(a, b, i, lanes)), lanes);
+            });
+        }
+
+        // 1. mag == 0: 0向量
+        // 2. mag == inf: NaN
+        // 3. mag == NaN: 传播NaN
+        template<size_t N>
+        TSIMD_DYN_FUNC_ATTR void normalized(const float32* const* a, float32* const* out, const size_t count) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float32);
+
+            const auto zero = op::zero();
+            const auto one = op::set(1.0f);
+            const auto inf = op::set(std::numeric_limits<float32>::infinity());
+            const auto nan = op::set(std::numeric_limits<float32>::quiet_NaN());
+
+            for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                const auto mag = op::sqrt(load_dot<N>(a, a, i, lanes));
+                const auto inv_mag = op::select(op::cmp_ne(mag, zero), op::div(one, mag), zero);
+                const auto is_inf = op::cmp_eq(mag, inf);
+
+                typename op::batch_t v[N];
+                for (size_t d = 0; d < N; ++d)
+                {
+                    v[d] = op::load_partial(a[d] + i, lanes);
+                }
+                for (size_t d = 0; d < N; ++d)
+                {
+                    op::store_partial(out[d] + i, op::select(is_inf, nan, op::mul(v[d], inv_mag)), lanes);
+                }
+            });
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_dot3_impl(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+    {
+        stream_detail::dot<3>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_dot4_impl(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+    {
+        stream_detail::dot<4>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_magnitude3_impl(const float32* const* a, float32* out, const size_t count) noexcept
+    {
+        stream_detail::magnitude<3>(a, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_magnitude4_impl(const float32* const* a, float32* out, const size_t count) noexcept
+    {
+        stream_detail::magnitude<4>(a, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_distance3_impl(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+    {
+        stream_detail::distance<3>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_distance4_impl(const float32* const* a, const float32* const* b, float32* out, const size_t count) noexcept
+    {
+        stream_detail::distance<4>(a, b, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_normalized3_impl(const float32* const* a, float32* const* out, const size_t count) noexcept
+    {
+        stream_detail::normalized<3>(a, out, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_normalized4_impl(const float32* const* a, float32* const* out, const size_t count) noexcept
+    {
+        stream_detail::normalized<4>(a, out, count);
+    }
+
+    // (a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x)
+    TSIMD_DYN_FUNC_ATTR void stream_cross_impl(const float32* const* a, const float32* const* b, float32* const* out, const size_t count) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float32);
+
+        for_each_batch<op>(count, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto ax = op::load_partial(a[0] + i, lanes);
+            const auto ay = op::load_partial(a[1] + i, lanes);
+            const auto az = op::load_partial(a[2] + i, lanes);
+            const auto bx = op::load_partial(b[0] + i, lanes);
+            const auto by = op::load_partial(b[1] + i, lanes);
+            const auto bz = op::load_partial(b[2] + i, lanes);
+
+            op::store_partial(out[0] + i, op::sub(op::mul(ay, bz), op::mul(az, by)), lanes);
+            op::store_partial(out[1] + i, op::sub(op::mul(az, bx), op::mul(ax, bz)), lanes);
+            op::store_partial(out[2] + i, op::sub(op::mul(ax, by), op::mul(ay, bx)), lanes);
+        });
+    }
+
+    // ------------------------------- AoS <-> SoA -------------------------------
+    // 完整的batch使用 SimdOp 的 deinterleave3/4 / interleave3/4 在寄存器内重排，末尾不足一个batch的元素逐个复制
+    namespace stream_detail
+    {
+        template<typename op, size_t N>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE void deinterleave(const float32* mem, typename op::batch_t (&v)[N]) noexcept
+        {
+            if constexpr (N == 3)
+            {
+                op::deinterleave3(mem, v[0], v[1], v[2]);
+            }
+            else
+            {
+                op::deinterleave4(mem, v[0], v[1], v[2], v[3]);
+            }
+        }
+
+        template<typename op, size_t N>
+        TSIMD_DYN_FUNC_ATTR TMATH_FORCE_INLINE void interleave(float32* mem, const typename op::batch_t (&v)[N]) noexcept
+        {
+            if constexpr (N == 3)
+            {
+                op::interleave3(mem, v[0], v[1], v[2]);
+            }
+            else
+            {
+                op::interleave4(mem, v[0], v[1], v[2], v[3]);
+            }
+        }
+
+        template<typename op, size_t N>
+        TSIMD_DYN_FUNC_ATTR void import_aos(const float32* aos, float32* const* soa, const size_t count) noexcept
+        {
+            size_t i = 0;
+            for (; i + op::Lanes <= count; i += op::Lanes)
+            {
+                typename op::batch_t v[N];
+                deinterleave<op, N>(aos + i * N, v);
+                for (size_t d = 0; d < N; ++d)
+                {
+                    op::storeu(soa[d] + i, v[d]);
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                for (size_t d = 0; d < N; ++d)
+                {
+                    soa[d][i] = aos[i * N + d];
+                }
+            }
+        }
+
+        template<typename op, size_t N>
+        TSIMD_DYN_FUNC_ATTR void export_aos(const float32* const* soa, float32* aos, const size_t count) noexcept
+        {
+            size_t i = 0;
+            for (; i + op::Lanes <= count; i += op::Lanes)
+            {
+                typename op::batch_t v[N];
+                for (size_t d = 0; d < N; ++d)
+                {
+                    v[d] = op::loadu(soa[d] + i);
+                }
+                interleave<op, N>(aos + i * N, v);
+            }
+
+            for (; i < count; ++i)
+            {
+                for (size_t d = 0; d < N; ++d)
+                {
+                    aos[i * N + d] = soa[d][i];
+                }
+            }
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_import_aos3_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 3>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_import_aos4_impl(const float32* aos, float32* const* soa, const size_t count) noexcept
+    {
+        stream_detail::import_aos<TSIMD_DYN_SIMD_OP(float32), 4>(aos, soa, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_export_aos3_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 3>(soa, aos, count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR void stream_export_aos4_impl(const float32* const* soa, float32* aos, const size_t count) noexcept
+    {
+        stream_detail::export_aos<TSIMD_DYN_SIMD_OP(float32), 4>(soa, aos, count);
+    }
+}
+
+#undef TSIMD_DETAIL_STREAM_BINARY_KERNEL
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(stream_add_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_sub_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_mul_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_div_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_min_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_max_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_mul_scalar_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_div_scalar_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_clamp_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_lerp_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_dot3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_dot4_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_magnitude3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_magnitude4_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_distance3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_distance4_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_normalized3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_normalized4_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_cross_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_import_aos3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_import_aos4_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_export_aos3_impl);
+TSIMD_DYN_DISPATCH_FUNC(stream_export_aos4_impl);
+
+TSIMD_NAMESPACE_BEGIN
+
+namespace detail
+{
+    void stream_add(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_add_impl)(a, b, out, count);
+    }
+
+    void stream_sub(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_sub_impl)(a, b, out, count);
+    }
+
+    void stream_mul(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_mul_impl)(a, b, out, count);
+    }
+
+    void stream_div(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_div_impl)(a, b, out, count);
+    }
+
+    void stream_mul_scalar(const float32* a, float32 s, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_mul_scalar_impl)(a, s, out, count);
+    }
+
+    void stream_div_scalar(const float32* a, float32 s, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_div_scalar_impl)(a, s, out, count);
+    }
+
+    void stream_min(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_min_impl)(a, b, out, count);
+    }
+
+    void stream_max(const float32* a, const float32* b, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_max_impl)(a, b, out, count);
+    }
+
+    void stream_clamp(const float32* a, float32 lo, float32 hi, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_clamp_impl)(a, lo, hi, out, count);
+    }
+
+    void stream_lerp(const float32* a, const float32* b, float32 t, float32* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_lerp_impl)(a, b, t, out, count);
+    }
+
+    void stream_dot(const float32* const* a, const float32* const* b, float32* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_dot3_impl)(a, b, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_dot4_impl)(a, b, out, count);
+        }
+    }
+
+    void stream_magnitude(const float32* const* a, float32* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_magnitude3_impl)(a, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_magnitude4_impl)(a, out, count);
+        }
+    }
+
+    void stream_distance(const float32* const* a, const float32* const* b, float32* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_distance3_impl)(a, b, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_distance4_impl)(a, b, out, count);
+        }
+    }
+
+    void stream_normalized(const float32* const* a, float32* const* out, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_normalized3_impl)(a, out, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_normalized4_impl)(a, out, count);
+        }
+    }
+
+    void stream_cross(const float32* const* a, const float32* const* b, float32* const* out, size_t count) noexcept
+    {
+        TSIMD_DYN_CALL(stream_cross_impl)(a, b, out, count);
+    }
+
+    void stream_import_aos(const float32* aos, float32* const* soa, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_import_aos3_impl)(aos, soa, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_import_aos4_impl)(aos, soa, count);
+        }
+    }
+
+    void stream_export_aos(const float32* const* soa, float32* aos, size_t dims, size_t count) noexcept
+    {
+        if (dims == 3)
+        {
+            TSIMD_DYN_CALL(stream_export_aos3_impl)(soa, aos, count);
+        }
+        else
+        {
+            TSIMD_DYN_CALL(stream_export_aos4_impl)(soa, aos, count);
+        }
+    }
+}
+
+TSIMD_NAMESPACE_END
+
+#endif
@@ -1 +1,4 @@
 #include "impl/dispatch.cpp"
+#include "impl/math.cpp"
+#include "impl/parallel.cpp"
+#include "impl/page_allocate.cpp"
@@ -0,0 +1,164 @@
+#include <tMath/bounds.hpp>
+#include <tMath/matrix.hpp>
+#include <tMath/vector.hpp>
+
+#include "../test.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+#if defined(TMATH_COMPILER_CLANG)
+TMATH_IGNORE_WARNING("-Wmissing-braces")
+#endif
+
+struct Vec3f
+{
+    TMATH_FULL_VECTOR3(Vec3f, float)
+};
+
+struct Vec4f
+{
+    TMATH_FULL_VECTOR4(Vec4f, float)
+};
+
+struct Mat4x4f_RM
+{
+    Vec4f data[4];
+};
+
+struct Mat4x4f_CM
+{
+    TMATH_MATRIX_COLUMN_MAJOR_TAG
+    Vec4f data[4];
+};
+
+using AABBf = tmath::AABB<Vec3f>;
+using Spheref = tmath::BoundingSphere<Vec3f>;
+using Frustumf = tmath::Frustum<Vec4f>;
+
+namespace
+{
+    void expect_vec3_eq(const Vec3f& a, const Vec3f& b)
+    {
+        EXPECT_EQ(a.x, b.x);
+        EXPECT_EQ(a.y, b.y);
+        EXPECT_EQ(a.z, b.z);
+    }
+
+    void expect_plane_near(const Vec4f& a, const Vec4f& b, const float eps = 1e-5f)
+    {
+        EXPECT_NEAR(a.x, b.x, eps);
+        EXPECT_NEAR(a.y, b.y, eps);
+        EXPECT_NEAR(a.z, b.z, eps);
+        EXPECT_NEAR(a.w, b.w, eps);
+    }
+
+    // 右手坐标系，看向 -z，fov 90°，aspect 1，near 1，far 100，作用在列向量上
+    Mat4x4f_RM perspective(const tmath::DepthRange depth)
+    {
+        constexpr float n = 1.0f, f = 100.0f;
+        Mat4x4f_RM m = {};
+        m.data[0].x = 1.0f;
+        m.data[1].y = 1.0f;
+        if (depth == tmath::DepthRange::ZeroToOne)
+        {
+            m.data[2].z = f / (n - f);
+            m.data[2].w = n * f / (n - f);
+        }
+        else
+        {
+            m.data[2].z = (f + n) / (n - f);
+            m.data[2].w = 2.0f * f * n / (n - f);
+        }
+        m.data[3].z = -1.0f;
+        return m;
+    }
+}
+
+TEST(bounds, aabb)
+{
+    constexpr AABBf box = tmath::aabb_from_center_extents(Vec3f{ 1, 2, 3 }, Vec3f{ 0.5f, 1, 2 });
+    expect_vec3_eq(box.min, { 0.5f, 1, 1 });
+    expect_vec3_eq(box.max, { 1.5f, 3, 5 });
+    expect_vec3_eq(tmath::center(box), { 1, 2, 3 });
+    expect_vec3_eq(tmath::extents(box), { 0.5f, 1, 2 });
+
+    EXPECT_TRUE(tmath::contains(box, Vec3f{ 1, 2, 3 }));
+    EXPECT_TRUE(tmath::contains(box, Vec3f{ 0.5f, 1, 5 })); // 边界
+    EXPECT_FALSE(tmath::contains(box, Vec3f{ 0.4f, 2, 3 }));
+
+    const AABBf merged = tmath::merge(box, Vec3f{ -1, 10, 3 });
+    expect_vec3_eq(merged.min, { -1, 1, 1 });
+    expect_vec3_eq(merged.max, { 1.5f, 10, 5 });
+
+    const AABBf other = { { 1.5f, 0, 0 }, { 4, 1, 1 } };
+    EXPECT_TRUE(tmath::intersects(box, other)); // 共享一个点
+    EXPECT_FALSE(tmath::intersects(box, AABBf{ { 1.6f, 0, 0 }, { 4, 1, 1 } }));
+
+    const AABBf both = tmath::merge(box, other);
+    expect_vec3_eq(both.min, { 0.5f, 0, 0 });
+    expect_vec3_eq(both.max, { 4, 3, 5 });
+}
+
+TEST(bounds, sphere)
+{
+    const Spheref s = tmath::bounding_sphere(AABBf{ { -1, -2, -2 }, { 1, 2, 2 } });
+    expect_vec3_eq(s.center, { 0, 0, 0 });
+    EXPECT_FLOAT_EQ(s.radius, 3.0f);
+
+    EXPECT_TRUE(tmath::contains(s, Vec3f{ 0, 3, 0 }));
+    EXPECT_FALSE(tmath::contains(s, Vec3f{ 2, 2, 2 }));
+
+    EXPECT_TRUE(tmath::intersects(s, Spheref{ { 5, 0, 0 }, 2 }));
+    EXPECT_FALSE(tmath::intersects(s, Spheref{ { 5, 0, 0 }, 1.9f }));
+}
+
+TEST(bounds, frustum_from_matrix)
+{
+    const float k = 1.0f / std::sqrt(2.0f);
+    for (const auto depth : { tmath::DepthRange::NegativeOneToOne, tmath::DepthRange::ZeroToOne })
+    {
+        const Mat4x4f_RM rm = perspective(depth);
+        const Frustumf f = tmath::frustum_from_matrix<Vec4f>(rm, depth);
+
+        // left, right, bottom, top, near, far
+        expect_plane_near(f.planes[0], { k, 0, -k, 0 });
+        expect_plane_near(f.planes[1], { -k, 0, -k, 0 });
+        expect_plane_near(f.planes[2], { 0, k, -k, 0 });
+        expect_plane_near(f.planes[3], { 0, -k, -k, 0 });
+        expect_plane_near(f.planes[4], { 0, 0, -1, -1 });
+        expect_plane_near(f.planes[5], { 0, 0, 1, 100 }, 1e-3f);
+
+        // 列主序的同一个矩阵
+        Mat4x4f_CM cm;
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                cm.data[c].data[r] = rm.data[r].data[c];
+            }
+        }
+        const Frustumf g = tmath::frustum_from_matrix<Vec4f>(cm, depth);
+        for (int i = 0; i < 6; ++i)
+        {
+            EXPECT_TRUE(g.planes[i] == f.planes[i]) << "plane: " << i;
+        }
+    }
+}
+
+TEST(bounds, frustum_intersects)
+{
+    const Frustumf f = tmath::frustum_from_matrix<Vec4f>(perspective(tmath::DepthRange::NegativeOneToOne));
+
+    EXPECT_TRUE(tmath::intersects(f, Spheref{ { 0, 0, -10 }, 1 }));
+    EXPECT_FALSE(tmath::intersects(f, Spheref{ { 0, 0, 0.5f }, 0.1f }));   // 近平面之前
+    EXPECT_TRUE(tmath::intersects(f, Spheref{ { 0, 0, -0.5f }, 1 }));      // 跨过近平面
+    EXPECT_FALSE(tmath::intersects(f, Spheref{ { 0, 0, -102 }, 1 }));      // 远平面之后
+    EXPECT_FALSE(tmath::intersects(f, Spheref{ { 20, 0, -10 }, 1 }));      // 右侧
+
+    EXPECT_TRUE(tmath::intersects(f, tmath::aabb_from_center_extents(Vec3f{ 0, 0, -10 }, Vec3f{ 1, 1, 1 })));
+    EXPECT_FALSE(tmath::intersects(f, tmath::aabb_from_center_extents(Vec3f{ 20, 0, -10 }, Vec3f{ 1, 1, 1 })));
+    EXPECT_TRUE(tmath::intersects(f, tmath::aabb_from_center_extents(Vec3f{ 20, 0, -10 }, Vec3f{ 11, 1, 1 })));
+    EXPECT_FALSE(tmath::intersects(f, tmath::aabb_from_center_extents(Vec3f{ 0, -20, -10 }, Vec3f{ 1, 1, 1 })));
+}
+
+TMATH_DIAGNOSTICS_POP
@@ -0,0 +1,276 @@
+#include <tMath/matrix.hpp>
+#include <tMath/vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "../test.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+#if defined(TMATH_COMPILER_CLANG)
+TMATH_IGNORE_WARNING("-Wmissing-braces")
+#endif
+
+struct Vec4f
+{
+    TMATH_FULL_VECTOR4(Vec4f, float)
+};
+
+struct Vec4d
+{
+    TMATH_FULL_VECTOR4(Vec4d, double)
+};
+
+// data[i] 为第i列
+struct Mat4x4f_CM
+{
+    TMATH_MATRIX_COLUMN_MAJOR_TAG
+    Vec4f data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4f_CM)
+};
+
+struct Mat4x4d_CM
+{
+    TMATH_MATRIX_COLUMN_MAJOR_TAG
+    Vec4d data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4d_CM)
+};
+
+struct Mat4x4f_RM
+{
+    Vec4f data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4f_RM)
+};
+
+namespace
+{
+    // 逻辑上的 (row, col) 元素
+    template<typename Mat>
+    auto& at(Mat& m, const int row, const int col)
+    {
+        if constexpr (tmath::matrix_traits<std::remove_const_t<Mat>>::is_column_major)
+        {
+            return m.data[col].data[row];
+        }
+        else
+        {
+            return m.data[row].data[col];
+        }
+    }
+
+    template<typename Mat>
+    Mat random_matrix()
+    {
+        Mat m;
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                at(m, r, c) = random_f(-10.0f, 10.0f);
+            }
+        }
+        return m;
+    }
+
+    Vec4f random_vec4()
+    {
+        return { random_f(-10.0f, 10.0f), random_f(-10.0f, 10.0f), random_f(-10.0f, 10.0f), random_f(-10.0f, 10.0f) };
+    }
+
+    // double 精度的参考值，运行时的 SIMD 版本可能使用 FMA，只比较到舍入误差
+    template<typename Mat>
+    void expect_mat_mul(const Mat& a, const Mat& b, Mat result)
+    {
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                double expected = 0.0;
+                for (int k = 0; k < 4; ++k)
+                {
+                    expected += double(at(a, r, k)) * double(at(b, k, c));
+                }
+                EXPECT_NEAR(at(result, r, c), expected, 1e-4 * (1.0 + std::abs(expected))) << "row: " << r << ", col: " << c;
+            }
+        }
+    }
+
+    template<typename Mat>
+    void expect_mat_mul_vec(const Mat& m, const Vec4f& v, const Vec4f& result)
+    {
+        for (int r = 0; r < 4; ++r)
+        {
+            double expected = 0.0;
+            for (int k = 0; k < 4; ++k)
+            {
+                expected += double(at(m, r, k)) * double(v.data[k]);
+            }
+            EXPECT_NEAR(result.data[r], expected, 1e-4 * (1.0 + std::abs(expected))) << "row: " << r;
+        }
+    }
+}
+
+TEST(mat4_CM, concept_test)
+{
+    static_assert(tmath::is_square_matrix_column_major<Mat4x4f_CM>);
+    static_assert(tmath::is_square_matrix_column_major<Mat4x4d_CM>);
+    static_assert(!tmath::is_matrix_row_major<Mat4x4f_CM>);
+    static_assert(tmath::matrix_traits<Mat4x4f_CM>::row_count == 4);
+    static_assert(tmath::matrix_traits<Mat4x4f_CM>::column_count == 4);
+}
+
+TEST(mat4_CM, mat4_mul_vec4)
+{
+    // 每一列为 data[i]: 平移 (10, 20, 30)
+    constexpr Mat4x4f_CM m = {
+        1, 0, 0, 0,
+        0, 2, 0, 0,
+        0, 0, 3, 0,
+        10, 20, 30, 1
+    };
+    constexpr Vec4f v = { 2, 3, 4, 1 };
+    constexpr Vec4f result = m * v;
+    static_assert(result == Vec4f{ 12, 26, 42, 1 }, "Compile-time multiplication failed!");
+
+    const Vec4f runtime_result = m * v;
+    EXPECT_TRUE(runtime_result == result);
+}
+
+TEST(mat4_CM, constexpr_validation)
+{
+    // 与行主序 mat4_RM.constexpr_validation 相同的逻辑矩阵 (按列书写)
+    constexpr Mat4x4f_CM m1 = {
+        1, 5, 9, 4,
+        2, 6, 1, 5,
+        3, 7, 2, 6,
+        4, 8, 3, 7
+    };
+    constexpr Mat4x4f_CM m2 = {
+        0, 1, 0, 1,
+        1, 0, 1, 0,
+        0, 1, 0, 1,
+        1, 0, 1, 0
+    };
+
+    constexpr Mat4x4f_CM result = m1 * m2;
+
+    // 第一行第一列：(1*0 + 2*1 + 3*0 + 4*1) = 6
+    static_assert(result.data[0].data[0] == 6.0f, "Compile-time multiplication failed!");
+    // 第一行第二列：(1*1 + 2*0 + 3*1 + 4*0) = 4
+    static_assert(result.data[1].data[0] == 4.0f, "Compile-time multiplication failed!");
+
+    const Mat4x4f_CM runtime_result = m1 * m2;
+    EXPECT_TRUE(runtime_result == result);
+
+    constexpr Mat4x4d_CM d1 = { 1, 5, 9, 4, 2, 6, 1, 5, 3, 7, 2, 6, 4, 8, 3, 7 };
+    constexpr Mat4x4d_CM d2 = { 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0 };
+    constexpr Mat4x4d_CM d_result = d1 * d2;
+    static_assert(d_result.data[1].data[0] == 4.0);
+}
+
+TEST(mat4_CM, non_commutative)
+{
+    Mat4x4f_CM A = {
+        1, 3, 0, 0,
+        2, 4, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+    Mat4x4f_CM B = {
+        5, 7, 0, 0,
+        6, 8, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    Mat4x4f_CM AB = A * B;
+    Mat4x4f_CM BA = B * A;
+
+    // AB[0][0] = 1*5 + 2*7 = 19
+    // BA[0][0] = 5*1 + 6*3 = 23
+    EXPECT_FLOAT_EQ(AB.data[0].data[0], 19.0f);
+    EXPECT_FLOAT_EQ(BA.data[0].data[0], 23.0f);
+    // AB[0][1] = 1*6 + 2*8 = 22
+    EXPECT_FLOAT_EQ(AB.data[1].data[0], 22.0f);
+}
+
+// 运行时 (TMATH_USE_TSIMD 时使用 tSimd) 的结果与参考值一致
+TEST(mat4_runtime, random_values)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto a_cm = random_matrix<Mat4x4f_CM>();
+        const auto b_cm = random_matrix<Mat4x4f_CM>();
+        const auto a_rm = random_matrix<Mat4x4f_RM>();
+        const auto b_rm = random_matrix<Mat4x4f_RM>();
+        const Vec4f v = random_vec4();
+
+        expect_mat_mul(a_cm, b_cm, a_cm * b_cm);
+        expect_mat_mul(a_rm, b_rm, a_rm * b_rm);
+        expect_mat_mul_vec(a_cm, v, a_cm * v);
+        expect_mat_mul_vec(a_rm, v, a_rm * v);
+    }
+}
+
+TEST(mat4_runtime, mul_batch)
+{
+    constexpr size_t N = 7; // 不是 2 / 4 的整数倍
+
+    Mat4x4f_CM a_cm[N], b_cm[N], out_cm[N];
+    Mat4x4f_RM a_rm[N], b_rm[N], out_rm[N];
+    Vec4f v[N], out_v_cm[N], out_v_rm[N];
+    for (size_t i = 0; i < N; ++i)
+    {
+        a_cm[i] = random_matrix<Mat4x4f_CM>();
+        b_cm[i] = random_matrix<Mat4x4f_CM>();
+        a_rm[i] = random_matrix<Mat4x4f_RM>();
+        b_rm[i] = random_matrix<Mat4x4f_RM>();
+        v[i] = random_vec4();
+    }
+
+    tmath::mul_batch(a_cm, b_cm, out_cm, N);
+    tmath::mul_batch(a_rm, b_rm, out_rm, N);
+    tmath::mul_batch(a_cm, v, out_v_cm, N);
+    tmath::mul_batch(a_rm, v, out_v_rm, N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        // 与单个矩阵的乘法使用相同的 kernel
+        EXPECT_TRUE(out_cm[i] == a_cm[i] * b_cm[i]) << i;
+        EXPECT_TRUE(out_rm[i] == a_rm[i] * b_rm[i]) << i;
+        EXPECT_TRUE(out_v_cm[i] == a_cm[i] * v[i]) << i;
+        EXPECT_TRUE(out_v_rm[i] == a_rm[i] * v[i]) << i;
+        expect_mat_mul(a_cm[i], b_cm[i], out_cm[i]);
+        expect_mat_mul_vec(a_rm[i], v[i], out_v_rm[i]);
+    }
+
+    // 原地计算
+    Mat4x4f_RM in_place[N];
+    std::copy(std::begin(a_rm), std::end(a_rm), std::begin(in_place));
+    tmath::mul_batch(in_place, b_rm, in_place, N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_TRUE(in_place[i] == out_rm[i]) << i;
+    }
+}
+
+TEST(mat4_runtime, mul_batch_constexpr)
+{
+    constexpr auto result = []()
+    {
+        const Mat4x4f_CM m[2] = {
+            { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1 },
+            { 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1 },
+        };
+        const Vec4f v[2] = { { 1, 1, 1, 1 }, { 1, 2, 3, 1 } };
+        Vec4f out[2] = {};
+        tmath::mul_batch(m, v, out, 2);
+        return out[0].data[2] + out[1].data[2];
+    }();
+    static_assert(result == 10.0f);
+    EXPECT_EQ(result, 10.0f);
+}
+
+TMATH_DIAGNOSTICS_POP
@@ -0,0 +1,289 @@
+#include <tMath/matrix.hpp>
+#include <tMath/vector.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "../test.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+#if defined(TMATH_COMPILER_CLANG)
+TMATH_IGNORE_WARNING("-Wmissing-braces")
+#endif
+
+struct Vec4f
+{
+    TMATH_FULL_VECTOR4(Vec4f, float)
+};
+
+struct Vec4d
+{
+    TMATH_FULL_VECTOR4(Vec4d, double)
+};
+
+struct Mat4x4f_RM
+{
+    Vec4f data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4f_RM)
+};
+
+struct Mat4x4d_RM
+{
+    Vec4d data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4d_RM)
+};
+
+struct Mat4x4f_CM
+{
+    TMATH_MATRIX_COLUMN_MAJOR_TAG
+    Vec4f data[4];
+    TMATH_MATRIX_OPERATORS(Mat4x4f_CM)
+};
+
+namespace
+{
+    constexpr Mat4x4f_RM m_rm = {
+        2, 0, 1, 3,
+        1, 4, 0, 2,
+        0, 1, 3, 1,
+        1, 2, 1, 5
+    };
+
+    // 绕 z 轴旋转 90 度，再平移 (1, 2, 3)
+    constexpr Mat4x4f_RM rigid_rm = {
+        0, -1, 0, 1,
+        1, 0, 0, 2,
+        0, 0, 1, 3,
+        0, 0, 0, 1
+    };
+
+    // 同一个逻辑矩阵的列主序存储
+    constexpr Mat4x4f_CM rigid_cm = {
+        0, 1, 0, 0,
+        -1, 0, 0, 0,
+        0, 0, 1, 0,
+        1, 2, 3, 1
+    };
+
+    template<typename Mat>
+    void expect_near_identity(const Mat& m, const float eps = 1e-4f)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                EXPECT_NEAR(m.data[i].data[j], i == j ? 1.0f : 0.0f, eps) << i << ", " << j;
+            }
+        }
+    }
+
+    template<typename Mat>
+    Mat random_matrix()
+    {
+        Mat m;
+        for (auto& v : m.data)
+        {
+            for (auto& c : v.data)
+            {
+                c = random_f(-4.0f, 4.0f);
+            }
+        }
+        // 对角线占优，保证可逆
+        for (int i = 0; i < 4; ++i)
+        {
+            m.data[i].data[i] += 20.0f;
+        }
+        return m;
+    }
+
+    template<typename Mat>
+    Mat random_rigid()
+    {
+        // 绕任意轴的旋转 (Rodrigues) + 平移，按行主序的逻辑元素生成
+        const float ax = random_f(-1.0f, 1.0f), ay = random_f(-1.0f, 1.0f), az = random_f(0.5f, 1.0f);
+        const float len = std::sqrt(ax * ax + ay * ay + az * az);
+        const float x = ax / len, y = ay / len, z = az / len;
+        const float angle = random_f(-3.0f, 3.0f);
+        const float c = std::cos(angle), s = std::sin(angle), t = 1.0f - c;
+
+        const float r[4][4] = {
+            { t * x * x + c,     t * x * y - s * z, t * x * z + s * y, random_f(-10.0f, 10.0f) },
+            { t * x * y + s * z, t * y * y + c,     t * y * z - s * x, random_f(-10.0f, 10.0f) },
+            { t * x * z - s * y, t * y * z + s * x, t * z * z + c,     random_f(-10.0f, 10.0f) },
+            { 0.0f, 0.0f, 0.0f, 1.0f },
+        };
+
+        Mat m;
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                if constexpr (tmath::matrix_traits<Mat>::is_column_major)
+                {
+                    m.data[j].data[i] = r[i][j];
+                }
+                else
+                {
+                    m.data[i].data[j] = r[i][j];
+                }
+            }
+        }
+        return m;
+    }
+}
+
+TEST(mat4_inverse, determinant)
+{
+    static_assert(tmath::determinant(m_rm) == 76.0f);
+    static_assert(tmath::determinant(tmath::identity<Mat4x4d_RM>()) == 1.0);
+    static_assert(tmath::determinant(tmath::scale<Mat4x4f_CM>(2)) == 16.0f);
+    // 转置的行列式相同
+    static_assert(tmath::determinant(tmath::transpose(m_rm)) == 76.0f);
+
+    const Mat4x4f_RM m = m_rm;
+    EXPECT_EQ(tmath::determinant(m), 76.0f);
+
+    constexpr Mat4x4f_RM singular = {
+        1, 2, 3, 4,
+        2, 4, 6, 8,
+        0, 1, 0, 1,
+        1, 0, 1, 0
+    };
+    EXPECT_EQ(tmath::determinant(singular), 0.0f);
+}
+
+TEST(mat4_inverse, inverse)
+{
+    constexpr Mat4x4f_RM inv = tmath::inverse(m_rm);
+    static_assert(tmath::inverse(tmath::identity<Mat4x4f_RM>()) == tmath::identity<Mat4x4f_RM>());
+    static_assert(tmath::inverse(tmath::scale<Mat4x4d_RM>(2)) == tmath::scale<Mat4x4d_RM>(0.5));
+    expect_near_identity(m_rm * inv);
+    expect_near_identity(inv * m_rm);
+
+    // 运行时与编译期的计算顺序相同，结果完全一致
+    const Mat4x4f_RM m = m_rm;
+    EXPECT_TRUE(tmath::inverse(m) == inv);
+
+    // 列主序: 同一个逻辑矩阵的逆矩阵
+    constexpr Mat4x4f_CM m_cm = {
+        2, 1, 0, 1,
+        0, 4, 1, 2,
+        1, 0, 3, 1,
+        3, 2, 1, 5
+    };
+    constexpr Mat4x4f_CM inv_cm = tmath::inverse(m_cm);
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            EXPECT_EQ(inv_cm.data[j].data[i], inv.data[i].data[j]);
+        }
+    }
+}
+
+TEST(mat4_inverse, inverse_affine)
+{
+    constexpr Mat4x4f_RM inv_rm = tmath::inverse_affine(rigid_rm);
+    constexpr Mat4x4f_CM inv_cm = tmath::inverse_affine(rigid_cm);
+    static_assert(inv_rm == tmath::inverse(rigid_rm));
+    static_assert(inv_cm == tmath::inverse(rigid_cm));
+
+    // 逆变换把 (1, 2, 3) 变回原点
+    constexpr Vec4f p = { 1, 2, 3, 1 };
+    static_assert(inv_rm * p == Vec4f{ 0, 0, 0, 1 });
+    static_assert(inv_cm * p == Vec4f{ 0, 0, 0, 1 });
+
+    const Mat4x4f_RM rm = rigid_rm;
+    const Mat4x4f_CM cm = rigid_cm;
+    EXPECT_TRUE(tmath::inverse_affine(rm) == inv_rm);
+    EXPECT_TRUE(tmath::inverse_affine(cm) == inv_cm);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto r = random_rigid<Mat4x4f_RM>();
+        const auto c = random_rigid<Mat4x4f_CM>();
+        expect_near_identity(r * tmath::inverse_affine(r));
+        expect_near_identity(c * tmath::inverse_affine(c));
+    }
+}
+
+TEST(mat4_inverse, inverse_transpose_3x3)
+{
+    // 非均匀缩放 + 平移: 法线矩阵为 1 / scale，没有平移
+    constexpr Mat4x4f_RM m = {
+        2, 0, 0, 5,
+        0, 4, 0, 6,
+        0, 0, 8, 7,
+        0, 0, 0, 1
+    };
+    constexpr Mat4x4f_RM expected = {
+        0.5f, 0, 0, 0,
+        0, 0.25f, 0, 0,
+        0, 0, 0.125f, 0,
+        0, 0, 0, 1
+    };
+    static_assert(tmath::inverse_transpose_3x3(m) == expected);
+
+    const Mat4x4f_RM rm = m_rm;
+    constexpr Mat4x4f_RM it = tmath::inverse_transpose_3x3(m_rm);
+    EXPECT_TRUE(tmath::inverse_transpose_3x3(rm) == it);
+
+    // 与 transpose(inverse(3x3)) 比较
+    Mat4x4f_RM upper = m_rm;
+    for (int i = 0; i < 3; ++i)
+    {
+        upper.data[i].data[3] = 0.0f;
+        upper.data[3].data[i] = 0.0f;
+    }
+    upper.data[3].data[3] = 1.0f;
+    const Mat4x4f_RM ref = tmath::transpose(tmath::inverse(upper));
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(it.data[i].data[j], ref.data[i].data[j], 1e-6f) << i << ", " << j;
+        }
+    }
+}
+
+TEST(mat4_inverse, batch)
+{
+    constexpr size_t N = 37; // 不是 4 / 8 / 16 的整数倍
+
+    std::vector<Mat4x4f_RM> rm(N);
+    std::vector<Mat4x4f_CM> cm(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        rm[i] = random_matrix<Mat4x4f_RM>();
+        cm[i] = random_rigid<Mat4x4f_CM>();
+    }
+
+    std::vector<float> det(N);
+    std::vector<Mat4x4f_RM> inv(N), it(N);
+    std::vector<Mat4x4f_CM> inv_affine(N);
+    tmath::determinant_batch(rm.data(), det.data(), N);
+    tmath::inverse_batch(rm.data(), inv.data(), N);
+    tmath::inverse_transpose_3x3_batch(rm.data(), it.data(), N);
+    tmath::inverse_affine_batch(cm.data(), inv_affine.data(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(det[i], tmath::determinant(rm[i])) << i;
+        EXPECT_TRUE(inv[i] == tmath::inverse(rm[i])) << i;
+        EXPECT_TRUE(it[i] == tmath::inverse_transpose_3x3(rm[i])) << i;
+        EXPECT_TRUE(inv_affine[i] == tmath::inverse_affine(cm[i])) << i;
+        expect_near_identity(rm[i] * inv[i]);
+        expect_near_identity(cm[i] * inv_affine[i]);
+    }
+
+    // 原地计算
+    auto in_place = rm;
+    tmath::inverse_batch(in_place.data(), in_place.data(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_TRUE(in_place[i] == inv[i]) << i;
+    }
+}
+
+TMATH_DIAGNOSTICS_POP
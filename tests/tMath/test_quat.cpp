@@ -1,6 +1,8 @@
 #include <tMath/quat.hpp>
 #include <tMath/vector.hpp>
 
+#include <cmath>
+
 #include "../test.hpp"
 
 struct Quatf
@@ -36,4 +38,189 @@ TEST(quat, identity)
     EXPECT_EQ(q[1], 0);
     EXPECT_EQ(q[2], 0);
     EXPECT_EQ(q[3], 1);
-}
\ No newline at end of file
+}
+struct Vector3f32
+{
+    TMATH_FULL_VECTOR3(Vector3f32, float)
+};
+
+struct Mat3x3f
+{
+    Vector3f32 data[3];
+};
+
+struct Mat4x4f_CM
+{
+    TMATH_MATRIX_COLUMN_MAJOR_TAG
+    Vector4f32 data[4];
+};
+
+namespace
+{
+    void expect_quat_near(const Quatf& a, const Quatf& b, const float eps = 1e-5f)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(a.data[i], b.data[i], eps) << i;
+        }
+    }
+
+    void expect_vec3_near(const Vector3f32& a, const Vector3f32& b, const float eps = 1e-5f)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(a.data[i], b.data[i], eps) << i;
+        }
+    }
+
+    // q 与 -q 表示同一个旋转
+    void expect_same_rotation(const Quatf& a, const Quatf& b, const float eps = 1e-5f)
+    {
+        EXPECT_NEAR(std::abs(tmath::dot(a, b)), 1.0f, eps);
+    }
+
+    Quatf random_unit_quat()
+    {
+        return tmath::normalized(Quatf{ random_f(-1.0f, 1.0f), random_f(-1.0f, 1.0f), random_f(-1.0f, 1.0f), random_f(-1.0f, 1.0f) });
+    }
+
+    constexpr float HalfSqrt2 = 0.70710678118654752f;
+}
+
+TEST(quat, hamilton_product)
+{
+    // i * j = k, j * k = i, k * i = j, i * i = -1
+    constexpr Quatf i = { 1, 0, 0, 0 };
+    constexpr Quatf j = { 0, 1, 0, 0 };
+    constexpr Quatf k = { 0, 0, 1, 0 };
+    static_assert(i * j == k);
+    static_assert(j * k == i);
+    static_assert(k * i == j);
+    static_assert(i * i == Quatf{ 0, 0, 0, -1 });
+    static_assert(j * i == Quatf{ 0, 0, -1, 0 });
+
+    constexpr Quatf a = { 1, 2, 3, 4 };
+    constexpr Quatf b = { 5, 6, 7, 8 };
+    // (4 + 1i + 2j + 3k) * (8 + 5i + 6j + 7k)
+    static_assert(a * b == Quatf{ 24, 48, 48, -6 });
+    static_assert(a * tmath::identity<Quatf>() == a);
+    static_assert(tmath::identity<Quatf>() * a == a);
+
+    Quatf c = a;
+    c *= b;
+    EXPECT_TRUE(c == a * b);
+
+    Quatf d = a;
+    d *= Vector4f32{ 5, 6, 7, 8 };
+    EXPECT_TRUE(d == a * b);
+}
+
+TEST(quat, conjugate_inverse)
+{
+    constexpr Quatf a = { 1, 2, 3, 4 };
+    static_assert(tmath::conjugate(a) == Quatf{ -1, -2, -3, 4 });
+    static_assert(tmath::dot(a, a) == 30.0f);
+
+    expect_quat_near(a * tmath::inverse(a), tmath::identity<Quatf>());
+    expect_quat_near(tmath::inverse(a) * a, tmath::identity<Quatf>());
+
+    const Quatf u = tmath::normalized(a);
+    EXPECT_NEAR(tmath::magnitude(u), 1.0f, 1e-6f);
+    expect_quat_near(tmath::inverse(u), tmath::conjugate(u));
+}
+
+TEST(quat, axis_angle_rotate)
+{
+    // 绕 z 轴旋转 90 度: x -> y
+    const auto q = tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, tmath::HalfPI<float>);
+    expect_quat_near(q, Quatf{ 0, 0, HalfSqrt2, HalfSqrt2 });
+    expect_vec3_near(tmath::rotate(q, Vector3f32{ 1, 0, 0 }), Vector3f32{ 0, 1, 0 });
+    expect_vec3_near(tmath::rotate(q, Vector3f32{ 0, 1, 0 }), Vector3f32{ -1, 0, 0 });
+
+    // 先旋转 rhs
+    const auto qx = tmath::axis_angle<Quatf>(Vector3f32{ 1, 0, 0 }, tmath::HalfPI<float>);
+    expect_vec3_near(tmath::rotate(q * qx, Vector3f32{ 0, 1, 0 }), tmath::rotate(q, tmath::rotate(qx, Vector3f32{ 0, 1, 0 })));
+
+    Vector3f32 axis;
+    const float angle = tmath::to_axis_angle(q, axis);
+    EXPECT_NEAR(angle, tmath::HalfPI<float>, 1e-6f);
+    expect_vec3_near(axis, Vector3f32{ 0, 0, 1 });
+
+    EXPECT_EQ(tmath::to_axis_angle(tmath::identity<Quatf>(), axis), 0.0f);
+    EXPECT_TRUE(axis == (Vector3f32{ 1, 0, 0 }));
+}
+
+TEST(quat, matrix)
+{
+    const auto q = tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, tmath::HalfPI<float>);
+    const auto m3 = tmath::to_matrix<Mat3x3f>(q);
+    // 行主序: 第0行为 (0, -1, 0)
+    EXPECT_NEAR(m3.data[0].data[1], -1.0f, 1e-6f);
+    EXPECT_NEAR(m3.data[1].data[0], 1.0f, 1e-6f);
+
+    const auto m4 = tmath::to_matrix<Mat4x4f_CM>(q);
+    EXPECT_NEAR(m4.data[1].data[0], -1.0f, 1e-6f); // 逻辑上的 (0, 1)
+    EXPECT_EQ(m4.data[3].data[3], 1.0f);
+    EXPECT_EQ(m4.data[3].data[0], 0.0f);
+
+    for (int n = 0; n < 200; ++n)
+    {
+        const Quatf r = random_unit_quat();
+        expect_same_rotation(tmath::from_matrix<Quatf>(tmath::to_matrix<Mat3x3f>(r)), r);
+        expect_same_rotation(tmath::from_matrix<Quatf>(tmath::to_matrix<Mat4x4f_CM>(r)), r);
+
+        // 矩阵乘向量与 rotate 一致
+        const Vector3f32 v = { random_f(-5.0f, 5.0f), random_f(-5.0f, 5.0f), random_f(-5.0f, 5.0f) };
+        const auto m = tmath::to_matrix<Mat3x3f>(r);
+        const Vector3f32 mv = {
+            m.data[0].data[0] * v.x + m.data[0].data[1] * v.y + m.data[0].data[2] * v.z,
+            m.data[1].data[0] * v.x + m.data[1].data[1] * v.y + m.data[1].data[2] * v.z,
+            m.data[2].data[0] * v.x + m.data[2].data[1] * v.y + m.data[2].data[2] * v.z,
+        };
+        expect_vec3_near(tmath::rotate(r, v), mv, 1e-4f);
+    }
+}
+
+TEST(quat, euler)
+{
+    // 单轴的欧拉角与 axis_angle 相同
+    expect_quat_near(tmath::from_euler<Quatf>(Vector3f32{ 0.5f, 0, 0 }), tmath::axis_angle<Quatf>(Vector3f32{ 1, 0, 0 }, 0.5f));
+    expect_quat_near(tmath::from_euler<Quatf>(Vector3f32{ 0, 0.5f, 0 }), tmath::axis_angle<Quatf>(Vector3f32{ 0, 1, 0 }, 0.5f));
+    expect_quat_near(tmath::from_euler<Quatf>(Vector3f32{ 0, 0, 0.5f }), tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, 0.5f));
+
+    // q = qz * qy * qx
+    const Vector3f32 e = { 0.3f, -0.7f, 1.1f };
+    const auto qx = tmath::axis_angle<Quatf>(Vector3f32{ 1, 0, 0 }, e.x);
+    const auto qy = tmath::axis_angle<Quatf>(Vector3f32{ 0, 1, 0 }, e.y);
+    const auto qz = tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, e.z);
+    expect_quat_near(tmath::from_euler<Quatf>(e), qz * qy * qx);
+
+    for (int n = 0; n < 200; ++n)
+    {
+        const Vector3f32 angles = { random_f(-3.0f, 3.0f), random_f(-1.5f, 1.5f), random_f(-3.0f, 3.0f) };
+        expect_vec3_near(tmath::to_euler<Vector3f32>(tmath::from_euler<Quatf>(angles)), angles, 1e-3f);
+    }
+}
+
+TEST(quat, slerp_nlerp)
+{
+    const auto a = tmath::identity<Quatf>();
+    const auto b = tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, tmath::HalfPI<float>);
+
+    expect_quat_near(tmath::slerp(a, b, 0.0f), a);
+    expect_quat_near(tmath::slerp(a, b, 1.0f), b);
+    // 角度均匀
+    expect_quat_near(tmath::slerp(a, b, 0.25f), tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, tmath::HalfPI<float> * 0.25f));
+    // t = 0.5 时 nlerp 与 slerp 相同
+    expect_quat_near(tmath::nlerp(a, b, 0.5f), tmath::slerp(a, b, 0.5f));
+
+    // 最短路径: b 与 -b 的结果相同
+    const Quatf neg_b = { -b.x, -b.y, -b.z, -b.w };
+    expect_same_rotation(tmath::slerp(a, neg_b, 0.3f), tmath::slerp(a, b, 0.3f));
+    expect_same_rotation(tmath::nlerp(a, neg_b, 0.3f), tmath::nlerp(a, b, 0.3f));
+
+    // 几乎相同的两个四元数退化为 nlerp
+    const auto c = tmath::axis_angle<Quatf>(Vector3f32{ 0, 0, 1 }, 1e-4f);
+    EXPECT_TRUE(tmath::slerp(a, c, 0.5f) == tmath::nlerp(a, c, 0.5f));
+    EXPECT_NEAR(tmath::magnitude(tmath::slerp(a, c, 0.5f)), 1.0f, 1e-6f);
+}
@@ -0,0 +1,91 @@
+#include <tMath/ray.hpp>
+#include <tMath/vector.hpp>
+
+#include <limits>
+
+#include "../test.hpp"
+
+TMATH_DIAGNOSTICS_PUSH
+
+#if defined(TMATH_COMPILER_CLANG)
+TMATH_IGNORE_WARNING("-Wmissing-braces")
+#endif
+
+struct Vec3f
+{
+    TMATH_FULL_VECTOR3(Vec3f, float)
+};
+
+using Rayf = tmath::Ray<Vec3f>;
+using Hitf = tmath::RayHit<float>;
+
+namespace
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+}
+
+TEST(ray, ray_at)
+{
+    constexpr Rayf ray = { { 1, 2, 3 }, { 0, -1, 2 } };
+    constexpr Vec3f p = tmath::ray_at(ray, 1.5f);
+    EXPECT_EQ(p.x, 1.0f);
+    EXPECT_EQ(p.y, 0.5f);
+    EXPECT_EQ(p.z, 6.0f);
+}
+
+TEST(ray, triangle)
+{
+    const Vec3f v0 = { 0, 0, 0 }, v1 = { 4, 0, 0 }, v2 = { 0, 2, 0 };
+
+    Hitf hit = { inf, 0, 0 };
+    ASSERT_TRUE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, 3 }, { 0, 0, -1 } }, v0, v1, v2, 0.0f, hit));
+    EXPECT_FLOAT_EQ(hit.t, 3.0f);
+    EXPECT_FLOAT_EQ(hit.u, 0.25f);
+    EXPECT_FLOAT_EQ(hit.v, 0.25f);
+
+    // 背面也相交
+    Hitf back = { inf, 0, 0 };
+    EXPECT_TRUE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, -3 }, { 0, 0, 2 } }, v0, v1, v2, 0.0f, back));
+    EXPECT_FLOAT_EQ(back.t, 1.5f);
+
+    // 三角形外 / 平行 / 在起点之后
+    Hitf miss = { inf, 0, 0 };
+    EXPECT_FALSE(tmath::intersect_triangle(Rayf{ { 3, 1.5f, 3 }, { 0, 0, -1 } }, v0, v1, v2, 0.0f, miss));
+    EXPECT_FALSE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, 3 }, { 1, 0, 0 } }, v0, v1, v2, 0.0f, miss));
+    EXPECT_FALSE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, 3 }, { 0, 0, 1 } }, v0, v1, v2, 0.0f, miss));
+    EXPECT_EQ(miss.t, inf);
+
+    // 已经有更近的交点时不更新
+    Hitf closer = { 2.0f, 0.5f, 0.5f };
+    EXPECT_FALSE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, 3 }, { 0, 0, -1 } }, v0, v1, v2, 0.0f, closer));
+    EXPECT_EQ(closer.t, 2.0f);
+    EXPECT_EQ(closer.u, 0.5f);
+
+    // t_min
+    Hitf near = { inf, 0, 0 };
+    EXPECT_FALSE(tmath::intersect_triangle(Rayf{ { 1, 0.5f, 3 }, { 0, 0, -1 } }, v0, v1, v2, 3.5f, near));
+}
+
+TEST(ray, aabb)
+{
+    const tmath::AABB<Vec3f> box = { { -1, -1, -1 }, { 1, 1, 1 } };
+
+    Hitf hit = { inf, 0, 0 };
+    ASSERT_TRUE(tmath::intersect_aabb(Rayf{ { -5, 0.5f, 0.5f }, { 2, 0, 0 } }, box, 0.0f, hit));
+    EXPECT_EQ(hit.t, 2.0f);
+
+    // 起点在内部时为 t_min
+    Hitf inside = { inf, 0, 0 };
+    ASSERT_TRUE(tmath::intersect_aabb(Rayf{ { 0.5f, 0, 0 }, { 1, 2, 3 } }, box, 0.125f, inside));
+    EXPECT_EQ(inside.t, 0.125f);
+
+    // 擦过 / 反方向 / 超出 hit.t
+    Hitf miss = { inf, 0, 0 };
+    EXPECT_FALSE(tmath::intersect_aabb(Rayf{ { -5, 2, 0 }, { 1, 0.1f, 0 } }, box, 0.0f, miss));
+    EXPECT_FALSE(tmath::intersect_aabb(Rayf{ { -5, 0, 0 }, { -1, 0, 0 } }, box, 0.0f, miss));
+    Hitf far = { 3.0f, 0, 0 };
+    EXPECT_FALSE(tmath::intersect_aabb(Rayf{ { -5, 0, 0 }, { 1, 0, 0 } }, box, 0.0f, far));
+    EXPECT_EQ(far.t, 3.0f);
+}
+
+TMATH_DIAGNOSTICS_POP
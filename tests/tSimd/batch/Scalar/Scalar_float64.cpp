@@ -0,0 +1,77 @@
+#define TSIMD_TEST_INTRINSIC Scalar
+
+#include "../test.hpp"
+
+#include <string>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/Scalar/Scalar_float64.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp> // auto dispatch
+#include <tSimd/batch.hpp>
+
+#include "../test_float64.inl"
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void kernel_dyn_impl(const double* TMATH_RESTRICT arr, const size_t N, double* TMATH_RESTRICT out_result) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(double);
+            using batch_t = op::batch_t;
+            constexpr size_t Step = op::Lanes;
+
+            // 测试SimdOp后端
+            bool test = std::is_same_v<op, SimdOp<SimdInstruction::Scalar, double>>;
+            EXPECT_TRUE(test);
+            EXPECT_TRUE(op::CurrentInstruction == SimdInstruction::Scalar);
+            EXPECT_TRUE(op::BatchSize == 8);
+            EXPECT_TRUE(op::ElementSize == 8);
+            EXPECT_TRUE(op::Lanes == 1);
+            EXPECT_TRUE(op::BatchAlignment == 8);
+
+            std::string cur_intrinsic = TMATH_STR("" TSIMD_DYN_FUNC_ATTR);
+            EXPECT_TRUE(cur_intrinsic == "\"\"");
+
+            batch_t sum_n = op::zero();
+            for (size_t i = 0; i < N; i += Step)
+            {
+                batch_t tmp = op::loadu(arr + i);
+                sum_n = op::add(sum_n, tmp);
+            }
+            double sum = op::reduce_sum(sum_n);
+
+            *out_result = sum;
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_dyn_impl);
+
+void kernel(const double* arr, const size_t N, double* out_result) noexcept
+{
+    TSIMD_DYN_CALL(kernel_dyn_impl)(arr, N, out_result);
+}
+
+TEST(dyn_dispatch, basic)
+{
+    double numbers[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    double expected = 36.0;
+
+    double result = -1.0;
+    kernel(numbers, 8, &result);
+
+    EXPECT_NEAR(result, expected, 1e-12);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
\ No newline at end of file
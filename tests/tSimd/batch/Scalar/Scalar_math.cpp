@@ -0,0 +1,49 @@
+#define TSIMD_TEST_INTRINSIC Scalar
+
+#include "../test.hpp"
+
+#include <string>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/Scalar/Scalar_math.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp> // auto dispatch
+#include <tSimd/batch.hpp>
+
+#include "../test_math.inl"
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void kernel_dyn_impl() noexcept
+        {
+            // 测试 batch_math.inl 使用的SimdOp后端
+            bool test = std::is_same_v<math::op_f32, SimdOp<SimdInstruction::Scalar, float32>>;
+            EXPECT_TRUE(test);
+            EXPECT_TRUE(math::op_f32::Lanes == 1);
+
+            std::string cur_intrinsic = TMATH_STR("" TSIMD_DYN_FUNC_ATTR);
+            EXPECT_TRUE(cur_intrinsic == "\"\"");
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_dyn_impl);
+
+TEST(dyn_dispatch, basic)
+{
+    TSIMD_DYN_CALL(kernel_dyn_impl)();
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -1,4 +1,12 @@
 #include "../test.hpp"
+#include <tSimd/algorithm.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 // #define TSIMD_ONCE 1
 
@@ -31,7 +39,7 @@ static void kernel_zero(float* out) noexcept
 TEST(dyn_dispatch_x86_float32, zero)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float out[TOTAL];
 
@@ -75,7 +83,7 @@ static void kernel_set(float x, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, set)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float out[TOTAL];
 
@@ -117,7 +125,7 @@ static void kernel_load_store(const float* in, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, load_store)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float in[TOTAL], out[TOTAL];
 
@@ -160,7 +168,7 @@ static void kernel_loadu_storeu(const float* in, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, loadu_storeu)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float in[TOTAL], out[TOTAL];
 
@@ -203,7 +211,7 @@ static void kernel_add(const float* a, const float* b, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, add)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float a[TOTAL], b[TOTAL], out[TOTAL];
 
@@ -250,7 +258,7 @@ static void kernel_sub(const float* a, const float* b, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, sub)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float a[TOTAL], b[TOTAL], out[TOTAL];
 
@@ -297,7 +305,7 @@ static void kernel_mul(const float* a, const float* b, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, mul)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float a[TOTAL], b[TOTAL], out[TOTAL];
 
@@ -344,7 +352,7 @@ static void kernel_div(const float* a, const float* b, float* out) noexcept
 TEST(dyn_dispatch_x86_float32, div)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
     
     alignas(ALIGNMENT) float a[TOTAL], b[TOTAL], out[TOTAL];
 
@@ -395,7 +403,7 @@ static float kernel_sum(const float* in) noexcept
 TEST(dyn_dispatch_x86_float32, sum)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
     
     alignas(ALIGNMENT) float in[TOTAL];
 
@@ -412,6 +420,69 @@ TEST(dyn_dispatch_x86_float32, sum)
 }
 #endif
 
+// ------------------------------------------ reduce_min / reduce_max / reduce_mul / argmin / argmax ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // 只读取前 Lanes 个元素，返回 Lanes
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_horizontal_impl(const float* TMATH_RESTRICT in, float* TMATH_RESTRICT out, size_t* TMATH_RESTRICT index) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        const auto v = op::loadu(in);
+        out[0] = op::reduce_min(v);
+        out[1] = op::reduce_max(v);
+        out[2] = op::reduce_mul(v);
+        index[0] = op::argmin(v);
+        index[1] = op::argmax(v);
+        return op::Lanes;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_horizontal_impl);
+
+TEST(dyn_dispatch_x86_float32, horizontal)
+{
+    constexpr size_t MAX_LANES = 16;
+
+    for (size_t shift = 0; shift < MAX_LANES; ++shift)
+    {
+        float in[MAX_LANES];
+        for (size_t i = 0; i < MAX_LANES; ++i)
+            in[i] = float((i * 7 + shift) % MAX_LANES) * 0.25f - 1.5f;
+
+        float out[3];
+        size_t index[2];
+        const size_t L = TSIMD_DYN_CALL(kernel_horizontal_impl)(in, out, index);
+
+        const auto first = in, last = in + L;
+        const size_t expected_argmin = static_cast<size_t>(std::min_element(first, last) - first);
+        const size_t expected_argmax = static_cast<size_t>(std::max_element(first, last) - first);
+        double product = 1.0;
+        for (size_t i = 0; i < L; ++i) product *= in[i];
+
+        EXPECT_EQ(out[0], in[expected_argmin]) << "shift: " << shift;
+        EXPECT_EQ(out[1], in[expected_argmax]) << "shift: " << shift;
+        EXPECT_NEAR(out[2], product, 1e-5 * std::fabs(product)) << "shift: " << shift;
+        EXPECT_EQ(index[0], expected_argmin) << "shift: " << shift;
+        EXPECT_EQ(index[1], expected_argmax) << "shift: " << shift;
+
+        // 有多个最小值 / 最大值时返回第一个
+        if (L > 2)
+        {
+            const float min_value = in[expected_argmin];
+            const float max_value = in[expected_argmax];
+            in[L - 1] = min_value;
+            in[0] = max_value;
+            TSIMD_DYN_CALL(kernel_horizontal_impl)(in, out, index);
+            EXPECT_EQ(index[0], expected_argmin == 0 ? L - 1 : expected_argmin) << "shift: " << shift;
+            EXPECT_EQ(index[1], 0u) << "shift: " << shift;
+        }
+    }
+}
+#endif
+
 // ------------------------------------------ mul_add ------------------------------------------
 namespace tsimd::TSIMD_DYN_INSTRUCTION
 {
@@ -453,7 +524,7 @@ static float kernel_mul_add(const float* a, const float* b, const float* c) noex
 TEST(dyn_dispatch_x86_float32, mul_add)
 {
     constexpr size_t TOTAL = 16;
-    constexpr size_t ALIGNMENT = 32;
+    constexpr size_t ALIGNMENT = 64;
 
     alignas(ALIGNMENT) float a[TOTAL];
     alignas(ALIGNMENT) float b[TOTAL];
@@ -475,3 +546,766 @@ TEST(dyn_dispatch_x86_float32, mul_add)
     EXPECT_FLOAT_EQ(r, expected);
 }
 #endif
+
+// ------------------------------------------ mul_sub / neg_mul_add / neg / min / max ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按运算分段，每段 N 个元素
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_arith_impl(
+        const float* TMATH_RESTRICT a,
+        const float* TMATH_RESTRICT b,
+        const float* TMATH_RESTRICT c,
+        const size_t N,
+        float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const auto va = op::load_partial(a + i, lanes);
+            const auto vb = op::load_partial(b + i, lanes);
+            const auto vc = op::load_partial(c + i, lanes);
+
+            op::store_partial(out + 0 * N + i, op::mul_sub(va, vb, vc), lanes);
+            op::store_partial(out + 1 * N + i, op::neg_mul_add(va, vb, vc), lanes);
+            op::store_partial(out + 2 * N + i, op::neg(va), lanes);
+            op::store_partial(out + 3 * N + i, op::min(va, vb), lanes);
+            op::store_partial(out + 4 * N + i, op::max(va, vb), lanes);
+        });
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_arith_impl);
+
+TEST(dyn_dispatch_x86_float32, mul_sub_neg_min_max)
+{
+    constexpr size_t N = 37;
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+    float a[N], b[N], c[N], out[5 * N];
+    for (size_t i = 0; i < N; ++i)
+    {
+        // 乘积和差都可以精确表示，有无 FMA 结果相同
+        a[i] = float(int(i % 11) - 5);
+        b[i] = float(int(i % 7) - 3) * 0.5f;
+        c[i] = float(i) * 0.25f;
+    }
+    a[3] = 0.0f;
+    b[3] = -0.0f;
+    a[5] = nan;
+    b[6] = nan;
+
+    TSIMD_DYN_CALL(kernel_arith_impl)(a, b, c, N, out);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (i == 5 || i == 6)
+        {
+            continue;
+        }
+        EXPECT_EQ(out[0 * N + i], a[i] * b[i] - c[i]) << "mul_sub: " << i;
+        EXPECT_EQ(out[1 * N + i], c[i] - a[i] * b[i]) << "neg_mul_add: " << i;
+        EXPECT_EQ(out[3 * N + i], std::min(a[i], b[i])) << "min: " << i;
+        EXPECT_EQ(out[4 * N + i], std::max(a[i], b[i])) << "max: " << i;
+    }
+
+    // neg 只翻转符号位，0 和 NaN 也一样
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(std::bit_cast<uint32_t>(out[2 * N + i]), std::bit_cast<uint32_t>(a[i]) ^ 0x80000000u) << "neg: " << i;
+    }
+
+    // 与 minps / maxps 一致: 有 NaN 或者两个数都是0时返回 rhs
+    EXPECT_EQ(std::bit_cast<uint32_t>(out[3 * N + 3]), std::bit_cast<uint32_t>(-0.0f));
+    EXPECT_EQ(std::bit_cast<uint32_t>(out[4 * N + 3]), std::bit_cast<uint32_t>(-0.0f));
+    EXPECT_EQ(out[3 * N + 5], b[5]);
+    EXPECT_EQ(out[4 * N + 5], b[5]);
+    EXPECT_TRUE(std::isnan(out[3 * N + 6]));
+    EXPECT_TRUE(std::isnan(out[4 * N + 6]));
+}
+#endif
+
+// ------------------------------------------ load_partial + store_partial ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_partial_impl(const float* TMATH_RESTRICT in, const size_t count, float* TMATH_RESTRICT out_loaded, float* TMATH_RESTRICT out_stored) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        // load_partial 之后完整写出，检查剩余lane是否为0
+        op::storeu(out_loaded, op::load_partial(in, count));
+
+        // 完整读取之后 store_partial，检查是否只写入了前 count 个元素
+        op::store_partial(out_stored, op::loadu(in), count);
+    }
+
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_lanes_impl() noexcept
+    {
+        return TSIMD_DYN_SIMD_OP(float)::Lanes;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_partial_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_lanes_impl);
+
+TEST(dyn_dispatch_x86_float32, load_partial_store_partial)
+{
+    constexpr size_t TOTAL = 16;
+    constexpr size_t ALIGNMENT = 64;
+
+    const size_t lanes = TSIMD_DYN_CALL(kernel_lanes_impl)();
+
+    alignas(ALIGNMENT) float in[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i) in[i] = float(i + 1);
+
+    for (size_t count = 0; count <= lanes; ++count)
+    {
+        alignas(ALIGNMENT) float loaded[TOTAL], stored[TOTAL];
+        for (size_t i = 0; i < TOTAL; ++i)
+        {
+            loaded[i] = -1.0f;
+            stored[i] = -1.0f;
+        }
+
+        TSIMD_DYN_CALL(kernel_partial_impl)(in, count, loaded, stored);
+
+        for (size_t i = 0; i < lanes; ++i)
+        {
+            EXPECT_FLOAT_EQ(loaded[i], i < count ? in[i] : 0.0f) << "count: " << count << ", lane: " << i;
+            EXPECT_FLOAT_EQ(stored[i], i < count ? in[i] : -1.0f) << "count: " << count << ", lane: " << i;
+        }
+    }
+}
+#endif
+
+// ------------------------------------------ for_each_batch ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_for_each_batch_impl(
+        const float* TMATH_RESTRICT a,
+        const float* TMATH_RESTRICT b,
+        const float* TMATH_RESTRICT c,
+        const size_t N,
+        float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        for_each_batch<op>(N, [&](const size_t i, const auto count) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t va = op::load_partial(a + i, count);
+            batch_t vb = op::load_partial(b + i, count);
+            batch_t vc = op::load_partial(c + i, count);
+            op::store_partial(out + i, op::mul_add(va, vb, vc), count);
+        });
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_for_each_batch_impl);
+
+TEST(dyn_dispatch_x86_float32, for_each_batch)
+{
+    constexpr size_t TOTAL = 41;
+
+    float a[TOTAL], b[TOTAL], c[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        a[i] = float(i + 1);
+        b[i] = float(i % 7) - 3.0f;
+        c[i] = float(i) * 0.5f;
+    }
+
+    // 覆盖 N < Lanes, N == k * Lanes, N == k * Lanes + r 的情况
+    for (size_t n = 0; n < TOTAL; ++n)
+    {
+        float out[TOTAL + 1];
+        for (size_t i = 0; i <= TOTAL; ++i) out[i] = -1.0f;
+
+        TSIMD_DYN_CALL(kernel_for_each_batch_impl)(a, b, c, n, out);
+
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_FLOAT_EQ(out[i], a[i] * b[i] + c[i]) << "n: " << n << ", i: " << i;
+
+        // 不能越界写入
+        EXPECT_FLOAT_EQ(out[n], -1.0f) << "n: " << n;
+    }
+}
+#endif
+
+// ------------------------------------------ stream + prefetch + fence ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // in / out 按 BatchAlignment 对齐，N 为 Lanes 的整数倍
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_stream_impl(const float* TMATH_RESTRICT in, float* TMATH_RESTRICT out, const size_t N) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        for (size_t i = 0; i < N; i += op::Lanes)
+        {
+            op::prefetch(in + i);
+            op::prefetch<PrefetchHint::NTA>(in + i);
+            op::stream(out + i, op::add(op::load(in + i), op::set(1.0f)));
+        }
+        op::fence();
+    }
+
+    // out[i] = a[i] * 2，输出超过阈值时使用 stream
+    TSIMD_DYN_FUNC_ATTR
+    bool kernel_for_each_batch_store_impl(const float* TMATH_RESTRICT a, const size_t N, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        const auto two = op::set(2.0f);
+        const bool streaming = for_each_batch_store<op>(N, out, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            TSIMD_STORE_BATCH(op, out + i, op::mul(op::load_partial(a + i, lanes), two), lanes);
+        });
+        if (streaming)
+        {
+            op::fence();
+        }
+        return streaming;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_stream_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_for_each_batch_store_impl);
+
+TEST(dyn_dispatch_x86_float32, stream)
+{
+    constexpr size_t TOTAL = 64;
+    constexpr size_t ALIGNMENT = 64;
+
+    alignas(ALIGNMENT) float in[TOTAL], out[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i) in[i] = float(i) * 0.5f;
+    for (size_t i = 0; i < TOTAL; ++i) out[i] = -1.0f;
+
+    TSIMD_DYN_CALL(kernel_stream_impl)(in, out, TOTAL);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+        EXPECT_FLOAT_EQ(out[i], in[i] + 1.0f) << "i: " << i;
+}
+
+TEST(dyn_dispatch_x86_float32, for_each_batch_store)
+{
+    constexpr size_t TOTAL = 41;
+    constexpr size_t ALIGNMENT = 64;
+
+    alignas(ALIGNMENT) float a[TOTAL], out[TOTAL + 1];
+    for (size_t i = 0; i < TOTAL; ++i) a[i] = float(i) - 7.0f;
+
+    const size_t old_threshold = tsimd::streaming_store_threshold();
+    for (const size_t threshold : { size_t(0), size_t(64), std::numeric_limits<size_t>::max() })
+    {
+        tsimd::set_streaming_store_threshold(threshold);
+        for (size_t n = 0; n < TOTAL; ++n)
+        {
+            for (size_t i = 0; i <= TOTAL; ++i) out[i] = -1.0f;
+
+            const bool streaming = TSIMD_DYN_CALL(kernel_for_each_batch_store_impl)(a, n, out);
+            EXPECT_EQ(streaming, n * sizeof(float) >= threshold) << "n: " << n;
+
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_FLOAT_EQ(out[i], a[i] * 2.0f) << "n: " << n << ", i: " << i;
+            EXPECT_FLOAT_EQ(out[n], -1.0f) << "n: " << n;
+        }
+
+        // 不对齐的输出退化为普通的 store
+        TSIMD_DYN_CALL(kernel_for_each_batch_store_impl)(a, TOTAL - 1, out + 1);
+        for (size_t i = 0; i + 1 < TOTAL; ++i)
+            EXPECT_FLOAT_EQ(out[i + 1], a[i] * 2.0f) << "i: " << i;
+    }
+    tsimd::set_streaming_store_threshold(old_threshold);
+}
+#endif
+
+// ------------------------------------------ cmp_* + select + mask ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按运算分段，每段 TOTAL 个元素，lane为true时写入1，否则写入0:
+    // cmp_eq, cmp_ne, cmp_lt, cmp_le, cmp_gt, cmp_ge, mask_or(lt, eq), mask_not(lt)
+    // bits / any / all 为每个batch中 cmp_lt 的结果
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_cmp_impl(const float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, float* TMATH_RESTRICT out,
+                           uint32_t* TMATH_RESTRICT bits, bool* TMATH_RESTRICT any, bool* TMATH_RESTRICT all) noexcept
+    {
+        constexpr size_t TOTAL = 16;
+
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+        using mask_t = op::mask_t;
+        constexpr size_t Step = op::Lanes;
+
+        const batch_t one = op::set(1.0f);
+        const batch_t zero = op::zero();
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            batch_t va = op::loadu(a + i);
+            batch_t vb = op::loadu(b + i);
+
+            const mask_t lt = op::cmp_lt(va, vb);
+            const mask_t masks[] = {
+                op::cmp_eq(va, vb), op::cmp_ne(va, vb), lt, op::cmp_le(va, vb), op::cmp_gt(va, vb), op::cmp_ge(va, vb),
+                op::mask_or(lt, op::cmp_eq(va, vb)), op::mask_not(lt)
+            };
+            for (size_t k = 0; k < std::size(masks); ++k)
+            {
+                op::storeu(out + k * TOTAL + i, op::select(masks[k], one, zero));
+            }
+
+            bits[i / Step] = op::movemask(lt);
+            any[i / Step] = op::any(lt);
+            all[i / Step] = op::all(lt);
+        }
+
+        return Step;
+    }
+
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_clamp_impl(const float* TMATH_RESTRICT in, const size_t N, const float lo, const float hi, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        const batch_t vlo = op::set(lo);
+        const batch_t vhi = op::set(hi);
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t x = op::load_partial(in + i, lanes);
+            x = op::select(op::cmp_lt(x, vlo), vlo, x);
+            x = op::select(op::cmp_gt(x, vhi), vhi, x);
+            op::store_partial(out + i, x, lanes);
+        });
+    }
+
+    // 每个元素都满足 |a - b| <= epsilon
+    TSIMD_DYN_FUNC_ATTR
+    bool kernel_approximately_impl(const float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, const size_t N, const float epsilon) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        const batch_t pos = op::set(epsilon);
+        const batch_t neg = op::set(-epsilon);
+
+        bool result = true;
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            // 末尾batch中多出的lane都是 0 - 0，不影响结果
+            batch_t diff = op::sub(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes));
+            result = result && op::all(op::mask_and(op::cmp_le(diff, pos), op::cmp_ge(diff, neg)));
+        });
+        return result;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_cmp_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_clamp_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_approximately_impl);
+
+TEST(dyn_dispatch_x86_float32, cmp_select)
+{
+    constexpr size_t TOTAL = 16;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    // 前8个全部小于，之后4个全部不小于，最后4个混合 (包含NaN)
+    float a[TOTAL], b[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        a[i] = float(i) - 4.0f;
+        b[i] = i < 8 ? a[i] + 1.0f : (i < 12 ? a[i] - float(i % 2) : a[i] + float(i % 3) - 1.0f);
+    }
+    a[13] = nan;
+    b[15] = nan;
+
+    float out[8 * TOTAL];
+    uint32_t bits[TOTAL] = {};
+    bool any[TOTAL] = {}, all[TOTAL] = {};
+    const size_t lanes = TSIMD_DYN_CALL(kernel_cmp_impl)(a, b, out, bits, any, all);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        const bool expected[] = {
+            a[i] == b[i], a[i] != b[i], a[i] < b[i], a[i] <= b[i], a[i] > b[i], a[i] >= b[i],
+            a[i] < b[i] || a[i] == b[i], !(a[i] < b[i])
+        };
+        for (size_t k = 0; k < std::size(expected); ++k)
+        {
+            EXPECT_EQ(out[k * TOTAL + i], expected[k] ? 1.0f : 0.0f) << "op: " << k << ", i: " << i;
+        }
+    }
+
+    for (size_t batch = 0; batch < TOTAL / lanes; ++batch)
+    {
+        uint32_t expected_bits = 0;
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const size_t i = batch * lanes + lane;
+            expected_bits |= uint32_t(a[i] < b[i]) << lane;
+        }
+        const uint32_t full = (1u << lanes) - 1u;
+
+        EXPECT_EQ(bits[batch], expected_bits) << "batch: " << batch;
+        EXPECT_EQ(any[batch], expected_bits != 0) << "batch: " << batch;
+        EXPECT_EQ(all[batch], expected_bits == full) << "batch: " << batch;
+    }
+}
+
+TEST(dyn_dispatch_x86_float32, clamp_approximately)
+{
+    constexpr size_t TOTAL = 37;
+
+    float in[TOTAL], out[TOTAL], other[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        in[i] = float(i) * 0.5f - 9.0f;
+        out[i] = -100.0f;
+        other[i] = in[i] + (i % 2 ? 1e-4f : -1e-4f);
+    }
+
+    TSIMD_DYN_CALL(kernel_clamp_impl)(in, TOTAL, -2.5f, 3.0f, out);
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        EXPECT_EQ(out[i], std::clamp(in[i], -2.5f, 3.0f)) << "i: " << i;
+    }
+
+    for (size_t n = 0; n <= TOTAL; ++n)
+    {
+        EXPECT_TRUE(TSIMD_DYN_CALL(kernel_approximately_impl)(in, other, n, 1e-3f)) << "n: " << n;
+    }
+    EXPECT_FALSE(TSIMD_DYN_CALL(kernel_approximately_impl)(in, other, TOTAL, 1e-5f));
+
+    // 只有最后一个元素 (末尾batch) 不满足
+    other[TOTAL - 1] += 1.0f;
+    EXPECT_TRUE(TSIMD_DYN_CALL(kernel_approximately_impl)(in, other, TOTAL - 1, 1e-3f));
+    EXPECT_FALSE(TSIMD_DYN_CALL(kernel_approximately_impl)(in, other, TOTAL, 1e-3f));
+}
+#endif
+
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // 每组一个4x4矩阵 (矩阵之间相隔16个float): 读取4行，转置后写回 out
+    // 同时把每行 splat_x4 第k个元素的结果 (每个矩阵的对角线元素) 写入 diag 的第k行
+    // 返回组数，Scalar 没有这些函数，返回0
+    template<typename op>
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_x4_helper(const float* TMATH_RESTRICT in, const size_t groups, float* TMATH_RESTRICT out, float* TMATH_RESTRICT diag) noexcept
+    {
+        using batch_t = typename op::batch_t;
+
+        if constexpr (op::Lanes >= 4)
+        {
+            batch_t r0 = op::load_x4_strided(in + 0, 16, groups);
+            batch_t r1 = op::load_x4_strided(in + 4, 16, groups);
+            batch_t r2 = op::load_x4_strided(in + 8, 16, groups);
+            batch_t r3 = op::load_x4_strided(in + 12, 16, groups);
+            op::transpose_x4(r0, r1, r2, r3);
+            op::store_x4_strided(out + 0, 16, r0, groups);
+            op::store_x4_strided(out + 4, 16, r1, groups);
+            op::store_x4_strided(out + 8, 16, r2, groups);
+            op::store_x4_strided(out + 12, 16, r3, groups);
+
+            for (size_t k = 0; k < 4; ++k)
+            {
+                op::store_x4_strided(diag + 4 * k, 16, op::splat_x4(op::load_x4_strided(in + 4 * k, 16, groups), k), groups);
+            }
+            return op::Lanes / 4;
+        }
+        else
+        {
+            (void)in;
+            (void)groups;
+            (void)out;
+            (void)diag;
+            return 0;
+        }
+    }
+
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_x4_impl(const float* TMATH_RESTRICT in, const size_t groups, float* TMATH_RESTRICT out, float* TMATH_RESTRICT diag) noexcept
+    {
+        return kernel_x4_helper<TSIMD_DYN_SIMD_OP(float)>(in, groups, out, diag);
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_x4_impl);
+
+TEST(dyn_dispatch_x86_float32, x4_groups)
+{
+    constexpr size_t MAX_GROUPS = 4;
+    constexpr size_t TOTAL = MAX_GROUPS * 16;
+
+    float in[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        in[i] = float(i);
+    }
+
+    float scratch[TOTAL], scratch_diag[TOTAL];
+    const size_t max_groups = TSIMD_DYN_CALL(kernel_x4_impl)(in, 1, scratch, scratch_diag);
+    for (size_t groups = 1; groups <= max_groups; ++groups)
+    {
+        float out[TOTAL], diag[TOTAL];
+        std::fill(std::begin(out), std::end(out), -1.0f);
+        std::fill(std::begin(diag), std::end(diag), -1.0f);
+
+        TSIMD_DYN_CALL(kernel_x4_impl)(in, groups, out, diag);
+
+        for (size_t g = 0; g < MAX_GROUPS; ++g)
+        {
+            const float* m = in + g * 16;
+            for (size_t r = 0; r < 4; ++r)
+            {
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    const size_t i = g * 16 + r * 4 + c;
+                    // 超出 groups 的组不写入
+                    EXPECT_EQ(out[i], g < groups ? m[c * 4 + r] : -1.0f) << "groups: " << groups << ", i: " << i;
+                    EXPECT_EQ(diag[i], g < groups ? m[r * 5] : -1.0f) << "groups: " << groups << ", i: " << i;
+                }
+            }
+        }
+    }
+}
+#endif
+
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // gathered[i] = table[idx[i]]，再按同样的下标 scatter 到 scattered
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_gather_scatter_impl(const float* TMATH_RESTRICT table, const int32* TMATH_RESTRICT idx, const size_t N, float* TMATH_RESTRICT gathered, float* TMATH_RESTRICT scattered) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        for (size_t i = 0; i < N; i += op::Lanes)
+        {
+            const auto index = op::load_index(idx + i);
+            const auto v = op::gather(table, index);
+            op::storeu(gathered + i, v);
+            op::scatter(scattered, index, op::add(v, op::set(1.0f)));
+        }
+    }
+
+    // 反转、循环移位、相邻交换、两个batch的低半部分交错、广播最后一个lane
+    template<typename op, size_t... K>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_lane_ops_helper(const float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, float* TMATH_RESTRICT out, std::index_sequence<K...>) noexcept
+    {
+        constexpr int L = static_cast<int>(op::Lanes);
+
+        const auto va = op::loadu(a);
+        const auto vb = op::loadu(b);
+        op::storeu(out + 0 * L, op::template permute<(L - 1 - static_cast<int>(K))...>(va));
+        op::storeu(out + 1 * L, op::template permute<((static_cast<int>(K) + 1) % L)...>(va));
+        op::storeu(out + 2 * L, op::template permute<(L == 1 ? 0 : static_cast<int>(K) ^ 1)...>(va));
+        op::storeu(out + 3 * L, op::template shuffle<(K % 2 == 0 ? static_cast<int>(K) / 2 : L + static_cast<int>(K) / 2)...>(va, vb));
+        op::storeu(out + 4 * L, op::template broadcast_lane<L - 1>(va));
+    }
+
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_lane_ops_impl(const float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        kernel_lane_ops_helper<op>(a, b, out, std::make_index_sequence<op::Lanes>{});
+        return op::Lanes;
+    }
+
+    // 把 N 个K分量的元素拆成K个数组 (soa + c * N)，再交错写回 out
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_interleave_impl(const float* TMATH_RESTRICT in, const size_t K, const size_t N, float* TMATH_RESTRICT soa, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        for (size_t i = 0; i < N; i += op::Lanes)
+        {
+            batch_t c[4];
+            switch (K)
+            {
+            case 2:
+                op::deinterleave2(in + i * K, c[0], c[1]);
+                op::interleave2(out + i * K, c[0], c[1]);
+                break;
+            case 3:
+                op::deinterleave3(in + i * K, c[0], c[1], c[2]);
+                op::interleave3(out + i * K, c[0], c[1], c[2]);
+                break;
+            default:
+                op::deinterleave4(in + i * K, c[0], c[1], c[2], c[3]);
+                op::interleave4(out + i * K, c[0], c[1], c[2], c[3]);
+                break;
+            }
+            for (size_t k = 0; k < K; ++k)
+            {
+                op::storeu(soa + k * N + i, c[k]);
+            }
+        }
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_gather_scatter_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_lane_ops_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_interleave_impl);
+
+TEST(dyn_dispatch_x86_float32, gather_scatter)
+{
+    constexpr size_t TOTAL = 64;
+    constexpr size_t TABLE = 37;
+
+    float table[TABLE];
+    for (size_t i = 0; i < TABLE; ++i) table[i] = float(i) * 1.5f - 3.0f;
+
+    // 包含重复的下标，scatter 按顺序写入，后面的元素覆盖前面的
+    tsimd::int32 idx[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i) idx[i] = static_cast<tsimd::int32>((i * 7 + 3) % TABLE);
+
+    float gathered[TOTAL], scattered[TABLE], expected[TABLE];
+    std::fill(std::begin(scattered), std::end(scattered), -100.0f);
+    std::fill(std::begin(expected), std::end(expected), -100.0f);
+    for (size_t i = 0; i < TOTAL; ++i) expected[idx[i]] = table[idx[i]] + 1.0f;
+
+    TSIMD_DYN_CALL(kernel_gather_scatter_impl)(table, idx, TOTAL, gathered, scattered);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+        EXPECT_EQ(gathered[i], table[idx[i]]) << "i: " << i;
+    for (size_t i = 0; i < TABLE; ++i)
+        EXPECT_EQ(scattered[i], expected[i]) << "i: " << i;
+}
+
+TEST(dyn_dispatch_x86_float32, permute_shuffle)
+{
+    constexpr size_t MAX_LANES = 16;
+
+    float a[MAX_LANES], b[MAX_LANES], out[5 * MAX_LANES];
+    for (size_t i = 0; i < MAX_LANES; ++i)
+    {
+        a[i] = float(i);
+        b[i] = float(i) + 100.0f;
+    }
+
+    const size_t L = TSIMD_DYN_CALL(kernel_lane_ops_impl)(a, b, out);
+    for (size_t k = 0; k < L; ++k)
+    {
+        EXPECT_EQ(out[0 * L + k], a[L - 1 - k]) << "reverse, k: " << k;
+        EXPECT_EQ(out[1 * L + k], a[(k + 1) % L]) << "rotate, k: " << k;
+        EXPECT_EQ(out[2 * L + k], a[L == 1 ? 0 : k ^ 1]) << "swap, k: " << k;
+        EXPECT_EQ(out[3 * L + k], k % 2 == 0 ? a[k / 2] : b[k / 2]) << "zip, k: " << k;
+        EXPECT_EQ(out[4 * L + k], a[L - 1]) << "broadcast, k: " << k;
+    }
+}
+
+static void check_interleave(const size_t K)
+{
+    constexpr size_t N = 32;
+    constexpr size_t MAX_K = 4;
+
+    float in[N * MAX_K], soa[N * MAX_K], out[N * MAX_K];
+    for (size_t i = 0; i < N * K; ++i) in[i] = float(i) * 0.25f;
+    std::fill(std::begin(out), std::end(out), -1.0f);
+
+    TSIMD_DYN_CALL(kernel_interleave_impl)(in, K, N, soa, out);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        for (size_t c = 0; c < K; ++c)
+        {
+            EXPECT_EQ(soa[c * N + i], in[i * K + c]) << "K: " << K << ", i: " << i << ", c: " << c;
+        }
+    }
+    for (size_t i = 0; i < N * K; ++i)
+        EXPECT_EQ(out[i], in[i]) << "K: " << K << ", i: " << i;
+}
+
+TEST(dyn_dispatch_x86_float32, interleave_deinterleave)
+{
+    check_interleave(2);
+    check_interleave(3);
+    check_interleave(4);
+}
+#endif
+
+
+// ---------------------------------- float16 ----------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // in -> half (store_f16) -> out (load_f16)，末尾不足一个batch的部分使用 _partial
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_f16_round_trip_impl(const float* TMATH_RESTRICT in, const size_t N, float16* TMATH_RESTRICT half, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            op::store_f16_partial(half + i, op::load_partial(in + i, lanes), lanes);
+        });
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            op::store_partial(out + i, op::load_f16_partial(half + i, lanes), lanes);
+        });
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_f16_round_trip_impl);
+
+TEST(dyn_dispatch_x86_float32, load_store_f16)
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+    // 舍入的边界: 65504 是最大的有限值，65520 舍入到 inf，2^-25 舍入到0 (ties to even)，2^-24 是最小的非规格化数
+    std::vector<float> in = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.1f, 1.0f / 3.0f, 65504.0f, 65519.0f, 65520.0f, -70000.0f,
+        0x1p-14f, 0x1p-24f, 0x1p-25f, 0x1.8p-25f, 0x1.8p-24f, 0x1.0p-20f + 0x1p-40f, 1e-8f, 1e-40f,
+        1.0f + 0x1p-11f, 1.0f + 0x3p-11f, 2049.0f, 2051.0f, inf, -inf, nan, -nan,
+    };
+    // 按位均匀地遍历 float32 的范围 (包括非规格化数、inf、NaN)
+    for (uint32_t bits = 0; bits < 0xFFF00000u; bits += 0x000FF001u)
+    {
+        in.push_back(std::bit_cast<float>(bits));
+    }
+    const size_t N = in.size();
+
+    std::vector<tsimd::float16> half(N + 1, tsimd::float16::from_bits(0xABCD));
+    std::vector<float> out(N + 1, -1.0f);
+    TSIMD_DYN_CALL(kernel_f16_round_trip_impl)(in.data(), N, half.data(), out.data());
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (std::isnan(in[i]))
+        {
+            EXPECT_TRUE((half[i].bits & 0x7C00u) == 0x7C00u && (half[i].bits & 0x3FFu) != 0) << "i: " << i;
+            EXPECT_TRUE(std::isnan(out[i])) << "i: " << i;
+            continue;
+        }
+        EXPECT_EQ(half[i].bits, tsimd::float16(in[i]).bits) << "i: " << i << ", in: " << in[i];
+        EXPECT_EQ(std::bit_cast<uint32_t>(out[i]), std::bit_cast<uint32_t>(static_cast<float>(half[i]))) << "i: " << i;
+    }
+    // 不会写到 N 之后
+    EXPECT_EQ(half[N].bits, 0xABCD);
+    EXPECT_EQ(out[N], -1.0f);
+
+    EXPECT_EQ(tsimd::float16(65504.0f).bits, 0x7BFF);
+    EXPECT_EQ(tsimd::float16(65520.0f).bits, 0x7C00);
+    EXPECT_EQ(tsimd::float16(0x1p-25f).bits, 0x0000);
+    EXPECT_EQ(tsimd::float16(0x1.8p-25f).bits, 0x0001);
+    EXPECT_EQ(tsimd::float16(1.0f + 0x1p-11f).bits, 0x3C00); // tie -> even
+    EXPECT_EQ(tsimd::float16(1.0f + 0x3p-11f).bits, 0x3C02);
+}
+#endif
@@ -0,0 +1,403 @@
+#include "../test.hpp"
+#include <tSimd/algorithm.hpp>
+
+#include <cmath>
+#include <limits>
+
+// #define TSIMD_ONCE 1
+
+// float64 的kernel都写成模板，同时测试 TSIMD_DYN_DISPATCH_FUNC_TEMPLATE
+
+// ------------------------------------------ zero + set ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_zero_set_f64_impl(T x, T* TMATH_RESTRICT out_zero, T* TMATH_RESTRICT out_set) noexcept
+    {
+        constexpr size_t TOTAL = 16;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            op::storeu(out_zero + i, op::zero());
+            op::storeu(out_set + i, op::set(x));
+        }
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_zero_set_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, zero_set)
+{
+    constexpr size_t TOTAL = 16;
+    constexpr size_t ALIGNMENT = 64;
+
+    alignas(ALIGNMENT) double out_zero[TOTAL], out_set[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        out_zero[i] = -1.0;
+        out_set[i] = -1.0;
+    }
+
+    TSIMD_DYN_CALL(kernel_zero_set_f64_impl<double>)(3.5, out_zero, out_set);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        EXPECT_DOUBLE_EQ(out_zero[i], 0.0);
+        EXPECT_DOUBLE_EQ(out_set[i], 3.5);
+    }
+}
+#endif
+
+// ------------------------------------------ load + store, loadu + storeu ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_load_store_f64_impl(const T* TMATH_RESTRICT in, T* TMATH_RESTRICT out, T* TMATH_RESTRICT outu) noexcept
+    {
+        constexpr size_t TOTAL = 16;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            op::store(out + i, op::load(in + i));
+        }
+
+        // 错开一个元素，保证不对齐
+        for (size_t i = 0; i + Step <= TOTAL - 1; i += Step)
+        {
+            op::storeu(outu + 1 + i, op::loadu(in + 1 + i));
+        }
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_load_store_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, load_store)
+{
+    constexpr size_t TOTAL = 16;
+    constexpr size_t ALIGNMENT = 64;
+
+    alignas(ALIGNMENT) double in[TOTAL], out[TOTAL], outu[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        in[i] = double(i) * 1.25;
+        out[i] = -1.0;
+        outu[i] = -1.0;
+    }
+
+    TSIMD_DYN_CALL(kernel_load_store_f64_impl<double>)(in, out, outu);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+        EXPECT_DOUBLE_EQ(out[i], in[i]);
+
+    // Lanes 最大为8，15个元素中至少前8个被写入
+    EXPECT_DOUBLE_EQ(outu[0], -1.0);
+    for (size_t i = 1; i <= 8; ++i)
+        EXPECT_DOUBLE_EQ(outu[i], in[i]);
+}
+#endif
+
+// ------------------------------------------ stream + prefetch + fence ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_stream_f64_impl(const T* TMATH_RESTRICT in, T* TMATH_RESTRICT out) noexcept
+    {
+        constexpr size_t TOTAL = 16;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            op::template prefetch<PrefetchHint::T1>(in + i);
+            op::stream(out + i, op::load(in + i));
+        }
+        op::fence();
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_stream_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, stream)
+{
+    constexpr size_t TOTAL = 16;
+    constexpr size_t ALIGNMENT = 64;
+
+    alignas(ALIGNMENT) double in[TOTAL], out[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        in[i] = double(i) * -0.75;
+        out[i] = -1.0;
+    }
+
+    TSIMD_DYN_CALL(kernel_stream_f64_impl<double>)(in, out);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+        EXPECT_DOUBLE_EQ(out[i], in[i]);
+}
+#endif
+
+// ------------------------------------------ add, sub, mul, div ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_arith_f64_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, T* TMATH_RESTRICT out) noexcept
+    {
+        constexpr size_t TOTAL = 16;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            batch_t va = op::loadu(a + i);
+            batch_t vb = op::loadu(b + i);
+
+            op::storeu(out + i, op::add(va, vb));
+            op::storeu(out + TOTAL + i, op::sub(va, vb));
+            op::storeu(out + 2 * TOTAL + i, op::mul(va, vb));
+            op::storeu(out + 3 * TOTAL + i, op::div(va, vb));
+        }
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_arith_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, arith)
+{
+    constexpr size_t TOTAL = 16;
+
+    double a[TOTAL], b[TOTAL], out[4 * TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        // 使用单精度无法精确表示的值，确认计算确实为双精度
+        a[i] = 1.0 + double(i) * 1e-10;
+        b[i] = 3.0 - double(i) * 0.1;
+    }
+
+    TSIMD_DYN_CALL(kernel_arith_f64_impl<double>)(a, b, out);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        EXPECT_DOUBLE_EQ(out[i], a[i] + b[i]);
+        EXPECT_DOUBLE_EQ(out[TOTAL + i], a[i] - b[i]);
+        EXPECT_DOUBLE_EQ(out[2 * TOTAL + i], a[i] * b[i]);
+        EXPECT_DOUBLE_EQ(out[3 * TOTAL + i], a[i] / b[i]);
+    }
+}
+#endif
+
+// ------------------------------------------ reduce_sum + mul_add ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    T kernel_dot_f64_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, const size_t N) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+
+        batch_t acc = op::zero();
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            acc = op::mul_add(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes), acc);
+        });
+        return op::reduce_sum(acc);
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_dot_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, dot)
+{
+    constexpr size_t TOTAL = 19;
+
+    double a[TOTAL], b[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        a[i] = double(i + 1);
+        b[i] = 0.5 + double(i % 3);
+    }
+
+    for (size_t n = 0; n <= TOTAL; ++n)
+    {
+        double expected = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            expected += a[i] * b[i];
+
+        EXPECT_DOUBLE_EQ(TSIMD_DYN_CALL(kernel_dot_f64_impl<double>)(a, b, n), expected) << "n: " << n;
+    }
+}
+
+// 同一个模板kernel，float 和 double 各自有一张函数指针表
+TEST(dyn_dispatch_x86_float64, template_table_both_types)
+{
+    constexpr size_t TOTAL = 19;
+
+    float af[TOTAL], bf[TOTAL];
+    double ad[TOTAL], bd[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        af[i] = float(i + 1);
+        bf[i] = 2.0f;
+        ad[i] = double(i + 1);
+        bd[i] = 2.0;
+    }
+
+    // 2 * (1 + 2 + ... + 19)
+    EXPECT_FLOAT_EQ(TSIMD_DYN_CALL(kernel_dot_f64_impl<float>)(af, bf, TOTAL), 380.0f);
+    EXPECT_DOUBLE_EQ(TSIMD_DYN_CALL(kernel_dot_f64_impl<double>)(ad, bd, TOTAL), 380.0);
+}
+#endif
+
+// ------------------------------------------ load_partial + store_partial ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_partial_f64_impl(const T* TMATH_RESTRICT in, const size_t count, T* TMATH_RESTRICT out_loaded, T* TMATH_RESTRICT out_stored) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+
+        op::storeu(out_loaded, op::load_partial(in, count));
+        op::store_partial(out_stored, op::loadu(in), count);
+
+        return op::Lanes;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_partial_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, load_partial_store_partial)
+{
+    constexpr size_t TOTAL = 8;
+
+    double in[TOTAL];
+    for (size_t i = 0; i < TOTAL; ++i) in[i] = double(i + 1);
+
+    for (size_t count = 0; ; ++count)
+    {
+        double loaded[TOTAL], stored[TOTAL];
+        for (size_t i = 0; i < TOTAL; ++i)
+        {
+            loaded[i] = -1.0;
+            stored[i] = -1.0;
+        }
+
+        const size_t lanes = TSIMD_DYN_CALL(kernel_partial_f64_impl<double>)(in, count, loaded, stored);
+
+        for (size_t i = 0; i < lanes; ++i)
+        {
+            EXPECT_DOUBLE_EQ(loaded[i], i < count ? in[i] : 0.0) << "count: " << count << ", lane: " << i;
+            EXPECT_DOUBLE_EQ(stored[i], i < count ? in[i] : -1.0) << "count: " << count << ", lane: " << i;
+        }
+
+        if (count >= lanes) break;
+    }
+}
+#endif
+
+// ------------------------------------------ cmp_* + select + mask ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按运算分段，每段 TOTAL 个元素: cmp_eq, cmp_ne, cmp_lt, cmp_le, cmp_gt, cmp_ge
+    // lane为true时写入a，否则写入b
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_cmp_f64_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, T* TMATH_RESTRICT out,
+                               uint32_t* TMATH_RESTRICT bits, bool* TMATH_RESTRICT any, bool* TMATH_RESTRICT all) noexcept
+    {
+        constexpr size_t TOTAL = 8;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+        using mask_t = typename op::mask_t;
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            batch_t va = op::loadu(a + i);
+            batch_t vb = op::loadu(b + i);
+
+            const mask_t masks[] = {
+                op::cmp_eq(va, vb), op::cmp_ne(va, vb), op::cmp_lt(va, vb),
+                op::cmp_le(va, vb), op::cmp_gt(va, vb), op::cmp_ge(va, vb)
+            };
+            for (size_t k = 0; k < std::size(masks); ++k)
+            {
+                op::storeu(out + k * TOTAL + i, op::select(masks[k], va, vb));
+            }
+
+            const mask_t le = op::mask_and(op::mask_not(op::cmp_gt(va, vb)), op::mask_or(masks[2], masks[0]));
+            bits[i / Step] = op::movemask(le);
+            any[i / Step] = op::any(le);
+            all[i / Step] = op::all(le);
+        }
+
+        return Step;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_cmp_f64_impl);
+
+TEST(dyn_dispatch_x86_float64, cmp_select)
+{
+    constexpr size_t TOTAL = 8;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // 单精度下相等，双精度下不相等
+    double a[TOTAL] = { 1.0, 2.0, 3.0, 4.0, 1.0, nan, 7.0, 1.0 + 1e-12 };
+    double b[TOTAL] = { 2.0, 3.0, 4.0, 4.0, 0.0, 6.0, nan, 1.0 };
+
+    double out[6 * TOTAL];
+    uint32_t bits[TOTAL] = {};
+    bool any[TOTAL] = {}, all[TOTAL] = {};
+    const size_t lanes = TSIMD_DYN_CALL(kernel_cmp_f64_impl<double>)(a, b, out, bits, any, all);
+
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        const bool expected[] = { a[i] == b[i], a[i] != b[i], a[i] < b[i], a[i] <= b[i], a[i] > b[i], a[i] >= b[i] };
+        for (size_t k = 0; k < std::size(expected); ++k)
+        {
+            const double selected = out[k * TOTAL + i];
+            const double expected_value = expected[k] ? a[i] : b[i];
+            if (std::isnan(expected_value))
+                TMATH_EXPECT_IS_NAN(selected);
+            else
+                EXPECT_EQ(selected, expected_value) << "op: " << k << ", i: " << i;
+        }
+    }
+
+    for (size_t batch = 0; batch < TOTAL / lanes; ++batch)
+    {
+        uint32_t expected_bits = 0;
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const size_t i = batch * lanes + lane;
+            expected_bits |= uint32_t(a[i] <= b[i]) << lane;
+        }
+
+        EXPECT_EQ(bits[batch], expected_bits) << "batch: " << batch;
+        EXPECT_EQ(any[batch], expected_bits != 0) << "batch: " << batch;
+        EXPECT_EQ(all[batch], expected_bits == (1u << lanes) - 1u) << "batch: " << batch;
+    }
+}
+#endif
@@ -0,0 +1,531 @@
+#include "../test.hpp"
+#include <tSimd/algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// #define TSIMD_ONCE 1
+
+// 整数kernel都写成模板，int32 / uint32 / int16 / uint8 共用
+
+// ------------------------------------------ 公共运算 ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按运算分段，每段 N 个元素:
+    // add, sub, bit_and, bit_or, bit_xor, bit_not, min, max, shift_left, shift_right
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int_common_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, const size_t N, const int shift, T* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t va = op::load_partial(a + i, lanes);
+            batch_t vb = op::load_partial(b + i, lanes);
+
+            op::store_partial(out + 0 * N + i, op::add(va, vb), lanes);
+            op::store_partial(out + 1 * N + i, op::sub(va, vb), lanes);
+            op::store_partial(out + 2 * N + i, op::bit_and(va, vb), lanes);
+            op::store_partial(out + 3 * N + i, op::bit_or(va, vb), lanes);
+            op::store_partial(out + 4 * N + i, op::bit_xor(va, vb), lanes);
+            op::store_partial(out + 5 * N + i, op::bit_not(va), lanes);
+            op::store_partial(out + 6 * N + i, op::min(va, vb), lanes);
+            op::store_partial(out + 7 * N + i, op::max(va, vb), lanes);
+            op::store_partial(out + 8 * N + i, op::shift_left(va, shift), lanes);
+            op::store_partial(out + 9 * N + i, op::shift_right(va, shift), lanes);
+        });
+    }
+
+    // out 按 BatchAlignment 对齐，N 为 Lanes 的整数倍
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int_stream_impl(const T* TMATH_RESTRICT a, const size_t N, T* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+
+        for (size_t i = 0; i < N; i += op::Lanes)
+        {
+            op::template prefetch<PrefetchHint::T2>(a + i);
+            op::stream(out + i, op::loadu(a + i));
+        }
+        op::fence();
+    }
+
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int_mullo_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, const size_t N, T* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            op::store_partial(out + i, op::mullo(op::load_partial(a + i, lanes), op::load_partial(b + i, lanes)), lanes);
+        });
+    }
+
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int_sat_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, const size_t N, T* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t va = op::load_partial(a + i, lanes);
+            batch_t vb = op::load_partial(b + i, lanes);
+            op::store_partial(out + i, op::add_sat(va, vb), lanes);
+            op::store_partial(out + N + i, op::sub_sat(va, vb), lanes);
+        });
+    }
+
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    T kernel_int_sum_impl(const T* TMATH_RESTRICT a, const size_t N) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+
+        batch_t acc = op::zero();
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            acc = op::add(acc, op::load_partial(a + i, lanes));
+        });
+        return op::reduce_sum(acc);
+    }
+
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_int_lanes_impl() noexcept
+    {
+        return TSIMD_DYN_SIMD_OP(T)::Lanes;
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_common_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_mullo_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_sat_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_sum_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_lanes_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_stream_impl);
+
+namespace test_integer
+{
+    // 覆盖正负数、边界值的伪随机数据
+    template<typename T>
+    static std::vector<T> make_data(const size_t n, uint32_t seed)
+    {
+        std::vector<T> data(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            data[i] = static_cast<T>(seed >> 7);
+        }
+        data[0] = std::numeric_limits<T>::max();
+        data[1] = std::numeric_limits<T>::min();
+        return data;
+    }
+
+    template<typename T>
+    using wide_unsigned_t = std::conditional_t<(sizeof(T) < sizeof(uint32_t)), uint32_t, uint64_t>;
+
+    template<typename T>
+    static T wrap(const int64_t x)
+    {
+        return static_cast<T>(static_cast<wide_unsigned_t<T>>(x));
+    }
+
+    template<typename T>
+    static T saturate(const int64_t x)
+    {
+        if (x < int64_t(std::numeric_limits<T>::min())) return std::numeric_limits<T>::min();
+        if (x > int64_t(std::numeric_limits<T>::max())) return std::numeric_limits<T>::max();
+        return static_cast<T>(x);
+    }
+
+    template<typename T>
+    static void check_common(const int shift)
+    {
+        constexpr size_t N = 67; // 不是任何Lanes的整数倍
+        auto a = make_data<T>(N, 1);
+        auto b = make_data<T>(N, 2);
+        b[2] = a[2]; // 相等的情况
+
+        std::vector<T> out(10 * N);
+        TSIMD_DYN_CALL(kernel_int_common_impl<T>)(a.data(), b.data(), N, shift, out.data());
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const int64_t x = a[i], y = b[i];
+            EXPECT_EQ(out[0 * N + i], wrap<T>(x + y)) << "add, i: " << i;
+            EXPECT_EQ(out[1 * N + i], wrap<T>(x - y)) << "sub, i: " << i;
+            EXPECT_EQ(out[2 * N + i], T(a[i] & b[i])) << "bit_and, i: " << i;
+            EXPECT_EQ(out[3 * N + i], T(a[i] | b[i])) << "bit_or, i: " << i;
+            EXPECT_EQ(out[4 * N + i], T(a[i] ^ b[i])) << "bit_xor, i: " << i;
+            EXPECT_EQ(out[5 * N + i], T(~a[i])) << "bit_not, i: " << i;
+            EXPECT_EQ(out[6 * N + i], std::min(a[i], b[i])) << "min, i: " << i;
+            EXPECT_EQ(out[7 * N + i], std::max(a[i], b[i])) << "max, i: " << i;
+            EXPECT_EQ(out[8 * N + i], wrap<T>(int64_t(static_cast<wide_unsigned_t<T>>(a[i]) << shift))) << "shift_left, i: " << i;
+            // 有符号为算术右移，无符号为逻辑右移
+            EXPECT_EQ(out[9 * N + i], T(x >> shift)) << "shift_right, i: " << i;
+        }
+    }
+
+    template<typename T>
+    static void check_stream()
+    {
+        constexpr size_t N = 128; // 所有 Lanes 的整数倍
+        auto a = make_data<T>(N, 8);
+
+        alignas(64) T out[N];
+        TSIMD_DYN_CALL(kernel_int_stream_impl<T>)(a.data(), N, out);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(out[i], a[i]) << "i: " << i;
+        }
+    }
+
+    template<typename T>
+    static void check_mullo()
+    {
+        constexpr size_t N = 67;
+        auto a = make_data<T>(N, 3);
+        auto b = make_data<T>(N, 4);
+
+        std::vector<T> out(N);
+        TSIMD_DYN_CALL(kernel_int_mullo_impl<T>)(a.data(), b.data(), N, out.data());
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const T expected = static_cast<T>(static_cast<wide_unsigned_t<T>>(a[i]) * static_cast<wide_unsigned_t<T>>(b[i]));
+            EXPECT_EQ(out[i], expected) << "i: " << i;
+        }
+    }
+
+    template<typename T>
+    static void check_sat()
+    {
+        constexpr size_t N = 67;
+        auto a = make_data<T>(N, 5);
+        auto b = make_data<T>(N, 6);
+
+        std::vector<T> out(2 * N);
+        TSIMD_DYN_CALL(kernel_int_sat_impl<T>)(a.data(), b.data(), N, out.data());
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(out[i], saturate<T>(int64_t(a[i]) + int64_t(b[i]))) << "add_sat, i: " << i;
+            EXPECT_EQ(out[N + i], saturate<T>(int64_t(a[i]) - int64_t(b[i]))) << "sub_sat, i: " << i;
+        }
+    }
+
+    template<typename T>
+    static void check_sum()
+    {
+        constexpr size_t N = 67;
+        auto a = make_data<T>(N, 7);
+
+        T expected = 0;
+        for (size_t i = 0; i < N; ++i) expected = wrap<T>(int64_t(expected) + int64_t(a[i]));
+
+        EXPECT_EQ(TSIMD_DYN_CALL(kernel_int_sum_impl<T>)(a.data(), N), expected);
+    }
+}
+
+TEST(dyn_dispatch_x86_integer, common)
+{
+    for (int shift : { 0, 1, 3, 7 })
+    {
+        test_integer::check_common<tsimd::int32>(shift);
+        test_integer::check_common<tsimd::uint32>(shift);
+        test_integer::check_common<tsimd::int16>(shift);
+        test_integer::check_common<tsimd::uint8>(shift);
+    }
+    test_integer::check_common<tsimd::int32>(31);
+    test_integer::check_common<tsimd::uint32>(31);
+    test_integer::check_common<tsimd::int16>(15);
+}
+
+TEST(dyn_dispatch_x86_integer, stream)
+{
+    test_integer::check_stream<tsimd::int32>();
+    test_integer::check_stream<tsimd::uint32>();
+    test_integer::check_stream<tsimd::int16>();
+    test_integer::check_stream<tsimd::uint8>();
+}
+
+TEST(dyn_dispatch_x86_integer, mullo)
+{
+    test_integer::check_mullo<tsimd::int32>();
+    test_integer::check_mullo<tsimd::uint32>();
+    test_integer::check_mullo<tsimd::int16>();
+}
+
+TEST(dyn_dispatch_x86_integer, saturate)
+{
+    test_integer::check_sat<tsimd::int16>();
+    test_integer::check_sat<tsimd::uint8>();
+}
+
+TEST(dyn_dispatch_x86_integer, reduce_sum)
+{
+    test_integer::check_sum<tsimd::int32>();
+    test_integer::check_sum<tsimd::uint32>();
+}
+
+// 有SIMD整数指令时，int32 与 float32 的Lanes一致，uint8 的Lanes为 int16 的2倍
+TEST(dyn_dispatch_x86_integer, lanes)
+{
+    const size_t lanes32 = TSIMD_DYN_CALL(kernel_int_lanes_impl<tsimd::int32>)();
+    const size_t lanes16 = TSIMD_DYN_CALL(kernel_int_lanes_impl<tsimd::int16>)();
+    const size_t lanes8 = TSIMD_DYN_CALL(kernel_int_lanes_impl<tsimd::uint8>)();
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_int_lanes_impl<tsimd::uint32>)(), lanes32);
+
+    // 标量，以及没有整数指令的 SSE
+    if (lanes32 == 1)
+    {
+        EXPECT_EQ(lanes16, 1u);
+        EXPECT_EQ(lanes8, 1u);
+        return;
+    }
+
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_int_lanes_impl<tsimd::float32>)(), lanes32);
+    EXPECT_EQ(lanes8, 2 * lanes16);
+}
+#endif
+
+// ------------------------------------------ 类型转换 ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // int16 -> int32 -> int16 (饱和)，以及 int32 <-> float32
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int32_convert_impl(const int16* TMATH_RESTRICT in16, const float* TMATH_RESTRICT in_f, const int32* TMATH_RESTRICT in32, const size_t N,
+        int32* TMATH_RESTRICT out_widen, int16* TMATH_RESTRICT out_narrow, float* TMATH_RESTRICT out_f, int32* TMATH_RESTRICT out_i) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(int32);
+        // SSE 的整数为标量实现，to_float32 / from_float32 使用标量的 float32 batch
+        using fop = std::conditional_t<
+            std::is_same_v<decltype(op::to_float32(op::zero())), Scalar::Batch<float32>>,
+            SimdOp<SimdInstruction::Scalar, float32>,
+            TSIMD_DYN_SIMD_OP(float32)>;
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i + Step <= N; i += Step)
+        {
+            op::storeu(out_widen + i, op::load_widen(in16 + i));
+            op::store_narrow(out_narrow + i, op::loadu(in32 + i));
+            fop::storeu(out_f + i, op::to_float32(op::loadu(in32 + i)));
+            op::storeu(out_i + i, op::from_float32(fop::loadu(in_f + i)));
+        }
+    }
+
+    // uint8 -> int16 -> uint8 (饱和)
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int16_convert_impl(const uint8* TMATH_RESTRICT in8, const int16* TMATH_RESTRICT in16, const size_t N,
+        int16* TMATH_RESTRICT out_widen, uint8* TMATH_RESTRICT out_narrow) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(int16);
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i + Step <= N; i += Step)
+        {
+            op::storeu(out_widen + i, op::load_widen(in8 + i));
+            op::store_narrow(out_narrow + i, op::loadu(in16 + i));
+        }
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_int32_convert_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_int16_convert_impl);
+
+TEST(dyn_dispatch_x86_integer, convert_int32)
+{
+    constexpr size_t N = 64;
+
+    auto in16 = test_integer::make_data<tsimd::int16>(N, 8);
+    auto in32 = test_integer::make_data<tsimd::int32>(N, 9);
+    in32[2] = 100; in32[3] = -100; // 不需要饱和的值
+
+    std::vector<float> in_f(N);
+    for (size_t i = 0; i < N; ++i) in_f[i] = (float(i) - 32.0f) * 1.75f;
+
+    std::vector<tsimd::int32> out_widen(N), out_i(N);
+    std::vector<tsimd::int16> out_narrow(N);
+    std::vector<float> out_f(N);
+    TSIMD_DYN_CALL(kernel_int32_convert_impl)(in16.data(), in_f.data(), in32.data(), N, out_widen.data(), out_narrow.data(), out_f.data(), out_i.data());
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(out_widen[i], tsimd::int32(in16[i])) << "i: " << i;
+        EXPECT_EQ(out_narrow[i], test_integer::saturate<tsimd::int16>(in32[i])) << "i: " << i;
+        EXPECT_FLOAT_EQ(out_f[i], float(in32[i])) << "i: " << i;
+        EXPECT_EQ(out_i[i], tsimd::int32(in_f[i])) << "i: " << i; // 向0取整
+    }
+}
+
+TEST(dyn_dispatch_x86_integer, convert_int16)
+{
+    constexpr size_t N = 64;
+
+    auto in8 = test_integer::make_data<tsimd::uint8>(N, 10);
+    auto in16 = test_integer::make_data<tsimd::int16>(N, 11);
+    in16[2] = 200; in16[3] = -1;
+
+    std::vector<tsimd::int16> out_widen(N);
+    std::vector<tsimd::uint8> out_narrow(N);
+    TSIMD_DYN_CALL(kernel_int16_convert_impl)(in8.data(), in16.data(), N, out_widen.data(), out_narrow.data());
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(out_widen[i], tsimd::int16(in8[i])) << "i: " << i;
+        EXPECT_EQ(out_narrow[i], test_integer::saturate<tsimd::uint8>(in16[i])) << "i: " << i;
+    }
+}
+#endif
+
+// ------------------------------------------ cmp_* + select + mask ------------------------------------------
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按运算分段，每段 TOTAL 个元素: cmp_eq, cmp_ne, cmp_lt, cmp_le, cmp_gt, cmp_ge, mask_or(lt, eq), mask_and(le, ge)
+    // lane为true时写入a，否则写入b
+    // bits / any / all 为每个batch中 mask_not(cmp_ge) 的结果
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    size_t kernel_int_cmp_impl(const T* TMATH_RESTRICT a, const T* TMATH_RESTRICT b, T* TMATH_RESTRICT out,
+                               uint32_t* TMATH_RESTRICT bits, bool* TMATH_RESTRICT any, bool* TMATH_RESTRICT all) noexcept
+    {
+        constexpr size_t TOTAL = 64;
+
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+        using mask_t = typename op::mask_t;
+        constexpr size_t Step = op::Lanes;
+
+        for (size_t i = 0; i < TOTAL; i += Step)
+        {
+            batch_t va = op::loadu(a + i);
+            batch_t vb = op::loadu(b + i);
+
+            const mask_t masks[] = {
+                op::cmp_eq(va, vb), op::cmp_ne(va, vb), op::cmp_lt(va, vb),
+                op::cmp_le(va, vb), op::cmp_gt(va, vb), op::cmp_ge(va, vb),
+                op::mask_or(op::cmp_lt(va, vb), op::cmp_eq(va, vb)),
+                op::mask_and(op::cmp_le(va, vb), op::cmp_ge(va, vb))
+            };
+            for (size_t k = 0; k < std::size(masks); ++k)
+            {
+                op::storeu(out + k * TOTAL + i, op::select(masks[k], va, vb));
+            }
+
+            const mask_t lt = op::mask_not(op::cmp_ge(va, vb));
+            bits[i / Step] = op::movemask(lt);
+            any[i / Step] = op::any(lt);
+            all[i / Step] = op::all(lt);
+        }
+
+        return Step;
+    }
+
+    template<typename T>
+    TSIMD_DYN_FUNC_ATTR
+    void kernel_int_clamp_impl(const T* TMATH_RESTRICT in, const size_t N, const T lo, const T hi, T* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(T);
+        using batch_t = typename op::batch_t;
+
+        const batch_t vlo = op::set(lo);
+        const batch_t vhi = op::set(hi);
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            batch_t x = op::load_partial(in + i, lanes);
+            x = op::select(op::cmp_lt(x, vlo), vlo, x);
+            x = op::select(op::cmp_gt(x, vhi), vhi, x);
+            op::store_partial(out + i, x, lanes);
+        });
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_cmp_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_int_clamp_impl);
+
+namespace test_integer
+{
+    template<typename T>
+    static void check_cmp()
+    {
+        constexpr size_t TOTAL = 64;
+
+        // 前32个全部小于，后32个为跨过符号位 / 最高位的伪随机数据
+        auto a = make_data<T>(TOTAL, 12);
+        auto b = make_data<T>(TOTAL, 13);
+        for (size_t i = 0; i < 32; ++i)
+        {
+            a[i] = static_cast<T>(std::numeric_limits<T>::min() + T(i));
+            b[i] = static_cast<T>(a[i] + 1);
+        }
+        b[40] = a[40];
+        b[41] = a[41];
+
+        std::vector<T> out(8 * TOTAL);
+        uint32_t bits[TOTAL] = {};
+        bool any[TOTAL] = {}, all[TOTAL] = {};
+        const size_t lanes = TSIMD_DYN_CALL(kernel_int_cmp_impl<T>)(a.data(), b.data(), out.data(), bits, any, all);
+
+        for (size_t i = 0; i < TOTAL; ++i)
+        {
+            const bool expected[] = {
+                a[i] == b[i], a[i] != b[i], a[i] < b[i], a[i] <= b[i], a[i] > b[i], a[i] >= b[i],
+                a[i] <= b[i], a[i] == b[i]
+            };
+            for (size_t k = 0; k < std::size(expected); ++k)
+            {
+                EXPECT_EQ(out[k * TOTAL + i], expected[k] ? a[i] : b[i]) << "op: " << k << ", i: " << i;
+            }
+        }
+
+        const uint32_t full = lanes == 32 ? 0xFFFFFFFFu : (1u << lanes) - 1u;
+        for (size_t batch = 0; batch < TOTAL / lanes; ++batch)
+        {
+            uint32_t expected_bits = 0;
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                const size_t i = batch * lanes + lane;
+                expected_bits |= uint32_t(a[i] < b[i]) << lane;
+            }
+
+            EXPECT_EQ(bits[batch], expected_bits) << "batch: " << batch;
+            EXPECT_EQ(any[batch], expected_bits != 0) << "batch: " << batch;
+            EXPECT_EQ(all[batch], expected_bits == full) << "batch: " << batch;
+        }
+
+        constexpr size_t N = 67;
+        auto in = make_data<T>(N, 14);
+        const T lo = static_cast<T>(std::numeric_limits<T>::min() / 2 + std::numeric_limits<T>::max() / 4);
+        const T hi = static_cast<T>(std::numeric_limits<T>::max() / 2 + std::numeric_limits<T>::max() / 4);
+
+        std::vector<T> clamped(N);
+        TSIMD_DYN_CALL(kernel_int_clamp_impl<T>)(in.data(), N, lo, hi, clamped.data());
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(clamped[i], std::clamp(in[i], lo, hi)) << "i: " << i;
+        }
+    }
+}
+
+TEST(dyn_dispatch_x86_integer, cmp_select)
+{
+    test_integer::check_cmp<tsimd::int32>();
+    test_integer::check_cmp<tsimd::uint32>();
+    test_integer::check_cmp<tsimd::int16>();
+    test_integer::check_cmp<tsimd::uint8>();
+}
+#endif
@@ -0,0 +1,474 @@
+#include "../test.hpp"
+#include <tSimd/algorithm.hpp>
+#include <tSimd/batch_math.inl>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// #define TSIMD_ONCE 1
+
+// 与double精度的 std:: 函数比较，测量 batch_math.inl 中每个函数的最大ULP误差
+
+namespace tsimd::TSIMD_DYN_INSTRUCTION
+{
+    // out 按函数分段，每段 N 个元素，顺序见 test_math::Unary
+    TSIMD_DYN_FUNC_ATTR void kernel_math_unary_impl(const float* TMATH_RESTRICT x, const size_t N, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const batch_t v = op::load_partial(x + i, lanes);
+
+            batch_t s, c;
+            math::sincos(v, s, c);
+
+            op::store_partial(out + 0 * N + i, math::sin(v), lanes);
+            op::store_partial(out + 1 * N + i, math::cos(v), lanes);
+            op::store_partial(out + 2 * N + i, s, lanes);
+            op::store_partial(out + 3 * N + i, c, lanes);
+            op::store_partial(out + 4 * N + i, math::tan(v), lanes);
+            op::store_partial(out + 5 * N + i, math::exp(v), lanes);
+            op::store_partial(out + 6 * N + i, math::exp2(v), lanes);
+            op::store_partial(out + 7 * N + i, math::log(v), lanes);
+            op::store_partial(out + 8 * N + i, math::log2(v), lanes);
+            op::store_partial(out + 9 * N + i, math::atan(v), lanes);
+            op::store_partial(out + 10 * N + i, math::sqrt(v), lanes);
+            op::store_partial(out + 11 * N + i, math::rsqrt(v), lanes);
+            op::store_partial(out + 12 * N + i, op::abs(v), lanes);
+            op::store_partial(out + 13 * N + i, op::round(v), lanes);
+            op::store_partial(out + 14 * N + i, op::get_exponent(v), lanes);
+            op::store_partial(out + 15 * N + i, op::get_mantissa(v), lanes);
+            op::store_partial(out + 16 * N + i, op::exp2i(v), lanes);
+            op::store_partial(out + 17 * N + i, op::floor(v), lanes);
+            op::store_partial(out + 18 * N + i, op::ceil(v), lanes);
+            op::store_partial(out + 19 * N + i, op::trunc(v), lanes);
+            op::store_partial(out + 20 * N + i, op::rcp_approx(v), lanes);
+            op::store_partial(out + 21 * N + i, op::rcp(v), lanes);
+            op::store_partial(out + 22 * N + i, op::rsqrt_approx(v), lanes);
+            op::store_partial(out + 23 * N + i, op::rsqrt(v), lanes);
+        });
+    }
+
+    // out[0, N) = pow(a, b), out[N, 2N) = atan2(a, b)
+    TSIMD_DYN_FUNC_ATTR void kernel_math_binary_impl(const float* TMATH_RESTRICT a, const float* TMATH_RESTRICT b, const size_t N, float* TMATH_RESTRICT out) noexcept
+    {
+        using op = TSIMD_DYN_SIMD_OP(float);
+        using batch_t = op::batch_t;
+
+        for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+        {
+            const batch_t va = op::load_partial(a + i, lanes);
+            const batch_t vb = op::load_partial(b + i, lanes);
+
+            op::store_partial(out + i, math::pow(va, vb), lanes);
+            op::store_partial(out + N + i, math::atan2(va, vb), lanes);
+        });
+    }
+}
+
+#if TSIMD_ONCE
+TSIMD_DYN_DISPATCH_FUNC(kernel_math_unary_impl);
+TSIMD_DYN_DISPATCH_FUNC(kernel_math_binary_impl);
+
+namespace test_math
+{
+    enum Unary : size_t
+    {
+        Sin, Cos, SinCos_Sin, SinCos_Cos, Tan, Exp, Exp2, Log, Log2, Atan, Sqrt, Rsqrt,
+        Abs, Round, GetExponent, GetMantissa, Exp2i,
+        Floor, Ceil, Trunc,
+        // op::rcp_approx / op::rcp / op::rsqrt_approx / op::rsqrt (Rsqrt 是 math::rsqrt)
+        RcpApprox, RcpNewton, RsqrtApprox, RsqrtNewton,
+        Count
+    };
+
+    // 以 ref 舍入到float后的ULP为单位的误差，inf / NaN 必须完全一致
+    static double ulp_error(const float got, const double ref)
+    {
+        if (std::isnan(ref))
+        {
+            return std::isnan(got) ? 0.0 : std::numeric_limits<double>::infinity();
+        }
+        // ref 超出float的范围时，正确的结果是 inf
+        if (std::isinf(static_cast<float>(ref)) || std::isinf(got))
+        {
+            return got == static_cast<float>(ref) ? 0.0 : std::numeric_limits<double>::infinity();
+        }
+
+        const float rf = std::max(std::fabs(static_cast<float>(ref)), std::numeric_limits<float>::min());
+        const double ulp = std::ldexp(1.0, std::ilogb(rf) - 23);
+        return std::fabs(static_cast<double>(got) - ref) / ulp;
+    }
+
+    // [lo, hi] 上的等距点，加上一点伪随机的抖动，个数不是任何Lanes的整数倍
+    static std::vector<float> make_linear(const double lo, const double hi, const size_t n = 20011)
+    {
+        std::vector<float> data(n);
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < n; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const double jitter = (seed >> 8) / double(1 << 24);
+            data[i] = static_cast<float>(lo + (hi - lo) * ((double(i) + jitter) / double(n)));
+        }
+        data[0] = static_cast<float>(lo);
+        data[n - 1] = static_cast<float>(hi);
+        return data;
+    }
+
+    // 2^[lo_exp, hi_exp) 上对数均匀分布的正数
+    static std::vector<float> make_log_uniform(const double lo_exp, const double hi_exp, const size_t n = 20011)
+    {
+        std::vector<float> data = make_linear(lo_exp, hi_exp, n);
+        for (float& x : data)
+        {
+            x = static_cast<float>(std::exp2(static_cast<double>(x)));
+        }
+        data[n - 1] = std::numeric_limits<float>::max();
+        return data;
+    }
+
+    static std::vector<float> eval_unary(const std::vector<float>& x)
+    {
+        std::vector<float> out(Unary::Count * x.size());
+        TSIMD_DYN_CALL(kernel_math_unary_impl)(x.data(), x.size(), out.data());
+        return out;
+    }
+
+    template<typename RefFn>
+    static double max_ulp(const std::vector<float>& x, const std::vector<float>& out, const Unary fn, RefFn&& ref)
+    {
+        double result = 0.0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            const double err = ulp_error(out[fn * x.size() + i], ref(static_cast<double>(x[i])));
+            EXPECT_FALSE(std::isinf(err)) << "fn: " << int(fn) << ", x: " << x[i] << ", got: " << out[fn * x.size() + i];
+            result = std::max(result, err);
+        }
+        return result;
+    }
+
+    // 逐个检查特殊值，a / b 中的NaN视为相等
+    static void expect_same(const float got, const float expected, const char* name, const float x)
+    {
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(got)) << name << "(" << x << ") = " << got;
+        }
+        else
+        {
+            EXPECT_EQ(got, expected) << name << "(" << x << ")";
+        }
+    }
+}
+
+TEST(dyn_dispatch_batch_math, sin_cos_tan)
+{
+    using namespace test_math;
+
+    for (const double range : { 3.14159265358979323846, 8192.0 })
+    {
+        const auto x = make_linear(-range, range);
+        const auto out = eval_unary(x);
+
+        const double err_sin = max_ulp(x, out, Sin, [](double v) { return std::sin(v); });
+        const double err_cos = max_ulp(x, out, Cos, [](double v) { return std::cos(v); });
+        const double err_tan = max_ulp(x, out, Tan, [](double v) { return std::tan(v); });
+        EXPECT_LE(err_sin, 2.5);
+        EXPECT_LE(err_cos, 2.5);
+        EXPECT_LE(err_tan, 3.5);
+        std::cout << std::format("|x| <= {:.0f} sin: {:.3f} ulp, cos: {:.3f} ulp, tan: {:.3f} ulp\n", range, err_sin, err_cos, err_tan);
+
+        // sincos 与 sin / cos 完全一致
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            EXPECT_EQ(out[SinCos_Sin * x.size() + i], out[Sin * x.size() + i]);
+            EXPECT_EQ(out[SinCos_Cos * x.size() + i], out[Cos * x.size() + i]);
+        }
+    }
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> specials = { 0.0f, -0.0f, inf, -inf, nan };
+    const auto out = eval_unary(specials);
+    const size_t n = specials.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        expect_same(out[Sin * n + i], std::sin(specials[i]), "sin", specials[i]);
+        expect_same(out[Cos * n + i], std::cos(specials[i]), "cos", specials[i]);
+        expect_same(out[Tan * n + i], std::tan(specials[i]), "tan", specials[i]);
+    }
+    EXPECT_TRUE(std::signbit(out[Sin * n + 1])); // sin(-0) = -0
+}
+
+TEST(dyn_dispatch_batch_math, exp_exp2)
+{
+    using namespace test_math;
+
+    const auto x = make_linear(-87.0, 88.0);
+    const auto out = eval_unary(x);
+    const double err_exp = max_ulp(x, out, Exp, [](double v) { return std::exp(v); });
+    EXPECT_LE(err_exp, 1.0);
+
+    const auto x2 = make_linear(-126.0, 127.0);
+    const auto out2 = eval_unary(x2);
+    const double err_exp2 = max_ulp(x2, out2, Exp2, [](double v) { return std::exp2(v); });
+    EXPECT_LE(err_exp2, 1.5);
+
+    std::cout << std::format("exp: {:.3f} ulp, exp2: {:.3f} ulp\n", err_exp, err_exp2);
+
+    // 上溢 / 下溢 / 特殊值
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> specials = { 0.0f, -0.0f, 89.0f, 1000.0f, -104.0f, -1000.0f, inf, -inf, nan, 128.0f, -151.0f };
+    const auto out3 = eval_unary(specials);
+    const size_t n = specials.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        expect_same(out3[Exp * n + i], std::exp(specials[i]), "exp", specials[i]);
+        expect_same(out3[Exp2 * n + i], std::exp2(specials[i]), "exp2", specials[i]);
+    }
+
+    // 结果为非正规数时也是正确舍入附近的值
+    const auto denormal = make_linear(-149.0, -127.0, 101);
+    const auto out4 = eval_unary(denormal);
+    for (size_t i = 0; i < denormal.size(); ++i)
+    {
+        const double ref = std::exp2(static_cast<double>(denormal[i]));
+        EXPECT_LE(std::fabs(out4[Exp2 * denormal.size() + i] - ref), std::ldexp(1.0, -149)) << denormal[i];
+    }
+}
+
+TEST(dyn_dispatch_batch_math, log_log2)
+{
+    using namespace test_math;
+
+    // 包括非正规数
+    const auto x = make_log_uniform(-149.0, 128.0);
+    const auto out = eval_unary(x);
+    const double err_log = max_ulp(x, out, Log, [](double v) { return std::log(v); });
+    const double err_log2 = max_ulp(x, out, Log2, [](double v) { return std::log2(v); });
+    EXPECT_LE(err_log, 1.0);
+    EXPECT_LE(err_log2, 1.5);
+
+    // 1附近
+    const auto x1 = make_linear(0.5, 2.0);
+    const auto out1 = eval_unary(x1);
+    const double err_log_1 = max_ulp(x1, out1, Log, [](double v) { return std::log(v); });
+    const double err_log2_1 = max_ulp(x1, out1, Log2, [](double v) { return std::log2(v); });
+    EXPECT_LE(err_log_1, 1.0);
+    EXPECT_LE(err_log2_1, 1.5);
+
+    std::cout << std::format("log: {:.3f} / {:.3f} ulp, log2: {:.3f} / {:.3f} ulp\n", err_log, err_log_1, err_log2, err_log2_1);
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> specials = { 0.0f, -0.0f, 1.0f, -1.0f, inf, -inf, nan, 2.0f, 0.5f };
+    const auto out2 = eval_unary(specials);
+    const size_t n = specials.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        expect_same(out2[Log * n + i], std::log(specials[i]), "log", specials[i]);
+        expect_same(out2[Log2 * n + i], std::log2(specials[i]), "log2", specials[i]);
+    }
+}
+
+TEST(dyn_dispatch_batch_math, atan_atan2)
+{
+    using namespace test_math;
+
+    auto x = make_linear(-10.0, 10.0);
+    const auto big = make_log_uniform(-30.0, 128.0);
+    x.insert(x.end(), big.begin(), big.end());
+    for (const float v : big)
+    {
+        x.push_back(-v);
+    }
+
+    const auto out = eval_unary(x);
+    const double err_atan = max_ulp(x, out, Atan, [](double v) { return std::atan(v); });
+    EXPECT_LE(err_atan, 2.5);
+
+    // 四个象限
+    auto y2 = make_linear(-100.0, 100.0);
+    auto x2 = make_linear(-100.0, 100.0);
+    std::reverse(x2.begin(), x2.end());
+    for (size_t i = 0; i < x2.size(); i += 3)
+    {
+        x2[i] = -x2[i];
+    }
+
+    const size_t n = x2.size();
+    std::vector<float> out2(2 * n);
+    TSIMD_DYN_CALL(kernel_math_binary_impl)(y2.data(), x2.data(), n, out2.data());
+    double err_atan2 = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        err_atan2 = std::max(err_atan2, ulp_error(out2[n + i], std::atan2(double(y2[i]), double(x2[i]))));
+    }
+    EXPECT_LE(err_atan2, 2.0);
+
+    std::cout << std::format("atan: {:.3f} ulp, atan2: {:.3f} ulp\n", err_atan, err_atan2);
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> specials = { 0.0f, -0.0f, 1.0f, -1.0f, inf, -inf, nan };
+    const auto out3 = eval_unary(specials);
+    for (size_t i = 0; i < specials.size(); ++i)
+    {
+        expect_same(out3[Atan * specials.size() + i], std::atan(specials[i]), "atan", specials[i]);
+    }
+
+    // 坐标轴上的点
+    const std::vector<float> ys = { 1.0f, -1.0f, 0.0f, 0.0f, 3.0f, -3.0f, inf, nan, 1.0f };
+    const std::vector<float> xs = { 0.0f, 0.0f, 2.0f, -2.0f, -0.0f, -0.0f, 1.0f, 1.0f, inf };
+    std::vector<float> out4(2 * ys.size());
+    TSIMD_DYN_CALL(kernel_math_binary_impl)(ys.data(), xs.data(), ys.size(), out4.data());
+    for (size_t i = 0; i < ys.size(); ++i)
+    {
+        expect_same(out4[ys.size() + i], std::atan2(ys[i], xs[i]), "atan2", ys[i]);
+    }
+}
+
+TEST(dyn_dispatch_batch_math, pow)
+{
+    using namespace test_math;
+
+    auto x = make_log_uniform(-20.0, 20.0);
+    auto y = make_linear(-6.0, 6.0);
+
+    const size_t n = x.size();
+    std::vector<float> out(2 * n);
+    TSIMD_DYN_CALL(kernel_math_binary_impl)(x.data(), y.data(), n, out.data());
+    for (size_t i = 0; i < n; ++i)
+    {
+        // 误差随 |y * log2(x)| 增大，见 batch_math.inl
+        const double t = std::fabs(double(y[i]) * std::log2(double(x[i])));
+        const double err = ulp_error(out[i], std::pow(double(x[i]), double(y[i])));
+        EXPECT_LE(err, 2.0 + t) << "pow(" << x[i] << ", " << y[i] << ")";
+    }
+
+    // 负数的底，整数的指数
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> xs = { -2.0f, -2.0f, -2.0f, -3.0f, -2.0f, 0.0f, 0.0f, 1.0f, nan, 2.0f, inf, inf, 4.0f };
+    const std::vector<float> ys = { 2.0f, 3.0f, -1.0f, 0.5f, 0.0f, 2.0f, -2.0f, nan, 0.0f, 10.0f, 1.0f, -1.0f, 0.5f };
+    std::vector<float> out2(2 * xs.size());
+    TSIMD_DYN_CALL(kernel_math_binary_impl)(xs.data(), ys.data(), xs.size(), out2.data());
+    for (size_t i = 0; i < xs.size(); ++i)
+    {
+        expect_same(out2[i], std::pow(xs[i], ys[i]), "pow", xs[i]);
+    }
+}
+
+TEST(dyn_dispatch_batch_math, sqrt_rsqrt)
+{
+    using namespace test_math;
+
+    const auto x = make_log_uniform(-149.0, 128.0);
+    const auto out = eval_unary(x);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_EQ(out[Sqrt * x.size() + i], std::sqrt(x[i]));
+    }
+    const double err_rsqrt = max_ulp(x, out, Rsqrt, [](double v) { return 1.0 / std::sqrt(v); });
+    EXPECT_LE(err_rsqrt, 1.5);
+}
+
+// rcp / rsqrt 的近似指令与一次 Newton-Raphson 迭代后的误差 (标量后端都是精确的除法)
+TEST(dyn_dispatch_batch_math, rcp_rsqrt_newton)
+{
+    using namespace test_math;
+
+    // 倒数不能是非正规数 (近似指令把非正规数的结果当作0)，去掉 make_log_uniform 的 FLT_MAX
+    auto x = make_log_uniform(-126.0, 126.0);
+    x.pop_back();
+    const size_t n = x.size();
+    const auto out = eval_unary(x);
+
+    double rel_rcp = 0.0, rel_rsqrt = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double r = 1.0 / double(x[i]);
+        const double rs = 1.0 / std::sqrt(double(x[i]));
+        rel_rcp = std::max(rel_rcp, std::fabs(out[RcpApprox * n + i] - r) / r);
+        rel_rsqrt = std::max(rel_rsqrt, std::fabs(out[RsqrtApprox * n + i] - rs) / rs);
+    }
+    EXPECT_LE(rel_rcp, 1.5 * 0x1p-12);
+    EXPECT_LE(rel_rsqrt, 1.5 * 0x1p-12);
+
+    const double err_rcp = max_ulp(x, out, RcpNewton, [](double v) { return 1.0 / v; });
+    const double err_rsqrt = max_ulp(x, out, RsqrtNewton, [](double v) { return 1.0 / std::sqrt(v); });
+    EXPECT_LE(err_rcp, 3.0);
+    EXPECT_LE(err_rsqrt, 3.5);
+
+    std::cout << std::format("rcp_approx: {:.3g}, rsqrt_approx: {:.3g} (relative), rcp: {:.3f} ulp, rsqrt: {:.3f} ulp\n",
+        rel_rcp, rel_rsqrt, err_rcp, err_rsqrt);
+
+    // 0 / inf / NaN 的结果是精确的，负数的 rsqrt 为 NaN
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> special = { 0.0f, -0.0f, inf, -inf, -1.0f, std::numeric_limits<float>::quiet_NaN() };
+    const auto out2 = eval_unary(special);
+    const size_t m = special.size();
+    for (size_t i = 0; i < m; ++i)
+    {
+        const float s = special[i];
+        expect_same(out2[RsqrtApprox * m + i], 1.0f / std::sqrt(s), "rsqrt_approx", s);
+        expect_same(out2[RsqrtNewton * m + i], 1.0f / std::sqrt(s), "rsqrt", s);
+        if (s == -1.0f)
+        {
+            continue;
+        }
+        expect_same(out2[RcpApprox * m + i], 1.0f / s, "rcp_approx", s);
+        expect_same(out2[RcpNewton * m + i], 1.0f / s, "rcp", s);
+    }
+}
+
+TEST(dyn_dispatch_batch_math, basic_ops)
+{
+    using namespace test_math;
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> x = {
+        0.0f, -0.0f, 0.5f, 1.5f, 2.5f, -0.5f, -1.5f, -2.5f, 0.49999997f, 3.7f, -3.7f,
+        8388607.5f, 8388608.0f, -16777216.0f, 1e30f, inf, -inf, 1.0f, 3.0f, 1e-20f, -123.456f,
+    };
+    const auto out = eval_unary(x);
+    const size_t n = x.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(out[Abs * n + i], std::fabs(x[i])) << "abs: " << x[i];
+        EXPECT_EQ(out[Round * n + i], std::nearbyint(x[i])) << "round: " << x[i];
+        EXPECT_EQ(std::signbit(out[Round * n + i]), std::signbit(x[i])) << "round: " << x[i];
+        EXPECT_EQ(out[Floor * n + i], std::floor(x[i])) << "floor: " << x[i];
+        EXPECT_EQ(std::signbit(out[Floor * n + i]), std::signbit(x[i])) << "floor: " << x[i];
+        EXPECT_EQ(out[Ceil * n + i], std::ceil(x[i])) << "ceil: " << x[i];
+        EXPECT_EQ(std::signbit(out[Ceil * n + i]), std::signbit(x[i])) << "ceil: " << x[i];
+        EXPECT_EQ(out[Trunc * n + i], std::trunc(x[i])) << "trunc: " << x[i];
+        EXPECT_EQ(std::signbit(out[Trunc * n + i]), std::signbit(x[i])) << "trunc: " << x[i];
+
+        if (std::isnormal(x[i]))
+        {
+            EXPECT_EQ(out[GetExponent * n + i], float(std::ilogb(x[i]))) << "get_exponent: " << x[i];
+            EXPECT_EQ(out[GetMantissa * n + i], std::ldexp(std::fabs(x[i]), -std::ilogb(x[i]))) << "get_mantissa: " << x[i];
+        }
+    }
+
+    // exp2i: [-126, 127] 的整数
+    std::vector<float> e;
+    for (int i = -126; i <= 127; ++i)
+    {
+        e.push_back(float(i));
+    }
+    const auto out2 = eval_unary(e);
+    for (size_t i = 0; i < e.size(); ++i)
+    {
+        EXPECT_EQ(out2[Exp2i * e.size() + i], std::ldexp(1.0f, int(e[i]))) << "exp2i: " << e[i];
+    }
+}
+#endif
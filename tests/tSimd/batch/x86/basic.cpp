@@ -73,7 +73,7 @@ TEST(dyn_dispatch, basic)
 
     EXPECT_NEAR(result, expected, 1e-5f);
 
-    EXPECT_EQ(std::size(tsimd::PFN_table::kernel_dyn_impl), 8);
+    EXPECT_EQ(std::size(tsimd::PFN_table::kernel_dyn_impl), 9);
 }
 
 int main(int argc, char **argv)
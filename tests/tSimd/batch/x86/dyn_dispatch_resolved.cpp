@@ -0,0 +1,96 @@
+#include "../test.hpp"
+
+#include <tSimd/algorithm.hpp>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/x86/dyn_dispatch_resolved.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 没有定义 TSIMD_TEST_INTRINSIC，TSIMD_DYN_CALL 使用运行时选择的指令集，并缓存查表的结果
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void kernel_scale_impl(const float* TMATH_RESTRICT arr, const size_t N, const float k, float* TMATH_RESTRICT out) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(float);
+
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                op::store_partial(out + i, op::mul(op::load_partial(arr + i, lanes), op::set(k)), lanes);
+            });
+        }
+
+        template<typename T>
+        TSIMD_DYN_FUNC_ATTR T kernel_sum_impl(const T* arr, const size_t N) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(T);
+            using batch_t = typename op::batch_t;
+
+            batch_t acc = op::zero();
+            for_each_batch<op>(N, [&](const size_t i, const auto lanes) TSIMD_DYN_FUNC_ATTR
+            {
+                acc = op::add(acc, op::load_partial(arr + i, lanes));
+            });
+            return op::reduce_sum(acc);
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_scale_impl);
+TSIMD_DYN_DISPATCH_FUNC_TEMPLATE(kernel_sum_impl);
+
+TEST(dyn_dispatch_resolved, first_call_resolves_once)
+{
+    const auto selected = TSIMD_DYN_TABLE_LOOKUP(kernel_scale_impl);
+
+    // 第一次调用前，缓存的是 first_call，而不是函数指针表中的任何一项
+    const auto before = TSIMD_DYN_RESOLVED(kernel_scale_impl);
+    for (const auto fn : tsimd::PFN_table::kernel_scale_impl)
+    {
+        EXPECT_NE(before, fn);
+    }
+
+    float numbers[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    float result[std::size(numbers)] = {};
+    TSIMD_DYN_CALL(kernel_scale_impl)(numbers, std::size(numbers), 2.0f, result);
+    for (size_t i = 0; i < std::size(numbers); ++i)
+    {
+        EXPECT_EQ(result[i], numbers[i] * 2.0f);
+    }
+
+    // 之后直接调用查表选出的函数
+    EXPECT_EQ(TSIMD_DYN_RESOLVED(kernel_scale_impl), selected);
+
+    TSIMD_DYN_CALL(kernel_scale_impl)(numbers, std::size(numbers), 3.0f, result);
+    EXPECT_EQ(result[10], 33.0f);
+    EXPECT_EQ(TSIMD_DYN_RESOLVED(kernel_scale_impl), selected);
+}
+
+TEST(dyn_dispatch_resolved, template_function)
+{
+    // 每组模板参数各自缓存
+    const float f[] = { 1.5f, 2.5f, 3.0f };
+    const double d[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_sum_impl<float>)(f, std::size(f)), 7.0f);
+    EXPECT_EQ(TSIMD_DYN_RESOLVED(kernel_sum_impl<float>), TSIMD_DYN_TABLE_LOOKUP(kernel_sum_impl<float>));
+
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_sum_impl<double>)(d, std::size(d)), 15.0);
+    EXPECT_EQ(TSIMD_DYN_RESOLVED(kernel_sum_impl<double>), TSIMD_DYN_TABLE_LOOKUP(kernel_sum_impl<double>));
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
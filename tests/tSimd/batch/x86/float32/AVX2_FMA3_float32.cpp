@@ -34,7 +34,7 @@ namespace tsimd
 #if defined(TMATH_COMPILER_MSVC)
             EXPECT_TRUE(cur_intrinsic == "\"\"");
 #elif defined(TMATH_COMPILER_GCC) || defined(TMATH_COMPILER_CLANG)
-            EXPECT_TRUE(cur_intrinsic == "\"\" __attribute__((target(\"avx2,fma\")))");
+            EXPECT_TRUE(cur_intrinsic == "\"\" __attribute__((target(\"avx2,fma,f16c\")))");
 #else
     #error "Unknown compiler."
 #endif
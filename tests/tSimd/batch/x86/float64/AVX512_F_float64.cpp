@@ -0,0 +1,100 @@
+#define TSIMD_TEST_INTRINSIC AVX512_F
+
+#include "../test.hpp"
+
+#include <string>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/x86/float64/AVX512_F_float64.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp> // auto dispatch
+#include <tSimd/batch.hpp>
+
+#include "../../test_float64.inl"
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void kernel_dyn_impl(const double* TMATH_RESTRICT arr, const double* TMATH_RESTRICT arr2, const double* TMATH_RESTRICT arr3, const size_t N, double* TMATH_RESTRICT out_result) noexcept
+        {
+            using op = TSIMD_DYN_SIMD_OP(double);
+            using batch_t = op::batch_t;
+            constexpr size_t Step = op::Lanes;
+
+            // 测试SimdOp后端
+            bool test = std::is_same_v<op, SimdOp<SimdInstruction::AVX512_F, double>>;
+            EXPECT_TRUE(test);
+            EXPECT_TRUE(op::CurrentInstruction == SimdInstruction::AVX512_F);
+            EXPECT_TRUE(op::BatchSize == 64);
+            EXPECT_TRUE(op::ElementSize == 8);
+            EXPECT_TRUE(op::Lanes == 8);
+            EXPECT_TRUE(op::BatchAlignment == 64);
+
+            std::string cur_intrinsic = TMATH_STR("" TSIMD_DYN_FUNC_ATTR);
+#if defined(TMATH_COMPILER_MSVC)
+            EXPECT_TRUE(cur_intrinsic == "\"\"");
+#elif defined(TMATH_COMPILER_GCC) || defined(TMATH_COMPILER_CLANG)
+            EXPECT_TRUE(cur_intrinsic == "\"\" __attribute__((target(\"avx512f,f16c\")))");
+#else
+    #error "Unknown compiler."
+#endif
+
+            size_t i = 0;
+            for (; i + Step <= N; i += Step)
+            {
+                batch_t a = op::loadu(arr + i);
+                batch_t b = op::loadu(arr2 + i);
+                batch_t c = op::loadu(arr3 + i);
+
+                op::storeu(out_result + i, op::mul_add(a, b, c));
+            }
+            for (; i < N; ++i)
+            {
+                out_result[i] = arr[i] * arr2[i] + arr3[i];
+            }
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_dyn_impl);
+
+void kernel(const double* arr, const double* arr2, const double* arr3, const size_t N, double* out_result) noexcept
+{
+    TSIMD_DYN_CALL(kernel_dyn_impl)(arr, arr2, arr3, N, out_result);
+}
+
+TEST(dyn_dispatch, basic)
+{
+    double numbers[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+    double numbers2[] = { -1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19 };
+    double numbers3[] = { 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
+
+    double result[19] = {};
+    kernel(numbers, numbers2, numbers3, 19, result);
+
+    for (int i = 0; i < 19; ++i)
+    {
+        double expected = numbers[i] * numbers2[i] + numbers3[i];
+        EXPECT_TRUE(expected == result[i]);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    // 不是所有CPU都支持AVX512F，不支持时直接跳过，避免 TSIMD_DYN_FUNC_POINTER abort
+    if (!tsimd::InstructionSelector::get_support_info().AVX512_F)
+    {
+        printf("AVX512_F is not supported on this CPU, skip.\n");
+        return 0;
+    }
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#define TSIMD_TEST_INTRINSIC AVX2
+
+#include "../test.hpp"
+
+#include <string>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/x86/integer/AVX2_integer.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp> // auto dispatch
+#include <tSimd/batch.hpp>
+
+#include "../../test_integer.inl"
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR void kernel_dyn_impl() noexcept
+        {
+            using op32 = TSIMD_DYN_SIMD_OP(int32);
+            using op8 = TSIMD_DYN_SIMD_OP(uint8);
+
+            // 测试SimdOp后端
+            bool test = std::is_same_v<op32, SimdOp<SimdInstruction::AVX2, int32>>;
+            EXPECT_TRUE(test);
+            EXPECT_TRUE(op32::CurrentInstruction == SimdInstruction::AVX2);
+            EXPECT_TRUE(op32::BatchSize == 32);
+            EXPECT_TRUE(op32::ElementSize == 4);
+            EXPECT_TRUE(op32::Lanes == 8);
+            EXPECT_TRUE(op32::BatchAlignment == 32);
+
+            EXPECT_TRUE(op8::CurrentInstruction == SimdInstruction::AVX2);
+            EXPECT_TRUE(op8::BatchSize == 32);
+            EXPECT_TRUE(op8::ElementSize == 1);
+            EXPECT_TRUE(op8::Lanes == 32);
+            EXPECT_TRUE(op8::BatchAlignment == 32);
+
+            std::string cur_intrinsic = TMATH_STR("" TSIMD_DYN_FUNC_ATTR);
+#if defined(TMATH_COMPILER_MSVC)
+            EXPECT_TRUE(cur_intrinsic == "\"\"");
+#elif defined(TMATH_COMPILER_GCC) || defined(TMATH_COMPILER_CLANG)
+            EXPECT_TRUE(cur_intrinsic == "\"\" __attribute__((target(\"avx2,f16c\")))");
+#else
+    #error "Unknown compiler."
+#endif
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_dyn_impl);
+
+TEST(dyn_dispatch, basic)
+{
+    TSIMD_DYN_CALL(kernel_dyn_impl)();
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,85 @@
+#include "../test.hpp"
+
+#include <cstdlib>
+
+#undef TSIMD_DISPATCH_THIS_FILE
+#define TSIMD_DISPATCH_THIS_FILE "batch/x86/max_instruction.cpp" // this file
+#include <tSimd/dispatch_this_file.hpp>
+
+#include <tSimd/batch.hpp>
+
+// 没有定义 TSIMD_TEST_INTRINSIC，分发使用 InstructionSelector::selected_instruction()
+// 指令集在整个进程中只确定一次，所以所有检查都放在同一个 TEST 中
+
+namespace tsimd
+{
+    namespace TSIMD_DYN_INSTRUCTION
+    {
+        TSIMD_DYN_FUNC_ATTR SimdInstruction kernel_current_instruction_impl() noexcept
+        {
+            return TSIMD_DYN_SIMD_OP(float)::CurrentInstruction;
+        }
+    }
+}
+
+
+#if TSIMD_ONCE
+
+// export impl function
+TSIMD_DYN_DISPATCH_FUNC(kernel_current_instruction_impl);
+
+TEST(max_instruction, instruction_name)
+{
+    using tsimd::InstructionSelector;
+    using tsimd::SimdInstruction;
+
+    EXPECT_STREQ(InstructionSelector::instruction_name(SimdInstruction::Scalar), "Scalar");
+    EXPECT_STREQ(InstructionSelector::instruction_name(SimdInstruction::SSE4_1), "SSE4_1");
+    EXPECT_STREQ(InstructionSelector::instruction_name(SimdInstruction::AVX2_FMA3), "AVX2_FMA3");
+    EXPECT_STREQ(InstructionSelector::instruction_name(SimdInstruction::AVX512_F), "AVX512_F");
+}
+
+TEST(max_instruction, env_and_api)
+{
+    using tsimd::InstructionSelector;
+    using tsimd::SimdInstruction;
+
+    if (!InstructionSelector::get_support_info().SSE4_1)
+    {
+        GTEST_SKIP() << "SSE4.1 is not supported on this machine.";
+    }
+
+    // 第一次分发之前设置，环境变量和 set_max_instruction 取较低的一个
+#if defined(_MSC_VER)
+    _putenv_s("TSIMD_MAX_ISA", "sse4.1");
+#else
+    setenv("TSIMD_MAX_ISA", "sse4.1", 1);
+#endif
+    EXPECT_TRUE(InstructionSelector::set_max_instruction(SimdInstruction::AVX2));
+
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_current_instruction_impl)(), SimdInstruction::SSE4_1);
+    EXPECT_EQ(InstructionSelector::selected_instruction(), SimdInstruction::SSE4_1);
+
+    // 已经分发过，不再生效
+    EXPECT_FALSE(InstructionSelector::set_max_instruction(SimdInstruction::SSE2));
+    EXPECT_EQ(InstructionSelector::selected_instruction(), SimdInstruction::SSE4_1);
+    EXPECT_EQ(TSIMD_DYN_CALL(kernel_current_instruction_impl)(), SimdInstruction::SSE4_1);
+
+    // 不受限制时的结果
+    const auto& supports = InstructionSelector::get_support_info();
+    const SimdInstruction max_supported = InstructionSelector::max_supported_instruction();
+    EXPECT_GE(max_supported, SimdInstruction::SSE4_1);
+    EXPECT_EQ(max_supported == SimdInstruction::AVX512_F, supports.AVX512_F);
+    if (!supports.AVX512_F)
+    {
+        EXPECT_EQ(max_supported == SimdInstruction::AVX2_FMA3, supports.AVX2_FMA3);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
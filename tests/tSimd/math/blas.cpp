@@ -0,0 +1,221 @@
+#include "../test.hpp"
+
+#include <tSimd/aligned_allocate.hpp>
+#include <tSimd/blas.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// tsimd::blas 与 float64 的参考实现比较，使用运行时选择的指令集
+// 长度覆盖 0、不足一个batch、不是展开的整数倍，偏移 1 个元素时走不对齐的路径
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::blas::Layout;
+
+    using aligned_vector = std::vector<float32, tsimd::AlignedAllocator<float32>>;
+
+    constexpr float32 qnan = std::numeric_limits<float32>::quiet_NaN();
+
+    aligned_vector make_random(const size_t n, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> dist(-1.0f, 1.0f);
+        aligned_vector data(n);
+        for (auto& x : data)
+        {
+            x = dist(rng);
+        }
+        return data;
+    }
+
+    constexpr size_t MaxCount = 70;
+}
+
+TEST(blas, axpy_axpby_scal)
+{
+    const auto x = make_random(MaxCount + 1, 1);
+    const auto y0 = make_random(MaxCount + 1, 2);
+
+    for (const size_t offset : { size_t(0), size_t(1) })
+    {
+        for (size_t n = 0; n <= MaxCount; ++n)
+        {
+            const float32* px = x.data() + offset;
+
+            auto y = y0;
+            tsimd::blas::axpy(0.75f, px, y.data() + offset, n);
+            for (size_t i = 0; i < y.size(); ++i)
+            {
+                const bool in_range = i >= offset && i < offset + n;
+                const double expected = in_range ? 0.75 * double(x[i]) + double(y0[i]) : double(y0[i]);
+                EXPECT_NEAR(y[i], expected, 1e-6) << "axpy n: " << n << ", offset: " << offset << ", i: " << i;
+            }
+
+            y = y0;
+            tsimd::blas::axpby(0.75f, px, -0.5f, y.data() + offset, n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                EXPECT_NEAR(y[offset + i], 0.75 * double(px[i]) - 0.5 * double(y0[offset + i]), 1e-6) << "axpby n: " << n << ", offset: " << offset;
+            }
+
+            // beta 为0时不读取 y
+            aligned_vector z(x.size(), qnan);
+            tsimd::blas::axpby(2.0f, px, 0.0f, z.data() + offset, n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(z[offset + i], 2.0f * px[i]) << "axpby beta = 0, n: " << n << ", offset: " << offset;
+            }
+
+            y = y0;
+            tsimd::blas::scal(-3.0f, y.data() + offset, n);
+            for (size_t i = 0; i < y.size(); ++i)
+            {
+                const bool in_range = i >= offset && i < offset + n;
+                EXPECT_EQ(y[i], in_range ? -3.0f * y0[i] : y0[i]) << "scal n: " << n << ", offset: " << offset << ", i: " << i;
+            }
+        }
+    }
+
+    // alpha 为0时 y 不变，x 中的 NaN 不会传播
+    aligned_vector y = y0;
+    const aligned_vector nans(y.size(), qnan);
+    tsimd::blas::axpy(0.0f, nans.data(), y.data(), y.size());
+    EXPECT_EQ(y, y0);
+}
+
+TEST(blas, dot_asum_nrm2)
+{
+    const auto x = make_random(MaxCount + 1, 3);
+    const auto y = make_random(MaxCount + 1, 4);
+
+    for (const size_t offset : { size_t(0), size_t(1) })
+    {
+        for (size_t n = 0; n <= MaxCount; ++n)
+        {
+            const float32* px = x.data() + offset;
+            const float32* py = y.data() + offset;
+
+            double d = 0.0, a = 0.0, s = 0.0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                d += double(px[i]) * double(py[i]);
+                a += std::fabs(double(px[i]));
+                s += double(px[i]) * double(px[i]);
+            }
+            EXPECT_NEAR(tsimd::blas::dot(px, py, n), d, 1e-5) << "n: " << n << ", offset: " << offset;
+            EXPECT_NEAR(tsimd::blas::asum(px, n), a, 1e-5) << "n: " << n << ", offset: " << offset;
+            EXPECT_NEAR(tsimd::blas::nrm2(px, n), std::sqrt(s), 1e-5) << "n: " << n << ", offset: " << offset;
+        }
+    }
+}
+
+TEST(blas, nrm2_overflow_underflow)
+{
+    // 直接求平方和会上溢成 inf / 下溢成0
+    for (const double scale : { 1e30, 1e-30, 1e-42 })
+    {
+        const auto x0 = make_random(37, 5);
+        aligned_vector x(x0.size());
+        double s = 0.0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            x[i] = static_cast<float32>(double(x0[i]) * scale);
+            s += double(x[i]) * double(x[i]);
+        }
+        const double expected = std::sqrt(s);
+        // 1e-42 是非正规数，只有几位有效数字
+        const double tol = scale < 1e-38 ? 1e-2 : 1e-6;
+        EXPECT_NEAR(tsimd::blas::nrm2(x.data(), x.size()) / expected, 1.0, tol) << "scale: " << scale;
+    }
+
+    const aligned_vector zeros(20, 0.0f);
+    EXPECT_EQ(tsimd::blas::nrm2(zeros.data(), zeros.size()), 0.0f);
+
+    aligned_vector x(20, 1.0f);
+    x[3] = std::numeric_limits<float32>::infinity();
+    EXPECT_EQ(tsimd::blas::nrm2(x.data(), x.size()), std::numeric_limits<float32>::infinity());
+    x[3] = qnan;
+    EXPECT_TRUE(std::isnan(tsimd::blas::nrm2(x.data(), x.size())));
+}
+
+TEST(blas, iamax)
+{
+    EXPECT_EQ(tsimd::blas::iamax(nullptr, 0), 0u);
+
+    for (size_t n = 1; n <= MaxCount; ++n)
+    {
+        for (size_t k = 0; k < n; ++k)
+        {
+            aligned_vector x(n, 0.5f);
+            x[k] = -2.0f;
+            EXPECT_EQ(tsimd::blas::iamax(x.data(), n), k) << "n: " << n << ", k: " << k;
+            // 相等时返回第一个
+            x[n - 1] = 2.0f;
+            EXPECT_EQ(tsimd::blas::iamax(x.data(), n), k) << "n: " << n << ", k: " << k;
+        }
+    }
+
+    // 忽略 NaN
+    aligned_vector x = { qnan, 1.0f, -3.0f, qnan, 2.0f };
+    EXPECT_EQ(tsimd::blas::iamax(x.data(), x.size()), 2u);
+    x = { qnan, qnan, qnan };
+    EXPECT_EQ(tsimd::blas::iamax(x.data(), x.size()), 0u);
+}
+
+TEST(blas, gemv)
+{
+    constexpr float32 alpha = 1.5f;
+
+    for (const Layout layout : { Layout::RowMajor, Layout::ColumnMajor })
+    {
+        for (const size_t rows : { size_t(0), size_t(1), size_t(3), size_t(4), size_t(9), size_t(33) })
+        {
+            for (const size_t cols : { size_t(0), size_t(1), size_t(5), size_t(8), size_t(17), size_t(40) })
+            {
+                for (const size_t pad : { size_t(0), size_t(3) })
+                {
+                    const size_t lda = (layout == Layout::RowMajor ? cols : rows) + pad;
+                    const auto A = make_random(rows * cols + (rows + cols) * pad + 1, 6);
+                    const auto x = make_random(cols, 7);
+                    const auto y0 = make_random(rows, 8);
+
+                    const auto a = [&](const size_t r, const size_t c)
+                    {
+                        return double(layout == Layout::RowMajor ? A[r * lda + c] : A[c * lda + r]);
+                    };
+
+                    for (const float32 beta : { 0.0f, 1.0f, -0.5f })
+                    {
+                        // beta 为0时不读取 y
+                        aligned_vector y = beta == 0.0f ? aligned_vector(rows, qnan) : y0;
+                        tsimd::blas::gemv(layout, rows, cols, alpha, A.data(), lda, x.data(), beta, y.data());
+
+                        for (size_t r = 0; r < rows; ++r)
+                        {
+                            double d = 0.0;
+                            for (size_t c = 0; c < cols; ++c)
+                            {
+                                d += a(r, c) * double(x[c]);
+                            }
+                            const double expected = double(alpha) * d + (beta == 0.0f ? 0.0 : double(beta) * double(y0[r]));
+                            EXPECT_NEAR(y[r], expected, 1e-5)
+                                << "layout: " << int(layout) << ", rows: " << rows << ", cols: " << cols << ", lda: " << lda << ", beta: " << beta << ", r: " << r;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
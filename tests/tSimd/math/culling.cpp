@@ -0,0 +1,251 @@
+#include "../test.hpp"
+
+#include <tSimd/culling.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// tsimd::cull_spheres / cull_aabbs 与标量版本比较，使用运行时选择的指令集 (CMake 中每个指令集各运行一次)
+// 计算顺序与标量版本相同 (见 tMath/bounds.hpp)，可见下标的列表要求完全一致
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::uint32;
+
+    struct Plane
+    {
+        float32 a, b, c, d;
+    };
+
+    using Planes = std::array<Plane, 6>;
+
+    // 随机方向的单位法线，d 使平面离原点 [2, 6]，原点附近的包围体大多可见
+    Planes make_planes(const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> dir(-1.0f, 1.0f);
+        std::uniform_real_distribution<float32> dist(2.0f, 6.0f);
+
+        Planes planes;
+        for (auto& p : planes)
+        {
+            float32 x, y, z, len;
+            do
+            {
+                x = dir(rng);
+                y = dir(rng);
+                z = dir(rng);
+                len = std::sqrt(x * x + y * y + z * z);
+            } while (len < 0.1f);
+            p = { x / len, y / len, z / len, dist(rng) };
+        }
+        return planes;
+    }
+
+    tsimd::Vec3Stream<float32> make_points(const size_t n, const float32 range, const float32 offset, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> dist(-range, range);
+        tsimd::Vec3Stream<float32> s(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            s.set(i, { dist(rng) + offset, dist(rng) + offset, dist(rng) + offset });
+        }
+        return s;
+    }
+
+    float32 distance(const Plane& p, const std::array<float32, 3>& v)
+    {
+        return p.a * v[0] + p.b * v[1] + p.c * v[2] + p.d;
+    }
+
+    std::vector<uint32> cull_spheres_ref(const Planes& planes, const tsimd::Vec3Stream<float32>& centers, const std::vector<float32>& radii)
+    {
+        std::vector<uint32> visible;
+        for (size_t i = 0; i < centers.size(); ++i)
+        {
+            bool inside = true;
+            for (const Plane& p : planes)
+            {
+                if (distance(p, centers.get(i)) + radii[i] < 0)
+                {
+                    inside = false;
+                }
+            }
+            if (inside)
+            {
+                visible.push_back(static_cast<uint32>(i));
+            }
+        }
+        return visible;
+    }
+
+    std::vector<uint32> cull_aabbs_ref(const Planes& planes, const tsimd::Vec3Stream<float32>& centers, const tsimd::Vec3Stream<float32>& extents)
+    {
+        std::vector<uint32> visible;
+        for (size_t i = 0; i < centers.size(); ++i)
+        {
+            const auto e = extents.get(i);
+            bool inside = true;
+            for (const Plane& p : planes)
+            {
+                const float32 r = std::abs(p.a) * e[0] + std::abs(p.b) * e[1] + std::abs(p.c) * e[2];
+                if (distance(p, centers.get(i)) + r < 0)
+                {
+                    inside = false;
+                }
+            }
+            if (inside)
+            {
+                visible.push_back(static_cast<uint32>(i));
+            }
+        }
+        return visible;
+    }
+
+    std::vector<uint32> cull_spheres(const Planes& planes, const tsimd::Vec3Stream<float32>& centers, const std::vector<float32>& radii)
+    {
+        // 多出的一个元素用来检查没有越界写入
+        std::vector<uint32> visible(centers.size() + 1, 0xdeadbeef);
+        const size_t n = tsimd::cull_spheres(planes, centers, radii.data(), visible.data());
+        EXPECT_EQ(visible.back(), 0xdeadbeef);
+        visible.resize(n);
+        return visible;
+    }
+
+    std::vector<uint32> cull_aabbs(const Planes& planes, const tsimd::Vec3Stream<float32>& centers, const tsimd::Vec3Stream<float32>& extents)
+    {
+        std::vector<uint32> visible(centers.size() + 1, 0xdeadbeef);
+        const size_t n = tsimd::cull_aabbs(planes, centers, extents, visible.data());
+        EXPECT_EQ(visible.back(), 0xdeadbeef);
+        visible.resize(n);
+        return visible;
+    }
+}
+
+TEST(culling, spheres)
+{
+    for (const size_t n : { size_t(0), size_t(1), size_t(7), size_t(16), size_t(1027) })
+    {
+        for (const unsigned seed : { 1u, 2u, 3u })
+        {
+            const auto planes = make_planes(seed);
+            const auto centers = make_points(n, 8.0f, 0.0f, seed + 10);
+
+            std::mt19937 rng(seed + 20);
+            std::uniform_real_distribution<float32> dist(0.0f, 2.0f);
+            std::vector<float32> radii(n);
+            for (auto& r : radii)
+            {
+                r = dist(rng);
+            }
+
+            const auto visible = cull_spheres(planes, centers, radii);
+            EXPECT_EQ(visible, cull_spheres_ref(planes, centers, radii)) << "n: " << n << ", seed: " << seed;
+            if (n == 1027)
+            {
+                // 数据要同时有可见和不可见的
+                EXPECT_GT(visible.size(), 0u);
+                EXPECT_LT(visible.size(), n);
+            }
+        }
+    }
+}
+
+TEST(culling, aabbs)
+{
+    for (const size_t n : { size_t(0), size_t(1), size_t(7), size_t(16), size_t(1027) })
+    {
+        for (const unsigned seed : { 4u, 5u, 6u })
+        {
+            const auto planes = make_planes(seed);
+            const auto centers = make_points(n, 8.0f, 0.0f, seed + 10);
+            const auto extents = make_points(n, 1.0f, 1.0f, seed + 20); // [0, 2]
+
+            const auto visible = cull_aabbs(planes, centers, extents);
+            EXPECT_EQ(visible, cull_aabbs_ref(planes, centers, extents)) << "n: " << n << ", seed: " << seed;
+            if (n == 1027)
+            {
+                EXPECT_GT(visible.size(), 0u);
+                EXPECT_LT(visible.size(), n);
+            }
+        }
+    }
+}
+
+TEST(culling, all_or_none)
+{
+    constexpr size_t n = 1027;
+    const auto centers = make_points(n, 8.0f, 0.0f, 7);
+    const std::vector<float32> radii(n, 0.5f);
+    const auto extents = make_points(n, 0.0f, 0.5f, 8);
+
+    // 原点为中心、边长 2000 的立方体，所有包围体都可见
+    Planes all;
+    const float32 half = 1000.0f;
+    all[0] = { 1, 0, 0, half };
+    all[1] = { -1, 0, 0, half };
+    all[2] = { 0, 1, 0, half };
+    all[3] = { 0, -1, 0, half };
+    all[4] = { 0, 0, 1, half };
+    all[5] = { 0, 0, -1, half };
+
+    std::vector<uint32> iota(n);
+    std::iota(iota.begin(), iota.end(), 0u);
+    EXPECT_EQ(cull_spheres(all, centers, radii), iota);
+    EXPECT_EQ(cull_aabbs(all, centers, extents), iota);
+
+    // 远离原点的立方体，全部不可见
+    Planes none = all;
+    none[1].d = -900.0f;
+    EXPECT_TRUE(cull_spheres(none, centers, radii).empty());
+    EXPECT_TRUE(cull_aabbs(none, centers, extents).empty());
+
+    // 与平面相切的包围体可见 (dist + r == 0)
+    tsimd::Vec3Stream<float32> touching;
+    touching.push_back({ -1000.5f, 0.0f, 0.0f });
+    const std::vector<float32> touching_radius = { 0.5f };
+    EXPECT_EQ(cull_spheres(all, touching, touching_radius).size(), 1u);
+
+    // 含 NaN 的包围体总是可见
+    auto with_nan = centers;
+    with_nan.set(5, { std::numeric_limits<float32>::quiet_NaN(), 0.0f, 0.0f });
+    const auto visible = cull_spheres(none, with_nan, radii);
+    ASSERT_EQ(visible.size(), 1u);
+    EXPECT_EQ(visible[0], 5u);
+}
+
+TEST(culling, frustum_layout)
+{
+    // float32[24] 与平面结构体数组的结果相同
+    const auto planes = make_planes(9);
+    float32 raw[24];
+    for (size_t k = 0; k < 6; ++k)
+    {
+        raw[k * 4 + 0] = planes[k].a;
+        raw[k * 4 + 1] = planes[k].b;
+        raw[k * 4 + 2] = planes[k].c;
+        raw[k * 4 + 3] = planes[k].d;
+    }
+
+    constexpr size_t n = 100;
+    const auto centers = make_points(n, 8.0f, 0.0f, 10);
+    const std::vector<float32> radii(n, 1.0f);
+    std::vector<uint32> visible(n);
+    visible.resize(tsimd::cull_spheres(raw, centers, radii.data(), visible.data()));
+    EXPECT_EQ(visible, cull_spheres_ref(planes, centers, radii));
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    printf("Instruction: %s\n", tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,208 @@
+#include "../test.hpp"
+
+#include <tSimd/aligned_allocate.hpp>
+#include <tSimd/blas.hpp>
+#include <tSimd/parallel.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// tsimd::blas::gemm 与 float64 的三重循环比较，使用运行时选择的指令集
+// 尺寸覆盖分块参数 (mr / nr / kc / mc) 的边界，以及线程池切分后的结果
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::blas::Layout;
+
+    using aligned_vector = std::vector<float32, tsimd::AlignedAllocator<float32>>;
+
+    constexpr float32 qnan = std::numeric_limits<float32>::quiet_NaN();
+
+    aligned_vector make_random(const size_t n, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> dist(-1.0f, 1.0f);
+        aligned_vector data(n);
+        for (auto& x : data)
+        {
+            x = dist(rng);
+        }
+        return data;
+    }
+
+    struct Case
+    {
+        Layout layout;
+        size_t M, N, K;
+        size_t pad; // lda / ldb / ldc 比最小值多出的元素个数
+        float32 alpha, beta;
+    };
+
+    // 返回最大误差 (相对于 sum(|a * b|))，C 中没有被写入的元素 (ld 的填充部分) 必须保持不变
+    double run_case(const Case& c, tsimd::ThreadPool* pool)
+    {
+        const bool row = c.layout == Layout::RowMajor;
+        const size_t lda = (row ? c.K : c.M) + c.pad;
+        const size_t ldb = (row ? c.N : c.K) + c.pad;
+        const size_t ldc = (row ? c.N : c.M) + c.pad;
+        const size_t a_size = (row ? c.M : c.K) * lda;
+        const size_t b_size = (row ? c.K : c.N) * ldb;
+        const size_t c_size = (row ? c.M : c.N) * ldc;
+
+        const auto A = make_random(a_size, 1);
+        const auto B = make_random(b_size, 2);
+        const auto C0 = make_random(c_size, 3);
+        // beta 为0时不读取 C
+        aligned_vector C = C0;
+        if (c.beta == 0.0f)
+        {
+            for (size_t i = 0; i < c.M; ++i)
+            {
+                for (size_t j = 0; j < c.N; ++j)
+                {
+                    C[row ? i * ldc + j : j * ldc + i] = qnan;
+                }
+            }
+        }
+
+        EXPECT_TRUE(tsimd::blas::gemm(c.layout, c.M, c.N, c.K, c.alpha, A.data(), lda, B.data(), ldb, c.beta, C.data(), ldc, pool));
+
+        const auto at = [row](const aligned_vector& m, const size_t ld, const size_t i, const size_t j)
+        {
+            return double(row ? m[i * ld + j] : m[j * ld + i]);
+        };
+
+        double max_err = 0.0;
+        for (size_t i = 0; i < c.M; ++i)
+        {
+            for (size_t j = 0; j < c.N; ++j)
+            {
+                double d = 0.0, mag = 0.0;
+                for (size_t p = 0; p < c.K; ++p)
+                {
+                    d += at(A, lda, i, p) * at(B, ldb, p, j);
+                    mag += std::fabs(at(A, lda, i, p) * at(B, ldb, p, j));
+                }
+                const double expected = double(c.alpha) * d + (c.beta == 0.0f ? 0.0 : double(c.beta) * at(C0, ldc, i, j));
+                const double err = std::fabs(at(C, ldc, i, j) - expected) / (mag + 1.0);
+                max_err = std::isnan(err) ? std::numeric_limits<double>::infinity() : std::max(max_err, err);
+            }
+        }
+
+        // ld 的填充部分
+        const size_t outer = row ? c.M : c.N;
+        const size_t inner = row ? c.N : c.M;
+        for (size_t o = 0; o < outer; ++o)
+        {
+            for (size_t k = inner; k < ldc; ++k)
+            {
+                EXPECT_EQ(C[o * ldc + k], C0[o * ldc + k]) << "padding overwritten";
+            }
+        }
+        return max_err;
+    }
+}
+
+TEST(gemm, blocking)
+{
+    const auto b = tsimd::blas::gemm_blocking();
+    EXPECT_GT(b.mr, 0u);
+    EXPECT_GT(b.nr, 0u);
+    EXPECT_EQ(b.mc % b.mr, 0u);
+    EXPECT_EQ(b.nc % b.nr, 0u);
+    EXPECT_GT(b.kc, 0u);
+}
+
+TEST(gemm, small_and_edges)
+{
+    const auto b = tsimd::blas::gemm_blocking();
+
+    for (const Layout layout : { Layout::RowMajor, Layout::ColumnMajor })
+    {
+        for (const size_t M : { size_t(1), size_t(3), b.mr, b.mr + 1, 2 * b.mr + 3 })
+        {
+            for (const size_t N : { size_t(1), size_t(5), b.nr, b.nr + 1, 2 * b.nr + 7 })
+            {
+                for (const size_t K : { size_t(1), size_t(2), size_t(17) })
+                {
+                    for (const float32 beta : { 0.0f, 1.0f, -0.5f })
+                    {
+                        const Case c{ layout, M, N, K, 3, 1.25f, beta };
+                        EXPECT_LE(run_case(c, nullptr), 1e-6)
+                            << "layout: " << int(layout) << ", M: " << M << ", N: " << N << ", K: " << K << ", beta: " << beta;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(gemm, multiple_blocks)
+{
+    // K 跨过多个 kc 块 (beta 只使用一次)，M 跨过多个 mc 块
+    const auto b = tsimd::blas::gemm_blocking();
+    for (const Layout layout : { Layout::RowMajor, Layout::ColumnMajor })
+    {
+        const Case c{ layout, b.mc + b.mr + 1, 2 * b.nr + 3, 2 * b.kc + 5, 0, 0.5f, 2.0f };
+        EXPECT_LE(run_case(c, nullptr), 1e-6) << "layout: " << int(layout);
+    }
+}
+
+TEST(gemm, degenerate)
+{
+    // K 为0或 alpha 为0时 C = beta * C
+    for (const size_t K : { size_t(0), size_t(4) })
+    {
+        for (const float32 beta : { 0.0f, 1.0f, 3.0f })
+        {
+            const Case c{ Layout::RowMajor, 5, 7, K, 1, K == 0 ? 1.0f : 0.0f, beta };
+            EXPECT_LE(run_case(c, nullptr), 1e-6) << "K: " << K << ", beta: " << beta;
+        }
+    }
+
+    // M / N 为0时什么都不做
+    tsimd::blas::gemm(Layout::RowMajor, 0, 4, 4, 1.0f, nullptr, 4, nullptr, 4, 0.0f, nullptr, 4);
+    tsimd::blas::gemm(Layout::RowMajor, 4, 0, 4, 1.0f, nullptr, 4, nullptr, 0, 0.0f, nullptr, 0);
+}
+
+TEST(gemm, thread_pool)
+{
+    // 与单线程的结果完全相同 (每个元素的累加顺序不变)
+    tsimd::ThreadPool pool(4);
+    const auto b = tsimd::blas::gemm_blocking();
+
+    for (const Layout layout : { Layout::RowMajor, Layout::ColumnMajor })
+    {
+        for (const size_t M : { size_t(64), b.mc + 3 })
+        {
+            const size_t N = 256 + 5;
+            const size_t K = 200;
+            const size_t ld_a = layout == Layout::RowMajor ? K : M;
+            const size_t ld_b = layout == Layout::RowMajor ? N : K;
+            const size_t ld_c = layout == Layout::RowMajor ? N : M;
+            const auto A = make_random(M * K, 4);
+            const auto B = make_random(K * N, 5);
+            const auto C0 = make_random(M * N, 6);
+
+            aligned_vector serial = C0;
+            aligned_vector parallel = C0;
+            EXPECT_TRUE(tsimd::blas::gemm(layout, M, N, K, 1.0f, A.data(), ld_a, B.data(), ld_b, 0.5f, serial.data(), ld_c));
+            EXPECT_TRUE(tsimd::blas::gemm(layout, M, N, K, 1.0f, A.data(), ld_a, B.data(), ld_b, 0.5f, parallel.data(), ld_c, &pool));
+            EXPECT_EQ(serial, parallel) << "layout: " << int(layout) << ", M: " << M;
+
+            const Case c{ layout, M, N, K, 0, 1.0f, 0.5f };
+            EXPECT_LE(run_case(c, &pool), 1e-6) << "layout: " << int(layout) << ", M: " << M;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
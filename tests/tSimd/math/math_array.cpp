@@ -0,0 +1,196 @@
+#include "../test.hpp"
+
+#include <tSimd/math.hpp>
+#include <tSimd/float16.hpp>
+
+#include <cmath>
+#include <vector>
+
+// tsimd::math 的数组接口，使用运行时选择的指令集，每个元素的精度见 batch_math.inl
+
+namespace
+{
+    constexpr size_t N = 1027; // 不是任何Lanes的整数倍
+
+    std::vector<float> make_data(const float lo, const float hi)
+    {
+        std::vector<float> data(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            data[i] = lo + (hi - lo) * static_cast<float>(i) / static_cast<float>(N - 1);
+        }
+        return data;
+    }
+
+    template<typename RefFn>
+    void expect_near_rel(const std::vector<float>& in, const std::vector<float>& out, RefFn&& ref, const char* name)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const double expected = ref(static_cast<double>(in[i]));
+            EXPECT_NEAR(out[i], expected, 1e-6 * std::max(1.0, std::fabs(expected))) << name << "(" << in[i] << ")";
+        }
+    }
+}
+
+TEST(math_array, unary)
+{
+    const auto x = make_data(-10.0f, 10.0f);
+    const auto pos = make_data(1e-3f, 100.0f);
+    std::vector<float> out(N);
+
+    tsimd::math::sin(x.data(), out.data(), N);
+    expect_near_rel(x, out, [](double v) { return std::sin(v); }, "sin");
+    tsimd::math::cos(x.data(), out.data(), N);
+    expect_near_rel(x, out, [](double v) { return std::cos(v); }, "cos");
+    tsimd::math::exp(x.data(), out.data(), N);
+    expect_near_rel(x, out, [](double v) { return std::exp(v); }, "exp");
+    tsimd::math::exp2(x.data(), out.data(), N);
+    expect_near_rel(x, out, [](double v) { return std::exp2(v); }, "exp2");
+    tsimd::math::atan(x.data(), out.data(), N);
+    expect_near_rel(x, out, [](double v) { return std::atan(v); }, "atan");
+
+    tsimd::math::log(pos.data(), out.data(), N);
+    expect_near_rel(pos, out, [](double v) { return std::log(v); }, "log");
+    tsimd::math::log2(pos.data(), out.data(), N);
+    expect_near_rel(pos, out, [](double v) { return std::log2(v); }, "log2");
+    tsimd::math::sqrt(pos.data(), out.data(), N);
+    expect_near_rel(pos, out, [](double v) { return std::sqrt(v); }, "sqrt");
+    tsimd::math::rsqrt(pos.data(), out.data(), N);
+    expect_near_rel(pos, out, [](double v) { return 1.0 / std::sqrt(v); }, "rsqrt");
+
+    const auto t = make_data(-1.5f, 1.5f);
+    tsimd::math::tan(t.data(), out.data(), N);
+    expect_near_rel(t, out, [](double v) { return std::tan(v); }, "tan");
+
+    std::vector<float> s(N), c(N);
+    tsimd::math::sincos(x.data(), s.data(), c.data(), N);
+    expect_near_rel(x, s, [](double v) { return std::sin(v); }, "sincos");
+    expect_near_rel(x, c, [](double v) { return std::cos(v); }, "sincos");
+}
+
+TEST(math_array, binary)
+{
+    const auto a = make_data(0.5f, 4.0f);
+    const auto b = make_data(-3.0f, 3.0f);
+    std::vector<float> out(N);
+
+    tsimd::math::pow(a.data(), b.data(), out.data(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        const double expected = std::pow(double(a[i]), double(b[i]));
+        EXPECT_NEAR(out[i], expected, 1e-5 * expected) << "pow(" << a[i] << ", " << b[i] << ")";
+    }
+
+    tsimd::math::atan2(b.data(), a.data(), out.data(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_NEAR(out[i], std::atan2(double(b[i]), double(a[i])), 1e-6) << "atan2(" << b[i] << ", " << a[i] << ")";
+    }
+}
+
+TEST(math_array, in_place_and_tail)
+{
+    // 原地计算
+    auto x = make_data(0.0f, 5.0f);
+    const auto ref = x;
+    tsimd::math::exp(x.data(), x.data(), N);
+    expect_near_rel(ref, x, [](double v) { return std::exp(v); }, "exp in place");
+
+    // 末尾的元素不能被改写
+    for (size_t count = 0; count < 40; ++count)
+    {
+        std::vector<float> in(count + 1, 1.0f);
+        std::vector<float> out(count + 1, -1.0f);
+        tsimd::math::sqrt(in.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(out[i], 1.0f);
+        }
+        EXPECT_EQ(out[count], -1.0f) << "count: " << count;
+    }
+}
+
+TEST(math_array, float16)
+{
+    // 所有的 float16 转换成 float32 再转换回来，除了 NaN (会置 quiet 位) 都不变
+    std::vector<tsimd::float16> all(65536);
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        all[i] = tsimd::float16::from_bits(static_cast<tsimd::uint16>(i));
+    }
+    std::vector<float> f(all.size());
+    std::vector<tsimd::float16> back(all.size());
+    tsimd::f16_to_f32(all.data(), f.data(), all.size());
+    tsimd::f32_to_f16(f.data(), back.data(), all.size());
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        if (std::isnan(f[i]))
+        {
+            EXPECT_EQ(back[i].bits, all[i].bits | 0x200) << "bits: " << i;
+            continue;
+        }
+        EXPECT_EQ(f[i], static_cast<float>(all[i])) << "bits: " << i;
+        EXPECT_EQ(back[i].bits, all[i].bits) << "bits: " << i;
+    }
+
+    // 读写 float16 的数学函数，结果等于 float32 版本的结果舍入到 float16
+    const auto x = make_data(-10.0f, 10.0f);
+    std::vector<tsimd::float16> hx(N), hy(N), hout(N), hout2(N);
+    tsimd::f32_to_f16(x.data(), hx.data(), N);
+    std::vector<float> fx(N), fy(N), fout(N), fout2(N);
+    tsimd::f16_to_f32(hx.data(), fx.data(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(hx[i].bits, tsimd::float16(x[i]).bits) << "i: " << i;
+        hy[i] = tsimd::float16(0.5f + 0.001f * static_cast<float>(i));
+        fy[i] = static_cast<float>(hy[i]);
+    }
+
+    const auto expect_rounded = [](const std::vector<float>& ref, const std::vector<tsimd::float16>& out, const char* name)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(out[i].bits, tsimd::float16(ref[i]).bits) << name << ", i: " << i;
+        }
+    };
+
+    tsimd::math::sin(hx.data(), hout.data(), N);
+    tsimd::math::sin(fx.data(), fout.data(), N);
+    expect_rounded(fout, hout, "sin");
+    tsimd::math::exp(hx.data(), hout.data(), N);
+    tsimd::math::exp(fx.data(), fout.data(), N);
+    expect_rounded(fout, hout, "exp");
+    tsimd::math::pow(hy.data(), hx.data(), hout.data(), N);
+    tsimd::math::pow(fy.data(), fx.data(), fout.data(), N);
+    expect_rounded(fout, hout, "pow");
+    tsimd::math::sincos(hx.data(), hout.data(), hout2.data(), N);
+    tsimd::math::sincos(fx.data(), fout.data(), fout2.data(), N);
+    expect_rounded(fout, hout, "sincos");
+    expect_rounded(fout2, hout2, "sincos");
+
+    // 末尾的元素不能被改写
+    for (size_t count = 0; count < 40; ++count)
+    {
+        std::vector<float> in(count + 1, 2.0f);
+        std::vector<tsimd::float16> h(count + 1, tsimd::float16::from_bits(0xABCD));
+        std::vector<float> out(count + 1, -1.0f);
+        tsimd::f32_to_f16(in.data(), h.data(), count);
+        tsimd::math::sqrt(h.data(), h.data(), count);
+        tsimd::f16_to_f32(h.data(), out.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(out[i], static_cast<float>(tsimd::float16(std::sqrt(2.0f))));
+        }
+        EXPECT_EQ(h[count].bits, 0xABCD) << "count: " << count;
+        EXPECT_EQ(out[count], -1.0f) << "count: " << count;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
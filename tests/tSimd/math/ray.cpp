@@ -0,0 +1,323 @@
+#include "../test.hpp"
+
+#include <tSimd/ray.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+// tsimd::intersect_triangles / intersect_aabbs 与标量版本比较，使用运行时选择的指令集
+// CMake 用 TSIMD_MAX_ISA 把这个测试在每个指令集上各运行一次，覆盖 4 / 8 / 16 条光线的光线包
+// 计算顺序与标量版本相同 (见 tMath/ray.hpp)，t / u / v / prim 要求完全一致
+
+namespace
+{
+    using tsimd::float32;
+    using tsimd::uint32;
+
+    using Vec3 = std::array<float32, 3>;
+    using Triangle = std::array<Vec3, 3>;
+
+    struct Box
+    {
+        Vec3 min, max;
+    };
+
+    constexpr float32 inf = std::numeric_limits<float32>::infinity();
+
+    struct Rays
+    {
+        tsimd::Vec3Stream<float32> origins;
+        tsimd::Vec3Stream<float32> directions;
+    };
+
+    // 起点在 z = -20 附近，指向原点附近的随机位置
+    Rays make_rays(const size_t n, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> dist(-8.0f, 8.0f);
+        Rays r{ tsimd::Vec3Stream<float32>(n), tsimd::Vec3Stream<float32>(n) };
+        for (size_t i = 0; i < n; ++i)
+        {
+            const Vec3 o = { dist(rng), dist(rng), -20.0f + dist(rng) };
+            const Vec3 target = { dist(rng), dist(rng), dist(rng) };
+            r.origins.set(i, o);
+            r.directions.set(i, { target[0] - o[0], target[1] - o[1], target[2] - o[2] });
+        }
+        return r;
+    }
+
+    std::vector<Triangle> make_triangles(const size_t n, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> center(-6.0f, 6.0f);
+        std::uniform_real_distribution<float32> offset(-3.0f, 3.0f);
+        std::vector<Triangle> tris(n);
+        for (auto& tri : tris)
+        {
+            const Vec3 c = { center(rng), center(rng), center(rng) };
+            for (auto& p : tri)
+            {
+                p = { c[0] + offset(rng), c[1] + offset(rng), c[2] + offset(rng) };
+            }
+        }
+        return tris;
+    }
+
+    std::vector<Box> make_boxes(const size_t n, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float32> center(-6.0f, 6.0f);
+        std::uniform_real_distribution<float32> extent(0.1f, 1.5f);
+        std::vector<Box> boxes(n);
+        for (auto& b : boxes)
+        {
+            for (size_t k = 0; k < 3; ++k)
+            {
+                const float32 c = center(rng);
+                const float32 e = extent(rng);
+                b.min[k] = c - e;
+                b.max[k] = c + e;
+            }
+        }
+        return boxes;
+    }
+
+    // 与 tMath 的 intersect_triangle 相同
+    void intersect_triangles_ref(const Rays& rays, const std::vector<Triangle>& tris, const float32 t_min, tsimd::RayHits& hits)
+    {
+        for (size_t i = 0; i < rays.origins.size(); ++i)
+        {
+            const Vec3 o = rays.origins.get(i);
+            const Vec3 d = rays.directions.get(i);
+            for (size_t j = 0; j < tris.size(); ++j)
+            {
+                const Vec3& v0 = tris[j][0];
+                const Vec3 e1 = { tris[j][1][0] - v0[0], tris[j][1][1] - v0[1], tris[j][1][2] - v0[2] };
+                const Vec3 e2 = { tris[j][2][0] - v0[0], tris[j][2][1] - v0[1], tris[j][2][2] - v0[2] };
+
+                const Vec3 p = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+                const float32 inv_det = 1.0f / (e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2]);
+                const Vec3 s = { o[0] - v0[0], o[1] - v0[1], o[2] - v0[2] };
+                const float32 u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv_det;
+                const Vec3 q = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+                const float32 v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inv_det;
+                const float32 t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv_det;
+
+                if (u >= 0 && v >= 0 && u + v <= 1 && t > t_min && t < hits.t[i])
+                {
+                    hits.t[i] = t;
+                    hits.u[i] = u;
+                    hits.v[i] = v;
+                    hits.prim[i] = static_cast<uint32>(j);
+                }
+            }
+        }
+    }
+
+    // 与 tMath 的 intersect_aabb 相同
+    void intersect_aabbs_ref(const Rays& rays, const std::vector<Box>& boxes, const float32 t_min, tsimd::RayHits& hits)
+    {
+        const auto min_ = [](const float32 a, const float32 b) { return a < b ? a : b; };
+        const auto max_ = [](const float32 a, const float32 b) { return a > b ? a : b; };
+
+        for (size_t i = 0; i < rays.origins.size(); ++i)
+        {
+            const Vec3 o = rays.origins.get(i);
+            const Vec3 d = rays.directions.get(i);
+            for (size_t j = 0; j < boxes.size(); ++j)
+            {
+                float32 t_in[3], t_out[3];
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    const float32 inv = 1.0f / d[k];
+                    const float32 t0 = (boxes[j].min[k] - o[k]) * inv;
+                    const float32 t1 = (boxes[j].max[k] - o[k]) * inv;
+                    t_in[k] = min_(t0, t1);
+                    t_out[k] = max_(t0, t1);
+                }
+                const float32 t_near = max_(max_(max_(t_in[0], t_in[1]), t_in[2]), t_min);
+                const float32 t_far = min_(min_(t_out[0], t_out[1]), t_out[2]);
+                if (t_near <= t_far && t_near < hits.t[i])
+                {
+                    hits.t[i] = t_near;
+                    hits.prim[i] = static_cast<uint32>(j);
+                }
+            }
+        }
+    }
+
+    void expect_hits_eq(const tsimd::RayHits& a, const tsimd::RayHits& b, const size_t n)
+    {
+        EXPECT_EQ(a.t, b.t) << "n: " << n;
+        EXPECT_EQ(a.u, b.u) << "n: " << n;
+        EXPECT_EQ(a.v, b.v) << "n: " << n;
+        EXPECT_EQ(a.prim, b.prim) << "n: " << n;
+    }
+
+    // 有交点的光线数
+    size_t hit_count(const tsimd::RayHits& hits)
+    {
+        size_t c = 0;
+        for (size_t i = 0; i < hits.size(); ++i)
+        {
+            c += hits.hit(i) ? 1 : 0;
+        }
+        return c;
+    }
+}
+
+TEST(ray, triangles)
+{
+    const auto tris = make_triangles(37, 1);
+    for (const size_t n : { size_t(0), size_t(1), size_t(7), size_t(16), size_t(1027) })
+    {
+        const auto rays = make_rays(n, 2);
+
+        tsimd::RayHits hits(n);
+        tsimd::intersect_triangles(rays.origins, rays.directions, std::span<const Triangle>(tris), hits);
+        tsimd::RayHits ref(n);
+        intersect_triangles_ref(rays, tris, 0.0f, ref);
+        expect_hits_eq(hits, ref, n);
+
+        if (n == 1027)
+        {
+            EXPECT_GT(hit_count(hits), 0u);
+            EXPECT_LT(hit_count(hits), n);
+        }
+    }
+}
+
+TEST(ray, triangles_t_range)
+{
+    // t_min 与每条光线不同的 t_max
+    constexpr size_t n = 1027;
+    const auto tris = make_triangles(37, 3);
+    const auto rays = make_rays(n, 4);
+
+    tsimd::RayHits hits(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        hits.t[i] = (i % 3 == 0) ? 0.9f : inf;
+    }
+    tsimd::RayHits ref = hits;
+
+    tsimd::intersect_triangles(rays.origins, rays.directions, std::span<const Triangle>(tris), hits, 0.6f);
+    intersect_triangles_ref(rays, tris, 0.6f, ref);
+    expect_hits_eq(hits, ref, n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (hits.hit(i))
+        {
+            EXPECT_GT(hits.t[i], 0.6f);
+            EXPECT_LT(hits.t[i], (i % 3 == 0) ? 0.9f : inf);
+        }
+    }
+}
+
+TEST(ray, triangles_in_chunks)
+{
+    // 分两次传入三角形，第二次只在更近时覆盖第一次的结果
+    constexpr size_t n = 100;
+    const auto tris = make_triangles(40, 5);
+    const auto rays = make_rays(n, 6);
+
+    tsimd::RayHits all(n);
+    tsimd::intersect_triangles(rays.origins, rays.directions, std::span<const Triangle>(tris), all);
+
+    tsimd::RayHits chunks(n);
+    const std::span<const Triangle> span(tris);
+    tsimd::intersect_triangles(rays.origins, rays.directions, span.first(25), chunks);
+    const auto first = chunks.prim;
+    tsimd::intersect_triangles(rays.origins, rays.directions, span.subspan(25), chunks);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(chunks.t[i], all.t[i]) << "i: " << i;
+        if (all.hit(i) && all.prim[i] < 25)
+        {
+            EXPECT_EQ(chunks.prim[i], all.prim[i]) << "i: " << i;
+        }
+        else if (all.hit(i))
+        {
+            EXPECT_EQ(chunks.prim[i] + 25, all.prim[i]) << "i: " << i;
+        }
+        else
+        {
+            EXPECT_EQ(first[i], tsimd::ray_miss);
+        }
+    }
+}
+
+TEST(ray, triangle_barycentrics)
+{
+    // 沿 -z 射向 z = 0 平面上的三角形，重心坐标就是交点在两条边上的比例
+    const std::vector<Triangle> tris = { Triangle{ Vec3{ 0, 0, 0 }, Vec3{ 4, 0, 0 }, Vec3{ 0, 2, 0 } } };
+    tsimd::Vec3Stream<float32> origins;
+    tsimd::Vec3Stream<float32> directions;
+    origins.push_back({ 1.0f, 0.5f, 3.0f });
+    directions.push_back({ 0.0f, 0.0f, -1.0f });
+    origins.push_back({ 3.0f, 1.5f, 3.0f }); // 在三角形外
+    directions.push_back({ 0.0f, 0.0f, -1.0f });
+    origins.push_back({ 1.0f, 0.5f, 3.0f }); // 与三角形平行
+    directions.push_back({ 1.0f, 0.0f, 0.0f });
+
+    tsimd::RayHits hits(3);
+    tsimd::intersect_triangles(origins, directions, std::span<const Triangle>(tris), hits);
+    ASSERT_TRUE(hits.hit(0));
+    EXPECT_FLOAT_EQ(hits.t[0], 3.0f);
+    EXPECT_FLOAT_EQ(hits.u[0], 0.25f);
+    EXPECT_FLOAT_EQ(hits.v[0], 0.25f);
+    EXPECT_FALSE(hits.hit(1));
+    EXPECT_FALSE(hits.hit(2));
+    EXPECT_EQ(hits.t[1], inf);
+}
+
+TEST(ray, aabbs)
+{
+    const auto boxes = make_boxes(29, 7);
+    for (const size_t n : { size_t(0), size_t(1), size_t(7), size_t(16), size_t(1027) })
+    {
+        const auto rays = make_rays(n, 8);
+
+        tsimd::RayHits hits(n);
+        tsimd::intersect_aabbs(rays.origins, rays.directions, std::span<const Box>(boxes), hits);
+        tsimd::RayHits ref(n);
+        intersect_aabbs_ref(rays, boxes, 0.0f, ref);
+        expect_hits_eq(hits, ref, n);
+
+        if (n == 1027)
+        {
+            EXPECT_GT(hit_count(hits), 0u);
+            EXPECT_LT(hit_count(hits), n);
+        }
+    }
+
+    // 起点在 AABB 内时 t 为 t_min
+    const std::vector<Box> unit = { Box{ { -1, -1, -1 }, { 1, 1, 1 } } };
+    tsimd::Vec3Stream<float32> origins;
+    tsimd::Vec3Stream<float32> directions;
+    origins.push_back({ 0.5f, 0.0f, 0.0f });
+    directions.push_back({ 1.0f, 2.0f, 3.0f });
+    origins.push_back({ -5.0f, 0.5f, 0.5f });
+    directions.push_back({ 2.0f, 0.0f, 0.0f });
+    tsimd::RayHits hits(2);
+    tsimd::intersect_aabbs(origins, directions, std::span<const Box>(unit), hits, 0.125f);
+    EXPECT_EQ(hits.t[0], 0.125f);
+    EXPECT_EQ(hits.t[1], 2.0f);
+    EXPECT_EQ(hits.prim[1], 0u);
+    EXPECT_EQ(hits.u[1], 0.0f); // 不修改 u / v
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    printf("Instruction: %s\n", tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+#include "../test.hpp"
+
+#include <tSimd/reduce.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// tsimd::reduce 的数组归约，使用运行时选择的指令集
+
+namespace
+{
+    using tsimd::reduce::Mode;
+
+    std::vector<float> make_random(const size_t n, const float lo, const float hi, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(lo, hi);
+        std::vector<float> data(n);
+        for (auto& x : data)
+        {
+            x = dist(rng);
+        }
+        return data;
+    }
+
+    double sum_double(const std::vector<float>& a, const std::vector<float>& b, const size_t n)
+    {
+        double s = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            s += double(a[i]) * double(b[i]);
+        }
+        return s;
+    }
+}
+
+TEST(reduce_array, sum_dot_norm2)
+{
+    const auto a = make_random(4099, -1.0f, 1.0f, 1);
+    const auto b = make_random(4099, -1.0f, 1.0f, 2);
+    const std::vector<float> ones(a.size(), 1.0f);
+
+    // 包括 0、不足一个batch、不是 Unroll * Lanes 的整数倍的长度
+    for (const size_t n : { size_t(0), size_t(1), size_t(7), size_t(31), size_t(129), size_t(1000), size_t(2049), a.size() })
+    {
+        for (const Mode mode : { Mode::Fast, Mode::Kahan, Mode::Pairwise })
+        {
+            const double s = sum_double(a, ones, n);
+            const double d = sum_double(a, b, n);
+            const double nn = std::sqrt(sum_double(a, a, n));
+            const double tol = 1e-6 * static_cast<double>(n + 1);
+            EXPECT_NEAR(tsimd::reduce::sum(a.data(), n, mode), s, tol) << "n: " << n << ", mode: " << int(mode);
+            EXPECT_NEAR(tsimd::reduce::dot(a.data(), b.data(), n, mode), d, tol) << "n: " << n << ", mode: " << int(mode);
+            EXPECT_NEAR(tsimd::reduce::norm2(a.data(), n, mode), nn, 1e-5 * (nn + 1.0)) << "n: " << n << ", mode: " << int(mode);
+        }
+    }
+}
+
+TEST(reduce_array, accuracy)
+{
+    // 1 + n 个很小的数: Fast 的误差随 n 增长，Kahan 几乎没有误差
+    constexpr size_t N = 1 << 20;
+    std::vector<float> x(N, 1e-4f);
+    x[0] = 1.0f;
+    double expected = 1.0;
+    for (size_t i = 1; i < N; ++i) expected += double(x[i]);
+
+    const double err_fast = std::fabs(double(tsimd::reduce::sum(x.data(), N, Mode::Fast)) - expected);
+    const double err_pairwise = std::fabs(double(tsimd::reduce::sum(x.data(), N, Mode::Pairwise)) - expected);
+    const double err_kahan = std::fabs(double(tsimd::reduce::sum(x.data(), N, Mode::Kahan)) - expected);
+
+    EXPECT_LE(err_kahan, expected * 1e-7);
+    EXPECT_LE(err_pairwise, expected * 1e-6);
+    EXPECT_LE(err_kahan, err_fast);
+}
+
+TEST(reduce_array, min_max)
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+
+    EXPECT_EQ(tsimd::reduce::min(nullptr, 0), inf);
+    EXPECT_EQ(tsimd::reduce::max(nullptr, 0), -inf);
+
+    auto x = make_random(1027, -100.0f, 100.0f, 3);
+    for (const size_t n : { size_t(1), size_t(3), size_t(16), size_t(17), size_t(100), x.size() })
+    {
+        float lo = inf, hi = -inf;
+        for (size_t i = 0; i < n; ++i)
+        {
+            lo = std::min(lo, x[i]);
+            hi = std::max(hi, x[i]);
+        }
+        EXPECT_EQ(tsimd::reduce::min(x.data(), n), lo) << "n: " << n;
+        EXPECT_EQ(tsimd::reduce::max(x.data(), n), hi) << "n: " << n;
+        const auto mm = tsimd::reduce::minmax(x.data(), n);
+        EXPECT_EQ(mm.min, lo) << "n: " << n;
+        EXPECT_EQ(mm.max, hi) << "n: " << n;
+    }
+
+    // 最小值 / 最大值在末尾，NaN 被忽略
+    x[1026] = -1000.0f;
+    x[1025] = 1000.0f;
+    x[5] = std::numeric_limits<float>::quiet_NaN();
+    const auto mm = tsimd::reduce::minmax(x.data(), x.size());
+    EXPECT_EQ(mm.min, -1000.0f);
+    EXPECT_EQ(mm.max, 1000.0f);
+    EXPECT_EQ(tsimd::reduce::min(x.data(), x.size()), -1000.0f);
+    EXPECT_EQ(tsimd::reduce::max(x.data(), x.size()), 1000.0f);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
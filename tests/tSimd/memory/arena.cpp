@@ -0,0 +1,186 @@
+#include "../test.hpp"
+
+#include <tSimd/arena.hpp>
+#include <tSimd/parallel.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// 线性分配器: 对齐、marker / scope 回退、多个块、reset 合并、标准库分配器、每个线程的 arena
+
+namespace
+{
+    bool is_aligned(const void* p, const size_t alignment)
+    {
+        return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+    }
+}
+
+TEST(arena, alignment)
+{
+    tsimd::SimdArena arena(4096);
+    const size_t align = tsimd::InstructionSelector::required_alignment();
+
+    for (const size_t bytes : { 1, 3, 4, 17, 64, 100, 0, 5 })
+    {
+        void* p = arena.allocate(bytes);
+        ASSERT_NE(p, nullptr);
+        EXPECT_TRUE(is_aligned(p, align)) << bytes;
+    }
+
+    // 更小的对齐可以紧密排列
+    auto* a = static_cast<char*>(arena.allocate(1, 1));
+    auto* b = static_cast<char*>(arena.allocate(1, 1));
+    EXPECT_EQ(a + 1, b);
+
+    const auto s = arena.allocate_span<float>(33);
+    EXPECT_EQ(s.size(), 33);
+    EXPECT_TRUE(is_aligned(s.data(), align));
+}
+
+TEST(arena, marker_and_scope)
+{
+    tsimd::SimdArena arena(4096);
+    (void)arena.allocate(10);
+    const size_t used = arena.used();
+
+    const auto m = arena.marker();
+    void* p = arena.allocate(100);
+    EXPECT_GT(arena.used(), used);
+    arena.rewind(m);
+    EXPECT_EQ(arena.used(), used);
+    EXPECT_EQ(arena.allocate(100), p); // 回退之后重复使用同一段内存
+
+    arena.rewind(m);
+    {
+        tsimd::ArenaScope outer(arena);
+        (void)arena.allocate(64);
+        const size_t outer_used = arena.used();
+        {
+            tsimd::ArenaScope inner(arena);
+            (void)arena.allocate(256);
+            EXPECT_GT(arena.used(), outer_used);
+        }
+        EXPECT_EQ(arena.used(), outer_used);
+    }
+    EXPECT_EQ(arena.used(), used);
+}
+
+TEST(arena, overflow_and_reset)
+{
+    tsimd::SimdArena arena(1024);
+    EXPECT_EQ(arena.block_count(), 1);
+    EXPECT_EQ(arena.capacity(), 1024);
+
+    std::vector<float*> ptrs;
+    for (int i = 0; i < 10; ++i)
+    {
+        auto s = arena.allocate_span<float>(100); // 400 字节，两个填满一块
+        std::iota(s.begin(), s.end(), static_cast<float>(i * 100));
+        ptrs.push_back(s.data());
+    }
+    // 超过块大小的分配
+    auto big = arena.allocate_span<float>(1000);
+    EXPECT_TRUE(is_aligned(big.data(), tsimd::InstructionSelector::required_alignment()));
+    EXPECT_GT(arena.block_count(), 1);
+
+    // 之前的内存没有被覆盖
+    for (int i = 0; i < 10; ++i)
+    {
+        for (int j = 0; j < 100; ++j)
+        {
+            ASSERT_EQ(ptrs[i][j], static_cast<float>(i * 100 + j));
+        }
+    }
+
+    // reset 合并成一个块，下一帧不再需要新的块
+    const size_t capacity = arena.capacity();
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0);
+    EXPECT_EQ(arena.block_count(), 1);
+    EXPECT_EQ(arena.capacity(), capacity);
+    for (int i = 0; i < 10; ++i)
+    {
+        (void)arena.allocate_span<float>(100);
+    }
+    (void)arena.allocate_span<float>(1000);
+    EXPECT_EQ(arena.block_count(), 1);
+}
+
+TEST(arena, rewind_reuses_blocks)
+{
+    tsimd::SimdArena arena(256);
+    const auto m = arena.marker();
+    (void)arena.allocate(200);
+    void* second = arena.allocate(200);
+    EXPECT_EQ(arena.block_count(), 2);
+
+    arena.rewind(m);
+    (void)arena.allocate(200);
+    EXPECT_EQ(arena.allocate(200), second);
+    EXPECT_EQ(arena.block_count(), 2);
+}
+
+TEST(arena, allocator)
+{
+    tsimd::SimdArena arena(1 << 16);
+    {
+        tsimd::ArenaScope scope(arena);
+        std::vector<float, tsimd::ArenaAllocator<float>> v{ tsimd::ArenaAllocator<float>(arena) };
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(static_cast<float>(i));
+        }
+        EXPECT_TRUE(is_aligned(v.data(), tsimd::InstructionSelector::required_alignment()));
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_EQ(v[i], static_cast<float>(i));
+        }
+
+        // 最后一次分配的内存可以被回收
+        const size_t used = arena.used();
+        std::vector<float, tsimd::ArenaAllocator<float>> w{ tsimd::ArenaAllocator<float>(arena) };
+        w.reserve(100);
+        w.clear();
+        w.shrink_to_fit();
+        EXPECT_EQ(arena.used(), used);
+
+        tsimd::ArenaAllocator<double> d(v.get_allocator());
+        EXPECT_TRUE(d == v.get_allocator());
+    }
+    EXPECT_EQ(arena.used(), 0);
+}
+
+TEST(arena, thread_local_arena)
+{
+    tsimd::ThreadPool pool(4);
+    std::atomic<int> errors = 0;
+    pool.parallel_for(0, 1 << 16, 256, [&](const size_t begin, const size_t end) noexcept
+    {
+        auto& arena = tsimd::thread_local_arena();
+        tsimd::ArenaScope scope(arena);
+        auto tmp = arena.allocate_span<float>(end - begin);
+        for (size_t i = begin; i < end; ++i)
+        {
+            tmp[i - begin] = static_cast<float>(i);
+        }
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (tmp[i - begin] != static_cast<float>(i))
+            {
+                ++errors;
+            }
+        }
+    });
+    EXPECT_EQ(errors, 0);
+    EXPECT_EQ(tsimd::thread_local_arena().used(), 0);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
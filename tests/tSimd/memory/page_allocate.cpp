@@ -0,0 +1,100 @@
+#include "../test.hpp"
+
+#include <tSimd/page_allocate.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// 按页分配的策略: 每种大页模式 / first touch / NUMA 绑定都要返回对齐、可写、内容为 0 的内存
+
+namespace
+{
+    using HugePage = tsimd::PageAllocPolicy::HugePage;
+
+    bool is_aligned(const void* p, const size_t alignment)
+    {
+        return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+    }
+
+    void check(const tsimd::PageAllocPolicy& policy, const size_t bytes)
+    {
+        auto* p = static_cast<unsigned char*>(policy.allocate(bytes));
+        ASSERT_NE(p, nullptr);
+        EXPECT_TRUE(is_aligned(p, 4096));
+        EXPECT_TRUE(is_aligned(p, tsimd::InstructionSelector::required_alignment()));
+        if (policy.huge_page != HugePage::None)
+        {
+            EXPECT_TRUE(is_aligned(p, tsimd::HugePageSize));
+        }
+
+        for (size_t i = 0; i < bytes; i += 1000)
+        {
+            ASSERT_EQ(p[i], 0) << i;
+            p[i] = 1;
+        }
+        p[bytes - 1] = 1;
+        policy.deallocate(p, bytes);
+    }
+}
+
+TEST(page_allocate, modes)
+{
+    for (const auto huge_page : { HugePage::None, HugePage::Transparent, HugePage::Explicit })
+    {
+        for (const bool first_touch : { false, true })
+        {
+            for (const size_t bytes : { size_t(1), size_t(5000), tsimd::HugePageSize, tsimd::HugePageSize * 3 + 123 })
+            {
+                check({ .huge_page = huge_page, .first_touch = first_touch }, bytes);
+            }
+        }
+    }
+}
+
+TEST(page_allocate, numa_node)
+{
+    // 节点 0 总是存在，不存在的节点被忽略
+    check({ .huge_page = HugePage::Transparent, .numa_node = 0 }, tsimd::HugePageSize * 2);
+    check({ .huge_page = HugePage::None, .numa_node = 63, .first_touch = true }, 100000);
+}
+
+TEST(page_allocate, first_touch)
+{
+    std::vector<unsigned char> v(tsimd::HugePageSize * 2 + 77, 0xff);
+    tsimd::ThreadPool pool(3);
+    tsimd::first_touch(v.data(), v.size(), pool);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        ASSERT_EQ(v[i], 0) << i;
+    }
+}
+
+TEST(page_allocate, std_vector)
+{
+    const tsimd::PageAllocator<float> alloc({ .huge_page = HugePage::Transparent, .first_touch = true });
+    std::vector<float, tsimd::PageAllocator<float>> v(alloc);
+    for (int i = 0; i < 100000; ++i)
+    {
+        v.push_back(static_cast<float>(i));
+    }
+    EXPECT_TRUE(is_aligned(v.data(), tsimd::HugePageSize));
+    for (int i = 0; i < 100000; ++i)
+    {
+        ASSERT_EQ(v[i], static_cast<float>(i));
+    }
+
+    auto w = std::move(v);
+    EXPECT_EQ(w.get_allocator(), alloc);
+    EXPECT_NE(w.get_allocator(), tsimd::PageAllocator<float>());
+
+    // 默认策略的 AlignedAllocator 仍然是无状态的
+    static_assert(std::is_empty_v<tsimd::AlignedAllocator<float>>);
+    EXPECT_EQ(tsimd::AlignedAllocator<float>(), tsimd::AlignedAllocator<double>());
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+#include "../test.hpp"
+
+#include <tSimd/parallel.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// 工作窃取线程池的 parallel_for
+// 每个元素恰好被处理一次，分块边界对齐，嵌套调用串行执行
+
+namespace
+{
+    // 记录每个分块，检查覆盖和对齐
+    struct ChunkRecorder
+    {
+        void operator()(const size_t begin, const size_t end) noexcept
+        {
+            std::lock_guard lock(mutex);
+            chunks.emplace_back(begin, end);
+            for (size_t i = begin; i < end; ++i)
+            {
+                ++hits[i];
+            }
+        }
+
+        explicit ChunkRecorder(const size_t n) : hits(n, 0) {}
+
+        std::mutex mutex;
+        std::vector<std::pair<size_t, size_t>> chunks;
+        std::vector<int> hits;
+    };
+
+    void check(tsimd::ThreadPool& pool, const size_t begin, const size_t end, const size_t grain)
+    {
+        const size_t boundary = tsimd::parallel_chunk_alignment<float>();
+        ChunkRecorder rec(end);
+        pool.parallel_for(begin, end, grain, rec);
+
+        for (size_t i = 0; i < end; ++i)
+        {
+            ASSERT_EQ(rec.hits[i], i < begin ? 0 : 1) << i << " [" << begin << ", " << end << ") grain=" << grain;
+        }
+        for (const auto& [b, e] : rec.chunks)
+        {
+            EXPECT_LT(b, e);
+            if (b != begin)
+            {
+                EXPECT_EQ(b % boundary, 0) << b;
+            }
+            if (e != end)
+            {
+                EXPECT_EQ(e % boundary, 0) << e;
+            }
+        }
+    }
+}
+
+TEST(parallel_for, chunk_alignment)
+{
+    const size_t boundary = tsimd::parallel_chunk_alignment<float>();
+    EXPECT_EQ(boundary * sizeof(float) % tsimd::CacheLineSize, 0);
+    EXPECT_EQ(boundary * sizeof(float) % tsimd::InstructionSelector::required_alignment(), 0);
+    EXPECT_EQ(tsimd::parallel_chunk_alignment<double>() * 2, boundary);
+}
+
+TEST(parallel_for, coverage)
+{
+    for (const size_t threads : { 1, 2, 3, 8 })
+    {
+        tsimd::ThreadPool pool(threads);
+        EXPECT_EQ(pool.thread_count(), threads);
+
+        check(pool, 0, 0, 1);
+        check(pool, 0, 1, 1);
+        check(pool, 0, 1027, 1);
+        check(pool, 5, 1027, 100);
+        check(pool, 13, 100000, 1000);
+        check(pool, 0, 4096, 100000); // 只有一个分块
+        check(pool, 31, 32, 1);
+    }
+}
+
+TEST(parallel_for, repeated)
+{
+    tsimd::ThreadPool pool(4);
+    std::vector<float> data(10007, 0.0f);
+    for (int round = 0; round < 200; ++round)
+    {
+        pool.parallel_for(0, data.size(), 64, [&](const size_t begin, const size_t end) noexcept
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                data[i] += 1.0f;
+            }
+        });
+    }
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        ASSERT_EQ(data[i], 200.0f) << i;
+    }
+}
+
+TEST(parallel_for, nested)
+{
+    tsimd::ThreadPool pool(4);
+    std::atomic<size_t> sum = 0;
+    pool.parallel_for(0, 64, 16, [&](const size_t begin, const size_t end) noexcept
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            // 嵌套调用在当前线程串行执行，只有一个分块
+            size_t calls = 0;
+            tsimd::parallel_for(0, 1000, 1, [&](const size_t b, const size_t e) noexcept
+            {
+                ++calls;
+                sum += e - b;
+            });
+            EXPECT_EQ(calls, 1);
+        }
+    });
+    EXPECT_EQ(sum, 64 * 1000);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,291 @@
+#include "../test.hpp"
+
+#include <tSimd/mat_stream.hpp>
+#include <tSimd/matrix.hpp>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+// SoA 矩阵的批量函数，使用运行时选择的指令集 (CMake 用 TSIMD_MAX_ISA 对每个指令集各运行一次，见 tests/tSimd/CMakeLists.txt)
+// mul / transform / 4x4 的 inverse / determinant 与 AoS 版本 (matrix.hpp) 的结果要求完全一致
+// 3x3 放在第4行第4列为0的 4x4 矩阵中与 AoS 版本比较 (多出的项都是 +0)，3x3 的 inverse 与 double 精度的参考值比较
+
+namespace
+{
+    constexpr size_t N = 1027; // 不是任何Lanes的整数倍
+
+    template<size_t D>
+    using Mat = std::array<float, D * D>;
+
+    using Vec3 = std::array<float, 3>;
+
+    float value(const size_t i, const size_t j, const float offset)
+    {
+        return std::sin(static_cast<float>(i * 16 + j) * 0.37f + offset);
+    }
+
+    // 对角线占优，保证可逆
+    template<size_t D>
+    tsimd::MatStream<float, D> make_mats(const float offset)
+    {
+        tsimd::MatStream<float, D> s(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            Mat<D> m;
+            for (size_t j = 0; j < D * D; ++j)
+            {
+                m[j] = value(i, j, offset) + (j % (D + 1) == 0 ? 2.0f : 0.0f);
+            }
+            s.set(i, m);
+        }
+        return s;
+    }
+
+    tsimd::Vec3Stream<float> make_vecs(const float offset)
+    {
+        tsimd::Vec3Stream<float> s(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            s.set(i, { value(i, 0, offset), value(i, 1, offset), value(i, 2, offset) });
+        }
+        return s;
+    }
+
+    template<size_t D>
+    Mat<4> embed4(const Mat<D>& m)
+    {
+        Mat<4> r{};
+        for (size_t row = 0; row < D; ++row)
+        {
+            for (size_t col = 0; col < D; ++col)
+            {
+                r[row * 4 + col] = m[row * D + col];
+            }
+        }
+        return r;
+    }
+
+    // AoS 版本的 a * b，结果取左上角 D x D
+    template<size_t D>
+    Mat<D> mul_ref(const Mat<D>& a, const Mat<D>& b)
+    {
+        const auto a4 = embed4<D>(a);
+        const auto b4 = embed4<D>(b);
+        Mat<4> c4;
+        tsimd::mat4_mul_row_major(a4.data(), b4.data(), c4.data());
+
+        Mat<D> c;
+        for (size_t row = 0; row < D; ++row)
+        {
+            for (size_t col = 0; col < D; ++col)
+            {
+                c[row * D + col] = c4[row * 4 + col];
+            }
+        }
+        return c;
+    }
+
+    // AoS 版本的 m * (v, w)，点的 w 为1，方向向量的 w 为0
+    template<size_t D>
+    Vec3 transform_ref(const Mat<D>& m, const Vec3& v, const float w)
+    {
+        const auto m4 = embed4<D>(m);
+        const float v4[4] = { v[0], v[1], v[2], w };
+        float r[4];
+        tsimd::mat4_mul_vec4_row_major(m4.data(), v4, r);
+        return { r[0], r[1], r[2] };
+    }
+
+    double determinant3_ref(const Mat<3>& m)
+    {
+        const auto a = [&](const size_t r, const size_t c) { return double(m[r * 3 + c]); };
+        return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1))
+             - a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0))
+             + a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+    }
+}
+
+TEST(mat_stream, container)
+{
+    tsimd::Mat4Stream<float> s;
+    EXPECT_TRUE(s.empty());
+
+    const auto m = make_mats<4>(0.5f);
+    for (size_t i = 0; i < 5; ++i)
+    {
+        s.push_back(m.get(i));
+    }
+    ASSERT_EQ(s.size(), 5u);
+    EXPECT_EQ(s.element(1, 2)[3], m.get(3)[6]);
+
+    // 行主序 / 列主序的导入导出，列主序导出的是转置
+    for (const bool column_major : { false, true })
+    {
+        std::vector<float> aos(N * 16);
+        column_major ? m.export_column_major(aos.data()) : m.export_row_major(aos.data());
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto ref = m.get(i);
+            for (size_t r = 0; r < 4; ++r)
+            {
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    ASSERT_EQ(aos[i * 16 + (column_major ? c * 4 + r : r * 4 + c)], ref[r * 4 + c]) << "i: " << i;
+                }
+            }
+        }
+
+        tsimd::Mat4Stream<float> back;
+        column_major ? back.import_column_major(aos.data(), N) : back.import_row_major(aos.data(), N);
+        ASSERT_EQ(back.size(), N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            ASSERT_EQ(back.get(i), m.get(i)) << "i: " << i << ", column_major: " << column_major;
+        }
+    }
+
+    const auto m3 = make_mats<3>(0.25f);
+    std::vector<Mat<3>> aos3(N);
+    m3.export_column_major(std::span<Mat<3>>(aos3));
+    tsimd::Mat3Stream<float> back3;
+    back3.import_column_major(std::span<const Mat<3>>(aos3));
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_EQ(back3.get(i), m3.get(i)) << "i: " << i;
+        EXPECT_EQ(aos3[i][1], m3.get(i)[3]) << "i: " << i;
+    }
+}
+
+template<size_t D>
+static void check_mul_transpose()
+{
+    const auto a = make_mats<D>(0.0f);
+    const auto b = make_mats<D>(1.0f);
+
+    const auto c = a * b;
+    ASSERT_EQ(c.size(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_EQ(c.get(i), mul_ref<D>(a.get(i), b.get(i))) << "D: " << D << ", i: " << i;
+    }
+
+    // 原地计算
+    auto x = a;
+    tsimd::mul(x, b, x);
+    auto y = b;
+    tsimd::mul(a, y, y);
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_EQ(x.get(i), c.get(i)) << "D: " << D << ", i: " << i;
+        ASSERT_EQ(y.get(i), c.get(i)) << "D: " << D << ", i: " << i;
+    }
+
+    auto t = a;
+    tsimd::transpose(t, t);
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto m = a.get(i);
+        const auto mt = t.get(i);
+        for (size_t r = 0; r < D; ++r)
+        {
+            for (size_t col = 0; col < D; ++col)
+            {
+                ASSERT_EQ(mt[r * D + col], m[col * D + r]) << "D: " << D << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST(mat_stream, mul_transpose)
+{
+    check_mul_transpose<3>();
+    check_mul_transpose<4>();
+}
+
+TEST(mat_stream, inverse4)
+{
+    const auto m = make_mats<4>(0.75f);
+
+    std::vector<float> aos(N * 16);
+    m.export_row_major(aos.data());
+    std::vector<float> inv_ref(N * 16);
+    std::vector<float> det_ref(N);
+    tsimd::mat4_inverse(aos.data(), inv_ref.data(), N);
+    tsimd::mat4_determinant(aos.data(), det_ref.data(), N);
+
+    std::vector<float> det(N);
+    tsimd::determinant(m, det.data());
+    EXPECT_EQ(det, det_ref);
+
+    auto inv = m;
+    tsimd::inverse(inv, inv);
+    std::vector<float> inv_aos(N * 16);
+    inv.export_row_major(inv_aos.data());
+    EXPECT_EQ(inv_aos, inv_ref);
+}
+
+TEST(mat_stream, inverse3)
+{
+    const auto m = make_mats<3>(0.75f);
+
+    std::vector<float> det(N);
+    tsimd::determinant(m, det.data());
+
+    tsimd::Mat3Stream<float> inv;
+    tsimd::inverse(m, inv);
+    ASSERT_EQ(inv.size(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto a = m.get(i);
+        const auto b = inv.get(i);
+        EXPECT_NEAR(det[i], determinant3_ref(a), 1e-5 * std::abs(determinant3_ref(a))) << "i: " << i;
+
+        // a * a^-1 = I
+        for (size_t r = 0; r < 3; ++r)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                double s = 0.0;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    s += double(a[r * 3 + k]) * double(b[k * 3 + c]);
+                }
+                ASSERT_NEAR(s, r == c ? 1.0 : 0.0, 1e-5) << "i: " << i << ", r: " << r << ", c: " << c;
+            }
+        }
+    }
+}
+
+TEST(mat_stream, transform)
+{
+    const auto m4 = make_mats<4>(0.3f);
+    const auto m3 = make_mats<3>(0.6f);
+    const auto v = make_vecs(0.9f);
+
+    tsimd::Vec3Stream<float> points;
+    tsimd::transform_points(m4, v, points);
+    tsimd::Vec3Stream<float> vectors4;
+    tsimd::transform_vectors(m4, v, vectors4);
+    auto vectors3 = v;
+    tsimd::transform_vectors(m3, vectors3, vectors3);
+
+    ASSERT_EQ(points.size(), N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        ASSERT_EQ(points.get(i), transform_ref<4>(m4.get(i), v.get(i), 1.0f)) << "i: " << i;
+        ASSERT_EQ(vectors4.get(i), transform_ref<4>(m4.get(i), v.get(i), 0.0f)) << "i: " << i;
+        ASSERT_EQ(vectors3.get(i), transform_ref<3>(m3.get(i), v.get(i), 0.0f)) << "i: " << i;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    printf("Instruction: %s\n", tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
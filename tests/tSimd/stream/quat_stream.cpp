@@ -0,0 +1,217 @@
+#include "../test.hpp"
+
+#include <tSimd/quat.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+
+// SoA 四元数的批量函数，使用运行时选择的指令集 (CMake 中每个指令集各运行一次)
+// mul / rotate / nlerp 的计算顺序与标量版本 (tMath quat.hpp) 相同，结果要求完全一致
+// slerp 的 Exact 使用向量版本的 sin / atan2，Fast 使用修正后的 nlerp，与 double 精度的参考值比较
+
+namespace
+{
+    constexpr size_t N = 1027; // 不是任何Lanes的整数倍
+
+    using Quat = std::array<float, 4>;
+
+    float dot_ref(const Quat& a, const Quat& b)
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    }
+
+    Quat normalize_ref(const Quat& q)
+    {
+        const float inv = 1.0f / std::sqrt(dot_ref(q, q));
+        return { q[0] * inv, q[1] * inv, q[2] * inv, q[3] * inv };
+    }
+
+    tsimd::QuatStream<float> make_quats(const float offset)
+    {
+        tsimd::QuatStream<float> s(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            Quat q;
+            for (size_t d = 0; d < 4; ++d)
+            {
+                q[d] = std::sin(static_cast<float>(i * 4 + d) * 0.37f + offset);
+            }
+            s.set(i, normalize_ref(q));
+        }
+        return s;
+    }
+
+    Quat mul_ref(const Quat& a, const Quat& b)
+    {
+        return {
+            a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1],
+            a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0],
+            a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3],
+            a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2]
+        };
+    }
+
+    Quat nlerp_ref(const Quat& a, const Quat& b, const float t)
+    {
+        const float k0 = 1.0f - t;
+        const float k1 = t * (dot_ref(a, b) < 0 ? -1.0f : 1.0f);
+        return normalize_ref({ a[0] * k0 + b[0] * k1, a[1] * k0 + b[1] * k1, a[2] * k0 + b[2] * k1, a[3] * k0 + b[3] * k1 });
+    }
+
+    // double 精度的 slerp
+    std::array<double, 4> slerp_ref(const Quat& a, const Quat& b, const double t)
+    {
+        double d = 0.0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            d += double(a[i]) * double(b[i]);
+        }
+        const double sign = d < 0 ? -1.0 : 1.0;
+        const double theta = std::acos(std::min(std::abs(d), 1.0));
+        const double s = std::sin(theta);
+        const double k0 = s < 1e-9 ? 1.0 - t : std::sin((1.0 - t) * theta) / s;
+        const double k1 = (s < 1e-9 ? t : std::sin(t * theta) / s) * sign;
+
+        std::array<double, 4> r;
+        double len2 = 0.0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            r[i] = double(a[i]) * k0 + double(b[i]) * k1;
+            len2 += r[i] * r[i];
+        }
+        for (auto& c : r)
+        {
+            c /= std::sqrt(len2);
+        }
+        return r;
+    }
+
+    // 逐分量的最大误差，q 与 -q 表示同一个旋转
+    double max_error(const std::array<double, 4>& a, const Quat& b)
+    {
+        double pos = 0.0, neg = 0.0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            pos = std::max(pos, std::abs(a[i] - double(b[i])));
+            neg = std::max(neg, std::abs(a[i] + double(b[i])));
+        }
+        return std::min(pos, neg);
+    }
+}
+
+TEST(quat_stream, mul)
+{
+    const auto a = make_quats(0.0f);
+    const auto b = make_quats(1.0f);
+    tsimd::QuatStream<float> out;
+    tsimd::quat_mul(a, b, out);
+    ASSERT_EQ(out.size(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(out.get(i), mul_ref(a.get(i), b.get(i))) << i;
+    }
+
+    // 原地计算
+    auto c = a;
+    tsimd::quat_mul(c, b, c);
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(c.get(i), out.get(i)) << i;
+    }
+}
+
+TEST(quat_stream, rotate)
+{
+    const auto q = make_quats(0.5f);
+    tsimd::Vec3Stream<float> v(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        v.set(i, { static_cast<float>(i % 7) - 3.0f, std::cos(static_cast<float>(i)), 2.0f });
+    }
+
+    tsimd::Vec3Stream<float> out;
+    tsimd::quat_rotate(q, v, out);
+    ASSERT_EQ(out.size(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto r = q.get(i);
+        const auto p = v.get(i);
+        const float tx = (r[1] * p[2] - r[2] * p[1]) * 2.0f;
+        const float ty = (r[2] * p[0] - r[0] * p[2]) * 2.0f;
+        const float tz = (r[0] * p[1] - r[1] * p[0]) * 2.0f;
+        const std::array<float, 3> expected = {
+            p[0] + r[3] * tx + (r[1] * tz - r[2] * ty),
+            p[1] + r[3] * ty + (r[2] * tx - r[0] * tz),
+            p[2] + r[3] * tz + (r[0] * ty - r[1] * tx)
+        };
+        EXPECT_EQ(out.get(i), expected) << i;
+
+        // q * v * q^-1 保持长度
+        const auto o = out.get(i);
+        EXPECT_NEAR(std::sqrt(o[0] * o[0] + o[1] * o[1] + o[2] * o[2]), std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]), 1e-4f) << i;
+    }
+}
+
+TEST(quat_stream, nlerp)
+{
+    const auto a = make_quats(0.0f);
+    const auto b = make_quats(2.0f);
+    tsimd::QuatStream<float> out;
+
+    for (const float t : { 0.0f, 0.3f, 0.5f, 1.0f })
+    {
+        tsimd::quat_nlerp(a, b, t, out);
+        ASSERT_EQ(out.size(), N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(out.get(i), nlerp_ref(a.get(i), b.get(i), t)) << i << " t=" << t;
+        }
+    }
+}
+
+TEST(quat_stream, slerp)
+{
+    auto a = make_quats(0.0f);
+    auto b = make_quats(2.0f);
+    // 几乎相同 (退化为 nlerp) 和完全相反的四元数
+    b.set(0, a.get(0));
+    const auto a1 = a.get(1);
+    b.set(1, { -a1[0], -a1[1], -a1[2], -a1[3] });
+
+    tsimd::QuatStream<float> exact, fast;
+    double max_exact = 0.0, max_fast = 0.0;
+    for (const float t : { 0.0f, 0.1f, 0.25f, 0.5f, 0.75f, 0.9f, 1.0f })
+    {
+        tsimd::quat_slerp(a, b, t, exact);
+        tsimd::quat_slerp(a, b, t, fast, tsimd::QuatAccuracy::Fast);
+        ASSERT_EQ(exact.size(), N);
+        ASSERT_EQ(fast.size(), N);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto ref = slerp_ref(a.get(i), b.get(i), t);
+            const double err_exact = max_error(ref, exact.get(i));
+            const double err_fast = max_error(ref, fast.get(i));
+            max_exact = std::max(max_exact, err_exact);
+            max_fast = std::max(max_fast, err_fast);
+
+            EXPECT_LT(err_exact, 1e-5) << i << " t=" << t;
+            EXPECT_LT(err_fast, 1e-3) << i << " t=" << t;
+            EXPECT_NEAR(dot_ref(exact.get(i), exact.get(i)), 1.0f, 1e-5f) << i;
+            EXPECT_NEAR(dot_ref(fast.get(i), fast.get(i)), 1.0f, 1e-5f) << i;
+        }
+    }
+    std::printf("slerp max error: exact %g, fast %g\n", max_exact, max_fast);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    printf("Instruction: %s\n", tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,261 @@
+#include "../test.hpp"
+
+#include <tSimd/stream.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+// SoA 流的批量函数，使用运行时选择的指令集 (CMake 中每个指令集各运行一次)
+// 逐分量运算和 dot / magnitude / normalized 的求和顺序与标量版本相同，结果要求完全一致
+
+namespace
+{
+    constexpr size_t N = 1027; // 不是任何Lanes的整数倍
+
+    template<size_t Dim>
+    tsimd::VecStream<float, Dim> make_stream(const float offset)
+    {
+        tsimd::VecStream<float, Dim> s(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            std::array<float, Dim> v;
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                v[d] = std::sin(static_cast<float>(i * Dim + d) * 0.37f + offset) * (10.0f + static_cast<float>(d));
+            }
+            s.set(i, v);
+        }
+        return s;
+    }
+
+    template<size_t Dim, typename Fn>
+    void expect_per_component(const tsimd::VecStream<float, Dim>& a, const tsimd::VecStream<float, Dim>& b,
+                              const tsimd::VecStream<float, Dim>& out, Fn&& fn, const char* name)
+    {
+        ASSERT_EQ(out.size(), a.size());
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                EXPECT_EQ(out.component(d)[i], fn(a.component(d)[i], b.component(d)[i], d)) << name << " i=" << i << " d=" << d;
+            }
+        }
+    }
+
+    template<size_t Dim>
+    float dot_ref(const std::array<float, Dim>& a, const std::array<float, Dim>& b)
+    {
+        float sum = a[0] * b[0];
+        for (size_t d = 1; d < Dim; ++d)
+        {
+            sum = sum + a[d] * b[d];
+        }
+        return sum;
+    }
+
+    template<size_t Dim>
+    void test_arithmetic()
+    {
+        const auto a = make_stream<Dim>(0.0f);
+        const auto b = make_stream<Dim>(1.0f);
+        tsimd::VecStream<float, Dim> out;
+
+        tsimd::add(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return x + y; }, "add");
+        tsimd::sub(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return x - y; }, "sub");
+        tsimd::mul(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return x * y; }, "mul");
+        tsimd::div(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return x / y; }, "div");
+
+        tsimd::mul(a, 2.5f, out);
+        expect_per_component(a, b, out, [](float x, float, size_t) { return x * 2.5f; }, "mul scalar");
+        tsimd::div(a, 3.0f, out);
+        expect_per_component(a, b, out, [](float x, float, size_t) { return x / 3.0f; }, "div scalar");
+
+        tsimd::min(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return std::min(x, y); }, "min");
+        tsimd::max(a, b, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return std::max(x, y); }, "max");
+
+        std::array<float, Dim> lo, hi;
+        for (size_t d = 0; d < Dim; ++d)
+        {
+            lo[d] = -5.0f + static_cast<float>(d);
+            hi[d] = 4.0f + static_cast<float>(d);
+        }
+        tsimd::clamp(a, lo, hi, out);
+        expect_per_component(a, b, out, [&](float x, float, size_t d) { return std::clamp(x, lo[d], hi[d]); }, "clamp");
+
+        tsimd::lerp(a, b, 0.25f, out);
+        expect_per_component(a, b, out, [](float x, float y, size_t) { return x + (y - x) * 0.25f; }, "lerp");
+
+        // 原地计算
+        auto c = a;
+        c += b;
+        expect_per_component(a, b, c, [](float x, float y, size_t) { return x + y; }, "+=");
+        c = a * 2.0f - b;
+        expect_per_component(a, b, c, [](float x, float y, size_t) { return x * 2.0f - y; }, "a * 2 - b");
+    }
+
+    template<size_t Dim>
+    void test_geometry()
+    {
+        const auto a = make_stream<Dim>(0.0f);
+        const auto b = make_stream<Dim>(2.0f);
+
+        std::vector<float> dot(N), mag(N), dist(N);
+        tsimd::dot(a, b, dot.data());
+        tsimd::magnitude(a, mag.data());
+        tsimd::distance(a, b, dist.data());
+
+        tsimd::VecStream<float, Dim> norm;
+        tsimd::normalized(a, norm);
+        ASSERT_EQ(norm.size(), N);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto va = a.get(i);
+            const auto vb = b.get(i);
+            std::array<float, Dim> delta;
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                delta[d] = va[d] - vb[d];
+            }
+
+            EXPECT_EQ(dot[i], dot_ref(va, vb)) << i;
+            const float m = std::sqrt(dot_ref(va, va));
+            EXPECT_EQ(mag[i], m) << i;
+            EXPECT_EQ(dist[i], std::sqrt(dot_ref(delta, delta))) << i;
+
+            const auto vn = norm.get(i);
+            for (size_t d = 0; d < Dim; ++d)
+            {
+                EXPECT_EQ(vn[d], va[d] * (1.0f / m)) << i;
+            }
+        }
+    }
+}
+
+TEST(vec_stream, arithmetic)
+{
+    test_arithmetic<3>();
+    test_arithmetic<4>();
+}
+
+TEST(vec_stream, geometry)
+{
+    test_geometry<3>();
+    test_geometry<4>();
+}
+
+TEST(vec_stream, normalized_special)
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+    tsimd::Vec3Stream<float> v;
+    v.push_back({ 0.0f, 0.0f, 0.0f });
+    v.push_back({ inf, 1.0f, 0.0f });
+    v.push_back({ nan, 1.0f, 0.0f });
+    v.push_back({ 3.0f, 0.0f, 4.0f });
+
+    tsimd::normalized(v, v);
+
+    EXPECT_EQ(v.get(0), (std::array<float, 3>{ 0.0f, 0.0f, 0.0f }));
+    for (const float c : v.get(1))
+    {
+        TMATH_EXPECT_IS_NAN(c);
+    }
+    for (const float c : v.get(2))
+    {
+        TMATH_EXPECT_IS_NAN(c);
+    }
+    EXPECT_FLOAT_EQ(v.get(3)[0], 0.6f);
+    EXPECT_FLOAT_EQ(v.get(3)[1], 0.0f);
+    EXPECT_FLOAT_EQ(v.get(3)[2], 0.8f);
+}
+
+TEST(vec_stream, cross)
+{
+    const auto a = make_stream<3>(0.0f);
+    const auto b = make_stream<3>(0.5f);
+
+    tsimd::Vec3Stream<float> out;
+    tsimd::cross(a, b, out);
+    ASSERT_EQ(out.size(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto va = a.get(i);
+        const auto vb = b.get(i);
+        const std::array<float, 3> expected = {
+            va[1] * vb[2] - va[2] * vb[1],
+            va[2] * vb[0] - va[0] * vb[2],
+            va[0] * vb[1] - va[1] * vb[0],
+        };
+        EXPECT_EQ(out.get(i), expected) << i;
+    }
+}
+
+TEST(vec_stream, aos_soa)
+{
+    struct Vector3f { float x, y, z; };
+    struct Vector4f { float x, y, z, w; };
+
+    std::vector<Vector3f> aos3(N);
+    std::vector<Vector4f> aos4(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        const float f = static_cast<float>(i);
+        aos3[i] = { f, f + 0.25f, f + 0.5f };
+        aos4[i] = { -f, f * 2.0f, f * 3.0f, 1.0f };
+    }
+
+    tsimd::Vec3Stream<float> s3;
+    s3.import_aos(std::span<const Vector3f>(aos3));
+    tsimd::Vec4Stream<float> s4;
+    s4.import_aos(std::span<const Vector4f>(aos4));
+    ASSERT_EQ(s3.size(), N);
+    ASSERT_EQ(s4.size(), N);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(s3.x()[i], aos3[i].x);
+        EXPECT_EQ(s3.y()[i], aos3[i].y);
+        EXPECT_EQ(s3.z()[i], aos3[i].z);
+        EXPECT_EQ(s4.x()[i], aos4[i].x);
+        EXPECT_EQ(s4.y()[i], aos4[i].y);
+        EXPECT_EQ(s4.z()[i], aos4[i].z);
+        EXPECT_EQ(s4.w()[i], aos4[i].w);
+    }
+
+    std::vector<Vector3f> back3(N);
+    std::vector<Vector4f> back4(N);
+    s3.export_aos(std::span<Vector3f>(back3));
+    s4.export_aos(std::span<Vector4f>(back4));
+    for (size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(back3[i].x, aos3[i].x);
+        EXPECT_EQ(back3[i].y, aos3[i].y);
+        EXPECT_EQ(back3[i].z, aos3[i].z);
+        EXPECT_EQ(back4[i].x, aos4[i].x);
+        EXPECT_EQ(back4[i].w, aos4[i].w);
+    }
+
+    // 分量数组是对齐的
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(s4.w()) % tsimd::InstructionSelector::required_alignment(), 0u);
+}
+
+int main(int argc, char **argv)
+{
+    printf("Running main() from %s\n", __FILE__);
+    printf("Instruction: %s\n", tsimd::InstructionSelector::instruction_name(tsimd::InstructionSelector::selected_instruction()));
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}